@@ -8,6 +8,7 @@ public class AGR_Animation_Runtime : ModuleRules {
         PublicDependencyModuleNames.AddRange(
             new string[] {
                 "Core",
+                "AGR_Core_Runtime",
             }
         );
 
@@ -9,8 +9,8 @@
 #include "Animation/Lib/AGR_AnimationFunctionLibrary.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Pawn.h"
-#include "GameFramework/PawnMovementComponent.h"
 #include "Components/CapsuleComponent.h" // Needed to assign UCapsuleComponent to UPrimitiveComponent
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_AnimInstance)
 
@@ -55,8 +55,7 @@ UAGR_AnimInstance::UAGR_AnimInstance()
     OwningComponent = nullptr;
     LocomotionComponent = nullptr;
 
-    OwnerVelocity = FVector::ZeroVector;
-    OwnerRotation = FRotator::ZeroRotator;
+    LocomotionSnapshot = FAGR_LocomotionSnapshot{};
     SkeletalMeshRotation = FRotator::ZeroRotator;
 }
 
@@ -67,6 +66,8 @@ UAGR_LocomotionComponent* UAGR_AnimInstance::GetLocomotionComponent() const
 
 void UAGR_AnimInstance::UpdateStates()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UAGR_AnimInstance::UpdateStates);
+
     if(!IsValid(Owner))
     {
         return;
@@ -77,45 +78,46 @@ void UAGR_AnimInstance::UpdateStates()
         return;
     }
 
-    OwnerVelocity = Owner->GetVelocity();
-    OwnerRotation = Owner->GetActorRotation();
     SkeletalMeshRotation = OwningComponent->GetComponentRotation();
 
-    LocomotionComponent = UAGR_AnimationFunctionLibrary::GetLocomotionComponent(Owner);
+    // Only search the owner's components again if the cached locomotion component went away.
+    if(!IsValid(LocomotionComponent) || LocomotionComponent->GetOwner() != Owner)
+    {
+        LocomotionComponent = UAGR_AnimationFunctionLibrary::GetLocomotionComponent(Owner);
+    }
 
-    const UPawnMovementComponent* const MovementComponent = Owner->GetMovementComponent();
-    if(IsValid(MovementComponent))
+    if(IsValid(LocomotionComponent))
     {
-        bCrouching = MovementComponent->IsCrouching();
-        bSwimming = MovementComponent->IsSwimming();
-        bFalling = MovementComponent->IsFalling();
-        bFlying = MovementComponent->IsFlying();
-        bMovingOnGround = MovementComponent->IsMovingOnGround();
+        LocomotionSnapshot = LocomotionComponent->UpdateSnapshot();
     }
     else
     {
-        bCrouching = false;
-        bSwimming = false;
-        bFalling = false;
-        bFlying = false;
-        bMovingOnGround = false;
+        LocomotionSnapshot.bHasLocomotionComponent = false;
+        LocomotionSnapshot.CapturePawn(Owner);
     }
 
+    bCrouching = LocomotionSnapshot.bCrouching;
+    bSwimming = LocomotionSnapshot.bSwimming;
+    bFalling = LocomotionSnapshot.bFalling;
+    bFlying = LocomotionSnapshot.bFlying;
+    bMovingOnGround = LocomotionSnapshot.bMovingOnGround;
+
     bInAir = bFalling || bFlying;
 }
 
 void UAGR_AnimInstance::UpdateRotation(const float InDeltaSeconds)
 {
-    if(!IsValid(LocomotionComponent))
+    if(!LocomotionSnapshot.bHasLocomotionComponent)
     {
         return;
     }
 
+    const FRotator& OwnerRotation = LocomotionSnapshot.ActorRotation;
     const FQuat RotationDeltaQuat = (LastUpdateRotation - OwnerRotation).GetNormalized().Quaternion();
     RelativeRootRotation = (RelativeRootRotation.Quaternion() * RotationDeltaQuat).Rotator();
     LastUpdateRotation = OwnerRotation;
 
-    switch(LocomotionComponent->GetRotationMethod())
+    switch(LocomotionSnapshot.RotationMethod)
     {
     case EAGR_RotationMethod::NoRotation:
         break;
@@ -162,8 +164,8 @@ void UAGR_AnimInstance::UpdateRotation(const float InDeltaSeconds)
 
 void UAGR_AnimInstance::UpdateSpeedAndVelocity()
 {
-    MovementSpeed = OwnerVelocity.Size();
-    MovementSpeedXY = OwnerVelocity.Size2D();
+    MovementSpeed = LocomotionSnapshot.Velocity.Size();
+    MovementSpeedXY = LocomotionSnapshot.Velocity.Size2D();
     bIdle = MovementSpeed < IdleThreshold;
     bIdleXY = MovementSpeedXY < IdleThreshold;
 
@@ -180,14 +182,13 @@ void UAGR_AnimInstance::UpdateDirection()
         return;
     }
 
-    if(IsValid(Owner))
+    if(LocomotionSnapshot.bHasMovementComponent)
     {
-        const UPawnMovementComponent* const MovementComponent = Owner->GetMovementComponent();
-        const FVector CurrentVelocity = MovementComponent->Velocity;
-        const float MaxSpeed = MovementComponent->GetMaxSpeed();
+        const float MaxSpeed = LocomotionSnapshot.MaxSpeed;
         NormalizedMovementDirection = MaxSpeed == 0.0f
                                       ? FVector::ZeroVector
-                                      : Owner->GetActorRotation().UnrotateVector(CurrentVelocity / MaxSpeed);
+                                      : LocomotionSnapshot.ActorRotation.UnrotateVector(
+                                          LocomotionSnapshot.MovementVelocity / MaxSpeed);
     }
     else
     {
@@ -199,12 +200,12 @@ void UAGR_AnimInstance::UpdateDirection()
 
 void UAGR_AnimInstance::UpdateAimOffset(const float InDeltaSeconds)
 {
-    if(!IsValid(LocomotionComponent))
+    if(!LocomotionSnapshot.bHasLocomotionComponent)
     {
         return;
     }
 
-    switch(LocomotionComponent->GetAimMethod())
+    switch(LocomotionSnapshot.AimMethod)
     {
     case EAGR_AimMethod::NoAimOffset:
         {
@@ -257,11 +258,7 @@ float UAGR_AnimInstance::GetRawAimOffsetPitch_Implementation() const
         return 0.f;
     }
 
-    const FRotator OwnerAimRotation = Owner->IsPawnControlled()
-                                      ? Owner->GetControlRotation()
-                                      : Owner->GetBaseAimRotation();
-
-    return (OwnerAimRotation - SkeletalMeshRotation).GetNormalized().Pitch;
+    return (LocomotionSnapshot.AimRotation - SkeletalMeshRotation).GetNormalized().Pitch;
 }
 
 float UAGR_AnimInstance::GetRawAimOffsetYaw_Implementation() const
@@ -271,8 +268,8 @@ float UAGR_AnimInstance::GetRawAimOffsetYaw_Implementation() const
 
 FVector UAGR_AnimInstance::CalculateMeshVelocity_Implementation() const
 {
-    const FQuat CombinedRotation = OwnerRotation.Quaternion() * RelativeRootRotation.Quaternion();
-    return CombinedRotation.UnrotateVector(OwnerVelocity);
+    const FQuat CombinedRotation = LocomotionSnapshot.ActorRotation.Quaternion() * RelativeRootRotation.Quaternion();
+    return CombinedRotation.UnrotateVector(LocomotionSnapshot.Velocity);
 }
 
 FRotator UAGR_AnimInstance::CalculateAimOffsetRotator_Implementation() const
@@ -282,8 +279,8 @@ FRotator UAGR_AnimInstance::CalculateAimOffsetRotator_Implementation() const
 
 float UAGR_AnimInstance::CalculateDirectionAngle_Implementation() const
 {
-    const FQuat CombinedRotation = RelativeRootRotation.Quaternion() * OwnerRotation.Quaternion();
-    return UKismetAnimationLibrary::CalculateDirection(OwnerVelocity, CombinedRotation.Rotator());
+    const FQuat CombinedRotation = RelativeRootRotation.Quaternion() * LocomotionSnapshot.ActorRotation.Quaternion();
+    return UKismetAnimationLibrary::CalculateDirection(LocomotionSnapshot.Velocity, CombinedRotation.Rotator());
 }
 
 float UAGR_AnimInstance::GetDeltaAimPitch_Implementation() const
@@ -315,7 +312,8 @@ void UAGR_AnimInstance::UpdateRotationToMovement()
     }
     else
     {
-        TargetRotation = OwnerRotation.UnrotateVector(OwnerVelocity).ToOrientationRotator();
+        const FVector LocalVelocity = LocomotionSnapshot.ActorRotation.UnrotateVector(LocomotionSnapshot.Velocity);
+        TargetRotation = LocalVelocity.ToOrientationRotator();
         bRotate = true;
     }
 }
@@ -411,6 +409,8 @@ void UAGR_AnimInstance::NativeBeginPlay()
 
 void UAGR_AnimInstance::NativeThreadSafeUpdateAnimation(const float DeltaSeconds)
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UAGR_AnimInstance::NativeThreadSafeUpdateAnimation);
+
     Super::NativeThreadSafeUpdateAnimation(DeltaSeconds);
 
     UpdateSpeedAndVelocity();
@@ -25,7 +25,12 @@ void FAGR_AnimNode_Rotation::Update_AnyThread(const FAnimationUpdateContext& Con
         const UAGR_AnimInstance* const AnimInstance = Cast<UAGR_AnimInstance>(AnimInstanceObject);
         if(IsValid(AnimInstance))
         {
-            NativeAnimNode.Yaw = AnimInstance->RelativeRootRotation.Yaw;
+            // Hold the last yaw while disabled, resetting it would make the mesh pop.
+            const bool bDisabled = AnimInstance->LocomotionSnapshot.SignificanceTier >= DisableAtSignificanceTier;
+            if(!bDisabled)
+            {
+                NativeAnimNode.Yaw = AnimInstance->RelativeRootRotation.Yaw;
+            }
             NativeAnimNode.MeshToComponent = BoneRotation;
         }
     }
@@ -4,11 +4,58 @@
 
 #include "GameFramework/Character.h"
 #include "GameFramework/CharacterMovementComponent.h"
+#include "GameFramework/PawnMovementComponent.h"
 #include "Module/AGR_Animation_RuntimeLogs.h"
 #include "Net/UnrealNetwork.h"
+#include "Significance/AGR_SignificanceSubsystem.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_LocomotionComponent)
 
+void FAGR_LocomotionSnapshot::CapturePawn(const APawn* const InPawn)
+{
+    check(IsInGameThread());
+
+    if(!IsValid(InPawn))
+    {
+        Velocity = FVector::ZeroVector;
+        ActorRotation = FRotator::ZeroRotator;
+        AimRotation = FRotator::ZeroRotator;
+        bHasMovementComponent = false;
+    }
+    else
+    {
+        Velocity = InPawn->GetVelocity();
+        ActorRotation = InPawn->GetActorRotation();
+        AimRotation = InPawn->IsPawnControlled() ? InPawn->GetControlRotation() : InPawn->GetBaseAimRotation();
+
+        const UPawnMovementComponent* const MovementComponent = InPawn->GetMovementComponent();
+        bHasMovementComponent = IsValid(MovementComponent);
+        if(bHasMovementComponent)
+        {
+            MovementVelocity = MovementComponent->Velocity;
+            MaxSpeed = MovementComponent->GetMaxSpeed();
+            bCrouching = MovementComponent->IsCrouching();
+            bSwimming = MovementComponent->IsSwimming();
+            bFalling = MovementComponent->IsFalling();
+            bFlying = MovementComponent->IsFlying();
+            bMovingOnGround = MovementComponent->IsMovingOnGround();
+        }
+    }
+
+    if(!bHasMovementComponent)
+    {
+        MovementVelocity = FVector::ZeroVector;
+        MaxSpeed = 0.0f;
+        bCrouching = false;
+        bSwimming = false;
+        bFalling = false;
+        bFlying = false;
+        bMovingOnGround = false;
+    }
+
+    Frame = GFrameCounter;
+}
+
 UAGR_LocomotionComponent::UAGR_LocomotionComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
@@ -22,6 +69,10 @@ UAGR_LocomotionComponent::UAGR_LocomotionComponent()
     RotationMethod = EAGR_RotationMethod::AbsoluteRotation;
     AimMethod = EAGR_AimMethod::FreeLook;
     Pose = FGameplayTag{};
+    bThrottleReplicationBySignificance = true;
+    SignificanceNetUpdateFrequencyScale = 2.0f;
+    SignificanceTier = EAGR_SignificanceTier::High;
+    NextStateReplicationTime = 0.0;
 }
 
 void UAGR_LocomotionComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -29,16 +80,26 @@ void UAGR_LocomotionComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProper
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
     DOREPLIFETIME_CONDITION(UAGR_LocomotionComponent, bUpdateAllowedByClient, COND_InitialOnly);
-    DOREPLIFETIME(UAGR_LocomotionComponent, RotationMethod);
-    DOREPLIFETIME(UAGR_LocomotionComponent, AimMethod);
-    DOREPLIFETIME(UAGR_LocomotionComponent, Pose);
-    DOREPLIFETIME(UAGR_LocomotionComponent, AnimationStates);
+
+    // Custom so that PreReplication can hold the state back in low significance tiers.
+    FDoRepLifetimeParams StateParams;
+    StateParams.Condition = COND_Custom;
+    DOREPLIFETIME_WITH_PARAMS_FAST(UAGR_LocomotionComponent, RotationMethod, StateParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(UAGR_LocomotionComponent, AimMethod, StateParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(UAGR_LocomotionComponent, Pose, StateParams);
+    DOREPLIFETIME_WITH_PARAMS_FAST(UAGR_LocomotionComponent, AnimationStates, StateParams);
 }
 
 void UAGR_LocomotionComponent::BeginPlay()
 {
     Super::BeginPlay();
 
+    UAGR_SignificanceSubsystem* const SignificanceSubsystem = UAGR_SignificanceSubsystem::Get(this);
+    if(IsValid(SignificanceSubsystem))
+    {
+        SignificanceSubsystem->RegisterComponent(this);
+    }
+
     APawn* const OwnerPawn = GetOwner<APawn>();
     if(!IsValid(OwnerPawn))
     {
@@ -61,6 +122,66 @@ void UAGR_LocomotionComponent::BeginPlay()
     }
 }
 
+void UAGR_LocomotionComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UAGR_SignificanceSubsystem* const SignificanceSubsystem = UAGR_SignificanceSubsystem::Get(this);
+    if(IsValid(SignificanceSubsystem))
+    {
+        SignificanceSubsystem->UnregisterComponent(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
+void UAGR_LocomotionComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+    Super::PreReplication(ChangedPropertyTracker);
+
+    bool bReplicateState = true;
+    const AActor* const Owner = GetOwner();
+    const UWorld* const World = GetWorld();
+    if(bThrottleReplicationBySignificance
+        && SignificanceTier != EAGR_SignificanceTier::High
+        && IsValid(Owner)
+        && IsValid(World))
+    {
+        // Changes made in between are held back, and sent with the next replicated state.
+        const double Now = World->GetTimeSeconds();
+        bReplicateState = Now >= NextStateReplicationTime;
+        if(bReplicateState)
+        {
+            const float FrequencyScale = FMath::Pow(
+                FMath::Max(1.0f, SignificanceNetUpdateFrequencyScale),
+                static_cast<float>(SignificanceTier));
+            NextStateReplicationTime = Now + FrequencyScale / FMath::Max(Owner->GetNetUpdateFrequency(), UE_KINDA_SMALL_NUMBER);
+        }
+    }
+
+    DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UAGR_LocomotionComponent, RotationMethod, bReplicateState);
+    DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UAGR_LocomotionComponent, AimMethod, bReplicateState);
+    DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UAGR_LocomotionComponent, Pose, bReplicateState);
+    DOREPLIFETIME_ACTIVE_OVERRIDE_FAST(UAGR_LocomotionComponent, AnimationStates, bReplicateState);
+}
+
+void UAGR_LocomotionComponent::SetSignificanceTier(const EAGR_SignificanceTier InSignificanceTier)
+{
+    SignificanceTier = InSignificanceTier;
+    Snapshot.SignificanceTier = InSignificanceTier;
+
+    if(!bThrottleReplicationBySignificance || SignificanceTier != EAGR_SignificanceTier::High)
+    {
+        return;
+    }
+
+    AActor* const Owner = GetOwner();
+    if(IsValid(Owner) && Owner->HasAuthority())
+    {
+        // Catch up immediately on the state held back while throttled.
+        NextStateReplicationTime = 0.0;
+        Owner->ForceNetUpdate();
+    }
+}
+
 bool UAGR_LocomotionComponent::IsUpdateAllowedByClient() const
 {
     return bUpdateAllowedByClient;
@@ -254,6 +375,26 @@ const FGameplayTagContainer& UAGR_LocomotionComponent::GetAnimationStates() cons
     return AnimationStates;
 }
 
+const FAGR_LocomotionSnapshot& UAGR_LocomotionComponent::UpdateSnapshot()
+{
+    if(Snapshot.Frame == GFrameCounter)
+    {
+        return Snapshot;
+    }
+
+    Snapshot.RotationMethod = RotationMethod;
+    Snapshot.AimMethod = AimMethod;
+    Snapshot.bHasLocomotionComponent = true;
+    Snapshot.SignificanceTier = SignificanceTier;
+    Snapshot.CapturePawn(GetOwner<APawn>());
+    return Snapshot;
+}
+
+const FAGR_LocomotionSnapshot& UAGR_LocomotionComponent::GetSnapshot() const
+{
+    return Snapshot;
+}
+
 void UAGR_LocomotionComponent::SetUpdateAllowedByClient(const bool bInUpdateAllowedByClient)
 {
     // Check if running in construction script/constructor (UActorComponent::SetAutoActivate does the same)
@@ -0,0 +1,69 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#include "Animation/Components/AGR_LocomotionComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+    FAGR_LocomotionComponentSpec,
+    "AGR.Animation.LocomotionComponent",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+    static constexpr float OwnerNetUpdateFrequency = 60.0f;
+
+    UWorld* World = nullptr;
+    AActor* Owner = nullptr;
+    UAGR_LocomotionComponent* Locomotion = nullptr;
+
+END_DEFINE_SPEC(FAGR_LocomotionComponentSpec)
+
+void FAGR_LocomotionComponentSpec::Define()
+{
+    BeforeEach(
+        [this]()
+        {
+            World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AGR_LocomotionComponentSpec"));
+            FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+            WorldContext.SetCurrentWorld(World);
+            World->InitializeActorsForPlay(FURL());
+            World->BeginPlay();
+
+            Owner = World->SpawnActor<AActor>();
+            Owner->SetNetUpdateFrequency(OwnerNetUpdateFrequency);
+
+            Locomotion = NewObject<UAGR_LocomotionComponent>(Owner);
+            Locomotion->RegisterComponent();
+        });
+
+    AfterEach(
+        [this]()
+        {
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+            World = nullptr;
+            Owner = nullptr;
+            Locomotion = nullptr;
+        });
+
+    Describe(
+        "Significance",
+        [this]()
+        {
+            It(
+                "should only throttle its own state instead of the owner's net update frequency",
+                [this]()
+                {
+                    Locomotion->SetSignificanceTier(EAGR_SignificanceTier::Lowest);
+                    TestEqual(TEXT("Throttled owner frequency"), Owner->GetNetUpdateFrequency(), OwnerNetUpdateFrequency);
+
+                    Locomotion->SetSignificanceTier(EAGR_SignificanceTier::High);
+                    TestEqual(TEXT("Restored owner frequency"), Owner->GetNetUpdateFrequency(), OwnerNetUpdateFrequency);
+                });
+        });
+}
+
+#endif
@@ -279,16 +279,11 @@ private:
     TObjectPtr<UAGR_LocomotionComponent> LocomotionComponent;
 
     /**
-     * Velocity of the owner.
+     * Locomotion state of the owner captured on the game thread for this frame. This is the only owner state read by the
+     * thread-safe update.
      */
     UPROPERTY(Transient)
-    FVector OwnerVelocity;
-
-    /**
-     * Rotation of the owner.
-     */
-    UPROPERTY(Transient)
-    FRotator OwnerRotation;
+    FAGR_LocomotionSnapshot LocomotionSnapshot;
 
     /**
      * The skeletal mesh rotation in world space.
@@ -4,6 +4,7 @@
 #include "CoreMinimal.h"
 #include "Animation/AnimNodeBase.h"
 #include "AnimNodes/AnimNode_RotateRootBone.h"
+#include "Significance/AGR_SignificanceTypes.h"
 
 #include "AGR_AnimNode_Rotation.generated.h"
 
@@ -29,6 +30,13 @@ public:
     UPROPERTY(EditAnywhere, Category="3Studio AGR", meta=(PinShownByDefault))
     FRotator BoneRotation;
 
+    /**
+     * Starting at this significance tier of the AGR Locomotion component, the root bone rotation is no longer updated
+     * and holds its last value.
+     */
+    UPROPERTY(EditAnywhere, Category="3Studio AGR|Significance")
+    EAGR_SignificanceTier DisableAtSignificanceTier = EAGR_SignificanceTier::Low;
+
 private:
     FAnimNode_RotateRootBone NativeAnimNode;
 
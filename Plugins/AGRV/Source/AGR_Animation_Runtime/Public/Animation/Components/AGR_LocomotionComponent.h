@@ -5,6 +5,7 @@
 #include "GameplayTagContainer.h"
 #include "Components/ActorComponent.h"
 #include "Misc/EnumRange.h"
+#include "Significance/AGR_SignificanceInterface.h"
 
 #include "AGR_LocomotionComponent.generated.h"
 
@@ -56,6 +57,123 @@ ENUM_RANGE_BY_VALUES(
     EAGR_AimMethod::ForwardFacing,
     EAGR_AimMethod::LookAtMovementDirection);
 
+class APawn;
+
+/**
+ * Compact copy of the locomotion state of a pawn for a single frame.
+ *
+ * Captured once per frame on the game thread and copied by the AGR Anim Instance, so that its rotation and aim offset
+ * math can run on animation worker threads without touching the pawn, its movement component or the locomotion
+ * component.
+ */
+USTRUCT(BlueprintType)
+struct AGR_ANIMATION_RUNTIME_API FAGR_LocomotionSnapshot
+{
+    GENERATED_BODY()
+
+    /**
+     * Rotation method of the locomotion component.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    EAGR_RotationMethod RotationMethod = EAGR_RotationMethod::AbsoluteRotation;
+
+    /**
+     * Aim method of the locomotion component.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    EAGR_AimMethod AimMethod = EAGR_AimMethod::FreeLook;
+
+    /**
+     * True, if the snapshot was captured from a locomotion component. Otherwise, rotation and aim methods are ignored.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bHasLocomotionComponent = false;
+
+    /**
+     * Significance tier of the locomotion component.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    EAGR_SignificanceTier SignificanceTier = EAGR_SignificanceTier::High;
+
+    /**
+     * Velocity of the pawn.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    FVector Velocity = FVector::ZeroVector;
+
+    /**
+     * World-space rotation of the pawn.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    FRotator ActorRotation = FRotator::ZeroRotator;
+
+    /**
+     * Control rotation of the pawn if it is controlled. Otherwise, its replicated base aim rotation.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    FRotator AimRotation = FRotator::ZeroRotator;
+
+    /**
+     * True, if the pawn has a movement component. All movement values below are only set if this is true.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bHasMovementComponent = false;
+
+    /**
+     * Velocity of the pawn's movement component.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    FVector MovementVelocity = FVector::ZeroVector;
+
+    /**
+     * Maximum speed of the pawn's movement component.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    float MaxSpeed = 0.0f;
+
+    /**
+     * True, if the pawn is crouching.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bCrouching = false;
+
+    /**
+     * True, if the pawn is swimming.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bSwimming = false;
+
+    /**
+     * True, if the pawn is falling.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bFalling = false;
+
+    /**
+     * True, if the pawn is flying.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bFlying = false;
+
+    /**
+     * True, if the pawn is moving on ground.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Snapshot")
+    bool bMovingOnGround = false;
+
+    /**
+     * Value of GFrameCounter when this snapshot was captured.
+     */
+    uint64 Frame = MAX_uint64;
+
+    /**
+     * Captures velocity, rotations and movement state of the pawn. Rotation and aim methods are left untouched.
+     * @note Must be called on the game thread.
+     * @param InPawn Pawn to capture.
+     */
+    void CapturePawn(const APawn* InPawn);
+};
+
 /**
  * The AGR Locomotion Component is responsible for multiplayer management of aim offset, rotation methods and animation
  * pose state updates. It works in tandem with the AGR Anim Instance.
@@ -66,7 +184,7 @@ UCLASS(
     BlueprintType,
     meta=(BlueprintSpawnableComponent),
     PrioritizeCategories="3Studio AGR")
-class AGR_ANIMATION_RUNTIME_API UAGR_LocomotionComponent : public UActorComponent
+class AGR_ANIMATION_RUNTIME_API UAGR_LocomotionComponent : public UActorComponent, public IAGR_SignificanceInterface
 {
     GENERATED_BODY()
 
@@ -133,6 +251,24 @@ private:
     UPROPERTY(EditDefaultsOnly, Replicated, Category="3Studio AGR|Config")
     bool bUpdateAllowedByClient;
 
+    /**
+     * If true, the server replicates the state of this component less often in low significance tiers.
+     *
+     * NOTE: Only this component is throttled, the rest of the owner keeps its net update frequency.
+     */
+    UPROPERTY(EditDefaultsOnly, Category="3Studio AGR|Config|Significance")
+    bool bThrottleReplicationBySignificance;
+
+    /**
+     * The state of this component replicates at the net update frequency of the owner divided by this value once for
+     * every significance tier below High.
+     */
+    UPROPERTY(
+        EditDefaultsOnly,
+        Category="3Studio AGR|Config|Significance",
+        meta=(EditCondition="bThrottleReplicationBySignificance", ClampMin=1.0f))
+    float SignificanceNetUpdateFrequencyScale;
+
     /**
      * Controls how the actor is rotated.
      */
@@ -161,14 +297,36 @@ private:
         SaveGame)
     FGameplayTagContainer AnimationStates;
 
+    /**
+     * Locomotion state of the owning pawn captured for the current frame.
+     */
+    UPROPERTY(Transient)
+    FAGR_LocomotionSnapshot Snapshot;
+
+    /**
+     * Significance tier of the owner, updated by the AGR significance subsystem.
+     */
+    EAGR_SignificanceTier SignificanceTier;
+
+    /**
+     * World time at which the throttled state of this component replicates next.
+     */
+    double NextStateReplicationTime;
+
 public:
     UAGR_LocomotionComponent();
 
     //~ Begin UActorComponent Interface
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+    virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
     //~ End UActorComponent Interface
 
+    //~ Begin IAGR_SignificanceInterface
+    virtual void SetSignificanceTier(const EAGR_SignificanceTier InSignificanceTier) override;
+    //~ End IAGR_SignificanceInterface
+
     /***/
     UFUNCTION(BlueprintPure, Category="3Studio AGR|State")
     bool IsUpdateAllowedByClient() const;
@@ -233,6 +391,20 @@ public:
     UFUNCTION(BlueprintPure, Category="3Studio AGR|State", meta=(BlueprintThreadSafe))
     const FGameplayTagContainer& GetAnimationStates() const;
 
+    /**
+     * Captures the locomotion snapshot of the owning pawn unless it was already captured this frame. Anim instances of
+     * all skeletal meshes of the pawn share the same capture.
+     * @note Must be called on the game thread.
+     * @return The snapshot for the current frame.
+     */
+    const FAGR_LocomotionSnapshot& UpdateSnapshot();
+
+    /**
+     * Gets the most recently captured locomotion snapshot.
+     */
+    UFUNCTION(BlueprintPure, Category="3Studio AGR|State", meta=(BlueprintThreadSafe))
+    const FAGR_LocomotionSnapshot& GetSnapshot() const;
+
 protected:
     /**
      * Sets the replication behavior for the client's changes to animation poses. 
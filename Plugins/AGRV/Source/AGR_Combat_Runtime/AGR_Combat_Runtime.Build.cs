@@ -9,6 +9,7 @@ public class AGR_Combat_Runtime : ModuleRules {
             new string[] {
                 "Core",
                 "GameplayTags",
+                "AGR_Core_Runtime",
             }
         );
 
@@ -15,6 +15,7 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Module/AGR_Combat_RuntimeLogs.h"
+#include "Significance/AGR_SignificanceSubsystem.h"
 #include "Utils/AGR_CombatUtils.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_SocketTracerComponent)
@@ -36,6 +37,10 @@ UAGR_SocketTracerComponent::UAGR_SocketTracerComponent()
     OverriddenSegmentCount = 5;
     bOverrideTraceParams = false;
     OverriddenTraceParams = FAGR_TraceParams{};
+    SignificanceMinTickInterval = 1.0f / 60.0f;
+    SignificanceTickIntervalScale = 2.0f;
+    SimplifiedHitsSignificanceTier = EAGR_SignificanceTier::Low;
+    SimplifiedHitsRadius = 10.0f;
 
     // Internal
     bAllSocketsValid = true;
@@ -43,6 +48,8 @@ UAGR_SocketTracerComponent::UAGR_SocketTracerComponent()
     CachedSegmentPoints = TArray<FVector>{};
     SegmentPoints = TArray<FVector>{};
     TracerComponentState = EAGR_TracerComponentState::Ended;
+    SignificanceTier = EAGR_SignificanceTier::High;
+    BaseTickInterval = PrimaryComponentTick.TickInterval;
     TracerId = FGameplayTag::EmptyTag;
     Owner = nullptr;
     CombatComponent = nullptr;
@@ -54,6 +61,13 @@ void UAGR_SocketTracerComponent::BeginPlay()
 {
     Super::BeginPlay();
 
+    BaseTickInterval = GetComponentTickInterval();
+    UAGR_SignificanceSubsystem* const SignificanceSubsystem = UAGR_SignificanceSubsystem::Get(this);
+    if(IsValid(SignificanceSubsystem))
+    {
+        SignificanceSubsystem->RegisterComponent(this);
+    }
+
     UpdateReferences();
     if(!IsValid(MeshComponent.Get()))
     {
@@ -74,6 +88,17 @@ void UAGR_SocketTracerComponent::BeginPlay()
     SegmentLength = CalculateSocketPathLength() / GetSegmentCount();
 }
 
+void UAGR_SocketTracerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    UAGR_SignificanceSubsystem* const SignificanceSubsystem = UAGR_SignificanceSubsystem::Get(this);
+    if(IsValid(SignificanceSubsystem))
+    {
+        SignificanceSubsystem->UnregisterComponent(this);
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void UAGR_SocketTracerComponent::TickComponent(
     float DeltaTime,
     ELevelTick TickType,
@@ -87,6 +112,12 @@ void UAGR_SocketTracerComponent::TickComponent(
     }
 
     CalculateSegmentPoints();
+    if(SignificanceTier >= SimplifiedHitsSignificanceTier)
+    {
+        SimplifiedTrace();
+        return;
+    }
+
     switch(TraceMode)
     {
     case EAGR_TraceMode::Raycast:
@@ -216,6 +247,23 @@ void UAGR_SocketTracerComponent::EndTracing_Implementation()
     ActorsHitResult_Wrapper.ActorsHitResult.Reset();
 }
 
+void UAGR_SocketTracerComponent::SetSignificanceTier(const EAGR_SignificanceTier InSignificanceTier)
+{
+    SignificanceTier = InSignificanceTier;
+
+    if(SignificanceTier == EAGR_SignificanceTier::High)
+    {
+        SetComponentTickInterval(BaseTickInterval);
+        return;
+    }
+
+    // Components ticking every frame have a tick interval of 0, that no scale would change.
+    const float TickIntervalScale = FMath::Pow(
+        FMath::Max(1.0f, SignificanceTickIntervalScale),
+        static_cast<float>(SignificanceTier));
+    SetComponentTickInterval(FMath::Max(BaseTickInterval, SignificanceMinTickInterval) * TickIntervalScale);
+}
+
 UMeshComponent* UAGR_SocketTracerComponent::FindComponentByTag(const FName Tag) const
 {
     if(!IsValid(Owner.Get()))
@@ -437,6 +485,29 @@ void UAGR_SocketTracerComponent::BroadcastHits(const TArray<FHitResult>& HitResu
     }
 }
 
+void UAGR_SocketTracerComponent::SimplifiedTrace()
+{
+    if(SegmentPoints.Num() < 2)
+    {
+        return;
+    }
+
+    FAGR_TraceParams TraceParams = GetTraceParams();
+    TraceParams.SetStart(SegmentPoints[0]);
+    TraceParams.SetEnd(SegmentPoints.Last());
+    TraceParams.SetSphereRadius(SimplifiedHitsRadius);
+    TArray<FHitResult> Hits = AGR_CombatUtils::CapsuleOverlapByChannel(
+        this,
+        TraceHitMode,
+        TraceParams,
+        CombatComponent->GetIgnoreList());
+
+    BroadcastHits(MoveTemp(Hits));
+
+    // Keep the cache up to date so that sweeping continues seamlessly when the significance rises again.
+    CachedSegmentPoints = SegmentPoints;
+}
+
 void UAGR_SocketTracerComponent::UpdateReferences()
 {
     if(!IsValid(Owner.Get()))
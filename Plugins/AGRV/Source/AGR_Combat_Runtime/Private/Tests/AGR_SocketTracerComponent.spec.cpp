@@ -0,0 +1,73 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#include "Combat/Components/AGR_SocketTracerComponent.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+    FAGR_SocketTracerComponentSpec,
+    "AGR.Combat.SocketTracerComponent",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+    UAGR_SocketTracerComponent* Tracer = nullptr;
+
+END_DEFINE_SPEC(FAGR_SocketTracerComponentSpec)
+
+void FAGR_SocketTracerComponentSpec::Define()
+{
+    BeforeEach(
+        [this]()
+        {
+            Tracer = NewObject<UAGR_SocketTracerComponent>(GetTransientPackage());
+            Tracer->AddToRoot();
+        });
+
+    AfterEach(
+        [this]()
+        {
+            Tracer->RemoveFromRoot();
+            Tracer = nullptr;
+        });
+
+    Describe(
+        "Significance",
+        [this]()
+        {
+            It(
+                "should tick every frame at full significance",
+                [this]()
+                {
+                    Tracer->SetSignificanceTier(EAGR_SignificanceTier::High);
+
+                    TestEqual(TEXT("Tick interval"), Tracer->GetComponentTickInterval(), 0.0f);
+                });
+
+            It(
+                "should scale the minimum tick interval when ticking every frame",
+                [this]()
+                {
+                    Tracer->SignificanceMinTickInterval = 0.02f;
+                    Tracer->SignificanceTickIntervalScale = 2.0f;
+
+                    Tracer->SetSignificanceTier(EAGR_SignificanceTier::Medium);
+                    TestEqual(TEXT("Medium tick interval"), Tracer->GetComponentTickInterval(), 0.04f);
+
+                    Tracer->SetSignificanceTier(EAGR_SignificanceTier::Lowest);
+                    TestEqual(TEXT("Lowest tick interval"), Tracer->GetComponentTickInterval(), 0.16f);
+                });
+
+            It(
+                "should restore the tick interval when the significance is back to high",
+                [this]()
+                {
+                    Tracer->SetSignificanceTier(EAGR_SignificanceTier::Low);
+                    TestTrue(TEXT("Throttled tick interval"), Tracer->GetComponentTickInterval() > 0.0f);
+
+                    Tracer->SetSignificanceTier(EAGR_SignificanceTier::High);
+                    TestEqual(TEXT("Restored tick interval"), Tracer->GetComponentTickInterval(), 0.0f);
+                });
+        });
+}
+
+#endif
@@ -6,6 +6,7 @@
 #include "GameplayTagContainer.h"
 #include "Combat/Interfaces/AGR_CombatInterface.h"
 #include "Components/ActorComponent.h"
+#include "Significance/AGR_SignificanceInterface.h"
 #include "Types/AGR_CombatEnums.h"
 #include "Types/AGR_CombatStructs.h"
 
@@ -23,7 +24,8 @@ UCLASS(
     BlueprintType,
     meta=(BlueprintSpawnableComponent),
     PrioritizeCategories="3Studio AGR")
-class AGR_COMBAT_RUNTIME_API UAGR_SocketTracerComponent : public UActorComponent, public IAGR_CombatInterface
+class AGR_COMBAT_RUNTIME_API UAGR_SocketTracerComponent
+    : public UActorComponent, public IAGR_CombatInterface, public IAGR_SignificanceInterface
 {
     GENERATED_BODY()
 
@@ -102,6 +104,44 @@ public:
         SaveGame)
     FAGR_TraceParams OverriddenTraceParams;
 
+    /**
+     * Tick interval the significance scaling starts from in tiers below High, when the tick interval of the component
+     * is shorter (eg. 0, ticking every frame).
+     */
+    UPROPERTY(
+        BlueprintReadWrite,
+        EditAnywhere,
+        Category="3Studio AGR|Combat|Significance",
+        meta=(UIMin="0.0", ClampMin="0.0", Units="Seconds"),
+        SaveGame)
+    float SignificanceMinTickInterval;
+
+    /**
+     * The tick interval is multiplied by this value once for every significance tier below High.
+     */
+    UPROPERTY(
+        BlueprintReadWrite,
+        EditAnywhere,
+        Category="3Studio AGR|Combat|Significance",
+        meta=(UIMin="1.0", ClampMin="1.0"),
+        SaveGame)
+    float SignificanceTickIntervalScale;
+
+    /**
+     * Starting at this significance tier, all segment traces are replaced by a single capsule overlap along the sockets.
+     */
+    UPROPERTY(BlueprintReadWrite, EditAnywhere, Category="3Studio AGR|Combat|Significance", SaveGame)
+    EAGR_SignificanceTier SimplifiedHitsSignificanceTier;
+
+    /** Radius of the capsule used for the simplified hit detection. */
+    UPROPERTY(
+        BlueprintReadWrite,
+        EditAnywhere,
+        Category="3Studio AGR|Combat|Significance",
+        meta=(UIMin="0.0", ClampMin="0.0", Units="Centimeters"),
+        SaveGame)
+    float SimplifiedHitsRadius;
+
 private:
     // Set to true at begin play if all provided sockets are valid on the mesh component.
     bool bAllSocketsValid;
@@ -118,6 +158,12 @@ private:
     // Current state of the tracer component.
     EAGR_TracerComponentState TracerComponentState;
 
+    // Significance tier of the owner, updated by the AGR significance subsystem.
+    EAGR_SignificanceTier SignificanceTier;
+
+    // Tick interval at full significance, cached at begin play.
+    float BaseTickInterval;
+
     // ID of the tracer.
     UPROPERTY(Replicated)
     FGameplayTag TracerId;
@@ -143,6 +189,7 @@ public:
 
     //~ Begin UActorComponent
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(
         float DeltaTime,
         ELevelTick TickType,
@@ -159,6 +206,10 @@ public:
     virtual void EndTracing_Implementation() override;
     //~ End IAGR_MeleeCombatInterface
 
+    //~ Begin IAGR_SignificanceInterface
+    virtual void SetSignificanceTier(const EAGR_SignificanceTier InSignificanceTier) override;
+    //~ End IAGR_SignificanceInterface
+
 private:
     /**
      * Finds and returns the first `UMeshComponent` on the owner actor with the specified tag.
@@ -210,6 +261,11 @@ private:
      */
     void BroadcastHits(const TArray<FHitResult>& HitResults);
 
+    /**
+     * Replaces all segment traces by a single capsule overlap along the `SegmentPoints`. Used in low significance tiers.
+     */
+    void SimplifiedTrace();
+
     /**
      * Updates owner and combat component references.
      */
@@ -5,6 +5,9 @@
 #include "Types/AGR_CombatEnums.h"
 #include "Types/AGR_CombatStructs.h"
 #include "Kismet/KismetSystemLibrary.h"
+#include "DrawDebugHelpers.h"
+#include "Engine/OverlapResult.h"
+#include "Engine/World.h"
 
 namespace AGR_CombatUtils
 {
@@ -236,6 +239,93 @@ namespace AGR_CombatUtils
         return HitResults;
     };
 
+    /**
+     * Performs a single capsule overlap by channel. The capsule axis spans from the trace start to the trace end and its
+     * radius is the sphere radius of the trace params. Cheaper than tracing every segment, but less precise: hit
+     * locations are the closest points on the capsule axis to the overlapped components.
+     * 
+     * @param ActorComponent The actor component performing the overlap.
+     * @param TraceHitMode Determines if the overlap detects a single hit or multiple hits.
+     * @param TraceParams Parameters defining the overlap operation.
+     * @param ActorsToIgnore Actors to ignore when overlapping.
+     * @returns list of hit results from the capsule overlap.
+     */
+    static TArray<FHitResult> CapsuleOverlapByChannel(
+        const UActorComponent* ActorComponent,
+        const EAGR_TraceHitMode TraceHitMode,
+        const FAGR_TraceParams& TraceParams,
+        const TArray<AActor*>& ActorsToIgnore)
+    {
+        TArray<FHitResult> HitResults;
+        if(!IsValid(ActorComponent))
+        {
+            return HitResults;
+        }
+
+        UWorld* const World = ActorComponent->GetWorld();
+        if(!IsValid(World))
+        {
+            return HitResults;
+        }
+
+        const FVector& Start = TraceParams.GetStart();
+        const FVector& End = TraceParams.GetEnd();
+        const FVector Center = (Start + End) * 0.5f;
+        const FVector Axis = End - Start;
+        const float Radius = TraceParams.GetSphereRadius();
+        const float HalfHeight = Axis.Size() * 0.5f + Radius;
+        const FQuat Rotation = Axis.IsNearlyZero() ? FQuat::Identity : FRotationMatrix::MakeFromZ(Axis).ToQuat();
+
+        FCollisionQueryParams QueryParams(SCENE_QUERY_STAT(AGR_CapsuleOverlap), TraceParams.bTraceComplex);
+        QueryParams.AddIgnoredActors(ActorsToIgnore);
+        if(TraceParams.bIgnoreSelf)
+        {
+            QueryParams.AddIgnoredActor(ActorComponent->GetOwner());
+        }
+
+        TArray<FOverlapResult> Overlaps;
+        World->OverlapMultiByChannel(
+            Overlaps,
+            Center,
+            Rotation,
+            UEngineTypes::ConvertToCollisionChannel(TraceParams.TraceChannel),
+            FCollisionShape::MakeCapsule(Radius, HalfHeight),
+            QueryParams);
+
+        for(const FOverlapResult& Overlap : Overlaps)
+        {
+            AActor* const HitActor = Overlap.GetActor();
+            UPrimitiveComponent* const HitComponent = Overlap.GetComponent();
+            if(!IsValid(HitActor) || !IsValid(HitComponent))
+            {
+                continue;
+            }
+
+            const FVector HitLocation = FMath::ClosestPointOnSegment(HitComponent->GetComponentLocation(), Start, End);
+            const FVector HitNormal = (HitLocation - HitComponent->GetComponentLocation()).GetSafeNormal();
+            HitResults.Emplace(HitActor, HitComponent, HitLocation, HitNormal);
+
+            if(TraceHitMode == EAGR_TraceHitMode::SingleHit)
+            {
+                break;
+            }
+        }
+
+        if(TraceParams.DrawDebugType != EDrawDebugTrace::None)
+        {
+            const bool bPersistent = TraceParams.DrawDebugType == EDrawDebugTrace::Persistent;
+            const float LifeTime = TraceParams.DrawDebugType == EDrawDebugTrace::ForDuration
+                                   ? TraceParams.DrawTime
+                                   : 0.f;
+            const FLinearColor& Color = HitResults.IsEmpty()
+                                        ? TraceParams.SingleFrameTraceColor
+                                        : TraceParams.TraceHitColor;
+            DrawDebugCapsule(World, Center, HalfHeight, Radius, Rotation, Color.ToFColor(true), bPersistent, LifeTime);
+        }
+
+        return HitResults;
+    };
+
     /**
      * Performs a trace using the specified shape (line, box, or sphere) by channel.
      * 
@@ -10,6 +10,7 @@ public class AGR_Core_Runtime : ModuleRules {
         PublicDependencyModuleNames.AddRange(
             new string[] {
                 "Core",
+                "DeveloperSettings",
             }
         );
 
@@ -19,6 +20,7 @@ public class AGR_Core_Runtime : ModuleRules {
                 "Engine",
                 "Slate",
                 "SlateCore",
+                "SignificanceManager",
             }
         );
     }
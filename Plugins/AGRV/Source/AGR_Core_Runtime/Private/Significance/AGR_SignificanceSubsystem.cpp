@@ -0,0 +1,256 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+// ReSharper disable CppTooWideScopeInitStatement
+#include "Significance/AGR_SignificanceSubsystem.h"
+
+#include "SignificanceManager.h"
+#include "Components/ActorComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "Module/AGR_Core_ProjectSettings.h"
+#include "Module/AGR_Core_RuntimeLogs.h"
+#include "Significance/AGR_SignificanceInterface.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_SignificanceSubsystem)
+
+namespace AGR_SignificanceSubsystem
+{
+    const FName SignificanceTag = TEXT("AGR");
+
+    /**
+     * Time in seconds after which an actor is no longer considered as rendered recently.
+     */
+    constexpr float RecentlyRenderedTolerance = 0.5f;
+}
+
+UAGR_SignificanceSubsystem* UAGR_SignificanceSubsystem::Get(const UObject* InWorldContextObject)
+{
+    if(!IsValid(InWorldContextObject))
+    {
+        return nullptr;
+    }
+
+    const UWorld* const World = InWorldContextObject->GetWorld();
+    if(!IsValid(World))
+    {
+        return nullptr;
+    }
+
+    return World->GetSubsystem<UAGR_SignificanceSubsystem>();
+}
+
+void UAGR_SignificanceSubsystem::Deinitialize()
+{
+    USignificanceManager* const SignificanceManager = USignificanceManager::Get(GetWorld());
+    if(IsValid(SignificanceManager))
+    {
+        for(const TWeakObjectPtr<UActorComponent>& Component : RegisteredComponents)
+        {
+            if(Component.IsValid())
+            {
+                SignificanceManager->UnregisterObject(Component.Get());
+            }
+        }
+    }
+
+    RegisteredComponents.Reset();
+    ComponentTiers.Reset();
+
+    Super::Deinitialize();
+}
+
+void UAGR_SignificanceSubsystem::Tick(const float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    if(RegisteredComponents.IsEmpty())
+    {
+        return;
+    }
+
+    const UAGR_Core_ProjectSettings* const Settings = UAGR_Core_ProjectSettings::Get();
+    if(!IsValid(Settings) || !Settings->bEnableSignificance || !Settings->bUpdateSignificanceManager)
+    {
+        return;
+    }
+
+    UWorld* const World = GetWorld();
+    USignificanceManager* const SignificanceManager = USignificanceManager::Get(World);
+    if(!IsValid(SignificanceManager))
+    {
+        return;
+    }
+
+    Viewpoints.Reset();
+    for(FConstPlayerControllerIterator Iterator = World->GetPlayerControllerIterator(); Iterator; ++Iterator)
+    {
+        const APlayerController* const PlayerController = Iterator->Get();
+        if(!IsValid(PlayerController))
+        {
+            continue;
+        }
+
+        FVector ViewLocation;
+        FRotator ViewRotation;
+        PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+        Viewpoints.Emplace(ViewRotation, ViewLocation);
+    }
+
+    SignificanceManager->Update(Viewpoints);
+}
+
+TStatId UAGR_SignificanceSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAGR_SignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UAGR_SignificanceSubsystem::RegisterComponent(UActorComponent* InComponent)
+{
+    if(!IsValid(InComponent) || ComponentTiers.Contains(InComponent))
+    {
+        return;
+    }
+
+    if(!InComponent->Implements<UAGR_SignificanceInterface>())
+    {
+        AGR_LOG(
+            LogAGR_Core_Runtime,
+            Error,
+            "Component %s does not implement IAGR_SignificanceInterface!",
+            *InComponent->GetFullName());
+        return;
+    }
+
+    const UAGR_Core_ProjectSettings* const Settings = UAGR_Core_ProjectSettings::Get();
+    if(!IsValid(Settings) || !Settings->bEnableSignificance)
+    {
+        return;
+    }
+
+    USignificanceManager* const SignificanceManager = USignificanceManager::Get(GetWorld());
+    if(!IsValid(SignificanceManager))
+    {
+        return;
+    }
+
+    ComponentTiers.Add(InComponent, EAGR_SignificanceTier::High);
+    RegisteredComponents.Add(InComponent);
+
+    // The significance function may run on worker threads, so it only reads the owner's location. Higher significance
+    // is more significant, hence the negated distance; the manager keeps the maximum over all view points.
+    auto SignificanceFunction = [](USignificanceManager::FManagedObjectInfo* InObjectInfo, const FTransform& InViewpoint)
+    {
+        const UActorComponent* const Component = Cast<UActorComponent>(InObjectInfo->GetObject());
+        const AActor* const Owner = IsValid(Component) ? Component->GetOwner() : nullptr;
+        if(!IsValid(Owner))
+        {
+            return 0.0f;
+        }
+
+        return -static_cast<float>(FVector::Dist(Owner->GetActorLocation(), InViewpoint.GetLocation()));
+    };
+
+    auto PostSignificanceFunction = [this](
+        USignificanceManager::FManagedObjectInfo* InObjectInfo,
+        const float InOldSignificance,
+        const float InSignificance,
+        const bool bInFinal)
+    {
+        UActorComponent* const Component = Cast<UActorComponent>(InObjectInfo->GetObject());
+        if(!IsValid(Component))
+        {
+            return;
+        }
+
+        ApplySignificanceTier(Component, CalculateSignificanceTier(Component->GetOwner(), -InSignificance));
+    };
+
+    SignificanceManager->RegisterObject(
+        InComponent,
+        AGR_SignificanceSubsystem::SignificanceTag,
+        MoveTemp(SignificanceFunction),
+        USignificanceManager::EPostSignificanceType::Sequential,
+        MoveTemp(PostSignificanceFunction));
+}
+
+void UAGR_SignificanceSubsystem::UnregisterComponent(UActorComponent* InComponent)
+{
+    if(ComponentTiers.Remove(InComponent) <= 0)
+    {
+        return;
+    }
+
+    RegisteredComponents.RemoveSwap(InComponent);
+
+    USignificanceManager* const SignificanceManager = USignificanceManager::Get(GetWorld());
+    if(IsValid(SignificanceManager))
+    {
+        SignificanceManager->UnregisterObject(InComponent);
+    }
+}
+
+EAGR_SignificanceTier UAGR_SignificanceSubsystem::GetSignificanceTier(const UActorComponent* InComponent) const
+{
+    const EAGR_SignificanceTier* const SignificanceTier = ComponentTiers.Find(InComponent);
+    return SignificanceTier != nullptr ? *SignificanceTier : EAGR_SignificanceTier::High;
+}
+
+EAGR_SignificanceTier UAGR_SignificanceSubsystem::CalculateSignificanceTier(
+    const AActor* const InActor,
+    const float InDistance)
+{
+    const UAGR_Core_ProjectSettings* const Settings = UAGR_Core_ProjectSettings::Get();
+    if(!IsValid(Settings) || !IsValid(InActor))
+    {
+        return EAGR_SignificanceTier::High;
+    }
+
+    EAGR_SignificanceTier SignificanceTier = EAGR_SignificanceTier::High;
+    if(InDistance > Settings->LowestSignificanceDistance)
+    {
+        SignificanceTier = EAGR_SignificanceTier::Lowest;
+    }
+    else if(InDistance > Settings->LowSignificanceDistance)
+    {
+        SignificanceTier = EAGR_SignificanceTier::Low;
+    }
+    else if(InDistance > Settings->MediumSignificanceDistance)
+    {
+        SignificanceTier = EAGR_SignificanceTier::Medium;
+    }
+
+    const bool bCanDemote = Settings->bDemoteWhenNotRendered
+                            && SignificanceTier != EAGR_SignificanceTier::Lowest
+                            && InActor->GetNetMode() != NM_DedicatedServer;
+    if(bCanDemote && !InActor->WasRecentlyRendered(AGR_SignificanceSubsystem::RecentlyRenderedTolerance))
+    {
+        SignificanceTier = static_cast<EAGR_SignificanceTier>(static_cast<uint8>(SignificanceTier) + 1);
+    }
+
+    return SignificanceTier;
+}
+
+bool UAGR_SignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAGR_SignificanceSubsystem::ApplySignificanceTier(
+    UActorComponent* InComponent,
+    const EAGR_SignificanceTier InSignificanceTier)
+{
+    EAGR_SignificanceTier* const CurrentSignificanceTier = ComponentTiers.Find(InComponent);
+    if(CurrentSignificanceTier == nullptr || *CurrentSignificanceTier == InSignificanceTier)
+    {
+        return;
+    }
+
+    *CurrentSignificanceTier = InSignificanceTier;
+
+    IAGR_SignificanceInterface* const SignificanceInterface = Cast<IAGR_SignificanceInterface>(InComponent);
+    if(SignificanceInterface != nullptr)
+    {
+        SignificanceInterface->SetSignificanceTier(InSignificanceTier);
+    }
+}
\ No newline at end of file
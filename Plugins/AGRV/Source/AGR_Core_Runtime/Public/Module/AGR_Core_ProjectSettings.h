@@ -0,0 +1,94 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+
+#include "AGR_Core_ProjectSettings.generated.h"
+
+/**
+ * AGR Core Project Settings.
+ */
+UCLASS(Config="AGR", DefaultConfig)
+class AGR_CORE_RUNTIME_API UAGR_Core_ProjectSettings : public UDeveloperSettings
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * If false, all AGR components stay at the highest significance tier.
+     */
+    UPROPERTY(config, EditDefaultsOnly, Category = "Significance")
+    bool bEnableSignificance = true;
+
+    /**
+     * If true, the AGR significance subsystem updates the world's significance manager with the view points of all
+     * player controllers every frame. Disable this if the game already updates the significance manager itself.
+     */
+    UPROPERTY(config, EditDefaultsOnly, Category = "Significance", meta=(EditCondition="bEnableSignificance"))
+    bool bUpdateSignificanceManager = true;
+
+    /**
+     * Actors further away from the closest view point than this distance are at least in the Medium tier.
+     */
+    UPROPERTY(
+        config,
+        EditDefaultsOnly,
+        Category = "Significance",
+        meta=(EditCondition="bEnableSignificance", ClampMin=0.0f, Units="Centimeters"))
+    float MediumSignificanceDistance = 2000.0f;
+
+    /**
+     * Actors further away from the closest view point than this distance are at least in the Low tier.
+     */
+    UPROPERTY(
+        config,
+        EditDefaultsOnly,
+        Category = "Significance",
+        meta=(EditCondition="bEnableSignificance", ClampMin=0.0f, Units="Centimeters"))
+    float LowSignificanceDistance = 5000.0f;
+
+    /**
+     * Actors further away from the closest view point than this distance are in the Lowest tier.
+     */
+    UPROPERTY(
+        config,
+        EditDefaultsOnly,
+        Category = "Significance",
+        meta=(EditCondition="bEnableSignificance", ClampMin=0.0f, Units="Centimeters"))
+    float LowestSignificanceDistance = 10000.0f;
+
+    /**
+     * If true, actors that were not rendered recently are moved down by one tier. Ignored on dedicated servers.
+     */
+    UPROPERTY(config, EditDefaultsOnly, Category = "Significance", meta=(EditCondition="bEnableSignificance"))
+    bool bDemoteWhenNotRendered = true;
+
+    virtual FName GetContainerName() const override
+    {
+        return TEXT("Project");
+    };
+
+    virtual FName GetCategoryName() const override
+    {
+        return TEXT("3Studio");
+    };
+
+    virtual FName GetSectionName() const override
+    {
+        return TEXT("AGR Core");
+    };
+
+#if WITH_EDITOR
+    virtual FText GetSectionText() const override
+    {
+        return FText::FromString(TEXT("AGR Core"));
+    };
+#endif
+
+    static UAGR_Core_ProjectSettings* Get()
+    {
+        const auto PluginProjectSettings = GetMutableDefault<UAGR_Core_ProjectSettings>();
+        return IsValid(PluginProjectSettings) ? PluginProjectSettings : nullptr;
+    }
+};
\ No newline at end of file
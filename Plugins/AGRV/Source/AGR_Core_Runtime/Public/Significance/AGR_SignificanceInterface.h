@@ -0,0 +1,30 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "UObject/Interface.h"
+#include "Significance/AGR_SignificanceTypes.h"
+
+#include "AGR_SignificanceInterface.generated.h"
+
+UINTERFACE(MinimalAPI, meta=(CannotImplementInterfaceInBlueprint))
+class UAGR_SignificanceInterface : public UInterface
+{
+    GENERATED_BODY()
+};
+
+/**
+ * Native interface for actor components that adapt their fidelity to the significance tier of their owner.
+ * Components implementing it register themselves with the UAGR_SignificanceSubsystem.
+ */
+class AGR_CORE_RUNTIME_API IAGR_SignificanceInterface
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Called on the game thread whenever the significance tier of the component changes.
+     * @param InSignificanceTier The new significance tier.
+     */
+    virtual void SetSignificanceTier(const EAGR_SignificanceTier InSignificanceTier) = 0;
+};
\ No newline at end of file
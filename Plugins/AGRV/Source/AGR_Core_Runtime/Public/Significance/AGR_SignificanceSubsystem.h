@@ -0,0 +1,97 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "Significance/AGR_SignificanceTypes.h"
+
+#include "AGR_SignificanceSubsystem.generated.h"
+
+class UActorComponent;
+
+/**
+ * Buckets AGR components into significance tiers based on the distance of their owner to the closest player view
+ * point (and optionally on whether the owner was rendered recently).
+ *
+ * Components implementing IAGR_SignificanceInterface register themselves with this subsystem, which registers them
+ * with the world's USignificanceManager. Every significance update recalculates the tier of each component on the game
+ * thread and notifies the component only if its tier changed.
+ */
+UCLASS()
+class AGR_CORE_RUNTIME_API UAGR_SignificanceSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+private:
+    /**
+     * Current significance tier of every registered component.
+     */
+    TMap<TObjectKey<UActorComponent>, EAGR_SignificanceTier> ComponentTiers;
+
+    /**
+     * Registered components, kept to unregister them from the significance manager on deinitialization.
+     */
+    TArray<TWeakObjectPtr<UActorComponent>> RegisteredComponents;
+
+    /**
+     * View points passed to the significance manager. Kept to avoid reallocating every frame.
+     */
+    TArray<FTransform> Viewpoints;
+
+public:
+    /**
+     * Gets the significance subsystem of the world of the given object.
+     * @param InWorldContextObject World context.
+     * @return The significance subsystem or nullptr if the world has none.
+     */
+    static UAGR_SignificanceSubsystem* Get(const UObject* InWorldContextObject);
+
+    //~ Begin USubsystem Interface
+    virtual void Deinitialize() override;
+    //~ End USubsystem Interface
+
+    //~ Begin FTickableGameObject Interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    //~ End FTickableGameObject Interface
+
+    /**
+     * Registers a component with the significance manager. The component must implement IAGR_SignificanceInterface.
+     * Does nothing if significance is disabled in the project settings.
+     * @param InComponent Component to register.
+     */
+    void RegisterComponent(UActorComponent* InComponent);
+
+    /**
+     * Unregisters a component from the significance manager.
+     * @param InComponent Component to unregister.
+     */
+    void UnregisterComponent(UActorComponent* InComponent);
+
+    /**
+     * Gets the current significance tier of a registered component.
+     * @param InComponent Registered component.
+     * @return The significance tier. High, if the component is not registered.
+     */
+    EAGR_SignificanceTier GetSignificanceTier(const UActorComponent* InComponent) const;
+
+    /**
+     * Calculates the significance tier of an actor.
+     * @param InActor Actor to calculate the tier for.
+     * @param InDistance Distance of the actor to the closest view point.
+     * @return The significance tier.
+     */
+    static EAGR_SignificanceTier CalculateSignificanceTier(const AActor* InActor, const float InDistance);
+
+protected:
+    //~ Begin UWorldSubsystem Interface
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    //~ End UWorldSubsystem Interface
+
+private:
+    /**
+     * Applies the tier to the component and notifies it if the tier changed.
+     */
+    void ApplySignificanceTier(UActorComponent* InComponent, const EAGR_SignificanceTier InSignificanceTier);
+};
\ No newline at end of file
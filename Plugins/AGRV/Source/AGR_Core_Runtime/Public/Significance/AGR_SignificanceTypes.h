@@ -0,0 +1,21 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+
+#include "AGR_SignificanceTypes.generated.h"
+
+/**
+ * Significance tier of an AGR-driven actor, ordered from most to least significant.
+ * Components drop fidelity in lower tiers, e.g. by ticking less often or skipping work entirely.
+ */
+UENUM(BlueprintType)
+enum class EAGR_SignificanceTier : uint8
+{
+    // @formatter:off
+    High                UMETA(DisplayName="High"),
+    Medium              UMETA(DisplayName="Medium"),
+    Low                 UMETA(DisplayName="Low"),
+    Lowest              UMETA(DisplayName="Lowest"),
+    // @formatter:on
+};
\ No newline at end of file
@@ -11,6 +11,7 @@ public class AGR_Inventory_Runtime : ModuleRules {
             new string[] {
                 "Core",
                 "GameplayTags",
+                "NetCore",
             }
         );
         
@@ -2,6 +2,8 @@
 
 #include "Inventory/Actors/AGR_InventoryContainer.h"
 
+#include "Inventory/Components/AGR_InventoryContainerRootComponent.h"
+
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_InventoryContainer)
 
 AAGR_InventoryContainer::AAGR_InventoryContainer()
@@ -22,5 +24,5 @@ AAGR_InventoryContainer::AAGR_InventoryContainer()
     bIsSpatiallyLoaded = false;
 #endif
 
-    SetRootComponent(CreateDefaultSubobject<USceneComponent>("Root"));
+    SetRootComponent(CreateDefaultSubobject<UAGR_InventoryContainerRootComponent>("Root"));
 }
\ No newline at end of file
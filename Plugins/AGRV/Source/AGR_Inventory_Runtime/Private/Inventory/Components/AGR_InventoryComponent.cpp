@@ -9,14 +9,109 @@
 #include "GameFramework/Pawn.h"
 #include "Inventory/Components/AGR_ItemComponent.h"
 #include "Inventory/Libs/AGR_InventoryFunctionLibrary.h"
-#include "Kismet/KismetArrayLibrary.h"
 #include "Kismet/KismetGuidLibrary.h"
 #include "Kismet/KismetSystemLibrary.h"
 #include "Module/AGR_Inventory_RuntimeLogs.h"
 #include "Net/UnrealNetwork.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_InventoryComponent)
 
+namespace AGR_InventoryComponent
+{
+    /**
+     * Serializes the SaveGame properties of an object into the archive as a length-prefixed blob.
+     */
+    void WriteSaveGameProperties(FArchive& InOutArchive, UObject* InObject)
+    {
+        TArray<uint8> ObjectData;
+        FMemoryWriter MemoryWriter(ObjectData, true);
+        FObjectAndNameAsStringProxyArchive ProxyArchive(MemoryWriter, false);
+        ProxyArchive.ArIsSaveGame = true;
+        InObject->Serialize(ProxyArchive);
+
+        InOutArchive << ObjectData;
+    }
+
+    /**
+     * Reads a length-prefixed blob written by WriteSaveGameProperties. Restores it into the object if one is given,
+     * otherwise skips it.
+     */
+    void ReadSaveGameProperties(FArchive& InOutArchive, UObject* InObject)
+    {
+        TArray<uint8> ObjectData;
+        InOutArchive << ObjectData;
+
+        if(InObject == nullptr)
+        {
+            return;
+        }
+
+        FMemoryReader MemoryReader(ObjectData, true);
+        FObjectAndNameAsStringProxyArchive ProxyArchive(MemoryReader, true);
+        ProxyArchive.ArIsSaveGame = true;
+        InObject->Serialize(ProxyArchive);
+    }
+
+    /**
+     * Captures the SaveGame properties of an item actor and all of its components.
+     */
+    void CaptureInstanceData(AActor* InItem, TArray<uint8>& OutInstanceData)
+    {
+        OutInstanceData.Reset();
+        FMemoryWriter Writer(OutInstanceData, true);
+
+        WriteSaveGameProperties(Writer, InItem);
+
+        TInlineComponentArray<UActorComponent*> Components(InItem);
+        int32 NumComponents = Components.Num();
+        Writer << NumComponents;
+
+        for(UActorComponent* const Component : Components)
+        {
+            FString ComponentName = Component->GetName();
+            Writer << ComponentName;
+            WriteSaveGameProperties(Writer, Component);
+        }
+    }
+
+    /**
+     * Restores data captured by CaptureInstanceData. Components are matched by name.
+     */
+    void RestoreInstanceData(AActor* InItem, const TArray<uint8>& InInstanceData)
+    {
+        if(InInstanceData.IsEmpty())
+        {
+            return;
+        }
+
+        FMemoryReader Reader(InInstanceData, true);
+
+        ReadSaveGameProperties(Reader, InItem);
+
+        TInlineComponentArray<UActorComponent*> Components(InItem);
+
+        int32 NumComponents = 0;
+        Reader << NumComponents;
+
+        for(int32 i = 0; i < NumComponents && !Reader.IsError(); ++i)
+        {
+            FString ComponentName;
+            Reader << ComponentName;
+
+            UActorComponent* const* Component = Components.FindByPredicate(
+                [&ComponentName](const UActorComponent* InComponent)
+                {
+                    return InComponent->GetName() == ComponentName;
+                });
+
+            ReadSaveGameProperties(Reader, Component != nullptr ? *Component : nullptr);
+        }
+    }
+}
+
 UAGR_InventoryComponent::UAGR_InventoryComponent(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
 {
@@ -31,31 +126,107 @@ UAGR_InventoryComponent::UAGR_InventoryComponent(const FObjectInitializer& Objec
     InventoryContainer = nullptr;
     ActiveEquipmentSlotsMap = TMap<FGameplayTag, TObjectPtr<AActor>>{};
 
-    ActiveEquipmentSlotsArray = TArray<FAGR_ActiveEquipmentKeyValue>{};
+    ActiveEquipmentSlotsArray = FAGR_ActiveEquipmentSlotsArray{};
+    ActiveEquipmentSlotsArray.OwnerComponent = this;
+    ItemRecords = FAGR_ItemRecordArray{};
+    ItemRecords.OwnerComponent = this;
 
     UActorComponent::SetAutoActivate(true);
 }
 
-void UAGR_InventoryComponent::SerializeActiveEquipmentSlotsMap()
+void FAGR_ActiveEquipmentKeyValue::PreReplicatedRemove(const FAGR_ActiveEquipmentSlotsArray& InArraySerializer) const
 {
-    const TArray<FAGR_ActiveEquipmentKeyValue> OldValue = ActiveEquipmentSlotsArray;
+    if(IsValid(InArraySerializer.OwnerComponent))
+    {
+        InArraySerializer.OwnerComponent->ApplyReplicatedSlot(Slot, nullptr);
+    }
+}
 
-    ActiveEquipmentSlotsArray.Empty();
-    for(const auto& PairMap : ActiveEquipmentSlotsMap)
+void FAGR_ActiveEquipmentKeyValue::PostReplicatedAdd(const FAGR_ActiveEquipmentSlotsArray& InArraySerializer) const
+{
+    if(IsValid(InArraySerializer.OwnerComponent))
+    {
+        InArraySerializer.OwnerComponent->ApplyReplicatedSlot(Slot, Item);
+    }
+}
+
+void FAGR_ActiveEquipmentKeyValue::PostReplicatedChange(const FAGR_ActiveEquipmentSlotsArray& InArraySerializer) const
+{
+    if(IsValid(InArraySerializer.OwnerComponent))
+    {
+        InArraySerializer.OwnerComponent->ApplyReplicatedSlot(Slot, Item);
+    }
+}
+
+bool FAGR_ActiveEquipmentSlotsArray::SetSlot(const FGameplayTag InSlot, AActor* InItem)
+{
+    for(FAGR_ActiveEquipmentKeyValue& Entry : Items)
+    {
+        if(Entry.Slot != InSlot)
+        {
+            continue;
+        }
+
+        if(Entry.Item == InItem)
+        {
+            return false;
+        }
+
+        Entry.Item = InItem;
+        MarkItemDirty(Entry);
+        return true;
+    }
+
+    FAGR_ActiveEquipmentKeyValue& NewEntry = Items.Add_GetRef(FAGR_ActiveEquipmentKeyValue{});
+    NewEntry.Slot = InSlot;
+    NewEntry.Item = InItem;
+    MarkItemDirty(NewEntry);
+
+    return true;
+}
+
+int32 FAGR_ItemRecordArray::IndexOfItemID(const FString& InItemID) const
+{
+    return Items.IndexOfByPredicate(
+        [&InItemID](const FAGR_ItemRecord& InRecord)
+        {
+            return InRecord.ItemID == InItemID;
+        });
+}
+
+void FAGR_ItemRecordArray::PostReplicatedReceive(
+    const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters) const
+{
+    if(IsValid(OwnerComponent))
     {
-        ActiveEquipmentSlotsArray.Add(FAGR_ActiveEquipmentKeyValue{PairMap.Key, PairMap.Value});
+        OwnerComponent->OnItemRecordsUpdated.Broadcast();
     }
+}
 
-    OnRep_ActiveSlotsMapArray(OldValue);
+void UAGR_InventoryComponent::SerializeActiveEquipmentSlotsMap()
+{
+    for(const auto& PairMap : ActiveEquipmentSlotsMap)
+    {
+        ActiveEquipmentSlotsArray.SetSlot(PairMap.Key, PairMap.Value);
+    }
 }
 
-void UAGR_InventoryComponent::DeserializeActiveEquipmentSlotsMap()
+void UAGR_InventoryComponent::ApplyReplicatedSlot(const FGameplayTag InSlot, AActor* InItem)
 {
-    ActiveEquipmentSlotsMap.Empty();
-    for(const FAGR_ActiveEquipmentKeyValue& PairArray : ActiveEquipmentSlotsArray)
+    const TObjectPtr<AActor>* OldItem = ActiveEquipmentSlotsMap.Find(InSlot);
+    const bool bSameItemInSlot = OldItem != nullptr ? *OldItem == InItem : InItem == nullptr;
+
+    ActiveEquipmentSlotsMap.Add(InSlot, InItem);
+
+    if(bSameItemInSlot)
     {
-        ActiveEquipmentSlotsMap.Add(PairArray.Slot, PairArray.Item);
+        return;
     }
+
+    OnEquipmentSlotUpdated.Broadcast(
+        InItem,
+        InItem != nullptr ? EAGR_EquipmentSlotAction::Set : EAGR_EquipmentSlotAction::Cleared,
+        InSlot);
 }
 
 void UAGR_InventoryComponent::BeginPlay()
@@ -110,6 +281,10 @@ void UAGR_InventoryComponent::BeginPlay()
         SpawnParameters);
 
     InventoryContainer->InventoryID = InventoryID;
+    InventoryContainer->InventoryComponent = this;
+
+    // Pick up any items that were attached to the owner before the inventory started.
+    RebuildItemIndex();
 }
 
 void UAGR_InventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
@@ -121,42 +296,7 @@ void UAGR_InventoryComponent::GetLifetimeReplicatedProps(TArray<FLifetimePropert
     DOREPLIFETIME_CONDITION(UAGR_InventoryComponent, InventoryContainer, COND_InitialOnly);
 
     DOREPLIFETIME(UAGR_InventoryComponent, ActiveEquipmentSlotsArray);
-}
-
-// ReSharper disable once CppMemberFunctionMayBeConst
-void UAGR_InventoryComponent::OnRep_ActiveSlotsMapArray(const TArray<FAGR_ActiveEquipmentKeyValue>& InOldValue)
-{
-    DeserializeActiveEquipmentSlotsMap();
-
-    for(int32 i = 0; i < ActiveEquipmentSlotsArray.Num(); ++i)
-    {
-        if(i >= InOldValue.Num())
-        {
-            break;
-        }
-
-        const FAGR_ActiveEquipmentKeyValue& Current = ActiveEquipmentSlotsArray[i];
-        const FAGR_ActiveEquipmentKeyValue& Old = InOldValue[i];
-
-        const bool SameItemValuesInSlot = Current.Item == Old.Item;
-        if(SameItemValuesInSlot)
-        {
-            continue;
-        }
-
-        const bool IsSetOrUpdated = Current.Item != nullptr;
-        if(IsSetOrUpdated)
-        {
-            OnEquipmentSlotUpdated.Broadcast(
-                Current.Item,
-                EAGR_EquipmentSlotAction::Set,
-                Current.Slot);
-        }
-        else
-        {
-            OnEquipmentSlotUpdated.Broadcast(Current.Item, EAGR_EquipmentSlotAction::Cleared, Current.Slot);
-        }
-    }
+    DOREPLIFETIME(UAGR_InventoryComponent, ItemRecords);
 }
 
 AActor* UAGR_InventoryComponent::GetItemInSlot_Implementation(const FGameplayTag InSlot) const
@@ -215,34 +355,101 @@ TArray<AActor*> UAGR_InventoryComponent::GetAllEquippedItems_Implementation() co
     return MoveTemp(EquippedItems);
 }
 
-TArray<AActor*> UAGR_InventoryComponent::GetAllItems_Implementation() const
+TArray<AActor*> UAGR_InventoryComponent::GetAllItems_Implementation(TArray<FAGR_ItemRecord>& OutVirtualItems) const
 {
+    OutVirtualItems = ItemRecords.Items;
+
+    TArray<AActor*> Items;
+    ItemIndex.GetAll(Items);
+
+    return MoveTemp(Items);
+}
+
+// ReSharper disable once CppPassValueParameterByConstReference
+TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByClass_Implementation(TSubclassOf<AActor> InClass) const
+{
+    TArray<AActor*> Items;
+    ItemIndex.GetByClass(InClass, Items);
+
+    return MoveTemp(Items);
+}
+
+TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByTags_Implementation(
+    const TArray<FName>& InTags,
+    const bool bInMatchAll) const
+{
+    TArray<AActor*> Items;
+    ItemIndex.GetByTags(InTags, bInMatchAll, Items);
+
+    return MoveTemp(Items);
+}
+
+TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByGameplayTag_Implementation(
+    const FGameplayTag InGameplayTag) const
+{
+    // The index stores every item under its type and all parent tags. For example, we want to allow matching "A.1" by
+    // searching for "A".
+    TArray<AActor*> Items;
+    ItemIndex.GetByGameplayTag(InGameplayTag, Items);
+
+    return MoveTemp(Items);
+}
+
+TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByName_Implementation(
+    const FText& InName,
+    const bool bInCaseSensitive) const
+{
+    TArray<AActor*> Items;
+    ItemIndex.GetByName(InName, bInCaseSensitive, Items);
+
+    return MoveTemp(Items);
+}
+
+void UAGR_InventoryComponent::RefreshItemIndex(const AActor* InItem)
+{
+    ItemIndex.Refresh(InItem);
+}
+
+void UAGR_InventoryComponent::RebuildItemIndex()
+{
+    TArray<AActor*> Items;
+    GatherAttachedItems(Items);
+
+    ItemIndex.Reset();
+    for(AActor* const Item : Items)
+    {
+        AddItemToIndex(Item);
+    }
+}
+
+void UAGR_InventoryComponent::GatherAttachedItems(TArray<AActor*>& OutItems) const
+{
+    OutItems.Reset();
+
     const AActor* Owner = GetOwner();
     if(!IsValid(Owner))
     {
-        return {};
+        return;
     }
 
     const FName ItemActorTag = UAGR_InventoryFunctionLibrary::GetItemActorTag();
     if(ItemActorTag == NAME_None)
     {
-        return {};
+        return;
     }
 
-    TArray<AActor*> Items;
-
     const APawn* Instigator = Owner->GetInstigator();
     if(Owner != Instigator && IsValid(Instigator))
     {
-        Instigator->GetAttachedActors(Items);
+        Instigator->GetAttachedActors(OutItems);
     }
     else
     {
-        Owner->GetAttachedActors(Items);
+        Owner->GetAttachedActors(OutItems);
     }
 
     // Remove any actor that does not have the item actor tag
-    for(auto It = Items.CreateIterator(); It; ++It)
+    for(auto It = OutItems.CreateIterator(); It; ++It)
     {
         if(!(*It)->Tags.Contains(ItemActorTag))
         {
@@ -252,128 +459,78 @@ TArray<AActor*> UAGR_InventoryComponent::GetAllItems_Implementation() const
 
     if(!IsValid(InventoryContainer))
     {
-        return Items;
+        return;
     }
 
     // Also include items that are in an inventory's container (i.e. items attached to container).
     TArray<AActor*> ItemsInContainer;
     InventoryContainer->GetAttachedActors(ItemsInContainer);
-    Items.Append(ItemsInContainer);
-
-    return MoveTemp(Items);
+    OutItems.Append(ItemsInContainer);
 }
 
-// ReSharper disable once CppPassValueParameterByConstReference
-TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByClass_Implementation(TSubclassOf<AActor> InClass) const
+void UAGR_InventoryComponent::OnRep_InventoryContainer()
 {
-    const TArray<AActor*> AllItems = GetAllItems();
-
-    TArray<AActor*> Items;
-    UKismetArrayLibrary::FilterArray(AllItems, InClass, Items);
+    if(IsValid(InventoryContainer))
+    {
+        InventoryContainer->InventoryComponent = this;
+    }
 
-    return Items;
+    // Items may have been attached to the container or the owner before it replicated.
+    RebuildItemIndex();
 }
 
-TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByTags_Implementation(
-    const TArray<FName>& InTags,
-    const bool bInMatchAll) const
+void UAGR_InventoryComponent::OnItemAttachedToContainer(AActor* InItem) const
 {
-    const TArray<AActor*> AllItems = GetAllItems();
+    AddItemToIndex(InItem);
+}
 
-    TArray<AActor*> Items;
-    for(AActor* const Item : AllItems)
+void UAGR_InventoryComponent::OnItemDetachedFromContainer(const AActor* InItem) const
+{
+    const UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(InItem);
+    if(IsValid(ItemComponent) && ItemComponent->InventoryID == InventoryID)
     {
-        const UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(Item);
-        if(!IsValid(ItemComponent))
-        {
-            continue;
-        }
-
-        TArray<FName> ItemTags = ItemComponent->ItemTags;
-
-        bool bAllTagsMatching = true;
-        for(const FName& Tag : InTags)
-        {
-            const bool bContains = ItemTags.Contains(Tag);
-
-            if(bInMatchAll)
-            {
-                // Case: Match all tags
-                if(!bContains)
-                {
-                    bAllTagsMatching = false;
-                    break;
-                }
-            }
-            else
-            {
-                // Case: Match any tag is enough
-                if(bContains)
-                {
-                    Items.AddUnique(Item);
-                    break;
-                }
-            }
-        }
-
-        if(bInMatchAll && bAllTagsMatching)
-        {
-            Items.AddUnique(Item);
-        }
+        // Still in this inventory, e.g. equipped and attached to the owner. Dropped items clear their inventory ID.
+        return;
     }
 
-    return MoveTemp(Items);
+    RemoveItemFromIndex(InItem);
 }
 
-TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByGameplayTag_Implementation(
-    const FGameplayTag InGameplayTag) const
+void UAGR_InventoryComponent::AddItemToIndex(AActor* InItem) const
 {
-    TArray<AActor*> Items;
-    const TArray<AActor*> AllItems = GetAllItems();
-
-    for(AActor* const Item : AllItems)
+    UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(InItem);
+    if(!IsValid(ItemComponent))
     {
-        const UAGR_ItemComponent* ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(Item);
-        if(!IsValid(ItemComponent))
-        {
-            continue;
-        }
+        return;
+    }
 
-        // Order of comparison is important here. For example, we want to allow matching "A.1" by searching for "A".
-        if(ItemComponent->ItemType.MatchesTag(InGameplayTag))
-        {
-            Items.AddUnique(Item);
-        }
+    const UAGR_InventoryComponent* const PreviousInventoryComponent = ItemComponent->IndexedInventoryComponent.Get();
+    if(IsValid(PreviousInventoryComponent) && PreviousInventoryComponent != this)
+    {
+        PreviousInventoryComponent->RemoveItemFromIndex(InItem);
     }
 
-    return MoveTemp(Items);
+    ItemIndex.Add(InItem, ItemComponent);
+    ItemComponent->IndexedInventoryComponent = this;
 }
 
-TArray<AActor*> UAGR_InventoryComponent::GetAllItemsByName_Implementation(
-    const FText& InName,
-    const bool bInCaseSensitive) const
+void UAGR_InventoryComponent::RemoveItemFromIndex(const AActor* InItem) const
 {
-    TArray<AActor*> Items;
-    const TArray<AActor*> AllItems = GetAllItems();
-
-    for(AActor* const Item : AllItems)
+    if(!ItemIndex.Remove(InItem))
     {
-        const UAGR_ItemComponent* ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(Item);
-        if(!IsValid(ItemComponent))
-        {
-            continue;
-        }
+        return;
+    }
 
-        const bool bFoundMatchingName = bInCaseSensitive
-                                        ? ItemComponent->ItemName.EqualTo(InName)
-                                        : ItemComponent->ItemName.EqualToCaseIgnored(InName);
-        if(bFoundMatchingName)
-        {
-            Items.AddUnique(Item);
-        }
+    UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(InItem);
+    if(IsValid(ItemComponent) && ItemComponent->IndexedInventoryComponent == this)
+    {
+        ItemComponent->IndexedInventoryComponent.Reset();
     }
+}
 
-    return MoveTemp(Items);
+void UAGR_InventoryComponent::UpdateItemStacksInIndex(const AActor* InItem) const
+{
+    ItemIndex.RefreshStacks(InItem);
 }
 
 FTransform UAGR_InventoryComponent::CalculateDropTransform_Implementation(
@@ -467,9 +624,39 @@ bool UAGR_InventoryComponent::IsItemInInventory_Implementation(const AActor* InI
         return false;
     }
 
-    const TArray<AActor*> AllItems = GetAllItems();
+    if(ItemIndex.Contains(InItem))
+    {
+        return true;
+    }
 
-    return AllItems.Contains(InItem);
+    const UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(InItem);
+    return IsValid(ItemComponent) && ItemRecords.IndexOfItemID(ItemComponent->GetItemID()) != INDEX_NONE;
+}
+
+bool UAGR_InventoryComponent::IsItemIDInInventory_Implementation(const FString& InItemID) const
+{
+    if(InItemID.IsEmpty())
+    {
+        return false;
+    }
+
+    if(ItemRecords.IndexOfItemID(InItemID) != INDEX_NONE)
+    {
+        return true;
+    }
+
+    TArray<AActor*> Items;
+    ItemIndex.GetAll(Items);
+    for(const AActor* const Item : Items)
+    {
+        const UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(Item);
+        if(IsValid(ItemComponent) && ItemComponent->GetItemID() == InItemID)
+        {
+            return true;
+        }
+    }
+
+    return false;
 }
 
 void UAGR_InventoryComponent::SetSlot(
@@ -500,24 +687,24 @@ void UAGR_InventoryComponent::SetSlot(
         return;
     }
 
-    if(InItem == nullptr)
+    if(InItem != nullptr && !IsValid(InItem))
     {
-        // Clear the slot
-        ActiveEquipmentSlotsMap.Emplace(InSlot, InItem);
+        OutErrorMessage = "Item is invalid";
+        return;
     }
-    else
-    {
-        // Set or update the slot
-        if(!IsValid(InItem))
-        {
-            OutErrorMessage = "Item is invalid";
-            return;
-        }
 
-        ActiveEquipmentSlotsMap.Add(InSlot, InItem);
-    }
+    // Set, update or clear the slot. Only the changed slot gets replicated.
+    const TObjectPtr<AActor> OldItem = ActiveEquipmentSlotsMap.FindRef(InSlot);
+    ActiveEquipmentSlotsMap.Add(InSlot, InItem);
+    ActiveEquipmentSlotsArray.SetSlot(InSlot, InItem);
 
-    SerializeActiveEquipmentSlotsMap();
+    if(OldItem != InItem)
+    {
+        OnEquipmentSlotUpdated.Broadcast(
+            InItem,
+            InItem != nullptr ? EAGR_EquipmentSlotAction::Set : EAGR_EquipmentSlotAction::Cleared,
+            InSlot);
+    }
 
     bOutSuccess = true;
 }
@@ -565,6 +752,24 @@ void UAGR_InventoryComponent::AddStacks_Implementation(
         return;
     }
 
+    // Top up existing stacks of the same class first so that no actor has to be spawned for stacks that fit into them.
+    TArray<UAGR_ItemComponent*> ItemComponentsWithFreeStacks;
+    ItemIndex.GetItemComponentsWithFreeStacks(InItemClass, ItemComponentsWithFreeStacks);
+    for(UAGR_ItemComponent* const ItemComponent : ItemComponentsWithFreeStacks)
+    {
+        if(StacksToAdd <= 0)
+        {
+            break;
+        }
+
+        const int64 AvailableStackCount = ItemComponent->MaxStackCount - ItemComponent->GetStackCount();
+        const int64 StacksToFill = FMath::Min(AvailableStackCount, StacksToAdd);
+        ItemComponent->SetStackCount(ItemComponent->GetStackCount() + StacksToFill);
+        StacksToAdd -= StacksToFill;
+
+        OnItemUpdated.Broadcast(ItemComponent->GetOwner(), EAGR_ItemUpdateType::Updated);
+    }
+
     FActorSpawnParameters SpawnParameters;
     SpawnParameters.SpawnCollisionHandlingOverride =
         ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
@@ -704,5 +909,351 @@ void UAGR_InventoryComponent::RemoveStacks_Implementation(
         }
     }
 
+    bOutSuccess = true;
+}
+
+TArray<FAGR_ItemRecord> UAGR_InventoryComponent::GetAllItemRecords() const
+{
+    return ItemRecords.Items;
+}
+
+FAGR_ItemRecord UAGR_InventoryComponent::FindItemRecord(bool& bOutFound, const FString& InItemID) const
+{
+    const int32 RecordIndex = ItemRecords.IndexOfItemID(InItemID);
+    bOutFound = RecordIndex != INDEX_NONE;
+
+    return bOutFound ? ItemRecords.Items[RecordIndex] : FAGR_ItemRecord{};
+}
+
+// ReSharper disable once CppPassValueParameterByConstReference
+int64 UAGR_InventoryComponent::CountStacksByClass(TSubclassOf<AActor> InItemClass) const
+{
+    if(!IsValid(InItemClass))
+    {
+        return 0;
+    }
+
+    int64 StackTotal = CountAllStacks(GetAllItemsByClass(InItemClass));
+
+    for(const FAGR_ItemRecord& Record : ItemRecords.Items)
+    {
+        if(IsValid(Record.ItemClass) && Record.ItemClass->IsChildOf(InItemClass))
+        {
+            StackTotal += Record.StackCount;
+        }
+    }
+
+    return StackTotal;
+}
+
+void UAGR_InventoryComponent::VirtualizeItem_Implementation(
+    bool& bOutSuccess,
+    FString& OutErrorMessage,
+    AActor* InItem)
+{
+    bOutSuccess = false;
+    OutErrorMessage = "";
+
+    if(GetOwnerRole() != ROLE_Authority)
+    {
+        OutErrorMessage = "Should be called with authority only";
+        return;
+    }
+
+    UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(InItem);
+    if(!IsValid(ItemComponent))
+    {
+        OutErrorMessage = "Item is invalid or does not have an AGR Item component";
+        return;
+    }
+
+    if(!IsItemInInventory(InItem))
+    {
+        OutErrorMessage = "Item is not in this inventory";
+        return;
+    }
+
+    TArray<FGameplayTag> EquippedInSlots;
+    if(IsItemEquipped(EquippedInSlots, InItem))
+    {
+        OutErrorMessage = "Equipped items cannot be virtualized";
+        return;
+    }
+
+    FAGR_ItemRecord& Record = ItemRecords.Items.Add_GetRef(FAGR_ItemRecord{});
+    Record.ItemID = ItemComponent->GetItemID();
+    Record.ItemClass = InItem->GetClass();
+    Record.ItemName = ItemComponent->ItemName;
+    Record.ItemType = ItemComponent->ItemType;
+    Record.ItemTags = ItemComponent->ItemTags;
+    Record.bIsStackable = ItemComponent->bIsStackable;
+    Record.MaxStackCount = ItemComponent->MaxStackCount;
+    Record.StackCount = ItemComponent->GetStackCount();
+    AGR_InventoryComponent::CaptureInstanceData(InItem, Record.InstanceData);
+    ItemRecords.MarkItemDirty(Record);
+
+    OnItemUpdated.Broadcast(InItem, EAGR_ItemUpdateType::Virtualized);
+
+    RemoveItemFromIndex(InItem);
+    InItem->Destroy();
+
+    OnItemRecordsUpdated.Broadcast();
+
+    bOutSuccess = true;
+}
+
+void UAGR_InventoryComponent::MaterializeItem_Implementation(
+    bool& bOutSuccess,
+    FString& OutErrorMessage,
+    AActor*& OutItem,
+    const FString& InItemID)
+{
+    bOutSuccess = false;
+    OutErrorMessage = "";
+    OutItem = nullptr;
+
+    if(GetOwnerRole() != ROLE_Authority)
+    {
+        OutErrorMessage = "Should be called with authority only";
+        return;
+    }
+
+    const int32 RecordIndex = ItemRecords.IndexOfItemID(InItemID);
+    if(RecordIndex == INDEX_NONE)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Virtual item '%s' is not in this inventory"), *InItemID);
+        return;
+    }
+
+    UWorld* const World = GetWorld();
+    const AActor* Owner = GetOwner();
+    if(!IsValid(World) || !IsValid(Owner))
+    {
+        OutErrorMessage = "World or owner is invalid";
+        return;
+    }
+
+    // Copied, spawning the item runs its BeginPlay which may add or remove records and reallocate the array.
+    const FAGR_ItemRecord Record = ItemRecords.Items[RecordIndex];
+    if(!IsValid(Record.ItemClass))
+    {
+        OutErrorMessage = FString::Printf(TEXT("Virtual item '%s' has an invalid item class"), *InItemID);
+        return;
+    }
+
+    const FTransform NewItemTransform{
+        Owner->GetActorRotation(),
+        Owner->GetActorLocation(),
+        FVector::OneVector
+    };
+
+    // Restore the captured state before BeginPlay so the item starts with its original ID and data.
+    AActor* const Item = World->SpawnActorDeferred<AActor>(
+        Record.ItemClass,
+        NewItemTransform,
+        nullptr,
+        nullptr,
+        ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn);
+    if(!IsValid(Item))
+    {
+        OutErrorMessage = FString::Printf(TEXT("Could not spawn virtual item '%s'"), *InItemID);
+        return;
+    }
+
+    AGR_InventoryComponent::RestoreInstanceData(Item, Record.InstanceData);
+    Item->FinishSpawning(NewItemTransform);
+
+    UAGR_ItemComponent* const ItemComponent = UAGR_InventoryFunctionLibrary::GetItemComponent(Item);
+    if(!IsValid(ItemComponent))
+    {
+        OutErrorMessage = FString::Printf(
+            TEXT("Actor spawned using Item Class '%s' does not have an AGR Item component"),
+            *Record.ItemClass->GetName());
+        World->DestroyActor(Item);
+        return;
+    }
+
+    bool bSetItemIDSuccess = false;
+    FString SetItemIDErrorMessage;
+    ItemComponent->SetItemID(bSetItemIDSuccess, SetItemIDErrorMessage, Record.ItemID);
+    ItemComponent->SetStackCount(Record.StackCount);
+
+    // An item whose ID is a virtual item counts as already being in this inventory, so take the record out first.
+    const int32 MaterializedRecordIndex = ItemRecords.IndexOfItemID(InItemID);
+    if(MaterializedRecordIndex == INDEX_NONE)
+    {
+        World->DestroyActor(Item);
+        OutErrorMessage = FString::Printf(TEXT("Virtual item '%s' was removed while materializing it"), *InItemID);
+        return;
+    }
+
+    ItemRecords.Items.RemoveAt(MaterializedRecordIndex);
+
+    bool bPickUpItemSuccess = false;
+    FString PickUpItemErrorMessage;
+    ItemComponent->PickUpItem(
+        bPickUpItemSuccess,
+        PickUpItemErrorMessage,
+        this,
+        true,
+        false,
+        false);
+
+    if(!bPickUpItemSuccess)
+    {
+        // Put the record back unchanged so the item is neither lost nor duplicated in the world.
+        ItemRecords.Items.Insert(Record, MaterializedRecordIndex);
+        World->DestroyActor(Item);
+        OutErrorMessage = FString::Printf(
+            TEXT("Materialize item failed when picking up the item: %s"),
+            *PickUpItemErrorMessage);
+        return;
+    }
+
+    ItemRecords.MarkArrayDirty();
+
+    OnItemRecordsUpdated.Broadcast();
+
+    OnItemUpdated.Broadcast(Item, EAGR_ItemUpdateType::Materialized);
+
+    OutItem = Item;
+    bOutSuccess = true;
+}
+
+void UAGR_InventoryComponent::AddVirtualStacks_Implementation(
+    bool& bOutSuccess,
+    FString& OutErrorMessage,
+    UClass* InItemClass,
+    const int64 InStacks)
+{
+    bOutSuccess = false;
+    OutErrorMessage = "";
+
+    if(!IsValid(InItemClass))
+    {
+        OutErrorMessage = "Item class is invalid";
+        return;
+    }
+
+    if(InStacks <= 0)
+    {
+        OutErrorMessage = "Stacks to add must be greater than 0";
+        return;
+    }
+
+    if(GetOwnerRole() != ROLE_Authority)
+    {
+        OutErrorMessage = "Should be called with authority only";
+        return;
+    }
+
+    const UAGR_ItemComponent* const ItemDefaults = UAGR_InventoryFunctionLibrary::GetItemComponentDefaults(InItemClass);
+    if(!IsValid(ItemDefaults))
+    {
+        OutErrorMessage = FString::Printf(
+            TEXT("Item Class '%s' does not have an AGR Item component"),
+            *InItemClass->GetName());
+        return;
+    }
+
+    const int64 MaxStackCount = ItemDefaults->bIsStackable ? FMath::Max<int64>(ItemDefaults->MaxStackCount, 1) : 1;
+    int64 StacksToAdd = InStacks;
+
+    // Fill up existing virtual items of the same class first.
+    if(ItemDefaults->bIsStackable)
+    {
+        for(FAGR_ItemRecord& Record : ItemRecords.Items)
+        {
+            if(StacksToAdd <= 0)
+            {
+                break;
+            }
+
+            if(Record.ItemClass != InItemClass || !Record.bIsStackable)
+            {
+                continue;
+            }
+
+            const int64 AvailableStackCount = Record.MaxStackCount - Record.StackCount;
+            if(AvailableStackCount <= 0)
+            {
+                continue;
+            }
+
+            const int64 StacksToFill = FMath::Min(AvailableStackCount, StacksToAdd);
+            Record.StackCount += StacksToFill;
+            StacksToAdd -= StacksToFill;
+            ItemRecords.MarkItemDirty(Record);
+        }
+    }
+
+    while(StacksToAdd > 0)
+    {
+        FAGR_ItemRecord& Record = ItemRecords.Items.Add_GetRef(FAGR_ItemRecord{});
+        Record.ItemID = UKismetGuidLibrary::NewGuid().ToString();
+        Record.ItemClass = InItemClass;
+        Record.ItemName = ItemDefaults->ItemName;
+        Record.ItemType = ItemDefaults->ItemType;
+        Record.ItemTags = ItemDefaults->ItemTags;
+        Record.bIsStackable = ItemDefaults->bIsStackable;
+        Record.MaxStackCount = MaxStackCount;
+        Record.StackCount = FMath::Min(StacksToAdd, MaxStackCount);
+        StacksToAdd -= Record.StackCount;
+        ItemRecords.MarkItemDirty(Record);
+    }
+
+    OnItemRecordsUpdated.Broadcast();
+
+    bOutSuccess = true;
+}
+
+void UAGR_InventoryComponent::RemoveVirtualStacks_Implementation(
+    bool& bOutSuccess,
+    FString& OutErrorMessage,
+    const FString& InItemID,
+    const int64 InStacks)
+{
+    bOutSuccess = false;
+    OutErrorMessage = "";
+
+    if(InStacks <= 0)
+    {
+        OutErrorMessage = "Stacks to remove must be greater than 0";
+        return;
+    }
+
+    if(GetOwnerRole() != ROLE_Authority)
+    {
+        OutErrorMessage = "Should be called with authority only";
+        return;
+    }
+
+    const int32 RecordIndex = ItemRecords.IndexOfItemID(InItemID);
+    if(RecordIndex == INDEX_NONE)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Virtual item '%s' is not in this inventory"), *InItemID);
+        return;
+    }
+
+    FAGR_ItemRecord& Record = ItemRecords.Items[RecordIndex];
+    if(InStacks > Record.StackCount)
+    {
+        OutErrorMessage = FString::Printf(TEXT("Stacks must be in range of [1..%lld]"), Record.StackCount);
+        return;
+    }
+
+    Record.StackCount -= InStacks;
+    if(Record.StackCount > 0)
+    {
+        ItemRecords.MarkItemDirty(Record);
+    }
+    else
+    {
+        ItemRecords.Items.RemoveAt(RecordIndex);
+        ItemRecords.MarkArrayDirty();
+    }
+
+    OnItemRecordsUpdated.Broadcast();
+
     bOutSuccess = true;
 }
\ No newline at end of file
@@ -0,0 +1,60 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#include "Inventory/Components/AGR_InventoryContainerRootComponent.h"
+
+#include "Inventory/Actors/AGR_InventoryContainer.h"
+#include "Inventory/Components/AGR_InventoryComponent.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(AGR_InventoryContainerRootComponent)
+
+void UAGR_InventoryContainerRootComponent::OnChildAttached(USceneComponent* ChildComponent)
+{
+    Super::OnChildAttached(ChildComponent);
+
+    const AAGR_InventoryContainer* const Container = GetOwner<AAGR_InventoryContainer>();
+    AActor* const Item = GetChildItem(ChildComponent);
+    if(!IsValid(Container) || !IsValid(Item))
+    {
+        return;
+    }
+
+    const UAGR_InventoryComponent* const InventoryComponent = Container->InventoryComponent.Get();
+    if(IsValid(InventoryComponent))
+    {
+        InventoryComponent->OnItemAttachedToContainer(Item);
+    }
+}
+
+void UAGR_InventoryContainerRootComponent::OnChildDetached(USceneComponent* ChildComponent)
+{
+    Super::OnChildDetached(ChildComponent);
+
+    const AAGR_InventoryContainer* const Container = GetOwner<AAGR_InventoryContainer>();
+    AActor* const Item = GetChildItem(ChildComponent);
+    if(!IsValid(Container) || !IsValid(Item))
+    {
+        return;
+    }
+
+    const UAGR_InventoryComponent* const InventoryComponent = Container->InventoryComponent.Get();
+    if(IsValid(InventoryComponent))
+    {
+        InventoryComponent->OnItemDetachedFromContainer(Item);
+    }
+}
+
+AActor* UAGR_InventoryContainerRootComponent::GetChildItem(const USceneComponent* InChildComponent)
+{
+    if(!IsValid(InChildComponent))
+    {
+        return nullptr;
+    }
+
+    AActor* const Item = InChildComponent->GetOwner();
+    if(!IsValid(Item) || Item->GetRootComponent() != InChildComponent)
+    {
+        return nullptr;
+    }
+
+    return Item;
+}
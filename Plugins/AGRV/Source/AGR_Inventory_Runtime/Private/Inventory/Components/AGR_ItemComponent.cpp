@@ -52,6 +52,17 @@ void UAGR_ItemComponent::BeginPlay()
     }
 }
 
+void UAGR_ItemComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    const UAGR_InventoryComponent* const InventoryComponent = IndexedInventoryComponent.Get();
+    if(IsValid(InventoryComponent))
+    {
+        InventoryComponent->RemoveItemFromIndex(GetOwner());
+    }
+
+    Super::EndPlay(EndPlayReason);
+}
+
 void UAGR_ItemComponent::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const
 {
     Super::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -152,6 +163,7 @@ void UAGR_ItemComponent::PickUpItem_Implementation(
             false
         };
         Owner->AttachToActor(InInventoryComponent->InventoryContainer, AttachmentTransformRules);
+        InInventoryComponent->AddItemToIndex(Owner);
 
         OnItemPickedUp.Broadcast(InInventoryComponent);
         InInventoryComponent->OnItemUpdated.Broadcast(Owner, EAGR_ItemUpdateType::PickedUp);
@@ -162,17 +174,12 @@ void UAGR_ItemComponent::PickUpItem_Implementation(
     }
 
     int64 RemainingStackCount = GetStackCount();
-    // Get all items in inventory of the same class and try to stack this item with them.
-    TArray<AActor*> Items = InInventoryComponent->GetAllItemsByClass(Owner->GetClass());
-    for(const AActor* const Item : Items)
+    // Get all items in inventory of the same class that still have room and try to stack this item with them.
+    TArray<UAGR_ItemComponent*> ItemComponentsWithFreeStacks;
+    InInventoryComponent->ItemIndex.GetItemComponentsWithFreeStacks(Owner->GetClass(), ItemComponentsWithFreeStacks);
+    for(UAGR_ItemComponent* const ItemComponentToStackWith : ItemComponentsWithFreeStacks)
     {
-        UAGR_ItemComponent* const ItemComponentToStackWith =
-            UAGR_InventoryFunctionLibrary::GetItemComponent(Item);
-
-        if(!IsValid(ItemComponentToStackWith))
-        {
-            continue;
-        }
+        const AActor* const Item = ItemComponentToStackWith->GetOwner();
 
         const int64 AvailableStackCount = ItemComponentToStackWith->MaxStackCount
                                           - ItemComponentToStackWith->GetStackCount();
@@ -234,6 +241,7 @@ void UAGR_ItemComponent::PickUpItem_Implementation(
             false
         };
         Owner->AttachToActor(InInventoryComponent->InventoryContainer, AttachmentTransformRules);
+        InInventoryComponent->AddItemToIndex(Owner);
 
         OnItemPickedUp.Broadcast(InInventoryComponent);
         InInventoryComponent->OnItemUpdated.Broadcast(Owner, EAGR_ItemUpdateType::PickedUp);
@@ -511,6 +519,7 @@ void UAGR_ItemComponent::DropItem_Implementation(
         false
     };
     Owner->DetachFromActor(DetachmentTransformRules);
+    InInventoryComponent->RemoveItemFromIndex(Owner);
 
     Owner->SetActorLocationAndRotation(
         InDropLocation,
@@ -577,6 +586,7 @@ void UAGR_ItemComponent::DestroyItem_Implementation(
         false
     };
     Owner->DetachFromActor(DetachmentTransformRules);
+    InInventoryComponent->RemoveItemFromIndex(Owner);
 
     Owner->Destroy();
 
@@ -734,9 +744,76 @@ void UAGR_ItemComponent::SetStackCount(const int64 NewStackCount)
 
     const int64 OldStackCount = StackCount;
     StackCount = NewStackCount;
+
+    const UAGR_InventoryComponent* const InventoryComponent = IndexedInventoryComponent.Get();
+    if(IsValid(InventoryComponent))
+    {
+        InventoryComponent->UpdateItemStacksInIndex(GetOwner());
+    }
+
     OnRep_StackCount(OldStackCount);
 }
 
+void UAGR_ItemComponent::SetItemName(const FText& NewItemName)
+{
+    ItemName = NewItemName;
+    OnRep_ItemIndexKeys();
+}
+
+void UAGR_ItemComponent::SetItemType(const FGameplayTag& NewItemType)
+{
+    ItemType = NewItemType;
+    OnRep_ItemIndexKeys();
+}
+
+void UAGR_ItemComponent::SetItemTags(const TArray<FName>& NewItemTags)
+{
+    ItemTags = NewItemTags;
+    OnRep_ItemIndexKeys();
+}
+
+// ReSharper disable once CppMemberFunctionMayBeConst
+void UAGR_ItemComponent::OnRep_ItemIndexKeys()
+{
+    const UAGR_InventoryComponent* const InventoryComponent = IndexedInventoryComponent.Get();
+    if(IsValid(InventoryComponent))
+    {
+        InventoryComponent->ItemIndex.Refresh(GetOwner());
+    }
+}
+
+void UAGR_ItemComponent::OnRep_InventoryID()
+{
+    AActor* const Owner = GetOwner();
+    const UAGR_InventoryComponent* const IndexedInventory = IndexedInventoryComponent.Get();
+    if(IsValid(IndexedInventory))
+    {
+        if(IndexedInventory->InventoryID == InventoryID)
+        {
+            return;
+        }
+
+        IndexedInventory->RemoveItemFromIndex(Owner);
+    }
+
+    if(InventoryID.IsEmpty() || !IsValid(Owner))
+    {
+        return;
+    }
+
+    // Attachment replicates before the properties of this component, so the item is already where its inventory is.
+    const AActor* const AttachParent = Owner->GetAttachParentActor();
+    const AAGR_InventoryContainer* const Container = Cast<AAGR_InventoryContainer>(AttachParent);
+    const UAGR_InventoryComponent* const InventoryComponent = IsValid(Container)
+                                                                  ? Container->InventoryComponent.Get()
+                                                                  : UAGR_InventoryFunctionLibrary::GetInventoryComponent(
+                                                                      AttachParent);
+    if(IsValid(InventoryComponent) && InventoryComponent->InventoryID == InventoryID)
+    {
+        InventoryComponent->AddItemToIndex(Owner);
+    }
+}
+
 // ReSharper disable once CppMemberFunctionMayBeConst
 void UAGR_ItemComponent::OnRep_StackCount(const int64 OldStackCount)
 {
@@ -2,6 +2,10 @@
 
 #include "Inventory/Libs/AGR_InventoryFunctionLibrary.h"
 
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/InheritableComponentHandler.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
 #include "GameFramework/Controller.h"
 #include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerState.h"
@@ -107,4 +111,99 @@ FName UAGR_InventoryFunctionLibrary::GetItemActorTag()
     }
 
     return PluginProjectSettings->ItemActorTag;
+}
+
+const UAGR_ItemComponent* UAGR_InventoryFunctionLibrary::GetItemComponentDefaults(const UClass* InItemClass)
+{
+    if(!IsValid(InItemClass) || !InItemClass->IsChildOf(AActor::StaticClass()))
+    {
+        return nullptr;
+    }
+
+    // Try to get the item component from: Class default object (native components)
+    const UAGR_ItemComponent* const ItemComponent = GetItemComponent(
+        Cast<AActor>(InItemClass->GetDefaultObject()));
+    if(IsValid(ItemComponent))
+    {
+        return ItemComponent;
+    }
+
+    // Try to get the item component from: Blueprint construction script templates
+    for(const UBlueprintGeneratedClass* OwningClass = Cast<UBlueprintGeneratedClass>(InItemClass);
+        IsValid(OwningClass);
+        OwningClass = Cast<UBlueprintGeneratedClass>(OwningClass->GetSuperClass()))
+    {
+        if(!IsValid(OwningClass->SimpleConstructionScript))
+        {
+            continue;
+        }
+
+        for(const USCS_Node* Node : OwningClass->SimpleConstructionScript->GetAllNodes())
+        {
+            const UAGR_ItemComponent* const Template = Cast<UAGR_ItemComponent>(Node->ComponentTemplate);
+            if(!IsValid(Template))
+            {
+                continue;
+            }
+
+            // Child Blueprints may override the template of an inherited component. Prefer the most derived one.
+            const FComponentKey ComponentKey{Node};
+            for(const UBlueprintGeneratedClass* ChildClass = Cast<UBlueprintGeneratedClass>(InItemClass);
+                IsValid(ChildClass) && ChildClass != OwningClass;
+                ChildClass = Cast<UBlueprintGeneratedClass>(ChildClass->GetSuperClass()))
+            {
+                const UInheritableComponentHandler* Handler =
+                    const_cast<UBlueprintGeneratedClass*>(ChildClass)->GetInheritableComponentHandler();
+                if(Handler == nullptr)
+                {
+                    continue;
+                }
+
+                const UAGR_ItemComponent* const OverriddenTemplate = Cast<UAGR_ItemComponent>(
+                    Handler->GetOverridenComponentTemplate(ComponentKey));
+                if(IsValid(OverriddenTemplate))
+                {
+                    return OverriddenTemplate;
+                }
+            }
+
+            return Template;
+        }
+    }
+
+    return nullptr;
+}
+
+AActor* UAGR_InventoryFunctionLibrary::GetOrMaterializeItem(
+    bool& bOutSuccess,
+    FString& OutErrorMessage,
+    UAGR_InventoryComponent* InInventoryComponent,
+    const FString& InItemID)
+{
+    bOutSuccess = false;
+    OutErrorMessage = "";
+
+    if(!IsValid(InInventoryComponent))
+    {
+        OutErrorMessage = "Inventory component is invalid";
+        return nullptr;
+    }
+
+    // Try to get the item from: Item actors in inventory
+    TArray<FAGR_ItemRecord> VirtualItems;
+    for(AActor* const Item : InInventoryComponent->GetAllItems(VirtualItems))
+    {
+        const UAGR_ItemComponent* const ItemComponent = GetItemComponent(Item);
+        if(IsValid(ItemComponent) && ItemComponent->GetItemID() == InItemID)
+        {
+            bOutSuccess = true;
+            return Item;
+        }
+    }
+
+    // Try to get the item from: Virtual items in inventory
+    AActor* Item = nullptr;
+    InInventoryComponent->MaterializeItem(bOutSuccess, OutErrorMessage, Item, InItemID);
+
+    return Item;
 }
\ No newline at end of file
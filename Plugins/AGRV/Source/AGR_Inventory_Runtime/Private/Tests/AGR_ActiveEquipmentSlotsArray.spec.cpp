@@ -0,0 +1,157 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#include "Inventory/Components/AGR_InventoryComponent.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AGRTest_Slot_Head, "AGRTest.Slot.Head");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AGRTest_Slot_Chest, "AGRTest.Slot.Chest");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AGRTest_Slot_Weapon, "AGRTest.Slot.Weapon");
+
+BEGIN_DEFINE_SPEC(
+    FAGR_ActiveEquipmentSlotsArraySpec,
+    "AGR.Inventory.ActiveEquipmentSlotsArray",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+    static constexpr int32 ChangeCount = 100;
+
+    FAGR_ActiveEquipmentSlotsArray SlotsArray;
+    TArray<AActor*> Items;
+
+    /**
+     * Replication keys of every slot, in slot order. A fast array only sends the items whose key changed since the
+     * last time it was replicated to a connection.
+     */
+    TArray<int32> GetItemReplicationKeys() const
+    {
+        TArray<int32> Keys;
+        for(const FAGR_ActiveEquipmentKeyValue& Entry : SlotsArray.Items)
+        {
+            Keys.Add(Entry.ReplicationKey);
+        }
+        return Keys;
+    }
+
+    /**
+     * Number of slots a connection that last received InOutSentKeys gets sent, as the fast array only writes items whose
+     * key changed. Updates InOutSentKeys as if they were acknowledged.
+     */
+    int32 ConsumeSlotsToSend(TArray<int32>& InOutSentKeys) const
+    {
+        const TArray<int32> Keys = GetItemReplicationKeys();
+        int32 SlotsToSend = 0;
+        for(int32 Index = 0; Index < Keys.Num(); ++Index)
+        {
+            SlotsToSend += !InOutSentKeys.IsValidIndex(Index) || InOutSentKeys[Index] != Keys[Index] ? 1 : 0;
+        }
+        InOutSentKeys = Keys;
+        return SlotsToSend;
+    }
+
+END_DEFINE_SPEC(FAGR_ActiveEquipmentSlotsArraySpec)
+
+void FAGR_ActiveEquipmentSlotsArraySpec::Define()
+{
+    Describe(TEXT("Delta replication"), [this]()
+    {
+        BeforeEach([this]()
+        {
+            SlotsArray.Items.Reset();
+            SlotsArray.MarkArrayDirty();
+
+            // Items are only compared by pointer, the default objects are enough
+            Items = {
+                GetMutableDefault<AActor>(),
+                GetMutableDefault<AAGR_InventoryContainer>()
+            };
+
+            SlotsArray.SetSlot(TAG_AGRTest_Slot_Head, Items[0]);
+            SlotsArray.SetSlot(TAG_AGRTest_Slot_Chest, Items[0]);
+            SlotsArray.SetSlot(TAG_AGRTest_Slot_Weapon, nullptr);
+        });
+
+        It(TEXT("should add one item per slot and mark each one dirty"), [this]()
+        {
+            TestEqual(TEXT("Slots"), SlotsArray.Items.Num(), 3);
+
+            for(const FAGR_ActiveEquipmentKeyValue& Entry : SlotsArray.Items)
+            {
+                TestNotEqual(TEXT("Slot replication ID"), Entry.ReplicationID, INDEX_NONE);
+                TestNotEqual(TEXT("Slot replication key"), Entry.ReplicationKey, INDEX_NONE);
+            }
+        });
+
+        It(TEXT("should only dirty the slot that changed"), [this]()
+        {
+            const TArray<int32> KeysBefore = GetItemReplicationKeys();
+            const int32 ArrayKeyBefore = SlotsArray.ArrayReplicationKey;
+
+            TestTrue(TEXT("Slot changed"), SlotsArray.SetSlot(TAG_AGRTest_Slot_Chest, Items[1]));
+
+            const TArray<int32> KeysAfter = GetItemReplicationKeys();
+            if(!TestEqual(TEXT("Slots"), KeysAfter.Num(), KeysBefore.Num()))
+            {
+                return;
+            }
+
+            TestEqual(TEXT("Head slot key unchanged"), KeysAfter[0], KeysBefore[0]);
+            TestNotEqual(TEXT("Chest slot key changed"), KeysAfter[1], KeysBefore[1]);
+            TestEqual(TEXT("Weapon slot key unchanged"), KeysAfter[2], KeysBefore[2]);
+            TestNotEqual(TEXT("Array key changed"), SlotsArray.ArrayReplicationKey, ArrayKeyBefore);
+            TestTrue(TEXT("Chest slot item"), SlotsArray.Items[1].Item == Items[1]);
+        });
+
+        It(TEXT("should not dirty anything when a slot is set to the item it already holds"), [this]()
+        {
+            const TArray<int32> KeysBefore = GetItemReplicationKeys();
+            const int32 ArrayKeyBefore = SlotsArray.ArrayReplicationKey;
+
+            TestFalse(TEXT("Head slot changed"), SlotsArray.SetSlot(TAG_AGRTest_Slot_Head, Items[0]));
+            TestFalse(TEXT("Weapon slot changed"), SlotsArray.SetSlot(TAG_AGRTest_Slot_Weapon, nullptr));
+
+            TestTrue(TEXT("Slot keys unchanged"), GetItemReplicationKeys() == KeysBefore);
+            TestEqual(TEXT("Array key unchanged"), SlotsArray.ArrayReplicationKey, ArrayKeyBefore);
+        });
+
+        It(TEXT("should replicate clearing a slot as a change of that slot only"), [this]()
+        {
+            const TArray<int32> KeysBefore = GetItemReplicationKeys();
+
+            TestTrue(TEXT("Head slot cleared"), SlotsArray.SetSlot(TAG_AGRTest_Slot_Head, nullptr));
+
+            const TArray<int32> KeysAfter = GetItemReplicationKeys();
+            TestEqual(TEXT("Slots kept"), KeysAfter.Num(), 3);
+            if(KeysAfter.Num() == 3)
+            {
+                TestNotEqual(TEXT("Head slot key changed"), KeysAfter[0], KeysBefore[0]);
+                TestEqual(TEXT("Chest slot key unchanged"), KeysAfter[1], KeysBefore[1]);
+                TestEqual(TEXT("Weapon slot key unchanged"), KeysAfter[2], KeysBefore[2]);
+            }
+        });
+
+        It(TEXT("should send one slot per change instead of the whole equipment"), [this]()
+        {
+            TArray<int32> SentKeys;
+            TestEqual(TEXT("Initial slots sent"), ConsumeSlotsToSend(SentKeys), SlotsArray.Items.Num());
+
+            int32 SlotsSent = 0;
+            for(int32 Index = 0; Index < ChangeCount; ++Index)
+            {
+                SlotsArray.SetSlot(TAG_AGRTest_Slot_Chest, Items[Index % 2 ? 0 : 1]);
+                SlotsSent += ConsumeSlotsToSend(SentKeys);
+            }
+
+            // Replicating the equipment as a whole sent every slot on each change
+            TestEqual(TEXT("Slots sent"), SlotsSent, ChangeCount);
+            AddInfo(FString::Printf(
+                TEXT("%d equipment changes: %d slots sent, %d with whole equipment replication"),
+                ChangeCount,
+                SlotsSent,
+                ChangeCount * SlotsArray.Items.Num()));
+        });
+    });
+}
+
+#endif
@@ -0,0 +1,218 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#include "Components/SceneComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "Inventory/Components/AGR_InventoryComponent.h"
+#include "Inventory/Components/AGR_ItemComponent.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AGR_TestItemActor.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+BEGIN_DEFINE_SPEC(
+    FAGR_InventoryComponentSpec,
+    "AGR.Inventory.InventoryComponent",
+    EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+    UWorld* World = nullptr;
+    UAGR_InventoryComponent* InventoryComponent = nullptr;
+    TArray<FAGR_ItemRecord> VirtualItems;
+
+    /**
+     * Spawns an actor with a root component and an AGR Item component.
+     */
+    AActor* SpawnItem(const FText& InName) const
+    {
+        AActor* const Item = World->SpawnActor<AActor>();
+
+        USceneComponent* const Root = NewObject<USceneComponent>(Item, TEXT("Root"));
+        Item->SetRootComponent(Root);
+        Root->RegisterComponent();
+
+        UAGR_ItemComponent* const ItemComponent = NewObject<UAGR_ItemComponent>(Item, TEXT("Item"));
+        ItemComponent->ItemName = InName;
+        ItemComponent->RegisterComponent();
+
+        return Item;
+    }
+
+    /**
+     * Attaches the item to the inventory container directly, without any of the AGR Item component's actions.
+     */
+    void AttachToContainer(AActor* InItem) const
+    {
+        InItem->AttachToActor(
+            InventoryComponent->InventoryContainer,
+            FAttachmentTransformRules::SnapToTargetNotIncludingScale);
+    }
+
+END_DEFINE_SPEC(FAGR_InventoryComponentSpec)
+
+void FAGR_InventoryComponentSpec::Define()
+{
+    BeforeEach(
+        [this]()
+        {
+            World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("AGR_InventoryComponentSpec"));
+            FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+            WorldContext.SetCurrentWorld(World);
+            World->InitializeActorsForPlay(FURL());
+            World->BeginPlay();
+
+            AActor* const Owner = World->SpawnActor<AActor>();
+            InventoryComponent = NewObject<UAGR_InventoryComponent>(Owner, TEXT("Inventory"));
+            InventoryComponent->RegisterComponent();
+        });
+
+    AfterEach(
+        [this]()
+        {
+            AAGR_TestItemActor::BeginPlayCallback = nullptr;
+            VirtualItems.Reset();
+
+            GEngine->DestroyWorldContext(World);
+            World->DestroyWorld(false);
+            World = nullptr;
+            InventoryComponent = nullptr;
+        });
+
+    Describe(
+        "Item index",
+        [this]()
+        {
+            It(
+                "should index an item attached to the inventory container",
+                [this]()
+                {
+                    AActor* const Item = SpawnItem(FText::FromString(TEXT("Sword")));
+                    TestFalse(TEXT("Item in inventory before attaching"), InventoryComponent->IsItemInInventory(Item));
+
+                    AttachToContainer(Item);
+
+                    TestTrue(TEXT("Item in inventory"), InventoryComponent->IsItemInInventory(Item));
+                    TestEqual(TEXT("Item count"), InventoryComponent->GetAllItems(VirtualItems).Num(), 1);
+                });
+
+            It(
+                "should remove an item detached from the inventory container",
+                [this]()
+                {
+                    AActor* const Item = SpawnItem(FText::FromString(TEXT("Sword")));
+                    AttachToContainer(Item);
+
+                    Item->DetachFromActor(FDetachmentTransformRules::KeepWorldTransform);
+
+                    TestFalse(TEXT("Item in inventory"), InventoryComponent->IsItemInInventory(Item));
+                    TestEqual(TEXT("Item count"), InventoryComponent->GetAllItems(VirtualItems).Num(), 0);
+                });
+
+            It(
+                "should find an item by the name and tags set after it was indexed",
+                [this]()
+                {
+                    AActor* const Item = SpawnItem(FText::FromString(TEXT("Sword")));
+                    AttachToContainer(Item);
+
+                    UAGR_ItemComponent* const ItemComponent = Item->FindComponentByClass<UAGR_ItemComponent>();
+                    ItemComponent->SetItemName(FText::FromString(TEXT("Axe")));
+                    ItemComponent->SetItemTags({TEXT("Heavy")});
+
+                    TestEqual(
+                        TEXT("Items with the old name"),
+                        InventoryComponent->GetAllItemsByName(FText::FromString(TEXT("Sword"))).Num(),
+                        0);
+                    TestEqual(
+                        TEXT("Items with the new name"),
+                        InventoryComponent->GetAllItemsByName(FText::FromString(TEXT("Axe"))).Num(),
+                        1);
+                    TestEqual(
+                        TEXT("Items with the new tag"),
+                        InventoryComponent->GetAllItemsByTags({TEXT("Heavy")}).Num(),
+                        1);
+                });
+        });
+
+    Describe(
+        "Virtual items",
+        [this]()
+        {
+            It(
+                "should clamp the maximum stack count of added virtual items",
+                [this]()
+                {
+                    bool bSuccess = false;
+                    FString ErrorMessage;
+                    InventoryComponent->AddVirtualStacks(bSuccess, ErrorMessage, AAGR_TestItemActor::StaticClass(), 2);
+                    TestTrue(TEXT("Added stacks"), bSuccess);
+
+                    for(const FAGR_ItemRecord& Record : InventoryComponent->GetAllItemRecords())
+                    {
+                        TestEqual(TEXT("Stack count"), Record.StackCount, 1ll);
+                        TestEqual(TEXT("Max stack count"), Record.MaxStackCount, 1ll);
+                    }
+                    TestEqual(TEXT("Record count"), InventoryComponent->GetAllItemRecords().Num(), 2);
+                });
+
+            It(
+                "should report virtual items as being in the inventory",
+                [this]()
+                {
+                    bool bSuccess = false;
+                    FString ErrorMessage;
+                    InventoryComponent->AddVirtualStacks(bSuccess, ErrorMessage, AAGR_TestItemActor::StaticClass(), 1);
+                    const FString ItemID = InventoryComponent->GetAllItemRecords()[0].ItemID;
+
+                    TestEqual(TEXT("Item actors"), InventoryComponent->GetAllItems(VirtualItems).Num(), 0);
+                    TestEqual(TEXT("Virtual items"), VirtualItems.Num(), 1);
+                    TestTrue(TEXT("Virtual item in inventory"), InventoryComponent->IsItemIDInInventory(ItemID));
+
+                    AActor* Item = nullptr;
+                    InventoryComponent->MaterializeItem(bSuccess, ErrorMessage, Item, ItemID);
+                    TestTrue(TEXT("Materialized"), bSuccess);
+
+                    TestEqual(TEXT("Materialized item actors"), InventoryComponent->GetAllItems(VirtualItems).Num(), 1);
+                    TestEqual(TEXT("Materialized virtual items"), VirtualItems.Num(), 0);
+                    TestTrue(TEXT("Materialized item in inventory"), InventoryComponent->IsItemInInventory(Item));
+                    TestTrue(TEXT("Materialized item ID in inventory"), InventoryComponent->IsItemIDInInventory(ItemID));
+                });
+
+            It(
+                "should materialize the record even when spawning the item adds more records",
+                [this]()
+                {
+                    bool bSuccess = false;
+                    FString ErrorMessage;
+                    InventoryComponent->AddVirtualStacks(bSuccess, ErrorMessage, AAGR_TestItemActor::StaticClass(), 1);
+                    const FString ItemID = InventoryComponent->GetAllItemRecords()[0].ItemID;
+
+                    // Enough records to reallocate the record array while the item is spawned.
+                    AAGR_TestItemActor::BeginPlayCallback = [this]()
+                    {
+                        bool bAddSuccess = false;
+                        FString AddErrorMessage;
+                        InventoryComponent->AddVirtualStacks(
+                            bAddSuccess,
+                            AddErrorMessage,
+                            AAGR_TestItemActor::StaticClass(),
+                            64);
+                    };
+
+                    AActor* Item = nullptr;
+                    InventoryComponent->MaterializeItem(bSuccess, ErrorMessage, Item, ItemID);
+                    TestTrue(TEXT("Materialized"), bSuccess);
+
+                    const UAGR_ItemComponent* const ItemComponent = Item->FindComponentByClass<UAGR_ItemComponent>();
+                    TestEqual(TEXT("Item ID"), ItemComponent->GetItemID(), ItemID);
+                    TestEqual(TEXT("Stack count"), ItemComponent->GetStackCount(), 1ll);
+                    TestFalse(TEXT("Record removed"), InventoryComponent->GetAllItemRecords().ContainsByPredicate(
+                        [&ItemID](const FAGR_ItemRecord& InRecord)
+                        {
+                            return InRecord.ItemID == ItemID;
+                        }));
+                    TestEqual(TEXT("Added records"), InventoryComponent->GetAllItemRecords().Num(), 64);
+                });
+        });
+}
+
+#endif
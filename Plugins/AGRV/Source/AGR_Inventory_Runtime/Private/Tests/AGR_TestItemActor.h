@@ -0,0 +1,50 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+#include "GameFramework/Actor.h"
+#include "Inventory/Components/AGR_ItemComponent.h"
+
+#include "AGR_TestItemActor.generated.h"
+
+/**
+ * Stackable item actor used by specs. Its item component has no maximum stack count set, and a callback lets specs
+ * change the inventory while the item is being spawned.
+ */
+UCLASS(Transient, NotBlueprintable)
+class AAGR_TestItemActor : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    /**
+     * Called on begin play of every test item.
+     */
+    inline static TFunction<void()> BeginPlayCallback;
+
+    UPROPERTY()
+    TObjectPtr<UAGR_ItemComponent> ItemComponent;
+
+public:
+    AAGR_TestItemActor()
+    {
+        SetRootComponent(CreateDefaultSubobject<USceneComponent>("Root"));
+
+        ItemComponent = CreateDefaultSubobject<UAGR_ItemComponent>("Item");
+        ItemComponent->bIsStackable = true;
+        ItemComponent->MaxStackCount = 0;
+    }
+
+    //~ Begin AActor Interface
+    virtual void BeginPlay() override
+    {
+        Super::BeginPlay();
+
+        if(BeginPlayCallback)
+        {
+            BeginPlayCallback();
+        }
+    }
+    //~ End AActor Interface
+};
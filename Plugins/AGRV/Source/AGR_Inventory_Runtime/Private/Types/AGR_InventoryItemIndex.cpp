@@ -0,0 +1,448 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+// ReSharper disable CppTooWideScopeInitStatement
+#include "Types/AGR_InventoryItemIndex.h"
+
+#include "GameFramework/Actor.h"
+#include "Inventory/Components/AGR_ItemComponent.h"
+
+namespace AGR_InventoryItemIndex
+{
+    template <typename KeyType>
+    void AddToBucket(
+        TMap<KeyType, TArray<FAGR_InventoryItemHandle>>& InOutMap,
+        const KeyType& InKey,
+        const FAGR_InventoryItemHandle InHandle)
+    {
+        InOutMap.FindOrAdd(InKey).Add(InHandle);
+    }
+
+    template <typename KeyType>
+    void RemoveFromBucket(
+        TMap<KeyType, TArray<FAGR_InventoryItemHandle>>& InOutMap,
+        const KeyType& InKey,
+        const FAGR_InventoryItemHandle InHandle)
+    {
+        TArray<FAGR_InventoryItemHandle>* Bucket = InOutMap.Find(InKey);
+        if(Bucket == nullptr)
+        {
+            return;
+        }
+
+        // Keep insertion order so that queries and stacking behave the same as before indexing.
+        Bucket->RemoveSingle(InHandle);
+        if(Bucket->IsEmpty())
+        {
+            InOutMap.Remove(InKey);
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::Reset()
+{
+    Entries.Empty();
+    HandleByItem.Empty();
+    HandlesByClass.Empty();
+    HandlesWithFreeStacksByClass.Empty();
+    HandlesByGameplayTag.Empty();
+    HandlesByTag.Empty();
+    HandlesByName.Empty();
+}
+
+FAGR_InventoryItemHandle FAGR_InventoryItemIndex::Add(AActor* InItem, UAGR_ItemComponent* InItemComponent)
+{
+    if(!IsValid(InItem) || !IsValid(InItemComponent))
+    {
+        return INDEX_NONE;
+    }
+
+    const FAGR_InventoryItemHandle* ExistingHandle = HandleByItem.Find(InItem);
+    if(ExistingHandle != nullptr)
+    {
+        const FAGR_InventoryItemHandle Handle = *ExistingHandle;
+        Refresh(InItem);
+        return Handle;
+    }
+
+    FEntry Entry;
+    Entry.Item = InItem;
+    Entry.ItemComponent = InItemComponent;
+    Entry.Class = InItem->GetClass();
+    ReadKeys(Entry);
+
+    const FAGR_InventoryItemHandle Handle = Entries.Add(MoveTemp(Entry));
+    HandleByItem.Add(InItem, Handle);
+    Link(Handle);
+
+    return Handle;
+}
+
+bool FAGR_InventoryItemIndex::Remove(const AActor* InItem)
+{
+    FAGR_InventoryItemHandle Handle = INDEX_NONE;
+    if(!HandleByItem.RemoveAndCopyValue(InItem, Handle))
+    {
+        return false;
+    }
+
+    Unlink(Handle);
+    Entries.RemoveAt(Handle);
+
+    return true;
+}
+
+bool FAGR_InventoryItemIndex::Refresh(const AActor* InItem)
+{
+    const FAGR_InventoryItemHandle* Handle = HandleByItem.Find(InItem);
+    if(Handle == nullptr)
+    {
+        return false;
+    }
+
+    Unlink(*Handle);
+    ReadKeys(Entries[*Handle]);
+    Link(*Handle);
+
+    return true;
+}
+
+void FAGR_InventoryItemIndex::RefreshStacks(const AActor* InItem)
+{
+    const FAGR_InventoryItemHandle* Handle = HandleByItem.Find(InItem);
+    if(Handle == nullptr)
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries[*Handle];
+    const bool bHasFreeStacks = HasFreeStacks(Entry.ItemComponent.Get());
+    if(Entry.bHasFreeStacks == bHasFreeStacks)
+    {
+        return;
+    }
+
+    Entry.bHasFreeStacks = bHasFreeStacks;
+    if(bHasFreeStacks)
+    {
+        AGR_InventoryItemIndex::AddToBucket(HandlesWithFreeStacksByClass, Entry.Class, *Handle);
+    }
+    else
+    {
+        AGR_InventoryItemIndex::RemoveFromBucket(HandlesWithFreeStacksByClass, Entry.Class, *Handle);
+    }
+}
+
+bool FAGR_InventoryItemIndex::Contains(const AActor* InItem) const
+{
+    return HandleByItem.Contains(InItem);
+}
+
+int32 FAGR_InventoryItemIndex::Num() const
+{
+    return Entries.Num();
+}
+
+void FAGR_InventoryItemIndex::GetAll(TArray<AActor*>& OutItems) const
+{
+    OutItems.Reserve(OutItems.Num() + Entries.Num());
+    for(auto It = Entries.CreateConstIterator(); It; ++It)
+    {
+        AActor* const Item = ResolveItem(It.GetIndex());
+        if(Item != nullptr)
+        {
+            OutItems.Add(Item);
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::GetByClass(const UClass* InClass, TArray<AActor*>& OutItems) const
+{
+    if(!IsValid(InClass))
+    {
+        return;
+    }
+
+    // The number of distinct item classes is small compared to the number of items, so walking the class buckets and
+    // checking inheritance is cheap.
+    for(const auto& ClassBucket : HandlesByClass)
+    {
+        const UClass* const ItemClass = ClassBucket.Key.ResolveObjectPtr();
+        if(!IsValid(ItemClass) || !ItemClass->IsChildOf(InClass))
+        {
+            continue;
+        }
+
+        for(const FAGR_InventoryItemHandle Handle : ClassBucket.Value)
+        {
+            AActor* const Item = ResolveItem(Handle);
+            if(Item != nullptr)
+            {
+                OutItems.Add(Item);
+            }
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::GetByTags(
+    const TArray<FName>& InTags,
+    const bool bInMatchAll,
+    TArray<AActor*>& OutItems) const
+{
+    if(InTags.IsEmpty())
+    {
+        // Every item trivially matches all of zero tags but none of them matches any of zero tags.
+        if(bInMatchAll)
+        {
+            GetAll(OutItems);
+        }
+
+        return;
+    }
+
+    if(!bInMatchAll)
+    {
+        TSet<FAGR_InventoryItemHandle> FoundHandles;
+        for(const FName& Tag : InTags)
+        {
+            const TArray<FAGR_InventoryItemHandle>* Bucket = HandlesByTag.Find(Tag);
+            if(Bucket == nullptr)
+            {
+                continue;
+            }
+
+            for(const FAGR_InventoryItemHandle Handle : *Bucket)
+            {
+                bool bAlreadyFound = false;
+                FoundHandles.Add(Handle, &bAlreadyFound);
+                if(bAlreadyFound)
+                {
+                    continue;
+                }
+
+                AActor* const Item = ResolveItem(Handle);
+                if(Item != nullptr)
+                {
+                    OutItems.Add(Item);
+                }
+            }
+        }
+
+        return;
+    }
+
+    // Match all: start from the smallest bucket and verify the remaining tags on each candidate.
+    const TArray<FAGR_InventoryItemHandle>* SmallestBucket = nullptr;
+    for(const FName& Tag : InTags)
+    {
+        const TArray<FAGR_InventoryItemHandle>* Bucket = HandlesByTag.Find(Tag);
+        if(Bucket == nullptr)
+        {
+            return;
+        }
+
+        if(SmallestBucket == nullptr || Bucket->Num() < SmallestBucket->Num())
+        {
+            SmallestBucket = Bucket;
+        }
+    }
+
+    for(const FAGR_InventoryItemHandle Handle : *SmallestBucket)
+    {
+        const FEntry& Entry = Entries[Handle];
+
+        bool bAllTagsMatching = true;
+        for(const FName& Tag : InTags)
+        {
+            if(!Entry.Tags.Contains(Tag))
+            {
+                bAllTagsMatching = false;
+                break;
+            }
+        }
+
+        if(!bAllTagsMatching)
+        {
+            continue;
+        }
+
+        AActor* const Item = ResolveItem(Handle);
+        if(Item != nullptr)
+        {
+            OutItems.Add(Item);
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::GetByGameplayTag(const FGameplayTag& InGameplayTag, TArray<AActor*>& OutItems) const
+{
+    const TArray<FAGR_InventoryItemHandle>* Bucket = HandlesByGameplayTag.Find(InGameplayTag);
+    if(Bucket == nullptr)
+    {
+        return;
+    }
+
+    for(const FAGR_InventoryItemHandle Handle : *Bucket)
+    {
+        AActor* const Item = ResolveItem(Handle);
+        if(Item != nullptr)
+        {
+            OutItems.Add(Item);
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::GetByName(
+    const FText& InName,
+    const bool bInCaseSensitive,
+    TArray<AActor*>& OutItems) const
+{
+    const TArray<FAGR_InventoryItemHandle>* Bucket = HandlesByName.Find(InName.ToString().ToLower());
+    if(Bucket == nullptr)
+    {
+        return;
+    }
+
+    for(const FAGR_InventoryItemHandle Handle : *Bucket)
+    {
+        AActor* const Item = ResolveItem(Handle);
+        if(Item == nullptr)
+        {
+            continue;
+        }
+
+        // The bucket only narrows down the candidates. The final comparison is done with the same text comparison
+        // rules as before so culture-specific casing is still respected.
+        const UAGR_ItemComponent* const ItemComponent = Entries[Handle].ItemComponent.Get();
+        const bool bFoundMatchingName = bInCaseSensitive
+                                        ? ItemComponent->ItemName.EqualTo(InName)
+                                        : ItemComponent->ItemName.EqualToCaseIgnored(InName);
+        if(bFoundMatchingName)
+        {
+            OutItems.Add(Item);
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::GetItemComponentsWithFreeStacks(
+    const UClass* InClass,
+    TArray<UAGR_ItemComponent*>& OutItemComponents) const
+{
+    if(!IsValid(InClass))
+    {
+        return;
+    }
+
+    for(const auto& ClassBucket : HandlesWithFreeStacksByClass)
+    {
+        const UClass* const ItemClass = ClassBucket.Key.ResolveObjectPtr();
+        if(!IsValid(ItemClass) || !ItemClass->IsChildOf(InClass))
+        {
+            continue;
+        }
+
+        for(const FAGR_InventoryItemHandle Handle : ClassBucket.Value)
+        {
+            if(ResolveItem(Handle) == nullptr)
+            {
+                continue;
+            }
+
+            OutItemComponents.Add(Entries[Handle].ItemComponent.Get());
+        }
+    }
+}
+
+void FAGR_InventoryItemIndex::ReadKeys(FEntry& InOutEntry)
+{
+    InOutEntry.GameplayTagKeys.Reset();
+    InOutEntry.Tags.Reset();
+    InOutEntry.NameKey.Reset();
+    InOutEntry.bHasFreeStacks = false;
+
+    const UAGR_ItemComponent* const ItemComponent = InOutEntry.ItemComponent.Get();
+    if(!IsValid(ItemComponent))
+    {
+        return;
+    }
+
+    // Index the item type together with all of its parents. This allows matching "A.1" by searching for "A" with a
+    // single lookup.
+    if(ItemComponent->ItemType.IsValid())
+    {
+        ItemComponent->ItemType.GetGameplayTagParents().GetGameplayTagArray(InOutEntry.GameplayTagKeys);
+    }
+
+    for(const FName& Tag : ItemComponent->ItemTags)
+    {
+        InOutEntry.Tags.AddUnique(Tag);
+    }
+
+    InOutEntry.NameKey = ItemComponent->ItemName.ToString().ToLower();
+    InOutEntry.bHasFreeStacks = HasFreeStacks(ItemComponent);
+}
+
+bool FAGR_InventoryItemIndex::HasFreeStacks(const UAGR_ItemComponent* InItemComponent)
+{
+    return IsValid(InItemComponent)
+           && InItemComponent->bIsStackable
+           && InItemComponent->GetStackCount() < InItemComponent->MaxStackCount;
+}
+
+void FAGR_InventoryItemIndex::Link(const FAGR_InventoryItemHandle InHandle)
+{
+    const FEntry& Entry = Entries[InHandle];
+
+    AGR_InventoryItemIndex::AddToBucket(HandlesByClass, Entry.Class, InHandle);
+    if(Entry.bHasFreeStacks)
+    {
+        AGR_InventoryItemIndex::AddToBucket(HandlesWithFreeStacksByClass, Entry.Class, InHandle);
+    }
+
+    for(const FGameplayTag& GameplayTag : Entry.GameplayTagKeys)
+    {
+        AGR_InventoryItemIndex::AddToBucket(HandlesByGameplayTag, GameplayTag, InHandle);
+    }
+
+    for(const FName& Tag : Entry.Tags)
+    {
+        AGR_InventoryItemIndex::AddToBucket(HandlesByTag, Tag, InHandle);
+    }
+
+    AGR_InventoryItemIndex::AddToBucket(HandlesByName, Entry.NameKey, InHandle);
+}
+
+void FAGR_InventoryItemIndex::Unlink(const FAGR_InventoryItemHandle InHandle)
+{
+    const FEntry& Entry = Entries[InHandle];
+
+    AGR_InventoryItemIndex::RemoveFromBucket(HandlesByClass, Entry.Class, InHandle);
+    if(Entry.bHasFreeStacks)
+    {
+        AGR_InventoryItemIndex::RemoveFromBucket(HandlesWithFreeStacksByClass, Entry.Class, InHandle);
+    }
+
+    for(const FGameplayTag& GameplayTag : Entry.GameplayTagKeys)
+    {
+        AGR_InventoryItemIndex::RemoveFromBucket(HandlesByGameplayTag, GameplayTag, InHandle);
+    }
+
+    for(const FName& Tag : Entry.Tags)
+    {
+        AGR_InventoryItemIndex::RemoveFromBucket(HandlesByTag, Tag, InHandle);
+    }
+
+    AGR_InventoryItemIndex::RemoveFromBucket(HandlesByName, Entry.NameKey, InHandle);
+}
+
+AActor* FAGR_InventoryItemIndex::ResolveItem(const FAGR_InventoryItemHandle InHandle) const
+{
+    const FEntry& Entry = Entries[InHandle];
+
+    AActor* const Item = Entry.Item.Get();
+    if(!IsValid(Item) || !Entry.ItemComponent.IsValid())
+    {
+        return nullptr;
+    }
+
+    return Item;
+}
\ No newline at end of file
@@ -6,6 +6,8 @@
 
 #include "AGR_InventoryContainer.generated.h"
 
+class UAGR_InventoryComponent;
+
 /**
  * AGR Inventory Container is an actor that is used by the AGR Inventory and will be automatically spawned by it.
  * It is a helper actor to temporarily store instantiated item actors.
@@ -35,6 +37,11 @@ public:
         meta=(ExposeOnSpawn))
     FString InventoryID;
 
+    /**
+     * The inventory component this container stores the items of. Set by the inventory component on all machines.
+     */
+    TWeakObjectPtr<const UAGR_InventoryComponent> InventoryComponent;
+
 public:
     AAGR_InventoryContainer();
 };
\ No newline at end of file
@@ -6,20 +6,27 @@
 #include "Components/ActorComponent.h"
 #include "GameFramework/Actor.h"
 #include "Inventory/Actors/AGR_InventoryContainer.h"
+#include "Net/Serialization/FastArraySerializer.h"
+#include "Types/AGR_InventoryItemIndex.h"
 #include "Types/AGR_InventoryTypes.h"
 
 #include "AGR_InventoryComponent.generated.h"
 
+class UAGR_InventoryComponent;
+class UAGR_InventoryContainerRootComponent;
 class UAGR_ItemComponent;
+struct FAGR_ActiveEquipmentSlotsArray;
+struct FAGR_ItemRecordArray;
 
 /**
  * Holds info about which item is equipped to what slot.
  *
  * This structure is used to flatten a map key/value entry so the data can be stored in a TArray. Since UE's network
- * replication system does not support TMap we serialize/deserialize this data to/from an internal TArray this way.
+ * replication system does not support TMap we replicate every slot as an item of a fast array instead. Only slots that
+ * changed are sent and each one is applied to the map individually on receiving machines.
  */
 USTRUCT()
-struct FAGR_ActiveEquipmentKeyValue
+struct FAGR_ActiveEquipmentKeyValue : public FFastArraySerializerItem
 {
     GENERATED_BODY()
 
@@ -34,6 +41,172 @@ struct FAGR_ActiveEquipmentKeyValue
      */
     UPROPERTY()
     TObjectPtr<AActor> Item{nullptr};
+
+    //~ Begin FFastArraySerializerItem Interface
+    void PreReplicatedRemove(const FAGR_ActiveEquipmentSlotsArray& InArraySerializer) const;
+    void PostReplicatedAdd(const FAGR_ActiveEquipmentSlotsArray& InArraySerializer) const;
+    void PostReplicatedChange(const FAGR_ActiveEquipmentSlotsArray& InArraySerializer) const;
+    //~ End FFastArraySerializerItem Interface
+};
+
+/**
+ * Delta-replicated list of all equipment slots of an inventory.
+ */
+USTRUCT()
+struct FAGR_ActiveEquipmentSlotsArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    /**
+     * Replicated equipment slots.
+     */
+    UPROPERTY()
+    TArray<FAGR_ActiveEquipmentKeyValue> Items;
+
+    /**
+     * Inventory component this array belongs to.
+     */
+    UPROPERTY(NotReplicated)
+    TObjectPtr<UAGR_InventoryComponent> OwnerComponent{nullptr};
+
+    /**
+     * Sets the item of a slot, adding the slot if it does not exist yet. Only marks the slot dirty if it changed.
+     * @param InSlot Slot to set.
+     * @param InItem Item to set in slot. Null clears the slot.
+     * @return True if the slot changed. Otherwise, false.
+     */
+    bool SetSlot(const FGameplayTag InSlot, AActor* InItem);
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FAGR_ActiveEquipmentKeyValue,
+            FAGR_ActiveEquipmentSlotsArray>(Items, DeltaParms, *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FAGR_ActiveEquipmentSlotsArray> : TStructOpsTypeTraitsBase2<FAGR_ActiveEquipmentSlotsArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
+};
+
+/**
+ * Lightweight, actor-free representation of an item stored in an inventory (a "virtual" item).
+ *
+ * Virtual items do not tick, replicate as actors or need garbage collection. A record is materialized into an actor
+ * only when it needs to exist in the world, e.g. to be equipped, dropped or inspected.
+ */
+USTRUCT(BlueprintType)
+struct FAGR_ItemRecord : public FFastArraySerializerItem
+{
+    GENERATED_BODY()
+
+    /**
+     * The ID of the item. Kept when the item is virtualized or materialized.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    FString ItemID;
+
+    /**
+     * Actor class used to materialize this item.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    TSubclassOf<AActor> ItemClass;
+
+    /**
+     * Name of the item.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    FText ItemName;
+
+    /**
+     * Type of the item.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    FGameplayTag ItemType;
+
+    /**
+     * Tags of the item.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    TArray<FName> ItemTags;
+
+    /**
+     * Whether the item can be stacked or not.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    bool bIsStackable{false};
+
+    /**
+     * The maximum stack count of the item.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    int64 MaxStackCount{1};
+
+    /**
+     * The current stack count of the item.
+     */
+    UPROPERTY(BlueprintReadOnly, Category="3Studio AGR|Item", SaveGame)
+    int64 StackCount{1};
+
+    /**
+     * SaveGame properties of the item actor and its components captured when the item was virtualized. Restored when
+     * the item is materialized. Only needed with authority and therefore not replicated.
+     */
+    UPROPERTY(NotReplicated, SaveGame)
+    TArray<uint8> InstanceData;
+};
+
+/**
+ * Delta-replicated list of all virtual items of an inventory.
+ */
+USTRUCT()
+struct FAGR_ItemRecordArray : public FFastArraySerializer
+{
+    GENERATED_BODY()
+
+    /**
+     * Virtual items.
+     */
+    UPROPERTY(SaveGame)
+    TArray<FAGR_ItemRecord> Items;
+
+    /**
+     * Inventory component this array belongs to.
+     */
+    UPROPERTY(NotReplicated)
+    TObjectPtr<UAGR_InventoryComponent> OwnerComponent{nullptr};
+
+    /**
+     * Finds the index of the record with the given item ID.
+     * @param InItemID Item ID to search for.
+     * @return Index of the record or INDEX_NONE if not found.
+     */
+    int32 IndexOfItemID(const FString& InItemID) const;
+
+    //~ Begin FFastArraySerializer Interface
+    void PostReplicatedReceive(const FFastArraySerializer::FPostReplicatedReceiveParameters& Parameters) const;
+    //~ End FFastArraySerializer Interface
+
+    bool NetDeltaSerialize(FNetDeltaSerializeInfo& DeltaParms)
+    {
+        return FFastArraySerializer::FastArrayDeltaSerialize<FAGR_ItemRecord, FAGR_ItemRecordArray>(
+            Items,
+            DeltaParms,
+            *this);
+    }
+};
+
+template <>
+struct TStructOpsTypeTraits<FAGR_ItemRecordArray> : TStructOpsTypeTraitsBase2<FAGR_ItemRecordArray>
+{
+    enum
+    {
+        WithNetDeltaSerializer = true,
+    };
 };
 
 /**
@@ -52,6 +225,8 @@ class AGR_INVENTORY_RUNTIME_API UAGR_InventoryComponent : public UActorComponent
     GENERATED_BODY()
 
     friend UAGR_ItemComponent;
+    friend UAGR_InventoryContainerRootComponent;
+    friend FAGR_ActiveEquipmentKeyValue;
 
 private:
     DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(
@@ -70,6 +245,9 @@ private:
         const EAGR_ItemUpdateType,
         UpdateType);
 
+    DECLARE_DYNAMIC_MULTICAST_DELEGATE(
+        FAGR_ItemRecordsUpdated_Delegate);
+
 public:
     /**
      * Broadcast when the equipment slot was updated.
@@ -83,6 +261,12 @@ public:
     UPROPERTY(BlueprintAssignable, BlueprintAuthorityOnly)
     FAGR_ItemUpdated_Delegate OnItemUpdated;
 
+    /**
+     * Broadcast when virtual items were added, changed or removed.
+     */
+    UPROPERTY(BlueprintAssignable)
+    FAGR_ItemRecordsUpdated_Delegate OnItemRecordsUpdated;
+
     /**
      * The ID of this inventory.
      */
@@ -120,7 +304,7 @@ public:
      */
     UPROPERTY(
         BlueprintReadWrite,
-        Replicated,
+        ReplicatedUsing="OnRep_InventoryContainer",
         Category="3Studio AGR|References")
     TObjectPtr<AAGR_InventoryContainer> InventoryContainer;
 
@@ -139,8 +323,22 @@ private:
     /**
      * Internal helper array to support replication of ActiveEquipmentSlotsMap.
      */
-    UPROPERTY(ReplicatedUsing="OnRep_ActiveSlotsMapArray")
-    TArray<FAGR_ActiveEquipmentKeyValue> ActiveEquipmentSlotsArray;
+    UPROPERTY(Replicated)
+    FAGR_ActiveEquipmentSlotsArray ActiveEquipmentSlotsArray;
+
+    /**
+     * Virtual items stored in this inventory without an actor.
+     */
+    UPROPERTY(Replicated, SaveGame)
+    FAGR_ItemRecordArray ItemRecords;
+
+    /**
+     * Native index of all items in this inventory used to answer item queries without walking attached actors.
+     *
+     * The index is updated incrementally on all machines: by the AGR Item component on pick up, drop, destroy, stack
+     * and property changes, and by the inventory container whenever an item gets attached to or detached from it.
+     */
+    mutable FAGR_InventoryItemIndex ItemIndex;
 
 public:
     UAGR_InventoryComponent(const FObjectInitializer& ObjectInitializer);
@@ -179,10 +377,12 @@ public:
 
     /**
      * Gets all items in this inventory.
-     * @return Array of all items in this inventory.
+     * @param OutVirtualItems Records of all virtual items in this inventory, which have no actor to return.
+     * @return Array of all item actors in this inventory.
      */
     UFUNCTION(BlueprintCallable, BlueprintPure=false, Category="3Studio AGR|Items", BlueprintNativeEvent)
-    TArray<AActor*> GetAllItems() const;
+    TArray<AActor*> GetAllItems(
+        UPARAM(DisplayName="Virtual Items") TArray<FAGR_ItemRecord>& OutVirtualItems) const;
 
     /**
      * Gets all items filtered by class in this inventory.
@@ -245,7 +445,7 @@ public:
         UPARAM(DisplayName="Items") const TArray<AActor*>& InItems) const;
 
     /**
-     * Checks if the specified item is in this inventory.
+     * Checks if the specified item is in this inventory, either as an item actor or as a virtual item with its ID.
      * @param InItem Item to check for if it is in this inventory.
      * @return True if item is in this inventory. Otherwise, false.
      */
@@ -253,6 +453,15 @@ public:
     bool IsItemInInventory(
         UPARAM(DisplayName="Item") const AActor* InItem) const;
 
+    /**
+     * Checks if an item with the specified ID is in this inventory, either as an item actor or as a virtual item.
+     * @param InItemID ID of the item to check for if it is in this inventory.
+     * @return True if item is in this inventory. Otherwise, false.
+     */
+    UFUNCTION(BlueprintPure, Category="3Studio AGR|Helper Functions", BlueprintNativeEvent)
+    bool IsItemIDInInventory(
+        UPARAM(DisplayName="Item ID") const FString& InItemID) const;
+
     /**
      * Checks is the specified slot exists.
      * @param InSlot Slot to check if it exists.
@@ -294,7 +503,180 @@ public:
         UPARAM(DisplayName="Items", ref) TArray<AActor*>& InItems,
         UPARAM(DisplayName="Stacks") const int64 InStacks);
 
+    /**
+     * Re-reads the name, type and tags of an item that is already in this inventory and updates the item index.
+     *
+     * The setters of the AGR Item component call this automatically. Only needed after writing ItemName, ItemType or
+     * ItemTags of an item directly while it is in this inventory.
+     * @param InItem Item whose index entry to refresh.
+     */
+    UFUNCTION(BlueprintCallable, Category="3Studio AGR|Items")
+    void RefreshItemIndex(
+        UPARAM(DisplayName="Item") const AActor* InItem);
+
+    /**
+     * Rebuilds the item index from all item actors attached to the owner and the inventory container.
+     *
+     * Only needed when items were attached to this inventory without using the AGR Item component's actions, e.g. when
+     * restoring a saved game.
+     */
+    UFUNCTION(BlueprintCallable, Category="3Studio AGR|Items")
+    void RebuildItemIndex();
+
+    /**
+     * Gets all virtual items in this inventory.
+     * @return Records of all virtual items in this inventory.
+     */
+    UFUNCTION(BlueprintPure, Category="3Studio AGR|Virtual Items")
+    TArray<FAGR_ItemRecord> GetAllItemRecords() const;
+
+    /**
+     * Finds a virtual item in this inventory.
+     * @param bOutFound True if a virtual item with the given ID is in this inventory.
+     * @param InItemID ID of the item to find.
+     * @return Record of the virtual item if found. Otherwise, an empty record.
+     */
+    UFUNCTION(BlueprintPure, Category="3Studio AGR|Virtual Items")
+    FAGR_ItemRecord FindItemRecord(
+        UPARAM(DisplayName="Found") bool& bOutFound,
+        UPARAM(DisplayName="Item ID") const FString& InItemID) const;
+
+    /**
+     * Counts the stacks of all items of the given class in this inventory, both item actors and virtual items.
+     * @param InItemClass Class of the items to count stacks for.
+     * @return Total amount of stacks.
+     */
+    UFUNCTION(BlueprintPure, Category="3Studio AGR|Helper Functions")
+    int64 CountStacksByClass(
+        UPARAM(DisplayName="Item Class") TSubclassOf<AActor> InItemClass) const;
+
+    /**
+     * Turns an item actor in this inventory into a virtual item and destroys the actor.
+     *
+     * Equipped items cannot be virtualized. This function should only be called with authority.
+     * @param bOutSuccess True if the item was virtualized.
+     * @param OutErrorMessage If failed, error message, otherwise empty.
+     * @param InItem Item to virtualize.
+     */
+    UFUNCTION(
+        BlueprintCallable,
+        BlueprintAuthorityOnly,
+        Category="3Studio AGR|Virtual Items",
+        BlueprintNativeEvent)
+    void VirtualizeItem(
+        UPARAM(DisplayName="Success") bool& bOutSuccess,
+        UPARAM(DisplayName="Error Message") FString& OutErrorMessage,
+        UPARAM(DisplayName="Item") AActor* InItem);
+
+    /**
+     * Spawns the actor of a virtual item, restores its state and picks it up into this inventory.
+     *
+     * This function should only be called with authority.
+     * @param bOutSuccess True if the item was materialized.
+     * @param OutErrorMessage If failed, error message, otherwise empty.
+     * @param OutItem The materialized item actor.
+     * @param InItemID ID of the virtual item to materialize.
+     */
+    UFUNCTION(
+        BlueprintCallable,
+        BlueprintAuthorityOnly,
+        Category="3Studio AGR|Virtual Items",
+        BlueprintNativeEvent)
+    void MaterializeItem(
+        UPARAM(DisplayName="Success") bool& bOutSuccess,
+        UPARAM(DisplayName="Error Message") FString& OutErrorMessage,
+        UPARAM(DisplayName="Item") AActor*& OutItem,
+        UPARAM(DisplayName="Item ID") const FString& InItemID);
+
+    /**
+     * Adds new stacks of the specified item class to this inventory as virtual items, without spawning any actor.
+     * Existing virtual items of the same class are filled up first.
+     *
+     * This function should only be called with authority.
+     * @param bOutSuccess True if the stacks were added.
+     * @param OutErrorMessage If failed, error message, otherwise empty.
+     * @param InItemClass Class of the items to add. Must have an AGR Item component.
+     * @param InStacks Amount of items to add.
+     */
+    UFUNCTION(
+        BlueprintCallable,
+        BlueprintAuthorityOnly,
+        Category="3Studio AGR|Virtual Items",
+        BlueprintNativeEvent)
+    void AddVirtualStacks(
+        UPARAM(DisplayName="Success") bool& bOutSuccess,
+        UPARAM(DisplayName="Error Message") FString& OutErrorMessage,
+        UPARAM(DisplayName="Item Class") UClass* InItemClass,
+        UPARAM(DisplayName="Stacks") const int64 InStacks);
+
+    /**
+     * Removes stacks from a virtual item. The virtual item is removed when no stacks remain.
+     *
+     * This function should only be called with authority.
+     * @param bOutSuccess True if the stacks were removed.
+     * @param OutErrorMessage If failed, error message, otherwise empty.
+     * @param InItemID ID of the virtual item.
+     * @param InStacks Amount of items to remove. Cannot be more than the virtual item has.
+     */
+    UFUNCTION(
+        BlueprintCallable,
+        BlueprintAuthorityOnly,
+        Category="3Studio AGR|Virtual Items",
+        BlueprintNativeEvent)
+    void RemoveVirtualStacks(
+        UPARAM(DisplayName="Success") bool& bOutSuccess,
+        UPARAM(DisplayName="Error Message") FString& OutErrorMessage,
+        UPARAM(DisplayName="Item ID") const FString& InItemID,
+        UPARAM(DisplayName="Stacks") const int64 InStacks);
+
+protected:
+    /**
+     * This function will be called automatically when InventoryContainer is updated via network-replication.
+     *
+     * Links the container to this inventory and indexes the items that were attached before it arrived.
+     */
+    UFUNCTION()
+    void OnRep_InventoryContainer();
+
 private:
+    /**
+     * Gathers all item actors attached to the owner (or instigator) and to the inventory container.
+     * @param OutItems Array to fill with the found items.
+     */
+    void GatherAttachedItems(TArray<AActor*>& OutItems) const;
+
+    /**
+     * Called by the inventory container when an actor got attached to it. Adds the actor to the item index if it is an
+     * item.
+     * @param InItem Attached actor.
+     */
+    void OnItemAttachedToContainer(AActor* InItem) const;
+
+    /**
+     * Called by the inventory container when an actor got detached from it. Removes the actor from the item index unless
+     * it still belongs to this inventory (e.g. an equipped item that got attached to the owner).
+     * @param InItem Detached actor.
+     */
+    void OnItemDetachedFromContainer(const AActor* InItem) const;
+
+    /**
+     * Adds an item to the item index and removes it from the index of the inventory it was previously indexed in.
+     * @param InItem Item to add.
+     */
+    void AddItemToIndex(AActor* InItem) const;
+
+    /**
+     * Removes an item from the item index.
+     * @param InItem Item to remove.
+     */
+    void RemoveItemFromIndex(const AActor* InItem) const;
+
+    /**
+     * Updates the stacking state of an indexed item after its stack count changed.
+     * @param InItem Item whose stack count changed.
+     */
+    void UpdateItemStacksInIndex(const AActor* InItem) const;
+
     /**
      * Sets an item in the specified slot. In order to clear a slot, set the Item value to null.
      *
@@ -311,18 +693,15 @@ private:
         const FGameplayTag InSlot);
 
     /**
-     * Convert the TMap to an array of key-value pairs.
+     * Convert the TMap to the replicated array of key-value pairs.
      */
     void SerializeActiveEquipmentSlotsMap();
 
     /**
-     * Convert the array of key-value pairs back to a TMap.
+     * Applies a single replicated slot to ActiveEquipmentSlotsMap and broadcasts OnEquipmentSlotUpdated if the item in
+     * the slot changed.
+     * @param InSlot Slot that was replicated.
+     * @param InItem Item now in the slot. Null if the slot was cleared or removed.
      */
-    void DeserializeActiveEquipmentSlotsMap();
-
-    /**
-     * This function will be called automatically when ActiveEquipmentSlotsArray is updated via replication.
-     */
-    UFUNCTION()
-    void OnRep_ActiveSlotsMapArray(const TArray<FAGR_ActiveEquipmentKeyValue>& InOldValue);
+    void ApplyReplicatedSlot(const FGameplayTag InSlot, AActor* InItem);
 };
\ No newline at end of file
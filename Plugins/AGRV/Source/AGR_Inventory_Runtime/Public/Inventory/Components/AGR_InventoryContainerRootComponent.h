@@ -0,0 +1,33 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/SceneComponent.h"
+
+#include "AGR_InventoryContainerRootComponent.generated.h"
+
+/**
+ * Root component of the AGR Inventory Container.
+ *
+ * Items are stored in an inventory by attaching them to its container. This component forwards attachment changes to
+ * the inventory component of the container, so that its item index also follows items that were attached without the
+ * AGR Item component's actions (e.g. when restoring a saved game) and attachments replicated to clients.
+ */
+UCLASS(NotBlueprintable)
+class AGR_INVENTORY_RUNTIME_API UAGR_InventoryContainerRootComponent : public USceneComponent
+{
+    GENERATED_BODY()
+
+protected:
+    //~ Begin USceneComponent Interface
+    virtual void OnChildAttached(USceneComponent* ChildComponent) override;
+    virtual void OnChildDetached(USceneComponent* ChildComponent) override;
+    //~ End USceneComponent Interface
+
+private:
+    /**
+     * Gets the item actor whose root component is the given child component.
+     * @return The item actor or nullptr if the child is not the root of an actor.
+     */
+    static AActor* GetChildItem(const USceneComponent* InChildComponent);
+};
@@ -30,6 +30,8 @@ class AGR_INVENTORY_RUNTIME_API UAGR_ItemComponent : public UActorComponent
 {
     GENERATED_BODY()
 
+    friend UAGR_InventoryComponent;
+
 private:
     DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(
         FAGR_ItemChangedVisibility_Delegate,
@@ -132,36 +134,45 @@ public:
 
     /**
      * Name of this item.
+     *
+     * Use SetItemName in C++, so that the index of the inventory this item is in stays up to date.
      */
     UPROPERTY(
         BlueprintReadWrite,
+        BlueprintSetter="SetItemName",
         EditAnywhere,
         Category="3Studio AGR|Config",
-        Replicated,
+        ReplicatedUsing="OnRep_ItemIndexKeys",
         SaveGame,
         meta=(ExposeOnSpawn))
     FText ItemName;
 
     /**
      * Type of this item.
+     *
+     * Use SetItemType in C++, so that the index of the inventory this item is in stays up to date.
      */
     UPROPERTY(
         BlueprintReadWrite,
+        BlueprintSetter="SetItemType",
         EditAnywhere,
         Category="3Studio AGR|Config",
-        Replicated,
+        ReplicatedUsing="OnRep_ItemIndexKeys",
         SaveGame,
         meta=(ExposeOnSpawn))
     FGameplayTag ItemType;
 
     /**
      * Tags of this item.
+     *
+     * Use SetItemTags in C++, so that the index of the inventory this item is in stays up to date.
      */
     UPROPERTY(
         BlueprintReadWrite,
+        BlueprintSetter="SetItemTags",
         EditAnywhere,
         Category="3Studio AGR|Config",
-        Replicated,
+        ReplicatedUsing="OnRep_ItemIndexKeys",
         SaveGame,
         meta=(ExposeOnSpawn))
     TArray<FName> ItemTags;
@@ -223,7 +234,7 @@ private:
      * The ID of the inventory this item belongs to.
      */
     UPROPERTY(
-        Replicated,
+        ReplicatedUsing="OnRep_InventoryID",
         SaveGame)
     FString InventoryID;
 
@@ -235,11 +246,17 @@ private:
         SaveGame)
     FString OwnerID;
 
+    /**
+     * The inventory component whose item index currently contains this item.
+     */
+    TWeakObjectPtr<const UAGR_InventoryComponent> IndexedInventoryComponent;
+
 public:
     UAGR_ItemComponent(const FObjectInitializer& ObjectInitializer);
 
     //~ Begin UActorComponent Interface
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
     //~ End UActorComponent Interface
 
@@ -443,7 +460,49 @@ public:
     UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="3Studio AGR|Item")
     void SetStackCount(const int64 NewStackCount);
 
+    /**
+     * Sets the name of this item and updates the index of the inventory this item is in.
+     *
+     * @param NewItemName New name.
+     */
+    UFUNCTION(BlueprintCallable, Category="3Studio AGR|Item")
+    void SetItemName(const FText& NewItemName);
+
+    /**
+     * Sets the type of this item and updates the index of the inventory this item is in.
+     *
+     * @param NewItemType New type.
+     */
+    UFUNCTION(BlueprintCallable, Category="3Studio AGR|Item")
+    void SetItemType(const FGameplayTag& NewItemType);
+
+    /**
+     * Sets the tags of this item and updates the index of the inventory this item is in.
+     *
+     * @param NewItemTags New tags.
+     */
+    UFUNCTION(BlueprintCallable, Category="3Studio AGR|Item")
+    void SetItemTags(const TArray<FName>& NewItemTags);
+
 protected:
+    /**
+     * This function will be called automatically when ItemName, ItemType or ItemTags are updated via
+     * network-replication.
+     *
+     * Refreshes the entry of this item in the index of the inventory it is in.
+     */
+    UFUNCTION()
+    void OnRep_ItemIndexKeys();
+
+    /**
+     * This function will be called automatically when InventoryID is updated via network-replication.
+     *
+     * Removes this item from the index of the inventory it left, and adds it to the index of the inventory it is
+     * attached to when that inventory has the new ID.
+     */
+    UFUNCTION()
+    void OnRep_InventoryID();
+
     /**
      * This function will be called automatically when StackCount is updated via network-replication.
      * 
@@ -42,4 +42,31 @@ public:
      */
     UFUNCTION(Blueprintable, BlueprintPure, Category="3Studio AGR|Item")
     static FName GetItemActorTag();
+
+    /**
+     * Gets the default AGR Item component of an item class without spawning an actor.
+     *
+     * Components added in Blueprints only exist as construction script templates, so these are searched as well.
+     * @param InItemClass The item class from which to get the component defaults.
+     * @return Default item component or null if the class does not have one.
+     */
+    static const UAGR_ItemComponent* GetItemComponentDefaults(const UClass* InItemClass);
+
+    /**
+     * Gets an item of an inventory by its ID, whether it exists as an actor or as a virtual item. Virtual items get
+     * materialized, so the returned actor can be equipped, dropped or inspected like any other item.
+     *
+     * This function should only be called with authority.
+     * @param bOutSuccess True if the item was found.
+     * @param OutErrorMessage If failed, error message, otherwise empty.
+     * @param InInventoryComponent Inventory component containing the item.
+     * @param InItemID ID of the item.
+     * @return The item actor or null if not found.
+     */
+    UFUNCTION(BlueprintCallable, BlueprintAuthorityOnly, Category="3Studio AGR|Item")
+    static AActor* GetOrMaterializeItem(
+        UPARAM(DisplayName="Success") bool& bOutSuccess,
+        UPARAM(DisplayName="Error Message") FString& OutErrorMessage,
+        UPARAM(DisplayName="Inventory Component") UAGR_InventoryComponent* InInventoryComponent,
+        UPARAM(DisplayName="Item ID") const FString& InItemID);
 };
\ No newline at end of file
@@ -0,0 +1,150 @@
+﻿// Copyright 2024 3S Game Studio OU. All Rights Reserved.
+
+#pragma once
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "Containers/SparseArray.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class AActor;
+class UAGR_ItemComponent;
+
+/**
+ * Handle to an item stored in an AGR inventory item index.
+ */
+using FAGR_InventoryItemHandle = int32;
+
+/**
+ * Native lookup structure used by the AGR Inventory component to answer item queries without walking attached actors.
+ *
+ * Items are stored in a sparse entry array and referenced by handle from maps keyed by class, gameplay tag (including
+ * all parent tags of the item type), item tag and lowercased item name. The index is updated incrementally whenever an
+ * item is picked up, dropped, destroyed or changes its stack count, so every query costs O(result) instead of O(items).
+ */
+struct AGR_INVENTORY_RUNTIME_API FAGR_InventoryItemIndex
+{
+public:
+    /**
+     * Removes all items from this index.
+     */
+    void Reset();
+
+    /**
+     * Adds an item to this index. If the item is already indexed its entry will be refreshed instead.
+     * @param InItem Item actor to add.
+     * @param InItemComponent Item component of the item actor.
+     * @return Handle of the indexed item or INDEX_NONE if the item could not be added.
+     */
+    FAGR_InventoryItemHandle Add(AActor* InItem, UAGR_ItemComponent* InItemComponent);
+
+    /**
+     * Removes an item from this index.
+     * @param InItem Item actor to remove.
+     * @return True if the item was indexed and got removed. Otherwise, false.
+     */
+    bool Remove(const AActor* InItem);
+
+    /**
+     * Re-reads class, type, tags and name of an already indexed item and updates all lookup maps accordingly.
+     * @param InItem Item actor to refresh.
+     * @return True if the item is indexed. Otherwise, false.
+     */
+    bool Refresh(const AActor* InItem);
+
+    /**
+     * Updates only the stacking state of an already indexed item. Cheaper than a full refresh.
+     * @param InItem Item actor whose stack count changed.
+     */
+    void RefreshStacks(const AActor* InItem);
+
+    /**
+     * Checks if the item is in this index.
+     */
+    bool Contains(const AActor* InItem) const;
+
+    /**
+     * Gets the number of indexed items.
+     */
+    int32 Num() const;
+
+    /**
+     * Appends all indexed items to the output array.
+     */
+    void GetAll(TArray<AActor*>& OutItems) const;
+
+    /**
+     * Appends all indexed items that are of the given class or any of its subclasses to the output array.
+     */
+    void GetByClass(const UClass* InClass, TArray<AActor*>& OutItems) const;
+
+    /**
+     * Appends all indexed items matching the given item tags to the output array.
+     * @param InTags Item tags to search for.
+     * @param bInMatchAll If true only items that have all the tags will be returned. Otherwise, any tag is enough.
+     * @param OutItems Array to append the found items to.
+     */
+    void GetByTags(const TArray<FName>& InTags, const bool bInMatchAll, TArray<AActor*>& OutItems) const;
+
+    /**
+     * Appends all indexed items whose item type matches the given gameplay tag (including parent tags) to the output
+     * array.
+     */
+    void GetByGameplayTag(const FGameplayTag& InGameplayTag, TArray<AActor*>& OutItems) const;
+
+    /**
+     * Appends all indexed items with the given name to the output array.
+     */
+    void GetByName(const FText& InName, const bool bInCaseSensitive, TArray<AActor*>& OutItems) const;
+
+    /**
+     * Appends item components of all indexed stackable items that are of the given class (or any of its subclasses)
+     * and are not yet at their maximum stack count.
+     */
+    void GetItemComponentsWithFreeStacks(const UClass* InClass, TArray<UAGR_ItemComponent*>& OutItemComponents) const;
+
+private:
+    struct FEntry
+    {
+        TWeakObjectPtr<AActor> Item;
+        TWeakObjectPtr<UAGR_ItemComponent> ItemComponent;
+        TObjectKey<UClass> Class;
+        TArray<FGameplayTag> GameplayTagKeys;
+        TArray<FName> Tags;
+        FString NameKey;
+        bool bHasFreeStacks = false;
+    };
+
+    /**
+     * Fills all lookup keys of the entry from its item component.
+     */
+    static void ReadKeys(FEntry& InOutEntry);
+
+    /**
+     * Checks if the item component has room for more stacks.
+     */
+    static bool HasFreeStacks(const UAGR_ItemComponent* InItemComponent);
+
+    /**
+     * Adds the handle to all lookup maps using the keys stored in its entry.
+     */
+    void Link(const FAGR_InventoryItemHandle InHandle);
+
+    /**
+     * Removes the handle from all lookup maps using the keys stored in its entry.
+     */
+    void Unlink(const FAGR_InventoryItemHandle InHandle);
+
+    /**
+     * Resolves a handle to its item actor if it is still valid.
+     */
+    AActor* ResolveItem(const FAGR_InventoryItemHandle InHandle) const;
+
+    TSparseArray<FEntry> Entries;
+    TMap<TObjectKey<AActor>, FAGR_InventoryItemHandle> HandleByItem;
+    TMap<TObjectKey<UClass>, TArray<FAGR_InventoryItemHandle>> HandlesByClass;
+    TMap<TObjectKey<UClass>, TArray<FAGR_InventoryItemHandle>> HandlesWithFreeStacksByClass;
+    TMap<FGameplayTag, TArray<FAGR_InventoryItemHandle>> HandlesByGameplayTag;
+    TMap<FName, TArray<FAGR_InventoryItemHandle>> HandlesByTag;
+    TMap<FString, TArray<FAGR_InventoryItemHandle>> HandlesByName;
+};
\ No newline at end of file
@@ -34,7 +34,9 @@ enum class EAGR_ItemUpdateType : uint8
     Equipped,
     Unequipped,
     Dropped,
-    BeforeDestroy
+    BeforeDestroy,
+    Virtualized,
+    Materialized
 };
 
 ENUM_RANGE_BY_VALUES(
@@ -45,4 +47,6 @@ ENUM_RANGE_BY_VALUES(
     EAGR_ItemUpdateType::Equipped,
     EAGR_ItemUpdateType::Unequipped,
     EAGR_ItemUpdateType::Dropped,
-    EAGR_ItemUpdateType::BeforeDestroy);
\ No newline at end of file
+    EAGR_ItemUpdateType::BeforeDestroy,
+    EAGR_ItemUpdateType::Virtualized,
+    EAGR_ItemUpdateType::Materialized);
\ No newline at end of file
@@ -3,7 +3,9 @@
 
 #include "Abilities/Attributes/GSCAttributeSet.h"
 #include "GameplayEffectExtension.h"
+#include "Abilities/Attributes/GSCDamagePipeline.h"
 #include "Components/GSCCoreComponent.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
 #include "Net/UnrealNetwork.h"
 #include "GSCLog.h"
 
@@ -80,6 +82,21 @@ void UGSCAttributeSet::GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& Out
     DOREPLIFETIME_CONDITION_NOTIFY(UGSCAttributeSet, ManaRegenRate, COND_None, REPNOTIFY_Always);
 }
 
+void UGSCAttributeSet::SetDamagePipeline(const UGSCDamagePipeline* InDamagePipeline)
+{
+	DamagePipelineOverride = InDamagePipeline;
+}
+
+const UGSCDamagePipeline* UGSCAttributeSet::GetDamagePipeline() const
+{
+	if (DamagePipelineOverride)
+	{
+		return DamagePipelineOverride;
+	}
+
+	return UGSCDeveloperSettings::Get().GetDamagePipeline();
+}
+
 void UGSCAttributeSet::OnRep_Health(const FGameplayAttributeData& OldHealth)
 {
     GAMEPLAYATTRIBUTE_REPNOTIFY(UGSCAttributeSet, Health, OldHealth);
@@ -144,7 +161,7 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 	AActor* SourceActor = ExecutionData.SourceActor;
 	AActor* TargetActor = ExecutionData.TargetActor;
 	UGSCCoreComponent* TargetCoreComponent = ExecutionData.TargetCoreComponent;
-	const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+	const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 
 	// Store a local copy of the amount of Damage done and clear the Damage attribute.
 	const float LocalDamageDone = GetDamage();
@@ -167,15 +184,36 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 
 		if (bAlive)
 		{
+			// Run damage through resistances, armor, shields, etc.
+			float FinalDamage = LocalDamageDone;
+			FGSCDamageBreakdown Breakdown;
+			const UGSCDamagePipeline* DamagePipeline = GetDamagePipeline();
+			const bool bBroadcastBreakdown = DamagePipeline && DamagePipeline->bBroadcastBreakdown && TargetCoreComponent;
+
+			if (DamagePipeline)
+			{
+				FGSCDamagePipelineContext Context;
+				Context.SourceASC = ExecutionData.SourceASC;
+				Context.TargetASC = GetOwningAbilitySystemComponent();
+				Context.SourceTags = &SourceTags;
+				Context.SpecAssetTags = &ExecutionData.SpecAssetTags;
+				FinalDamage = DamagePipeline->Evaluate(Context, LocalDamageDone, bBroadcastBreakdown ? &Breakdown : nullptr);
+			}
+
 			// Apply the Health change and then clamp it.
-			const float NewHealth = GetHealth() - LocalDamageDone;
+			const float NewHealth = GetHealth() - FinalDamage;
 			const float ClampMinimumValue = GetClampMinimumValueFor(GetHealthAttribute());
 			SetHealth(FMath::Clamp(NewHealth, ClampMinimumValue, GetMaxHealth()));
 
 			if (TargetCoreComponent)
 			{
-				TargetCoreComponent->HandleDamage(LocalDamageDone, SourceTags, SourceActor);
-				TargetCoreComponent->HandleHealthChange(-LocalDamageDone, SourceTags);
+				TargetCoreComponent->HandleDamage(FinalDamage, SourceTags, SourceActor);
+				TargetCoreComponent->HandleHealthChange(-FinalDamage, SourceTags);
+
+				if (bBroadcastBreakdown)
+				{
+					TargetCoreComponent->HandleDamageBreakdown(Breakdown, SourceActor);
+				}
 			}
 		}
 	}
@@ -184,7 +222,7 @@ void UGSCAttributeSet::HandleDamageAttribute(const FGSCAttributeSetExecutionData
 void UGSCAttributeSet::HandleStaminaDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData)
 {
 	UGSCCoreComponent* TargetCoreComponent = ExecutionData.TargetCoreComponent;
-	const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+	const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 
 	// Store a local copy of the amount of damage done and clear the damage attribute
 	const float LocalStaminaDamageDone = GetStaminaDamage();
@@ -213,7 +251,7 @@ void UGSCAttributeSet::HandleHealthAttribute(const FGSCAttributeSetExecutionData
 	if (TargetCoreComponent)
 	{
 		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+		const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 		TargetCoreComponent->HandleHealthChange(DeltaValue, SourceTags);
 	}
 }
@@ -228,7 +266,7 @@ void UGSCAttributeSet::HandleStaminaAttribute(const FGSCAttributeSetExecutionDat
 	if (TargetCoreComponent)
 	{
 		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+		const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 		TargetCoreComponent->HandleStaminaChange(DeltaValue, SourceTags);
 	}
 }
@@ -243,7 +281,7 @@ void UGSCAttributeSet::HandleManaAttribute(const FGSCAttributeSetExecutionData&
 	if (TargetCoreComponent)
 	{
 		const float DeltaValue = ExecutionData.DeltaValue;
-		const FGameplayTagContainer SourceTags = ExecutionData.SourceTags;
+		const FGameplayTagContainer& SourceTags = ExecutionData.SourceTags;
 		TargetCoreComponent->HandleManaChange(DeltaValue, SourceTags);
 	}
 }
@@ -0,0 +1,119 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/Attributes/GSCDamagePipeline.h"
+
+#include "AbilitySystemComponent.h"
+#include "Math/RandomStream.h"
+
+float UGSCDamagePipeline::Evaluate(const FGSCDamagePipelineContext& InContext, const float InDamage, FGSCDamageBreakdown* OutBreakdown) const
+{
+	float Damage = FMath::Max(InDamage, 0.f);
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->IncomingDamage = Damage;
+		OutBreakdown->bCritical = false;
+		OutBreakdown->Stages.Reset(Stages.Num());
+	}
+
+	for (int32 StageIndex = 0; StageIndex < Stages.Num(); ++StageIndex)
+	{
+		const FGSCDamageStage& Stage = Stages[StageIndex];
+		if (!AreRequiredTagsMet(Stage, InContext))
+		{
+			continue;
+		}
+
+		switch (Stage.Type)
+		{
+		case EGSCDamageStageType::Multiplier:
+			Damage *= GetStageValue(Stage, InContext.TargetASC);
+			break;
+
+		case EGSCDamageStageType::CriticalHit:
+			{
+				const float Chance = FMath::Clamp(GetStageValue(Stage, InContext.SourceASC), 0.f, 1.f);
+				const float Roll = InContext.RandomStream ? InContext.RandomStream->FRand() : FMath::FRand();
+				if (Chance > 0.f && Roll < Chance)
+				{
+					Damage *= Stage.Coefficient;
+					if (OutBreakdown)
+					{
+						OutBreakdown->bCritical = true;
+					}
+				}
+			}
+			break;
+
+		case EGSCDamageStageType::Resistance:
+			Damage *= 1.f - FMath::Clamp(GetStageValue(Stage, InContext.TargetASC), 0.f, FMath::Clamp(Stage.Coefficient, 0.f, 1.f));
+			break;
+
+		case EGSCDamageStageType::Armor:
+			{
+				const float Armor = FMath::Max(GetStageValue(Stage, InContext.TargetASC), 0.f);
+				if (Stage.Coefficient > 0.f)
+				{
+					Damage *= Stage.Coefficient / (Stage.Coefficient + Armor);
+				}
+			}
+			break;
+
+		case EGSCDamageStageType::Shield:
+			{
+				const float Shield = FMath::Max(GetStageValue(Stage, InContext.TargetASC), 0.f);
+				const float Absorbed = FMath::Min(Damage, Shield);
+				Damage -= Absorbed;
+
+				// Consume the shield attribute, if that's where the value comes from
+				if (Absorbed > 0.f && Stage.Attribute.IsValid() && InContext.TargetASC && InContext.TargetASC->HasAttributeSetForAttribute(Stage.Attribute))
+				{
+					InContext.TargetASC->SetNumericAttributeBase(Stage.Attribute, InContext.TargetASC->GetNumericAttributeBase(Stage.Attribute) - Absorbed);
+				}
+			}
+			break;
+		}
+
+		Damage = FMath::Max(Damage, 0.f);
+
+		if (OutBreakdown)
+		{
+			FGSCDamageBreakdownStage& BreakdownStage = OutBreakdown->Stages.AddDefaulted_GetRef();
+			BreakdownStage.StageIndex = static_cast<uint8>(FMath::Min(StageIndex, static_cast<int32>(MAX_uint8)));
+			BreakdownStage.Type = Stage.Type;
+			BreakdownStage.DamageAfter = Damage;
+		}
+	}
+
+	if (OutBreakdown)
+	{
+		OutBreakdown->FinalDamage = Damage;
+	}
+
+	return Damage;
+}
+
+bool UGSCDamagePipeline::AreRequiredTagsMet(const FGSCDamageStage& InStage, const FGSCDamagePipelineContext& InContext)
+{
+	for (const FGameplayTag& RequiredTag : InStage.RequiredTags)
+	{
+		const bool bInSourceTags = InContext.SourceTags && InContext.SourceTags->HasTag(RequiredTag);
+		const bool bInAssetTags = InContext.SpecAssetTags && InContext.SpecAssetTags->HasTag(RequiredTag);
+		if (!bInSourceTags && !bInAssetTags)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+float UGSCDamagePipeline::GetStageValue(const FGSCDamageStage& InStage, const UAbilitySystemComponent* InASC)
+{
+	if (InStage.Attribute.IsValid() && InASC && InASC->HasAttributeSetForAttribute(InStage.Attribute))
+	{
+		return InASC->GetNumericAttribute(InStage.Attribute);
+	}
+
+	return InStage.Value;
+}
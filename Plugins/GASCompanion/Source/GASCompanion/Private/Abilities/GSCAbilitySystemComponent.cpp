@@ -81,6 +81,7 @@ void UGSCAbilitySystemComponent::BeginDestroy()
 	AddedAttributes.Reset();
 	AddedEffects.Reset();
 	AddedAbilitySets.Reset();
+	GameplayEventBindingPool.Reset(this);
 
 	Super::BeginDestroy();
 }
@@ -352,22 +353,70 @@ bool UGSCAbilitySystemComponent::ShouldGrantAbility(const TSubclassOf<UGameplayA
 		return true;
 	}
 
-	// Check for activatable abilities, if one is matching the given Ability type, prevent re adding again
-	TArray<FGameplayAbilitySpec> AbilitySpecs = GetActivatableAbilities();
-	for (const FGameplayAbilitySpec& ActivatableAbility : AbilitySpecs)
+	// If an ability is matching the given Ability type and level, prevent re adding again
+	return !IsAbilityGranted(InAbility, InLevel);
+}
+
+bool UGSCAbilitySystemComponent::IsAbilityGranted(const TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel) const
+{
+	return FindGrantedAbilityHandle(InAbility, InLevel).IsValid();
+}
+
+FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::FindGrantedAbilityHandle(const TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel) const
+{
+	if (!InAbility)
 	{
-		if (!ActivatableAbility.Ability)
-		{
-			continue;
-		}
+		return FGameplayAbilitySpecHandle();
+	}
 
-		if (ActivatableAbility.Ability->GetClass() == InAbility && ActivatableAbility.Level == InLevel)
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<1>>* Handles = GrantedAbilityRegistry.Find(InAbility.Get());
+	if (!Handles)
+	{
+		return FGameplayAbilitySpecHandle();
+	}
+
+	for (const FGameplayAbilitySpecHandle& Handle : *Handles)
+	{
+		const FGameplayAbilitySpec* AbilitySpec = FindIndexedAbilitySpec(Handle);
+		if (AbilitySpec && AbilitySpec->Level == InLevel)
 		{
-			return false;
+			return Handle;
 		}
 	}
 
-	return true;
+	return FGameplayAbilitySpecHandle();
+}
+
+FGameplayAbilitySpecHandle UGSCAbilitySystemComponent::FindAnyGrantedAbilityHandle(const TSubclassOf<UGameplayAbility> InAbility) const
+{
+	if (!InAbility)
+	{
+		return FGameplayAbilitySpecHandle();
+	}
+
+	const TArray<FGameplayAbilitySpecHandle, TInlineAllocator<1>>* Handles = GrantedAbilityRegistry.Find(InAbility.Get());
+	return Handles && !Handles->IsEmpty() ? (*Handles)[0] : FGameplayAbilitySpecHandle();
+}
+
+const FGameplayAbilitySpec* UGSCAbilitySystemComponent::FindIndexedAbilitySpec(const FGameplayAbilitySpecHandle& InHandle) const
+{
+	const TArray<FGameplayAbilitySpec>& Specs = ActivatableAbilities.Items;
+
+	const int32* SpecIndex = AbilitySpecIndices.Find(InHandle);
+	if (SpecIndex && Specs.IsValidIndex(*SpecIndex) && Specs[*SpecIndex].Handle == InHandle)
+	{
+		return &Specs[*SpecIndex];
+	}
+
+	// Specs moved since they were indexed, re-index all of them at once so that the next lookups hit again
+	AbilitySpecIndices.Reset();
+	for (int32 Index = 0; Index < Specs.Num(); ++Index)
+	{
+		AbilitySpecIndices.Add(Specs[Index].Handle, Index);
+	}
+
+	SpecIndex = AbilitySpecIndices.Find(InHandle);
+	return SpecIndex ? &Specs[*SpecIndex] : nullptr;
 }
 
 bool UGSCAbilitySystemComponent::ShouldGrantAbilitySet(const UGSCAbilitySet* InAbilitySet) const
@@ -466,10 +515,15 @@ void UGSCAbilitySystemComponent::GrantDefaultAbilitiesAndAttributes(AActor* InOw
 		if (InputComponent && InputAction)
 		{
 			// Handle for server or standalone game, clients need to bind OnGiveAbility
-			const FGameplayAbilitySpec* AbilitySpec = FindAbilitySpecFromClass(Ability);
-			if (AbilitySpec)
+			FGameplayAbilitySpecHandle GrantedHandle = FindGrantedAbilityHandle(Ability, GrantedAbility.Level);
+			if (!GrantedHandle.IsValid())
+			{
+				GrantedHandle = FindAnyGrantedAbilityHandle(Ability);
+			}
+
+			if (GrantedHandle.IsValid())
 			{
-				InputComponent->SetInputBinding(InputAction, GrantedAbility.TriggerEvent, AbilitySpec->Handle);
+				InputComponent->SetInputBinding(InputAction, GrantedAbility.TriggerEvent, GrantedHandle);
 			}
 			else
 			{
@@ -575,9 +629,44 @@ void UGSCAbilitySystemComponent::OnGiveAbility(FGameplayAbilitySpec& AbilitySpec
 {
 	Super::OnGiveAbility(AbilitySpec);
 	GSC_WLOG(Verbose, TEXT("%s"), *AbilitySpec.GetDebugString());
+
+	if (AbilitySpec.Ability)
+	{
+		GrantedAbilityRegistry.FindOrAdd(AbilitySpec.Ability->GetClass()).AddUnique(AbilitySpec.Handle);
+	}
+
+	// Abilities granted on authority are appended, others are indexed on their first lookup
+	const TArray<FGameplayAbilitySpec>& Specs = ActivatableAbilities.Items;
+	if (!Specs.IsEmpty() && Specs.Last().Handle == AbilitySpec.Handle)
+	{
+		AbilitySpecIndices.Add(AbilitySpec.Handle, Specs.Num() - 1);
+	}
+
 	OnGiveAbilityDelegate.Broadcast(AbilitySpec);
 }
 
+void UGSCAbilitySystemComponent::OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec)
+{
+	if (AbilitySpec.Ability)
+	{
+		const TObjectKey<UClass> Key(AbilitySpec.Ability->GetClass());
+		if (TArray<FGameplayAbilitySpecHandle, TInlineAllocator<1>>* Handles = GrantedAbilityRegistry.Find(Key))
+		{
+			Handles->RemoveSingleSwap(AbilitySpec.Handle);
+			if (Handles->IsEmpty())
+			{
+				GrantedAbilityRegistry.Remove(Key);
+			}
+		}
+	}
+
+	AbilitySpecIndices.Remove(AbilitySpec.Handle);
+
+	OnRemoveAbilityDelegate.Broadcast(AbilitySpec);
+
+	Super::OnRemoveAbility(AbilitySpec);
+}
+
 void UGSCAbilitySystemComponent::GrantStartupEffects()
 {
 	if (!IsOwnerActorAuthoritative())
@@ -4,9 +4,13 @@
 
 #include "GSCLog.h"
 #include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCGameplayAbility.h"
 #include "Components/GSCAbilityInputBindingComponent.h"
 #include "Components/GameFrameworkComponentManager.h"
+#include "Engine/AssetManager.h"
 #include "Engine/GameInstance.h"
+#include "Engine/StreamableManager.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 
 void FGSCAbilitySystemUtils::TryGrantAbility(UAbilitySystemComponent* InASC, const FGSCGameFeatureAbilityMapping& InAbilityMapping, FGameplayAbilitySpecHandle& OutAbilityHandle, FGameplayAbilitySpec& OutAbilitySpec)
 {
@@ -42,11 +46,7 @@ void FGSCAbilitySystemUtils::TryGrantAbility(UAbilitySystemComponent* InASC, con
 		else
 		{
 			// In case granting is prevented because of ability already existing, return the existing handle
-			const FGameplayAbilitySpec* ExistingAbilitySpec = ASC->FindAbilitySpecFromClass(AbilityType);
-			if (ExistingAbilitySpec)
-			{
-				OutAbilityHandle = ExistingAbilitySpec->Handle;
-			}
+			OutAbilityHandle = ASC->FindGrantedAbilityHandle(AbilityType, InAbilityMapping.Level);
 		}
 	}
 	else
@@ -298,11 +298,43 @@ bool FGSCAbilitySystemUtils::TryGrantAbilitySet(UAbilitySystemComponent* InASC,
 		OutAbilitySetHandle.OwnedTags = InAbilitySet->OwnedTags;
 	}
 	
+	// Start loading what granted abilities will need on activation, so that first activation doesn't hitch
+	OutAbilitySetHandle.PreloadHandle = TryPreloadAbilitySetAssets(InAbilitySet);
+	
 	// Store the name of the Ability Set "instigator"
 	OutAbilitySetHandle.AbilitySetPathName = InAbilitySet->GetPathName();
 	return true;
 }
 
+TSharedPtr<FStreamableHandle> FGSCAbilitySystemUtils::TryPreloadAbilitySetAssets(const UGSCAbilitySet* InAbilitySet)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGSCAbilitySystemUtils::TryPreloadAbilitySetAssets);
+
+	if (!InAbilitySet || !InAbilitySet->bPreloadAbilityAssets)
+	{
+		return nullptr;
+	}
+
+	TArray<FSoftObjectPath> AssetPaths;
+	for (const FGSCGameFeatureAbilityMapping& AbilityMapping : InAbilitySet->GrantedAbilities)
+	{
+		// Ability classes have been loaded when granting abilities, only query the ones that are
+		const UClass* AbilityType = AbilityMapping.AbilityType.Get();
+		if (const UGSCGameplayAbility* AbilityCDO = AbilityType ? Cast<UGSCGameplayAbility>(AbilityType->GetDefaultObject()) : nullptr)
+		{
+			AbilityCDO->GetAssetsToPreload(AssetPaths);
+		}
+	}
+
+	if (AssetPaths.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	GSC_PLOG(Verbose, TEXT("Preloading %d asset(s) for ability set %s"), AssetPaths.Num(), *GetNameSafe(InAbilitySet));
+	return UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(AssetPaths), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+}
+
 UAttributeSet* FGSCAbilitySystemUtils::GetAttributeSet(const UAbilitySystemComponent* InASC, const TSubclassOf<UAttributeSet> InAttributeSet)
 {
 	check(InASC);
@@ -336,10 +368,15 @@ bool FGSCAbilitySystemUtils::HasGameplayEffectApplied(const UAbilitySystemCompon
 bool FGSCAbilitySystemUtils::IsAbilityGranted(const UAbilitySystemComponent* InASC, TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel)
 {
 	check(InASC);
+
+	// GSC ASCs keep a registry of granted abilities by class and level
+	if (const UGSCAbilitySystemComponent* GSCASC = Cast<UGSCAbilitySystemComponent>(InASC))
+	{
+		return GSCASC->IsAbilityGranted(InAbility, InLevel);
+	}
 	
 	// Check for activatable abilities, if one is matching the given Ability type, prevent re adding again
-	TArray<FGameplayAbilitySpec> AbilitySpecs = InASC->GetActivatableAbilities();
-	for (const FGameplayAbilitySpec& ActivatableAbility : AbilitySpecs)
+	for (const FGameplayAbilitySpec& ActivatableAbility : InASC->GetActivatableAbilities())
 	{
 		if (!ActivatableAbility.Ability)
 		{
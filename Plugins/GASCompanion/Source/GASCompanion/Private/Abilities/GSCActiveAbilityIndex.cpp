@@ -0,0 +1,227 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCActiveAbilityIndex.h"
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GameplayAbility.h"
+#include "Misc/EngineVersionComparison.h"
+
+void FGSCActiveAbilityIndex::Reset()
+{
+	AbilitiesByClass.Reset();
+	AbilitiesByTag.Reset();
+}
+
+void FGSCActiveAbilityIndex::Rebuild(const UAbilitySystemComponent& InASC)
+{
+	Reset();
+
+	for (const FGameplayAbilitySpec& Spec : InASC.GetActivatableAbilities())
+	{
+		if (!Spec.Ability)
+		{
+			continue;
+		}
+
+		// Iterate all instances on this ability spec, which can include instance per execution abilities
+		for (UGameplayAbility* Instance : Spec.GetAbilityInstances())
+		{
+			if (Instance && Instance->IsActive())
+			{
+				Add(Instance);
+			}
+		}
+	}
+}
+
+void FGSCActiveAbilityIndex::Add(UGameplayAbility* InAbility)
+{
+	if (!InAbility || !InAbility->IsInstantiated() || !InAbility->IsActive())
+	{
+		return;
+	}
+
+	FAbilityBucket& ClassBucket = AbilitiesByClass.FindOrAdd(InAbility->GetClass());
+	if (ClassBucket.Contains(InAbility))
+	{
+		return;
+	}
+
+	ClassBucket.Add(InAbility);
+
+	// Register under every tag and every parent of those tags, so that a query for "Ability.Melee" finds an ability tagged "Ability.Melee.Light"
+	TSet<FGameplayTag> TagKeys;
+	for (const FGameplayTag& AbilityTag : GetAbilityTags(InAbility))
+	{
+		for (const FGameplayTag& TagKey : AbilityTag.GetGameplayTagParents())
+		{
+			TagKeys.Add(TagKey);
+		}
+	}
+
+	for (const FGameplayTag& TagKey : TagKeys)
+	{
+		AbilitiesByTag.FindOrAdd(TagKey).Add(InAbility);
+	}
+}
+
+void FGSCActiveAbilityIndex::Remove(const UGameplayAbility* InAbility)
+{
+	if (!InAbility)
+	{
+		return;
+	}
+
+	RemoveFromBucket(AbilitiesByClass, TObjectKey<UClass>(InAbility->GetClass()), InAbility);
+
+	for (const FGameplayTag& AbilityTag : GetAbilityTags(InAbility))
+	{
+		for (const FGameplayTag& TagKey : AbilityTag.GetGameplayTagParents())
+		{
+			RemoveFromBucket(AbilitiesByTag, TagKey, InAbility);
+		}
+	}
+}
+
+void FGSCActiveAbilityIndex::GetByClass(const UClass* InAbilityClass, TArray<UGameplayAbility*>& OutAbilities) const
+{
+	if (!InAbilityClass)
+	{
+		return;
+	}
+
+	// Only classes with a running instance have a bucket, so this loop is bound by the number of active abilities
+	for (const TPair<TObjectKey<UClass>, FAbilityBucket>& Pair : AbilitiesByClass)
+	{
+		const UClass* AbilityClass = Pair.Key.ResolveObjectPtr();
+		if (!AbilityClass || !AbilityClass->IsChildOf(InAbilityClass))
+		{
+			continue;
+		}
+
+		for (const TWeakObjectPtr<UGameplayAbility>& Ability : Pair.Value)
+		{
+			if (UGameplayAbility* ActiveAbility = ResolveActive(Ability))
+			{
+				OutAbilities.Add(ActiveAbility);
+			}
+		}
+	}
+}
+
+void FGSCActiveAbilityIndex::GetByTags(const FGameplayTagContainer& InAbilityTags, TArray<UGameplayAbility*>& OutAbilities) const
+{
+	// Empty container matches every ability, same as UAbilitySystemComponent::GetActivatableGameplayAbilitySpecsByAllMatchingTags()
+	if (InAbilityTags.IsEmpty())
+	{
+		GetByClass(UGameplayAbility::StaticClass(), OutAbilities);
+		return;
+	}
+
+	// Any matching ability has to be in the bucket of the first tag, only check those against the remaining tags
+	const FAbilityBucket* Bucket = AbilitiesByTag.Find(InAbilityTags.GetByIndex(0));
+	if (!Bucket)
+	{
+		return;
+	}
+
+	for (const TWeakObjectPtr<UGameplayAbility>& Ability : *Bucket)
+	{
+		UGameplayAbility* ActiveAbility = ResolveActive(Ability);
+		if (ActiveAbility && GetAbilityTags(ActiveAbility).HasAll(InAbilityTags))
+		{
+			OutAbilities.Add(ActiveAbility);
+		}
+	}
+}
+
+bool FGSCActiveAbilityIndex::HasAnyByClass(const UClass* InAbilityClass) const
+{
+	if (!InAbilityClass)
+	{
+		return false;
+	}
+
+	for (const TPair<TObjectKey<UClass>, FAbilityBucket>& Pair : AbilitiesByClass)
+	{
+		const UClass* AbilityClass = Pair.Key.ResolveObjectPtr();
+		if (!AbilityClass || !AbilityClass->IsChildOf(InAbilityClass))
+		{
+			continue;
+		}
+
+		for (const TWeakObjectPtr<UGameplayAbility>& Ability : Pair.Value)
+		{
+			if (ResolveActive(Ability))
+			{
+				return true;
+			}
+		}
+	}
+
+	return false;
+}
+
+bool FGSCActiveAbilityIndex::HasAnyByTags(const FGameplayTagContainer& InAbilityTags) const
+{
+	if (InAbilityTags.IsEmpty())
+	{
+		return HasAnyByClass(UGameplayAbility::StaticClass());
+	}
+
+	const FAbilityBucket* Bucket = AbilitiesByTag.Find(InAbilityTags.GetByIndex(0));
+	if (!Bucket)
+	{
+		return false;
+	}
+
+	for (const TWeakObjectPtr<UGameplayAbility>& Ability : *Bucket)
+	{
+		const UGameplayAbility* ActiveAbility = ResolveActive(Ability);
+		if (ActiveAbility && GetAbilityTags(ActiveAbility).HasAll(InAbilityTags))
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+const FGameplayTagContainer& FGSCActiveAbilityIndex::GetAbilityTags(const UGameplayAbility* InAbility)
+{
+	check(InAbility);
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	return InAbility->AbilityTags;
+#else
+	return InAbility->GetAssetTags();
+#endif
+}
+
+UGameplayAbility* FGSCActiveAbilityIndex::ResolveActive(const TWeakObjectPtr<UGameplayAbility>& InAbility)
+{
+	UGameplayAbility* Ability = InAbility.Get();
+	return Ability && Ability->IsActive() ? Ability : nullptr;
+}
+
+template<typename KeyType>
+void FGSCActiveAbilityIndex::RemoveFromBucket(TMap<KeyType, FAbilityBucket>& InMap, const KeyType& InKey, const UGameplayAbility* InAbility)
+{
+	FAbilityBucket* Bucket = InMap.Find(InKey);
+	if (!Bucket)
+	{
+		return;
+	}
+
+	// Also drop entries for instances that were garbage collected or ended without the ASC notifying us
+	Bucket->RemoveAllSwap([InAbility](const TWeakObjectPtr<UGameplayAbility>& Ability)
+	{
+		const UGameplayAbility* TrackedAbility = Ability.Get();
+		return !TrackedAbility || TrackedAbility == InAbility || !TrackedAbility->IsActive();
+	});
+
+	if (Bucket->IsEmpty())
+	{
+		InMap.Remove(InKey);
+	}
+}
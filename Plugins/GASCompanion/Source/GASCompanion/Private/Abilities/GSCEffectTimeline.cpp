@@ -0,0 +1,276 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCEffectTimeline.h"
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "Abilities/GameplayAbility.h"
+
+void FGSCEffectTimeline::Reset()
+{
+	Entries.Reset();
+	StatesByTag.Reset();
+	CooldownStatesByAbilityClass.Reset();
+}
+
+void FGSCEffectTimeline::Rebuild(const UAbilitySystemComponent& InASC)
+{
+	Reset();
+
+	for (FActiveGameplayEffectsContainer::ConstIterator It = InASC.GetActiveGameplayEffects().CreateConstIterator(); It; ++It)
+	{
+		if (!It->IsPendingRemove)
+		{
+			Add(*It);
+		}
+	}
+}
+
+const FGSCEffectTimeline::FEntry* FGSCEffectTimeline::Add(const FActiveGameplayEffect& InEffect)
+{
+	const UGameplayEffect* EffectDef = InEffect.Spec.Def;
+	if (!EffectDef || EffectDef->DurationPolicy == EGameplayEffectDurationType::Instant)
+	{
+		return nullptr;
+	}
+
+	if (Entries.Contains(InEffect.Handle))
+	{
+		Remove(InEffect.Handle);
+	}
+
+	FEntry Entry;
+	Entry.Handle = InEffect.Handle;
+	InEffect.Spec.GetAllAssetTags(Entry.AssetTags);
+	InEffect.Spec.GetAllGrantedTags(Entry.GrantedTags);
+	Entry.StartTime = InEffect.StartWorldTime;
+	Entry.Duration = InEffect.GetDuration() == FGameplayEffectConstants::INFINITE_DURATION ? -1.f : InEffect.GetDuration();
+
+	// Cooldowns are applied with an effect context referencing the committed ability
+	const UGameplayAbility* Ability = InEffect.Spec.GetContext().GetAbility();
+	if (Ability && Ability->GetCooldownGameplayEffect() == EffectDef)
+	{
+		Entry.CooldownAbility = Ability;
+	}
+
+	const FEntry& AddedEntry = Entries.Add(InEffect.Handle, MoveTemp(Entry));
+	Link(AddedEntry);
+	return &AddedEntry;
+}
+
+void FGSCEffectTimeline::UpdateTime(const FActiveGameplayEffectHandle InHandle, const float InStartTime, const float InDuration)
+{
+	FEntry Entry;
+	if (!Remove(InHandle, &Entry))
+	{
+		return;
+	}
+
+	Entry.StartTime = InStartTime;
+	Entry.Duration = InDuration == FGameplayEffectConstants::INFINITE_DURATION ? -1.f : InDuration;
+
+	const FEntry& UpdatedEntry = Entries.Add(InHandle, MoveTemp(Entry));
+	Link(UpdatedEntry);
+}
+
+bool FGSCEffectTimeline::Remove(const FActiveGameplayEffectHandle InHandle, FEntry* OutEntry)
+{
+	const FEntry* Entry = Entries.Find(InHandle);
+	if (!Entry)
+	{
+		return false;
+	}
+
+	Unlink(*Entry);
+
+	if (OutEntry)
+	{
+		*OutEntry = MoveTemp(*const_cast<FEntry*>(Entry));
+	}
+
+	Entries.Remove(InHandle);
+	return true;
+}
+
+const FGSCEffectTimeline::FEntry* FGSCEffectTimeline::Find(const FActiveGameplayEffectHandle InHandle) const
+{
+	return Entries.Find(InHandle);
+}
+
+void FGSCEffectTimeline::GetHandles(TArray<FActiveGameplayEffectHandle>& OutHandles) const
+{
+	OutHandles.Reserve(OutHandles.Num() + Entries.Num());
+	for (const TPair<FActiveGameplayEffectHandle, FEntry>& Entry : Entries)
+	{
+		OutHandles.Add(Entry.Key);
+	}
+}
+
+int32 FGSCEffectTimeline::Num() const
+{
+	return Entries.Num();
+}
+
+bool FGSCEffectTimeline::HasTag(const FGameplayTag& InTag) const
+{
+	return StatesByTag.Contains(InTag);
+}
+
+bool FGSCEffectTimeline::GetTimeRemainingAndDuration(const FGameplayTag& InTag, const float InWorldTime, float& OutTimeRemaining, float& OutDuration) const
+{
+	OutTimeRemaining = 0.f;
+	OutDuration = 0.f;
+
+	const FKeyState* State = StatesByTag.Find(InTag);
+	return State && GetStateTimeRemainingAndDuration(*State, InWorldTime, OutTimeRemaining, OutDuration);
+}
+
+bool FGSCEffectTimeline::GetTimeRemainingAndDuration(const FGameplayTagContainer& InTags, const float InWorldTime, float& OutTimeRemaining, float& OutDuration) const
+{
+	OutTimeRemaining = 0.f;
+	OutDuration = 0.f;
+
+	bool bFound = false;
+	for (const FGameplayTag& Tag : InTags)
+	{
+		float TimeRemaining = 0.f;
+		float Duration = 0.f;
+		if (!GetTimeRemainingAndDuration(Tag, InWorldTime, TimeRemaining, Duration))
+		{
+			continue;
+		}
+
+		if (!bFound || TimeRemaining > OutTimeRemaining)
+		{
+			OutTimeRemaining = TimeRemaining;
+			OutDuration = Duration;
+		}
+
+		bFound = true;
+	}
+
+	return bFound;
+}
+
+bool FGSCEffectTimeline::GetCooldownTimeRemainingAndDuration(const UClass* InAbilityClass, const float InWorldTime, float& OutTimeRemaining, float& OutDuration) const
+{
+	OutTimeRemaining = 0.f;
+	OutDuration = 0.f;
+
+	const FKeyState* State = CooldownStatesByAbilityClass.Find(InAbilityClass);
+	return State && GetStateTimeRemainingAndDuration(*State, InWorldTime, OutTimeRemaining, OutDuration);
+}
+
+void FGSCEffectTimeline::Link(const FEntry& InEntry)
+{
+	TSet<FGameplayTag> TagKeys;
+	GetTagKeys(InEntry, TagKeys);
+	for (const FGameplayTag& TagKey : TagKeys)
+	{
+		AddToState(StatesByTag, TagKey, InEntry);
+	}
+
+	if (const UGameplayAbility* CooldownAbility = InEntry.CooldownAbility.Get())
+	{
+		AddToState(CooldownStatesByAbilityClass, TObjectKey<UClass>(CooldownAbility->GetClass()), InEntry);
+	}
+}
+
+void FGSCEffectTimeline::Unlink(const FEntry& InEntry)
+{
+	TSet<FGameplayTag> TagKeys;
+	GetTagKeys(InEntry, TagKeys);
+	for (const FGameplayTag& TagKey : TagKeys)
+	{
+		RemoveFromState(StatesByTag, TagKey, InEntry.Handle);
+	}
+
+	if (const UGameplayAbility* CooldownAbility = InEntry.CooldownAbility.Get())
+	{
+		RemoveFromState(CooldownStatesByAbilityClass, TObjectKey<UClass>(CooldownAbility->GetClass()), InEntry.Handle);
+	}
+}
+
+void FGSCEffectTimeline::RecomputeState(FKeyState& InState) const
+{
+	InState.StartTime = 0.f;
+	InState.Duration = -1.f;
+	InState.bHasFiniteEffect = false;
+
+	for (const FActiveGameplayEffectHandle& Handle : InState.Handles)
+	{
+		const FEntry* Entry = Entries.Find(Handle);
+		if (!Entry || Entry->IsInfinite())
+		{
+			continue;
+		}
+
+		if (!InState.bHasFiniteEffect || Entry->GetEndTime() > InState.StartTime + InState.Duration)
+		{
+			InState.StartTime = Entry->StartTime;
+			InState.Duration = Entry->Duration;
+			InState.bHasFiniteEffect = true;
+		}
+	}
+}
+
+template<typename KeyType>
+void FGSCEffectTimeline::AddToState(TMap<KeyType, FKeyState>& InMap, const KeyType& InKey, const FEntry& InEntry)
+{
+	FKeyState& State = InMap.FindOrAdd(InKey);
+	State.Handles.Add(InEntry.Handle);
+
+	// Only the effect ending last matters, no need to go through all of them
+	if (!InEntry.IsInfinite() && (!State.bHasFiniteEffect || InEntry.GetEndTime() > State.StartTime + State.Duration))
+	{
+		State.StartTime = InEntry.StartTime;
+		State.Duration = InEntry.Duration;
+		State.bHasFiniteEffect = true;
+	}
+}
+
+template<typename KeyType>
+void FGSCEffectTimeline::RemoveFromState(TMap<KeyType, FKeyState>& InMap, const KeyType& InKey, const FActiveGameplayEffectHandle InHandle)
+{
+	FKeyState* State = InMap.Find(InKey);
+	if (!State)
+	{
+		return;
+	}
+
+	State->Handles.RemoveSingleSwap(InHandle);
+	if (State->Handles.IsEmpty())
+	{
+		InMap.Remove(InKey);
+		return;
+	}
+
+	RecomputeState(*State);
+}
+
+bool FGSCEffectTimeline::GetStateTimeRemainingAndDuration(const FKeyState& InState, const float InWorldTime, float& OutTimeRemaining, float& OutDuration)
+{
+	if (!InState.bHasFiniteEffect)
+	{
+		// Only infinite effects, same as UAbilitySystemComponent::GetActiveEffectsTimeRemainingAndDuration()
+		OutTimeRemaining = -1.f;
+		OutDuration = -1.f;
+		return true;
+	}
+
+	OutTimeRemaining = FMath::Max(InState.StartTime + InState.Duration - InWorldTime, 0.f);
+	OutDuration = InState.Duration;
+	return true;
+}
+
+void FGSCEffectTimeline::GetTagKeys(const FEntry& InEntry, TSet<FGameplayTag>& OutTagKeys)
+{
+	// Register under every tag and every parent of those tags, so that a query for "Cooldown.Skill" finds an effect granting "Cooldown.Skill.Fireball"
+	for (const FGameplayTag& GrantedTag : InEntry.GrantedTags)
+	{
+		for (const FGameplayTag& TagKey : GrantedTag.GetGameplayTagParents())
+		{
+			OutTagKeys.Add(TagKey);
+		}
+	}
+}
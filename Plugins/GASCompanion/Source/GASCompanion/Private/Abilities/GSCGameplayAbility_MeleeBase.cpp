@@ -3,14 +3,61 @@
 
 #include "Abilities/GSCGameplayAbility_MeleeBase.h"
 
+#include "AbilitySystemComponent.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/Tasks/GSCTask_PlayMontageWaitForEvent.h"
 #include "Components/GSCComboManagerComponent.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 
 UGSCGameplayAbility_MeleeBase::UGSCGameplayAbility_MeleeBase()
 {
 }
 
+void UGSCGameplayAbility_MeleeBase::OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	Super::OnGiveAbility(ActorInfo, Spec);
+
+	TArray<FSoftObjectPath> MontagePaths;
+	for (const TSoftObjectPtr<UAnimMontage>& Montage : Montages)
+	{
+		if (!Montage.IsNull())
+		{
+			MontagePaths.AddUnique(Montage.ToSoftObjectPath());
+		}
+	}
+
+	// Start loading now, so that montages can be played right away within the prediction window of the first activations
+	if (!MontagePaths.IsEmpty() && !MontagesPreloadHandle.IsValid())
+	{
+		MontagesPreloadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(MoveTemp(MontagePaths), FStreamableDelegate(), FStreamableManager::AsyncLoadHighPriority);
+	}
+}
+
+void UGSCGameplayAbility_MeleeBase::OnRemoveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec)
+{
+	if (MontagesPreloadHandle.IsValid())
+	{
+		MontagesPreloadHandle->CancelHandle();
+		MontagesPreloadHandle.Reset();
+	}
+
+	Super::OnRemoveAbility(ActorInfo, Spec);
+}
+
+void UGSCGameplayAbility_MeleeBase::GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssetPaths) const
+{
+	Super::GetAssetsToPreload(OutAssetPaths);
+
+	for (const TSoftObjectPtr<UAnimMontage>& Montage : Montages)
+	{
+		if (!Montage.IsNull())
+		{
+			OutAssetPaths.AddUnique(Montage.ToSoftObjectPath());
+		}
+	}
+}
+
 void UGSCGameplayAbility_MeleeBase::ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData)
 {
 	if (!CommitAbility(Handle, ActorInfo, ActivationInfo))
@@ -33,8 +80,16 @@ void UGSCGameplayAbility_MeleeBase::ActivateAbility(const FGameplayAbilitySpecHa
 		return;
 	}
 
+	// Combo inputs of a remote owning client come as target data of this activation
+	UAbilitySystemComponent* ASC = ActorInfo->AbilitySystemComponent.Get();
+	if (ASC && ActorInfo->IsNetAuthority() && !ActorInfo->IsLocallyControlled())
+	{
+		ComboManagerComponent->ListenForComboInputFrames(ASC, Handle, ActivationInfo.GetActivationPredictionKey());
+	}
+
 	ComboManagerComponent->IncrementCombo();
 
+	// Montage has to start within this activation to be predicted, don't wait for an async load here
 	UAnimMontage* Montage = GetNextComboMontage();
 
 	UGSCTask_PlayMontageWaitForEvent* Task = UGSCTask_PlayMontageWaitForEvent::PlayMontageAndWaitForEvent(this, NAME_None, Montage, WaitForEventTag, Rate, NAME_None, true, 1.0f);
@@ -62,10 +117,16 @@ void UGSCGameplayAbility_MeleeBase::OnEventReceived(const FGameplayTag EventTag,
 }
 
 UAnimMontage* UGSCGameplayAbility_MeleeBase::GetNextComboMontage()
+{
+	// Only hitches if activated before the preload started in OnGiveAbility() completed
+	return GetNextComboSoftMontage().LoadSynchronous();
+}
+
+TSoftObjectPtr<UAnimMontage> UGSCGameplayAbility_MeleeBase::GetNextComboSoftMontage()
 {
 	if (!ComboManagerComponent)
 	{
-		return nullptr;
+		return TSoftObjectPtr<UAnimMontage>();
 	}
 
 	int32 ComboIndex = ComboManagerComponent->ComboIndex;
@@ -75,5 +136,5 @@ UAnimMontage* UGSCGameplayAbility_MeleeBase::GetNextComboMontage()
 		ComboIndex = 0;
 	}
 
-	return Montages.IsValidIndex(ComboIndex) ? Montages[ComboIndex] : nullptr;
+	return Montages.IsValidIndex(ComboIndex) ? Montages[ComboIndex] : TSoftObjectPtr<UAnimMontage>();
 }
@@ -0,0 +1,82 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCGameplayEventBindingPool.h"
+
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+
+uint32 FGSCGameplayEventBindingPool::HashTags(const FGameplayTagContainer& InTags)
+{
+	TArray<uint32, TInlineAllocator<8>> TagHashes;
+	TagHashes.Reserve(InTags.Num());
+	for (const FGameplayTag& Tag : InTags)
+	{
+		TagHashes.Add(GetTypeHash(Tag));
+	}
+
+	// Containers with the same tags in a different order should share the same binding
+	TagHashes.Sort();
+
+	uint32 Hash = GetTypeHash(TagHashes.Num());
+	for (const uint32 TagHash : TagHashes)
+	{
+		Hash = HashCombine(Hash, TagHash);
+	}
+
+	return Hash;
+}
+
+FDelegateHandle FGSCGameplayEventBindingPool::Register(UAbilitySystemComponent& InASC, const FGameplayTagContainer& InTags, const uint32 InTagsHash, FGameplayEventTagMulticastDelegate::FDelegate&& InDelegate)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FGSCGameplayEventBindingPool::Register);
+
+	FBinding* Binding = Bindings.Find(InTagsHash);
+	if (!Binding)
+	{
+		Binding = &Bindings.Add(InTagsHash);
+		Binding->Tags = InTags;
+		Binding->Handle = InASC.AddGameplayEventTagContainerDelegate(InTags, FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([Listeners = Binding->Listeners](const FGameplayTag EventTag, const FGameplayEventData* Payload)
+		{
+			Listeners->Broadcast(EventTag, Payload);
+		}));
+	}
+	else if (Binding->Tags.Num() != InTags.Num() || !Binding->Tags.HasAllExact(InTags))
+	{
+		return FDelegateHandle();
+	}
+
+	Binding->NumListeners++;
+	return Binding->Listeners->Add(MoveTemp(InDelegate));
+}
+
+void FGSCGameplayEventBindingPool::Unregister(const uint32 InTagsHash, const FDelegateHandle InHandle)
+{
+	FBinding* Binding = Bindings.Find(InTagsHash);
+	if (Binding && Binding->Listeners->Remove(InHandle))
+	{
+		Binding->NumListeners--;
+	}
+}
+
+void FGSCGameplayEventBindingPool::Reset(UAbilitySystemComponent* InASC)
+{
+	if (InASC)
+	{
+		for (const TPair<uint32, FBinding>& Binding : Bindings)
+		{
+			InASC->RemoveGameplayEventTagContainerDelegate(Binding.Value.Tags, Binding.Value.Handle);
+		}
+	}
+
+	Bindings.Reset();
+}
+
+int32 FGSCGameplayEventBindingPool::NumBindings() const
+{
+	return Bindings.Num();
+}
+
+int32 FGSCGameplayEventBindingPool::NumListeners(const uint32 InTagsHash) const
+{
+	const FBinding* Binding = Bindings.Find(InTagsHash);
+	return Binding ? Binding->NumListeners : 0;
+}
@@ -7,9 +7,14 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCGameplayEventBindingPool.h"
 #include "Abilities/Tasks/GSCAbilityTask_NetworkSyncPoint.h"
 #include "Animation/AnimInstance.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
 #include "GameFramework/Character.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Runtime/Launch/Resources/Version.h"
 
 UGSCTask_PlayMontageWaitForEvent::UGSCTask_PlayMontageWaitForEvent(const FObjectInitializer& ObjectInitializer)
@@ -18,11 +23,39 @@ UGSCTask_PlayMontageWaitForEvent::UGSCTask_PlayMontageWaitForEvent(const FObject
 
 void UGSCTask_PlayMontageWaitForEvent::Activate()
 {
+    TRACE_CPUPROFILER_EVENT_SCOPE(UGSCTask_PlayMontageWaitForEvent::Activate);
+
     if (!Ability)
     {
         return;
     }
 
+    if (!MontageToPlay && !SoftMontageToPlay.IsNull())
+    {
+        MontageToPlay = SoftMontageToPlay.Get();
+        if (!MontageToPlay)
+        {
+            // Not loaded yet (eg. not preloaded by an Ability Set), play it once loaded instead of loading it synchronously
+            GSC_LOG(Verbose, TEXT("UGSCTask_PlayMontageWaitForEvent async loading montage %s; Task Instance Name %s."), *SoftMontageToPlay.ToString(), *InstanceName.ToString());
+            MontageLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+                SoftMontageToPlay.ToSoftObjectPath(),
+                FStreamableDelegate::CreateUObject(this, &UGSCTask_PlayMontageWaitForEvent::OnMontageLoaded),
+                FStreamableManager::AsyncLoadHighPriority
+            );
+
+            SetWaitingOnAvatar();
+            return;
+        }
+    }
+
+    PlayMontage();
+    SetWaitingOnAvatar();
+}
+
+void UGSCTask_PlayMontageWaitForEvent::PlayMontage()
+{
+    TRACE_CPUPROFILER_EVENT_SCOPE(UGSCTask_PlayMontageWaitForEvent::PlayMontage);
+
     bool bPlayedMontage = false;
 
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 1
@@ -36,7 +69,7 @@ void UGSCTask_PlayMontageWaitForEvent::Activate()
         if (AnimInstance != nullptr)
         {
             // Bind to event callback
-            EventHandle = AbilitySystemComponent->AddGameplayEventTagContainerDelegate(EventTags, FGameplayEventTagMulticastDelegate::FDelegate::CreateUObject(this, &UGSCTask_PlayMontageWaitForEvent::OnGameplayEvent));
+            BindGameplayEvents(*AbilitySystemComponent);
 
         	float CurrentMontageSectionTimeLeft = AbilitySystemComponent->GetCurrentMontageSectionTimeLeft();
             if (AbilitySystemComponent->PlayMontage(Ability, Ability->GetCurrentActivationInfo(), MontageToPlay, Rate, StartSection) > 0.f)
@@ -83,8 +116,57 @@ void UGSCTask_PlayMontageWaitForEvent::Activate()
             OnCancelled.Broadcast(FGameplayTag(), FGameplayEventData());
         }
     }
+}
 
-    SetWaitingOnAvatar();
+void UGSCTask_PlayMontageWaitForEvent::OnMontageLoaded()
+{
+    MontageLoadHandle.Reset();
+
+    if (IsFinished() || !Ability)
+    {
+        return;
+    }
+
+    MontageToPlay = SoftMontageToPlay.Get();
+    PlayMontage();
+}
+
+void UGSCTask_PlayMontageWaitForEvent::BindGameplayEvents(UAbilitySystemComponent& InASC)
+{
+    FGameplayEventTagMulticastDelegate::FDelegate Delegate = FGameplayEventTagMulticastDelegate::FDelegate::CreateUObject(this, &UGSCTask_PlayMontageWaitForEvent::OnGameplayEvent);
+
+    // Reuse the ASC binding of previous tasks waiting on the same tags, if any
+    if (UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(&InASC))
+    {
+        EventHandle = ASC->GetGameplayEventBindingPool().Register(InASC, EventTags, EventTagsHash, CopyTemp(Delegate));
+        bEventHandleFromPool = EventHandle.IsValid();
+    }
+
+    if (!bEventHandleFromPool)
+    {
+        EventHandle = InASC.AddGameplayEventTagContainerDelegate(EventTags, MoveTemp(Delegate));
+    }
+}
+
+void UGSCTask_PlayMontageWaitForEvent::UnbindGameplayEvents(UAbilitySystemComponent& InASC)
+{
+    if (!EventHandle.IsValid())
+    {
+        return;
+    }
+
+    UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(&InASC);
+    if (bEventHandleFromPool && ASC)
+    {
+        ASC->GetGameplayEventBindingPool().Unregister(EventTagsHash, EventHandle);
+    }
+    else
+    {
+        InASC.RemoveGameplayEventTagContainerDelegate(EventTags, EventHandle);
+    }
+
+    EventHandle.Reset();
+    bEventHandleFromPool = false;
 }
 
 void UGSCTask_PlayMontageWaitForEvent::ExternalCancel()
@@ -113,7 +195,8 @@ FString UGSCTask_PlayMontageWaitForEvent::GetDebugString() const
         }
     }
 
-    return FString::Printf(TEXT("PlayMontageAndWaitForEvent. MontageToPlay: %s  (Currently Playing): %s"), *GetNameSafe(MontageToPlay), *GetNameSafe(PlayingMontage));
+    const FString MontageName = MontageToPlay || SoftMontageToPlay.IsNull() ? GetNameSafe(MontageToPlay) : FString::Printf(TEXT("%s (Loading)"), *SoftMontageToPlay.GetAssetName());
+    return FString::Printf(TEXT("PlayMontageAndWaitForEvent. MontageToPlay: %s  (Currently Playing): %s"), *MontageName, *GetNameSafe(PlayingMontage));
 }
 
 void UGSCTask_PlayMontageWaitForEvent::OnDestroy(const bool AbilityEnded)
@@ -121,6 +204,12 @@ void UGSCTask_PlayMontageWaitForEvent::OnDestroy(const bool AbilityEnded)
     // Note: Clearing montage end delegate isn't necessary since its not a multicast and will be cleared when the next montage plays.
     // (If we are destroyed, it will detect this and not do anything)
 
+    if (MontageLoadHandle.IsValid())
+    {
+        MontageLoadHandle->CancelHandle();
+        MontageLoadHandle.Reset();
+    }
+
     // This delegate, however, should be cleared as it is a multicast
     if (Ability)
     {
@@ -137,7 +226,7 @@ void UGSCTask_PlayMontageWaitForEvent::OnDestroy(const bool AbilityEnded)
 	if (AbilitySystemComponent)
 #endif
     {
-        AbilitySystemComponent->RemoveGameplayEventTagContainerDelegate(EventTags, EventHandle);
+        UnbindGameplayEvents(*AbilitySystemComponent);
     }
 
     Super::OnDestroy(AbilityEnded);
@@ -165,6 +254,7 @@ UGSCTask_PlayMontageWaitForEvent* UGSCTask_PlayMontageWaitForEvent::PlayMontageA
     UGSCTask_PlayMontageWaitForEvent* MyObj = NewAbilityTask<UGSCTask_PlayMontageWaitForEvent>(OwningAbility, TaskInstanceName);
     MyObj->MontageToPlay = MontageToPlay;
     MyObj->EventTags = EventTags;
+    MyObj->EventTagsHash = FGSCGameplayEventBindingPool::HashTags(EventTags);
     MyObj->Rate = Rate;
     MyObj->StartSection = StartSection;
     MyObj->AnimRootMotionTranslationScale = AnimRootMotionTranslationScale;
@@ -173,6 +263,17 @@ UGSCTask_PlayMontageWaitForEvent* UGSCTask_PlayMontageWaitForEvent::PlayMontageA
     return MyObj;
 }
 
+UGSCTask_PlayMontageWaitForEvent* UGSCTask_PlayMontageWaitForEvent::PlaySoftMontageAndWaitForEvent(UGameplayAbility* OwningAbility, FName TaskInstanceName, TSoftObjectPtr<UAnimMontage> MontageToPlay, FGameplayTagContainer EventTags, float Rate, FName StartSection, bool bStopWhenAbilityEnds, float AnimRootMotionTranslationScale)
+{
+    UGSCTask_PlayMontageWaitForEvent* MyObj = PlayMontageAndWaitForEvent(OwningAbility, TaskInstanceName, nullptr, EventTags, Rate, StartSection, bStopWhenAbilityEnds, AnimRootMotionTranslationScale);
+    if (MyObj)
+    {
+        MyObj->SoftMontageToPlay = MontageToPlay;
+    }
+
+    return MyObj;
+}
+
 bool UGSCTask_PlayMontageWaitForEvent::StopPlayingMontage() const
 {
     const FGameplayAbilityActorInfo* ActorInfo = Ability->GetCurrentActorInfo();
@@ -4,9 +4,7 @@
 
 #include "GSCLog.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
-#include "Abilities/GSCGameplayAbility.h"
 #include "Components/GSCComboManagerComponent.h"
-#include "Components/GSCCoreComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 
 void UGSCComboWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, UAnimSequenceBase* Animation, float TotalDuration)
@@ -17,14 +15,9 @@ void UGSCComboWindowNotifyState::NotifyBegin(USkeletalMeshComponent* MeshComp, U
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run on server and on owning client, predicting the combo window from its own montage
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (ComboManagerComponent)
+	if (ComboManagerComponent && ComboManagerComponent->IsResolvingComboLocally())
 	{
 		ComboManagerComponent->bComboWindowOpened = true;
 	}
@@ -38,17 +31,25 @@ void UGSCComboWindowNotifyState::NotifyEnd(USkeletalMeshComponent* MeshComp, UAn
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run on server and on owning client, predicting the combo window from its own montage
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (ComboManagerComponent)
+	if (ComboManagerComponent && ComboManagerComponent->IsResolvingComboLocally())
 	{
 		GSC_LOG(Verbose, TEXT("NotifyEnd: bNextComboAbilityActivated %s (%s)"), ComboManagerComponent->bNextComboAbilityActivated ? TEXT("true") : TEXT("false"), *Owner->GetName())
 		GSC_LOG(Verbose, TEXT("NotifyEnd: bEndCombo %s (%s)"), bEndCombo ? TEXT("true") : TEXT("false"), *Owner->GetName())
+		if (!ComboManagerComponent->bNextComboAbilityActivated && !bEndCombo)
+		{
+			if (ComboManagerComponent->IsOwnerActorAuthoritative())
+			{
+				ComboManagerComponent->CloseComboWindow();
+			}
+			else if (ComboManagerComponent->bShouldTriggerCombo)
+			{
+				// Owning client doesn't activate next combo itself, predict its combo step as the server didn't activate it yet
+				ComboManagerComponent->IncrementCombo();
+			}
+		}
+
 		if (!ComboManagerComponent->bNextComboAbilityActivated || bEndCombo)
 		{
 			GSC_LOG(Verbose, TEXT("NotifyEnd: ResetCombo  (%s)"), *Owner->GetName())
@@ -70,7 +71,7 @@ void UGSCComboWindowNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UA
 		return;
 	}
 
-	// run only on server
+	// run only on server, owning client gets the next combo ability activated from there
 	if (!Owner->HasAuthority())
 	{
 		return;
@@ -84,24 +85,11 @@ void UGSCComboWindowNotifyState::NotifyTick(USkeletalMeshComponent* MeshComp, UA
 
 	if (ComboManagerComponent->bComboWindowOpened && ComboManagerComponent->bShouldTriggerCombo && ComboManagerComponent->bRequestTriggerCombo && !bEndCombo)
 	{
-		UGSCCoreComponent* CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(Owner);
-		// prevent reactivate of ability in this tick window (especially on networked environment with some lags)
-		if (CoreComponent && !ComboManagerComponent->bNextComboAbilityActivated)
+		// prevent reactivate of ability in this tick window (especially on networked environment with some lags),
+		// bNextComboAbilityActivated is set when the next combo ability increments the combo
+		if (!ComboManagerComponent->bNextComboAbilityActivated)
 		{
-			const UGameplayAbility* ComboAbility = ComboManagerComponent->GetCurrentActiveComboAbility();
-			if (ComboAbility)
-			{
-				UGSCGameplayAbility* ActivatedAbility;
-				const bool bSuccess = CoreComponent->ActivateAbilityByClass(ComboAbility->GetClass(), ActivatedAbility);
-				if (bSuccess)
-				{
-					ComboManagerComponent->bNextComboAbilityActivated = true;
-				}
-				else
-				{
-					GSC_LOG(Verbose, TEXT("ComboWindowNotifyState:NotifyTick Ability %s didn't activate"), *ComboAbility->GetClass()->GetName())
-				}
-			}
+			ComboManagerComponent->ActivateNextComboAbility();
 		}
 	}
 }
@@ -14,14 +14,9 @@ void UGSCTriggerComboNotify::Notify(USkeletalMeshComponent* MeshComp, UAnimSeque
 		return;
 	}
 
-	// run only on server
-	if (!Owner->HasAuthority())
-	{
-		return;
-	}
-
+	// run on server and on owning client, predicting combo state from its own montage
 	UGSCComboManagerComponent* ComboManagerComponent = UGSCBlueprintFunctionLibrary::GetComboManagerComponent(Owner);
-	if (!ComboManagerComponent)
+	if (!ComboManagerComponent || !ComboManagerComponent->IsResolvingComboLocally())
 	{
 		return;
 	}
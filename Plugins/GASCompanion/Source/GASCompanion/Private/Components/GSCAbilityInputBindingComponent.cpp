@@ -5,6 +5,7 @@
 #include "AbilitySystemComponent.h"
 #include "AbilitySystemGlobals.h"
 #include "GSCLog.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
 
 namespace GSCAbilityInputBindingComponent_Impl
 {
@@ -147,6 +148,8 @@ void UGSCAbilityInputBindingComponent::SetInputBinding(UInputAction* InputAction
 
 	AbilityInputBinding->BoundAbilitiesStack.Push(AbilityHandle);
 	TryBindAbilityInput(InputAction, *AbilityInputBinding);
+
+	MarkBindingIndexDirty();
 }
 
 void UGSCAbilityInputBindingComponent::ClearInputBinding(const FGameplayAbilitySpecHandle AbilityHandle)
@@ -160,40 +163,32 @@ void UGSCAbilityInputBindingComponent::ClearInputBinding(const FGameplayAbilityS
 	}
 
 	// Find the mapping for this ability
-	auto MappedIterator = MappedAbilities.CreateIterator();
-	while (MappedIterator)
-	{
-		if (MappedIterator.Value().InputID == FoundAbility->InputID)
-		{
-			break;
-		}
+	UpdateBindingIndex();
+	UInputAction* InputAction = InputActionsByAbilityHandle.FindRef(AbilityHandle);
+	FGSCAbilityInputBinding* AbilityInputBinding = InputAction ? MappedAbilities.Find(InputAction) : nullptr;
 
-		++MappedIterator;
-	}
-
-	if (MappedIterator)
+	if (AbilityInputBinding)
 	{
-		FGSCAbilityInputBinding& AbilityInputBinding = MappedIterator.Value();
-
-		if (AbilityInputBinding.BoundAbilitiesStack.Remove(AbilityHandle) > 0)
+		if (AbilityInputBinding->BoundAbilitiesStack.Remove(AbilityHandle) > 0)
 		{
-			if (AbilityInputBinding.BoundAbilitiesStack.Num() > 0)
+			if (AbilityInputBinding->BoundAbilitiesStack.Num() > 0)
 			{
-				FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding.BoundAbilitiesStack.Top());
+				FGameplayAbilitySpec* StackedAbility = FindAbilitySpec(AbilityInputBinding->BoundAbilitiesStack.Top());
 				if (StackedAbility && StackedAbility->InputID == 0)
 				{
-					StackedAbility->InputID = AbilityInputBinding.InputID;
+					StackedAbility->InputID = AbilityInputBinding->InputID;
 				}
 			}
 			else
 			{
-				// NOTE: This will invalidate the `AbilityInputBinding` ref above
-				RemoveEntry(MappedIterator.Key());
+				// NOTE: This will invalidate the `AbilityInputBinding` pointer above
+				RemoveEntry(InputAction);
 			}
 			// DO NOT act on `AbilityInputBinding` after here (it could have been removed)
 
 
 			FoundAbility->InputID = InvalidInputID;
+			MarkBindingIndexDirty();
 		}
 	}
 }
@@ -221,6 +216,13 @@ UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbility(co
 		return nullptr;
 	}
 
+	// Answer from the binding index for the ASC we're bound to
+	if (AbilitySystemComponent == AbilityComponent)
+	{
+		UpdateBindingIndex();
+		return InputActionsByAbilityClass.FindRef(Ability->GetClass());
+	}
+
 	// Ensure and update inputs ID for specs based on mapped abilities.
 	UpdateAbilitySystemBindings(AbilitySystemComponent);
 
@@ -250,6 +252,11 @@ UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbilitySpe
 {
 	check(AbilitySpec);
 
+	if (!bBindingIndexDirty)
+	{
+		return InputActionsByInputID.FindRef(AbilitySpec->InputID);
+	}
+
 	UInputAction* FoundInputAction = nullptr;
 	for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& MappedAbility : MappedAbilities)
 	{
@@ -264,6 +271,12 @@ UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbilitySpe
 	return FoundInputAction;
 }
 
+UInputAction* UGSCAbilityInputBindingComponent::GetBoundInputActionForAbilityHandle(const FGameplayAbilitySpecHandle AbilityHandle)
+{
+	UpdateBindingIndex();
+	return InputActionsByAbilityHandle.FindRef(AbilityHandle);
+}
+
 void UGSCAbilityInputBindingComponent::ResetBindings()
 {
 	for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& InputBinding : MappedAbilities)
@@ -297,7 +310,9 @@ void UGSCAbilityInputBindingComponent::ResetBindings()
 		RegisteredInputHandles.Reset();
 	}
 
+	UnregisterAbilitySystemDelegates();
 	AbilityComponent = nullptr;
+	MarkBindingIndexDirty();
 }
 
 void UGSCAbilityInputBindingComponent::RunAbilitySystemSetup()
@@ -322,6 +337,167 @@ void UGSCAbilityInputBindingComponent::RunAbilitySystemSetup()
 				}
 			}
 		}
+
+		RegisterAbilitySystemDelegates();
+	}
+
+	MarkBindingIndexDirty();
+}
+
+void UGSCAbilityInputBindingComponent::RegisterAbilitySystemDelegates()
+{
+	UnregisterAbilitySystemDelegates();
+
+	if (UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilityComponent))
+	{
+		OnGiveAbilityDelegateHandle = ASC->OnGiveAbilityDelegate.AddUObject(this, &UGSCAbilityInputBindingComponent::OnAbilityGivenOrRemoved);
+		OnRemoveAbilityDelegateHandle = ASC->OnRemoveAbilityDelegate.AddUObject(this, &UGSCAbilityInputBindingComponent::OnAbilityGivenOrRemoved);
+	}
+}
+
+void UGSCAbilityInputBindingComponent::UnregisterAbilitySystemDelegates()
+{
+	if (UGSCAbilitySystemComponent* ASC = Cast<UGSCAbilitySystemComponent>(AbilityComponent))
+	{
+		ASC->OnGiveAbilityDelegate.Remove(OnGiveAbilityDelegateHandle);
+		ASC->OnRemoveAbilityDelegate.Remove(OnRemoveAbilityDelegateHandle);
+	}
+
+	OnGiveAbilityDelegateHandle.Reset();
+	OnRemoveAbilityDelegateHandle.Reset();
+}
+
+void UGSCAbilityInputBindingComponent::OnAbilityGivenOrRemoved(FGameplayAbilitySpec& AbilitySpec)
+{
+	MarkBindingIndexDirty();
+}
+
+void UGSCAbilityInputBindingComponent::MarkBindingIndexDirty()
+{
+	bBindingIndexDirty = true;
+}
+
+void UGSCAbilityInputBindingComponent::UpdateBindingIndex()
+{
+	using namespace GSCAbilityInputBindingComponent_Impl;
+
+	// Without grant / removal notifications, fall back to checking bound specs are still where they were
+	if (!bBindingIndexDirty && AbilityComponent && !OnGiveAbilityDelegateHandle.IsValid())
+	{
+		bBindingIndexDirty = !AreBoundAbilitySpecIndicesValid();
+	}
+
+	if (!bBindingIndexDirty)
+	{
+		return;
+	}
+
+	InputActionsByInputID.Reset();
+	InputActionsByAbilityHandle.Reset();
+	InputActionsByAbilityClass.Reset();
+	BoundAbilitySpecIndices.Reset();
+
+	// Locate all bound specs with a single pass over activatable abilities
+	if (AbilityComponent)
+	{
+		for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& MappedAbility : MappedAbilities)
+		{
+			for (const FGameplayAbilitySpecHandle AbilityHandle : MappedAbility.Value.BoundAbilitiesStack)
+			{
+				BoundAbilitySpecIndices.Add(AbilityHandle, INDEX_NONE);
+			}
+		}
+
+		const TArray<FGameplayAbilitySpec>& Specs = AbilityComponent->GetActivatableAbilities();
+		for (int32 Index = 0; Index < Specs.Num(); ++Index)
+		{
+			if (int32* SpecIndex = BoundAbilitySpecIndices.Find(Specs[Index].Handle))
+			{
+				*SpecIndex = Index;
+			}
+		}
+
+		for (auto It = BoundAbilitySpecIndices.CreateIterator(); It; ++It)
+		{
+			if (It.Value() == INDEX_NONE)
+			{
+				It.RemoveCurrent();
+			}
+		}
+	}
+
+	for (const TPair<TObjectPtr<UInputAction>, FGSCAbilityInputBinding>& MappedAbility : MappedAbilities)
+	{
+		const FGSCAbilityInputBinding& AbilityInputBinding = MappedAbility.Value;
+		if (AbilityInputBinding.InputID != InvalidInputID)
+		{
+			InputActionsByInputID.Add(AbilityInputBinding.InputID, MappedAbility.Key);
+		}
+
+		for (const FGameplayAbilitySpecHandle AbilityHandle : AbilityInputBinding.BoundAbilitiesStack)
+		{
+			FGameplayAbilitySpec* FoundAbility = FindBoundAbilitySpec(AbilityHandle);
+			if (!FoundAbility)
+			{
+				// Only drop handles once they can be resolved, the spec may have been removed from the ASC
+				if (!AbilityComponent)
+				{
+					InputActionsByAbilityHandle.Add(AbilityHandle, MappedAbility.Key);
+				}
+				continue;
+			}
+
+			InputActionsByAbilityHandle.Add(AbilityHandle, MappedAbility.Key);
+
+			// Ensure and update inputs ID for specs based on mapped abilities (same as UpdateAbilitySystemBindings)
+			if (AbilityInputBinding.InputID > 0)
+			{
+				FoundAbility->InputID = AbilityInputBinding.InputID;
+			}
+
+			if (FoundAbility->Ability)
+			{
+				InputActionsByAbilityClass.Add(FoundAbility->Ability->GetClass(), MappedAbility.Key);
+			}
+		}
+	}
+
+	// Specs can only be resolved once the ASC is known, keep the index dirty until then
+	bBindingIndexDirty = AbilityComponent == nullptr;
+}
+
+bool UGSCAbilityInputBindingComponent::AreBoundAbilitySpecIndicesValid() const
+{
+	if (!AbilityComponent)
+	{
+		return false;
+	}
+
+	const TArray<FGameplayAbilitySpec>& Specs = AbilityComponent->GetActivatableAbilities();
+	for (const TPair<FGameplayAbilitySpecHandle, int32>& BoundAbilitySpecIndex : BoundAbilitySpecIndices)
+	{
+		if (!Specs.IsValidIndex(BoundAbilitySpecIndex.Value) || Specs[BoundAbilitySpecIndex.Value].Handle != BoundAbilitySpecIndex.Key)
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+void UGSCAbilityInputBindingComponent::ApplyInputID(const FGSCAbilityInputBinding& AbilityInputBinding) const
+{
+	if (AbilityInputBinding.InputID <= 0)
+	{
+		return;
+	}
+
+	for (const FGameplayAbilitySpecHandle AbilityHandle : AbilityInputBinding.BoundAbilitiesStack)
+	{
+		if (FGameplayAbilitySpec* FoundAbility = FindBoundAbilitySpec(AbilityHandle))
+		{
+			FoundAbility->InputID = AbilityInputBinding.InputID;
+		}
 	}
 }
 
@@ -356,11 +532,7 @@ void UGSCAbilityInputBindingComponent::UpdateAbilitySystemBindings(UAbilitySyste
 void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* InputAction)
 {
 	// The AbilitySystemComponent may not have been valid when we first bound input... try again.
-	if (AbilityComponent)
-	{
-		UpdateAbilitySystemBindings(AbilityComponent);
-	}
-	else
+	if (!AbilityComponent)
 	{
 		RunAbilitySystemSetup();
 	}
@@ -369,9 +541,15 @@ void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* Input
 	{
 		using namespace GSCAbilityInputBindingComponent_Impl;
 
+		// Only rebuilds the index when bindings or granted abilities changed
+		UpdateBindingIndex();
+
 		const FGSCAbilityInputBinding* FoundBinding = MappedAbilities.Find(InputAction);
 		if (FoundBinding && ensure(FoundBinding->InputID != InvalidInputID))
 		{
+			// Replicated spec updates (on clients and in PIE) reset InputID without granting or removing abilities, so the
+			// index isn't dirtied. Re-apply it on the specs bound to this input only, or the press would be dropped.
+			ApplyInputID(*FoundBinding);
 			AbilityComponent->AbilityLocalInputPressed(FoundBinding->InputID);
 		}
 	}
@@ -380,16 +558,17 @@ void UGSCAbilityInputBindingComponent::OnAbilityInputPressed(UInputAction* Input
 // ReSharper disable once CppParameterMayBeConstPtrOrRef
 void UGSCAbilityInputBindingComponent::OnAbilityInputReleased(UInputAction* InputAction)
 {
-	// The AbilitySystemComponent may need to have specs inputID updated here for clients... try again.
-	UpdateAbilitySystemBindings(AbilityComponent);
-
 	if (AbilityComponent)
 	{
 		using namespace GSCAbilityInputBindingComponent_Impl;
 
+		UpdateBindingIndex();
+
 		const FGSCAbilityInputBinding* FoundBinding = MappedAbilities.Find(InputAction);
 		if (FoundBinding && ensure(FoundBinding->InputID != InvalidInputID))
 		{
+			// The AbilitySystemComponent may need to have specs inputID updated here for clients... try again.
+			ApplyInputID(*FoundBinding);
 			AbilityComponent->AbilityLocalInputReleased(FoundBinding->InputID);
 		}
 	}
@@ -438,6 +617,7 @@ void UGSCAbilityInputBindingComponent::RemoveEntry(const UInputAction* InputActi
 		}
 
 		MappedAbilities.Remove(InputAction);
+		MarkBindingIndexDirty();
 	}
 }
 
@@ -451,6 +631,30 @@ FGameplayAbilitySpec* UGSCAbilityInputBindingComponent::FindAbilitySpec(const FG
 	return FoundAbility;
 }
 
+FGameplayAbilitySpec* UGSCAbilityInputBindingComponent::FindBoundAbilitySpec(const FGameplayAbilitySpecHandle Handle) const
+{
+	if (!AbilityComponent)
+	{
+		return nullptr;
+	}
+
+	// Bound specs that were not granted when the binding index was built can't be granted later on with the same handle
+	const int32* Index = BoundAbilitySpecIndices.Find(Handle);
+	if (!Index)
+	{
+		return nullptr;
+	}
+
+	TArray<FGameplayAbilitySpec>& Specs = AbilityComponent->GetActivatableAbilities();
+	if (Specs.IsValidIndex(*Index) && Specs[*Index].Handle == Handle)
+	{
+		return &Specs[*Index];
+	}
+
+	// Spec moved since the binding index was built
+	return FindAbilitySpec(Handle);
+}
+
 void UGSCAbilityInputBindingComponent::TryBindAbilityInput(UInputAction* InputAction, FGSCAbilityInputBinding& AbilityInputBinding)
 {
 	GSC_WLOG(Verbose, TEXT("Setup player controls for %s (InputID: %d)"), *GetNameSafe(InputAction), AbilityInputBinding.InputID)
@@ -7,14 +7,15 @@
 #include "GSCDelegates.h"
 #include "GSCLog.h"
 #include "Abilities/GSCGameplayAbility.h"
+#include "Engine/World.h"
 #include "GameFramework/Pawn.h"
+#include "TimerManager.h"
 
 // Sets default values for this component's properties
 UGSCAbilityQueueComponent::UGSCAbilityQueueComponent()
 {
-	// Set this component to be initialized when the game starts, and to be ticked every frame.  You can turn these features
-	// off to improve performance if you don't need them.
-	PrimaryComponentTick.bCanEverTick = true;
+	// Queue is driven by ability ended / failed events, no need to tick
+	PrimaryComponentTick.bCanEverTick = false;
 
 	// ...
 	SetIsReplicatedByDefault(true);
@@ -107,7 +108,17 @@ bool UGSCAbilityQueueComponent::IsAllAbilitiesAllowedForAbilityQueue() const
 
 const UGameplayAbility* UGSCAbilityQueueComponent::GetCurrentQueuedAbility() const
 {
-	return QueuedAbility;
+	return QueuedInputs.IsEmpty() ? nullptr : QueuedInputs[0].Ability.Get();
+}
+
+const TArray<FGSCQueuedAbilityInput>& UGSCAbilityQueueComponent::GetQueuedInputs() const
+{
+	return QueuedInputs;
+}
+
+void UGSCAbilityQueueComponent::ClearQueuedInputs()
+{
+	QueuedInputs.Reset();
 }
 
 TArray<TSubclassOf<UGameplayAbility>> UGSCAbilityQueueComponent::GetQueuedAllowedAbilities() const
@@ -149,31 +160,34 @@ void UGSCAbilityQueueComponent::OnAbilityEnded(const UGameplayAbility* InAbility
 
 	if (bAbilityQueueEnabled)
 	{
-		if (QueuedAbility)
+		RemoveExpiredQueuedInputs();
+
+		// Consume the oldest queued input, inputs left in the buffer are kept for the next ability ending
+		while (!QueuedInputs.IsEmpty())
 		{
-			// Store queue ability in a local var, it is cleared in ResetAbilityQueueState
-			const UGameplayAbility* AbilityToActivate = QueuedAbility;
+			const FGSCQueuedAbilityInput QueuedInput = QueuedInputs[0];
+			QueuedInputs.RemoveAt(0, 1, EAllowShrinking::No);
+
+			const UGameplayAbility* AbilityToActivate = QueuedInput.Ability;
+			if (!AbilityToActivate)
+			{
+				continue;
+			}
+
 			GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() has a queued input: %s [AbilityQueueSystem]"), *AbilityToActivate->GetName())
-			if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(AbilityToActivate->GetClass()))
+			if (IsAbilityAllowedForAbilityQueue(AbilityToActivate))
 			{
 				ResetAbilityQueueState();
 
 				GSC_LOG(Log, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() %s is within Allowed Abilties, try activate [AbilityQueueSystem]"), *AbilityToActivate->GetName())
-				if (OwnerAbilitySystemComponent)
-				{
-					OwnerAbilitySystemComponent->TryActivateAbilityByClass(AbilityToActivate->GetClass());
-				}
-			}
-			else
-			{
-				ResetAbilityQueueState();
-				GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() not allowed ability, do nothing: %s [AbilityQueueSystem]"), *AbilityToActivate->GetName())
+				ActivateQueuedInput(QueuedInput);
+				return;
 			}
+
+			GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityEnded() not allowed ability, do nothing: %s [AbilityQueueSystem]"), *AbilityToActivate->GetName())
 		}
-		else
-		{
-			ResetAbilityQueueState();
-		}
+
+		ResetAbilityQueueState();
 	}
 }
 
@@ -182,12 +196,15 @@ void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability,
 	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() %s, Reason: %s"), *Ability->GetName(), *ReasonTags.ToStringSimple())
 	if (bAbilityQueueEnabled && bAbilityQueueOpened)
 	{
-		GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() Set QueuedAbility to %s"), *Ability->GetName())
+		GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnAbilityFailed() Queue input for %s"), *Ability->GetName())
 
 		// Only queue the ability if it's allowed (or AllowAllAbilities is turned on)
-		if (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(Ability->GetClass()))
+		if (IsAbilityAllowedForAbilityQueue(Ability))
 		{
-			QueuedAbility = TObjectPtr<UGameplayAbility>(const_cast<UGameplayAbility*>(Ability));
+			FGSCQueuedAbilityInput QueuedInput;
+			QueuedInput.Ability = TObjectPtr<UGameplayAbility>(const_cast<UGameplayAbility*>(Ability));
+			QueuedInput.QueuedTime = GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0;
+			AddQueuedInput(QueuedInput);
 		}
 	}
 }
@@ -195,10 +212,15 @@ void UGSCAbilityQueueComponent::OnAbilityFailed(const UGameplayAbility* Ability,
 void UGSCAbilityQueueComponent::ResetAbilityQueueState()
 {
 	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::ResetAbilityQueueState()"))
-	QueuedAbility = nullptr;
 	bAllowAllAbilitiesForAbilityQueue = false;
 	QueuedAllowedAbilities.Empty();
 
+	// Without a lifetime, inputs only live for the queue window they were buffered in
+	if (QueuedInputLifetime <= 0.f)
+	{
+		QueuedInputs.Reset();
+	}
+
 	// Notify Debug Widget if any is on screen
 	UpdateDebugWidgetAllowedAbilities();
 }
@@ -207,3 +229,100 @@ void UGSCAbilityQueueComponent::UpdateDebugWidgetAllowedAbilities()
 {
 	FGSCDelegates::OnUpdateAllowedAbilities.Broadcast(QueuedAllowedAbilities);
 }
+
+void UGSCAbilityQueueComponent::AddQueuedInput(const FGSCQueuedAbilityInput& InQueuedInput)
+{
+	const int32 MaxInputs = FMath::Max(MaxQueuedInputs, 1);
+	if (QueuedInputs.Num() >= MaxInputs)
+	{
+		// Buffer is full, drop the oldest inputs
+		QueuedInputs.RemoveAt(0, QueuedInputs.Num() - MaxInputs + 1, EAllowShrinking::No);
+	}
+
+	QueuedInputs.Add(InQueuedInput);
+}
+
+void UGSCAbilityQueueComponent::RemoveExpiredQueuedInputs()
+{
+	const UWorld* World = GetWorld();
+	if (QueuedInputLifetime <= 0.f || !World)
+	{
+		return;
+	}
+
+	const double ExpiredTime = World->GetTimeSeconds() - QueuedInputLifetime;
+	QueuedInputs.RemoveAll([ExpiredTime](const FGSCQueuedAbilityInput& QueuedInput)
+	{
+		return QueuedInput.QueuedTime < ExpiredTime;
+	});
+}
+
+bool UGSCAbilityQueueComponent::IsAbilityAllowedForAbilityQueue(const UGameplayAbility* InAbility) const
+{
+	return InAbility && (bAllowAllAbilitiesForAbilityQueue || QueuedAllowedAbilities.Contains(InAbility->GetClass()));
+}
+
+bool UGSCAbilityQueueComponent::ActivateQueuedInput(const FGSCQueuedAbilityInput& InQueuedInput)
+{
+	if (!OwnerAbilitySystemComponent || !InQueuedInput.Ability)
+	{
+		return false;
+	}
+
+	const TSubclassOf<UGameplayAbility> AbilityClass = InQueuedInput.Ability->GetClass();
+	if (!OwnerAbilitySystemComponent->TryActivateAbilityByClass(AbilityClass))
+	{
+		return false;
+	}
+
+	// Nothing to reconcile on server or for abilities that are not locally predicted
+	if (OwnerAbilitySystemComponent->IsOwnerActorAuthoritative())
+	{
+		return true;
+	}
+
+	const FGameplayAbilitySpec* Spec = OwnerAbilitySystemComponent->FindAbilitySpecFromClass(AbilityClass);
+	if (!Spec)
+	{
+		return true;
+	}
+
+	TArray<UGameplayAbility*> Instances = Spec->GetAbilityInstances();
+	if (Instances.IsEmpty())
+	{
+		return true;
+	}
+
+	FPredictionKey PredictionKey = Instances.Last()->GetCurrentActivationInfo().GetActivationPredictionKey();
+	if (PredictionKey.IsLocalClientKey())
+	{
+		PredictionKey.NewRejectedDelegate().BindUObject(this, &UGSCAbilityQueueComponent::OnQueuedInputRejected, InQueuedInput);
+	}
+
+	return true;
+}
+
+void UGSCAbilityQueueComponent::OnQueuedInputRejected(FGSCQueuedAbilityInput InQueuedInput)
+{
+	UWorld* World = GetWorld();
+	if (!World || !bAbilityQueueEnabled || !InQueuedInput.Ability)
+	{
+		return;
+	}
+
+	const bool bExpired = QueuedInputLifetime > 0.f && InQueuedInput.QueuedTime < World->GetTimeSeconds() - QueuedInputLifetime;
+	if (bExpired || InQueuedInput.RejectedCount >= MaxRejectedRetries)
+	{
+		GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnQueuedInputRejected() Discard %s [AbilityQueueSystem]"), *InQueuedInput.Ability->GetName())
+		return;
+	}
+
+	GSC_LOG(Verbose, TEXT("UGSCAbilityQueueComponent::OnQueuedInputRejected() Server rejected %s, retry on next frame [AbilityQueueSystem]"), *InQueuedInput.Ability->GetName())
+	InQueuedInput.RejectedCount++;
+
+	// Server is most likely still running the previous ability, give it a frame to catch up
+	World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateWeakLambda(this, [this, InQueuedInput]()
+	{
+		ActivateQueuedInput(InQueuedInput);
+	}));
+}
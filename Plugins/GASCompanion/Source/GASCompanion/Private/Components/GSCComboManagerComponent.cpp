@@ -4,6 +4,7 @@
 #include "Components/GSCComboManagerComponent.h"
 
 #include "AbilitySystemBlueprintLibrary.h"
+#include "AbilitySystemComponent.h"
 #include "Abilities/GSCBlueprintFunctionLibrary.h"
 #include "Abilities/GSCGameplayAbility_MeleeBase.h"
 #include "Components/GSCCoreComponent.h"
@@ -24,18 +25,57 @@ void UGSCComboManagerComponent::GetLifetimeReplicatedProps(TArray<FLifetimePrope
 {
 	Super::GetLifetimeReplicatedProps(OutLifetimeProps);
 
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, ComboIndex, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bComboWindowOpened, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bShouldTriggerCombo, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bRequestTriggerCombo, COND_None, REPNOTIFY_Always);
-	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, bNextComboAbilityActivated, COND_None, REPNOTIFY_Always);
+	// Combo state replication can be turned off with SetMinimalReplication(), see PreReplication()
+	// Owning client predicts combo state and reconciles it against ReplicatedComboState, simulated proxies take the
+	// individual properties as is
+	DOREPLIFETIME_CONDITION(UGSCComboManagerComponent, ComboIndex, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(UGSCComboManagerComponent, bComboWindowOpened, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(UGSCComboManagerComponent, bShouldTriggerCombo, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(UGSCComboManagerComponent, bRequestTriggerCombo, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION(UGSCComboManagerComponent, bNextComboAbilityActivated, COND_SkipOwner);
+	DOREPLIFETIME_CONDITION_NOTIFY(UGSCComboManagerComponent, ReplicatedComboState, COND_OwnerOnly, REPNOTIFY_Always);
+}
+
+void UGSCComboManagerComponent::PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker)
+{
+	Super::PreReplication(ChangedPropertyTracker);
+
+	// Snapshot of the server state, along with the last owning client input it accounts for
+	ReplicatedComboState = GetComboState();
+
+	const bool bReplicateComboState = !bMinimalReplication;
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGSCComboManagerComponent, ComboIndex, bReplicateComboState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGSCComboManagerComponent, bComboWindowOpened, bReplicateComboState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGSCComboManagerComponent, bShouldTriggerCombo, bReplicateComboState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGSCComboManagerComponent, bRequestTriggerCombo, bReplicateComboState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGSCComboManagerComponent, bNextComboAbilityActivated, bReplicateComboState);
+	DOREPLIFETIME_ACTIVE_OVERRIDE(UGSCComboManagerComponent, ReplicatedComboState, bReplicateComboState);
+}
+
+void UGSCComboManagerComponent::SetMinimalReplication(const bool bInMinimalReplication)
+{
+	if (bMinimalReplication == bInMinimalReplication)
+	{
+		return;
+	}
+
+	bMinimalReplication = bInMinimalReplication;
+	if (!bMinimalReplication && GetOwner())
+	{
+		// Send combo state changed while replication was off
+		GetOwner()->ForceNetUpdate();
+	}
 }
 
 void UGSCComboManagerComponent::IncrementCombo()
 {
+	ComboPrediction.BeginComboStep(!bComboWindowOpened);
 	if (bComboWindowOpened)
 	{
 		ComboIndex = ComboIndex + 1;
+
+		// Next combo step is taken for this combo window, it won't be reset when the window ends
+		bNextComboAbilityActivated = true;
 	}
 }
 
@@ -45,31 +85,226 @@ void UGSCComboManagerComponent::ResetCombo()
 	SetComboIndex(0);
 }
 
+void UGSCComboManagerComponent::CloseComboWindow()
+{
+	// Input frame resolved after the last tick of the combo window
+	if (bShouldTriggerCombo && ComboPrediction.HasTriggeredComboFrom(ComboIndex) && ActivateNextComboAbility())
+	{
+		return;
+	}
+
+	ComboPrediction.CloseComboWindow(ComboIndex);
+}
+
 void UGSCComboManagerComponent::ActivateComboAbility(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
 {
-	if (IsOwnerActorAuthoritative())
+	if (IsOwnerActorAuthoritative() || !IsLocallyPredicting())
 	{
 		ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
+		return;
 	}
-	else
+
+	// Owning client resolves the input right away. Activation of the first combo ability goes through the regular
+	// ability prediction, inputs for next combos are sent within the prediction window of the active combo ability.
+	const bool bComboActive = OwnerCoreComponent && AbilityClass && OwnerCoreComponent->IsUsingAbilityByClass(AbilityClass);
+	ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
+
+	if (bComboActive)
 	{
-		ServerActivateComboAbility(AbilityClass, bAllowRemoteActivation);
+		SendComboInputFrame();
 	}
 }
 
 void UGSCComboManagerComponent::SetComboIndex(const int32 InComboIndex)
 {
-	if (IsOwnerActorAuthoritative())
+	// Resolved on both the server and the owning client, corrected by ReplicatedComboState if they disagree
+	ComboIndex = InComboIndex;
+}
+
+bool UGSCComboManagerComponent::IsResolvingComboLocally() const
+{
+	return IsOwnerActorAuthoritative() || IsLocallyPredicting();
+}
+
+bool UGSCComboManagerComponent::IsLocallyPredicting() const
+{
+	return bCachedIsNetSimulated && OwningCharacter && OwningCharacter->IsLocallyControlled();
+}
+
+void UGSCComboManagerComponent::ResolveComboInputFrame(const FGSCComboInputFrame& InFrame)
+{
+	if (!IsOwnerActorAuthoritative())
 	{
-		ComboIndex = InComboIndex;
+		return;
 	}
-	else
+
+	bool bTriggerCombo = false;
+	if (!ComboPrediction.ResolveInputFrame(InFrame, GetComboState(), GetCurrentActiveComboAbility() != nullptr, bTriggerCombo))
+	{
+		GSC_LOG(Verbose, TEXT("UGSCComboManagerComponent::ResolveComboInputFrame() Ignoring stale %s"), *InFrame.ToString())
+		return;
+	}
+
+	GSC_LOG(
+		Verbose,
+		TEXT("UGSCComboManagerComponent::ResolveComboInputFrame() %s resolved at combo index %d to trigger combo: %s"),
+		*InFrame.ToString(),
+		ComboIndex,
+		bTriggerCombo ? TEXT("true") : TEXT("false")
+	)
+
+	if (!bTriggerCombo || bComboWindowOpened)
+	{
+		// Next combo activated from the combo window NotifyTick
+		bShouldTriggerCombo = bTriggerCombo;
+		return;
+	}
+
+	// Combo window the input was made in already closed here, reopen it to activate the next combo right away
+	ComboIndex = InFrame.ComboIndex;
+	bComboWindowOpened = true;
+	const bool bSuccess = ActivateNextComboAbility();
+	bComboWindowOpened = false;
+	bShouldTriggerCombo = false;
+	bRequestTriggerCombo = false;
+	bNextComboAbilityActivated = false;
+
+	if (!bSuccess)
 	{
-		ComboIndex = InComboIndex;
-		ServerSetComboIndex(InComboIndex);
+		ResetCombo();
 	}
 }
 
+void UGSCComboManagerComponent::ListenForComboInputFrames(UAbilitySystemComponent* InASC, const FGameplayAbilitySpecHandle InAbilityHandle, const FPredictionKey InActivationPredictionKey)
+{
+	StopListeningForComboInputFrames();
+	if (!InASC)
+	{
+		return;
+	}
+
+	ComboInputFrameASC = InASC;
+	ComboInputFrameAbilityHandle = InAbilityHandle;
+	ComboInputFramePredictionKey = InActivationPredictionKey;
+	ComboInputFrameDelegateHandle = InASC->AbilityTargetDataSetDelegate(InAbilityHandle, InActivationPredictionKey).AddUObject(this, &UGSCComboManagerComponent::OnComboInputFrameReceived);
+	InASC->CallReplicatedTargetDataDelegatesIfSet(InAbilityHandle, InActivationPredictionKey);
+}
+
+void UGSCComboManagerComponent::StopListeningForComboInputFrames()
+{
+	if (UAbilitySystemComponent* ASC = ComboInputFrameASC.Get())
+	{
+		ASC->AbilityTargetDataSetDelegate(ComboInputFrameAbilityHandle, ComboInputFramePredictionKey).Remove(ComboInputFrameDelegateHandle);
+		ASC->ConsumeClientReplicatedTargetData(ComboInputFrameAbilityHandle, ComboInputFramePredictionKey);
+	}
+
+	ComboInputFrameASC.Reset();
+	ComboInputFrameDelegateHandle.Reset();
+}
+
+void UGSCComboManagerComponent::OnComboInputFrameReceived(const FGameplayAbilityTargetDataHandle& Data, FGameplayTag ApplicationTag)
+{
+	if (UAbilitySystemComponent* ASC = ComboInputFrameASC.Get())
+	{
+		ASC->ConsumeClientReplicatedTargetData(ComboInputFrameAbilityHandle, ComboInputFramePredictionKey);
+	}
+
+	const FGameplayAbilityTargetData* TargetData = Data.Get(0);
+	if (!TargetData || TargetData->GetScriptStruct() != FGSCComboInputFrame::StaticStruct())
+	{
+		return;
+	}
+
+	// Combo ability may have ended already, the frame is then acknowledged without triggering the next combo
+	ResolveComboInputFrame(*static_cast<const FGSCComboInputFrame*>(TargetData));
+}
+
+bool UGSCComboManagerComponent::ActivateNextComboAbility()
+{
+	const UGameplayAbility* ComboAbility = GetCurrentActiveComboAbility();
+	if (!ComboAbility || !OwnerCoreComponent)
+	{
+		return false;
+	}
+
+	UGSCGameplayAbility* ActivatedAbility;
+	const bool bSuccess = OwnerCoreComponent->ActivateAbilityByClass(ComboAbility->GetClass(), ActivatedAbility);
+	if (!bSuccess)
+	{
+		GSC_LOG(Verbose, TEXT("UGSCComboManagerComponent::ActivateNextComboAbility() Ability %s didn't activate"), *ComboAbility->GetClass()->GetName())
+	}
+
+	return bSuccess;
+}
+
+void UGSCComboManagerComponent::SendComboInputFrame()
+{
+	const UGameplayAbility* ComboAbility = GetCurrentActiveComboAbility();
+	UAbilitySystemComponent* ASC = ComboAbility ? ComboAbility->GetAbilitySystemComponentFromActorInfo() : nullptr;
+	if (!ASC)
+	{
+		return;
+	}
+
+	// Target data handle takes ownership of the frame
+	FGSCComboInputFrame* Frame = new FGSCComboInputFrame(ComboPrediction.MakeInputFrame(GetComboState()));
+	const FGameplayAbilityTargetDataHandle DataHandle(Frame);
+
+	FScopedPredictionWindow ScopedPrediction(ASC, true);
+	ASC->CallServerSetReplicatedTargetData(
+		ComboAbility->GetCurrentAbilitySpecHandle(),
+		ComboAbility->GetCurrentActivationInfo().GetActivationPredictionKey(),
+		DataHandle,
+		FGameplayTag(),
+		ASC->ScopedPredictionKey
+	);
+}
+
+void UGSCComboManagerComponent::OnRep_ComboState()
+{
+	if (!IsLocallyPredicting())
+	{
+		// Owner not predicting combos (eg. not locally controlled), take the server state as is
+		SetComboState(ReplicatedComboState);
+		return;
+	}
+
+	FGSCComboState PredictedState = GetComboState();
+	if (ComboPrediction.Reconcile(ReplicatedComboState, PredictedState))
+	{
+		GSC_LOG(
+			Verbose,
+			TEXT("UGSCComboManagerComponent::OnRep_ComboState() Server rejected input frame %d, correcting predicted combo index %d to %d"),
+			ReplicatedComboState.InputFrame,
+			ComboIndex,
+			PredictedState.ComboIndex
+		)
+		SetComboState(PredictedState);
+	}
+}
+
+FGSCComboState UGSCComboManagerComponent::GetComboState() const
+{
+	FGSCComboState State;
+	State.ComboIndex = ComboIndex;
+	State.bComboWindowOpened = bComboWindowOpened;
+	State.bShouldTriggerCombo = bShouldTriggerCombo;
+	State.bRequestTriggerCombo = bRequestTriggerCombo;
+	State.bNextComboAbilityActivated = bNextComboAbilityActivated;
+	State.InputFrame = ComboPrediction.GetLastInputFrame();
+	State.bInputFrameTriggeredCombo = ComboPrediction.DidLastInputTriggerCombo();
+	return State;
+}
+
+void UGSCComboManagerComponent::SetComboState(const FGSCComboState& InComboState)
+{
+	ComboIndex = InComboState.ComboIndex;
+	bComboWindowOpened = InComboState.bComboWindowOpened;
+	bShouldTriggerCombo = InComboState.bShouldTriggerCombo;
+	bRequestTriggerCombo = InComboState.bRequestTriggerCombo;
+	bNextComboAbilityActivated = InComboState.bNextComboAbilityActivated;
+}
+
 bool UGSCComboManagerComponent::IsOwnerActorAuthoritative() const
 {
 	return !bCachedIsNetSimulated;
@@ -87,6 +322,13 @@ void UGSCComboManagerComponent::BeginPlay()
 	CacheIsNetSimulated();
 }
 
+void UGSCComboManagerComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	StopListeningForComboInputFrames();
+
+	Super::EndPlay(EndPlayReason);
+}
+
 void UGSCComboManagerComponent::OnRegister()
 {
 	Super::OnRegister();
@@ -171,29 +413,3 @@ void UGSCComboManagerComponent::CacheIsNetSimulated()
 {
 	bCachedIsNetSimulated = IsNetSimulating();
 }
-
-void UGSCComboManagerComponent::ServerSetComboIndex_Implementation(const int32 InComboIndex)
-{
-	MulticastSetComboIndex(InComboIndex);
-}
-
-void UGSCComboManagerComponent::MulticastSetComboIndex_Implementation(const int32 InComboIndex)
-{
-	if (OwningCharacter && !OwningCharacter->IsLocallyControlled())
-	{
-		ComboIndex = InComboIndex;
-	}
-}
-
-void UGSCComboManagerComponent::MulticastActivateComboAbility_Implementation(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
-{
-    if (OwningCharacter && !OwningCharacter->IsLocallyControlled())
-    {
-        ActivateComboAbilityInternal(AbilityClass, bAllowRemoteActivation);
-    }
-}
-
-void UGSCComboManagerComponent::ServerActivateComboAbility_Implementation(const TSubclassOf<UGSCGameplayAbility> AbilityClass, const bool bAllowRemoteActivation)
-{
-    MulticastActivateComboAbility(AbilityClass, bAllowRemoteActivation);
-}
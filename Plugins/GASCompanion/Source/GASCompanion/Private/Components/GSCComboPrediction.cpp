@@ -0,0 +1,129 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Components/GSCComboPrediction.h"
+
+FString FGSCComboInputFrame::ToString() const
+{
+	return FString::Printf(TEXT("FGSCComboInputFrame(Frame: %d, ComboIndex: %d, TriggerCombo: %s)"), InputFrame, ComboIndex, bTriggerCombo ? TEXT("true") : TEXT("false"));
+}
+
+bool FGSCComboInputFrame::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar << InputFrame;
+	uint32 PackedComboIndex = FMath::Max(ComboIndex, 0);
+	Ar.SerializeIntPacked(PackedComboIndex);
+	ComboIndex = static_cast<int32>(PackedComboIndex);
+
+	uint8 bTrigger = bTriggerCombo ? 1 : 0;
+	Ar.SerializeBits(&bTrigger, 1);
+	bTriggerCombo = bTrigger != 0;
+
+	bOutSuccess = true;
+	return true;
+}
+
+FGSCComboInputFrame FGSCComboPrediction::MakeInputFrame(const FGSCComboState& InPredictedState)
+{
+	FGSCComboInputFrame Frame;
+	Frame.InputFrame = ++LastInputFrame;
+	Frame.ComboIndex = InPredictedState.ComboIndex;
+	Frame.bTriggerCombo = InPredictedState.bShouldTriggerCombo;
+
+	LastInputComboIndex = Frame.ComboIndex;
+	bLastInputTriggeredCombo = Frame.bTriggerCombo;
+	return Frame;
+}
+
+bool FGSCComboPrediction::ResolveInputFrame(const FGSCComboInputFrame& InFrame, const FGSCComboState& InServerState, const bool bInComboActive, bool& bOutTriggerCombo)
+{
+	bOutTriggerCombo = false;
+
+	if (!IsNewerInputFrame(InFrame.InputFrame, LastInputFrame))
+	{
+		return false;
+	}
+
+	LastInputFrame = InFrame.InputFrame;
+	LastInputComboIndex = InFrame.ComboIndex;
+	bLastInputTriggeredCombo = false;
+
+	if (!InFrame.bTriggerCombo || !bInComboActive)
+	{
+		return true;
+	}
+
+	if (InFrame.ComboIndex == LastTriggeredComboIndex)
+	{
+		// Next combo was already triggered from this combo step by a previous input
+		bLastInputTriggeredCombo = true;
+		return true;
+	}
+
+	if (!InServerState.bNextComboAbilityActivated)
+	{
+		// Resolve against the combo step the input was made in. The owning client plays it one way trip later than the
+		// server when the server activated it, so its combo window may close later on the client.
+		const int32 ComboStepIndex = InServerState.bComboWindowOpened ? InServerState.ComboIndex : ClosedComboWindowIndex;
+		bOutTriggerCombo = InFrame.ComboIndex == ComboStepIndex;
+	}
+
+	if (bOutTriggerCombo)
+	{
+		LastTriggeredComboIndex = InFrame.ComboIndex;
+	}
+
+	bLastInputTriggeredCombo = bOutTriggerCombo;
+	return true;
+}
+
+void FGSCComboPrediction::CloseComboWindow(const int32 InComboIndex)
+{
+	ClosedComboWindowIndex = InComboIndex;
+	LastTriggeredComboIndex = INDEX_NONE;
+}
+
+void FGSCComboPrediction::BeginComboStep(const bool bInNewCombo)
+{
+	ClosedComboWindowIndex = INDEX_NONE;
+	if (bInNewCombo)
+	{
+		LastTriggeredComboIndex = INDEX_NONE;
+	}
+}
+
+bool FGSCComboPrediction::Reconcile(const FGSCComboState& InServerState, FGSCComboState& InOutPredictedState)
+{
+	// Server didn't see all of our inputs yet, or this outcome was already reconciled
+	if (HasPendingInputFrames(InServerState) || InServerState.InputFrame == LastReconciledInputFrame)
+	{
+		return false;
+	}
+
+	LastReconciledInputFrame = InServerState.InputFrame;
+
+	// Only inputs predicted to trigger the next combo can be rejected
+	if (!bLastInputTriggeredCombo || InServerState.bInputFrameTriggeredCombo)
+	{
+		return false;
+	}
+
+	bLastInputTriggeredCombo = false;
+	if (InOutPredictedState.ComboIndex == LastInputComboIndex)
+	{
+		// Still in the combo step of the input, next combo won't trigger
+		InOutPredictedState.bShouldTriggerCombo = false;
+	}
+	else
+	{
+		// Next combo step was predicted when the combo window closed, the server ended the combo instead
+		InOutPredictedState.ComboIndex = 0;
+		InOutPredictedState.bShouldTriggerCombo = false;
+	}
+
+	return true;
+}
+
+bool FGSCComboPrediction::HasPendingInputFrames(const FGSCComboState& InServerState) const
+{
+	return IsNewerInputFrame(LastInputFrame, InServerState.InputFrame);
+}
@@ -7,6 +7,7 @@
 #include "AbilitySystemComponent.h"
 #include "Abilities/GSCGameplayAbility.h"
 #include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Engine/World.h"
 #include "GameFramework/Character.h"
 #include "GSCLog.h"
 
@@ -33,6 +34,12 @@ void UGSCCoreComponent::BeginDestroy()
 	// Clean up any bound delegates when component is destroyed
 	ShutdownAbilitySystemDelegates(OwnerAbilitySystemComponent);
 
+	if (FlushAttributeChangesHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(FlushAttributeChangesHandle);
+		FlushAttributeChangesHandle.Reset();
+	}
+
 	Super::BeginDestroy();
 }
 
@@ -91,6 +98,23 @@ void UGSCCoreComponent::RegisterAbilitySystemDelegates(UAbilitySystemComponent*
 
 	// Handle Ability Commit events
 	ASC->AbilityCommittedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityCommitted);
+
+	// Keep track of running abilities, starting with the ones that may already be active
+	ASC->AbilityActivatedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityActivatedForIndex);
+	ASC->AbilityEndedCallbacks.AddUObject(this, &UGSCCoreComponent::OnAbilityEndedForIndex);
+	ActiveAbilityIndex.Rebuild(*ASC);
+	ActiveAbilityIndexASC = ASC;
+
+	// Keep track of active effects durations and cooldowns, starting with the ones that may already be applied
+	EffectTimeline.Rebuild(*ASC);
+	EffectTimelineASC = ASC;
+
+	TArray<FActiveGameplayEffectHandle> ActiveHandles;
+	EffectTimeline.GetHandles(ActiveHandles);
+	for (const FActiveGameplayEffectHandle ActiveHandle : ActiveHandles)
+	{
+		RegisterActiveGameplayEffectDelegates(ActiveHandle);
+	}
 }
 
 void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent* ASC)
@@ -114,28 +138,35 @@ void UGSCCoreComponent::ShutdownAbilitySystemDelegates(UAbilitySystemComponent*
 	ASC->OnAnyGameplayEffectRemovedDelegate().RemoveAll(this);
 	ASC->RegisterGenericGameplayTagEvent().RemoveAll(this);
 	ASC->AbilityCommittedCallbacks.RemoveAll(this);
+	ASC->AbilityActivatedCallbacks.RemoveAll(this);
+	ASC->AbilityEndedCallbacks.RemoveAll(this);
 
-	for (const FActiveGameplayEffectHandle GameplayEffectAddedHandle : GameplayEffectAddedHandles)
+	if (ActiveAbilityIndexASC == ASC)
 	{
-		if (GameplayEffectAddedHandle.IsValid())
+		ActiveAbilityIndex.Reset();
+		ActiveAbilityIndexASC.Reset();
+	}
+
+	if (EffectTimelineASC == ASC)
+	{
+		// Only effects still active have delegates to clear
+		TArray<FActiveGameplayEffectHandle> ActiveHandles;
+		EffectTimeline.GetHandles(ActiveHandles);
+		for (const FActiveGameplayEffectHandle ActiveHandle : ActiveHandles)
 		{
-			FOnActiveGameplayEffectStackChange* EffectStackChangeDelegate = ASC->OnGameplayEffectStackChangeDelegate(GameplayEffectAddedHandle);
-			if (EffectStackChangeDelegate)
+			if (FOnActiveGameplayEffectStackChange* EffectStackChangeDelegate = ASC->OnGameplayEffectStackChangeDelegate(ActiveHandle))
 			{
 				EffectStackChangeDelegate->RemoveAll(this);
 			}
 
-			FOnActiveGameplayEffectTimeChange* EffectTimeChangeDelegate = ASC->OnGameplayEffectTimeChangeDelegate(GameplayEffectAddedHandle);
-			if (EffectTimeChangeDelegate)
+			if (FOnActiveGameplayEffectTimeChange* EffectTimeChangeDelegate = ASC->OnGameplayEffectTimeChangeDelegate(ActiveHandle))
 			{
 				EffectTimeChangeDelegate->RemoveAll(this);
 			}
 		}
-	}
 
-	for (const FGameplayTag GameplayTagBoundToDelegate : GameplayTagBoundToDelegates)
-	{
-		ASC->RegisterGameplayTagEvent(GameplayTagBoundToDelegate).RemoveAll(this);
+		EffectTimeline.Reset();
+		EffectTimelineASC.Reset();
 	}
 }
 
@@ -148,6 +179,25 @@ void UGSCCoreComponent::HandleDamage(const float DamageAmount, const FGameplayTa
 	// BroadcastDamageToStatusBar(DamageAmount, DamageTags, SourceActor);
 }
 
+void UGSCCoreComponent::HandleDamageBreakdown(const FGSCDamageBreakdown& Breakdown, AActor* SourceActor)
+{
+	OnDamageBreakdown.Broadcast(Breakdown, SourceActor);
+
+	if (GetOwner() && GetOwner()->HasAuthority() && GetOwner()->GetNetMode() != NM_Standalone)
+	{
+		MulticastDamageBreakdown(Breakdown, SourceActor);
+	}
+}
+
+void UGSCCoreComponent::MulticastDamageBreakdown_Implementation(const FGSCDamageBreakdown& Breakdown, AActor* SourceActor)
+{
+	// Server already broadcast it from HandleDamageBreakdown
+	if (GetOwner() && !GetOwner()->HasAuthority())
+	{
+		OnDamageBreakdown.Broadcast(Breakdown, SourceActor);
+	}
+}
+
 void UGSCCoreComponent::HandleHealthChange(const float DeltaValue, const FGameplayTagContainer& EventTags)
 {
 	// We only call the BP callbacks if this is not the initial ability setup
@@ -156,11 +206,24 @@ void UGSCCoreComponent::HandleHealthChange(const float DeltaValue, const FGamepl
 		return;
 	}
 
-	OnHealthChange.Broadcast(DeltaValue, EventTags);
-	if (!IsAlive())
+	if (ShouldAccumulateAttributeChanges())
 	{
-		Die();
+		if (!PendingHealthChange.IsSet())
+		{
+			PendingHealthChange.Emplace();
+		}
+		PendingHealthChange.GetValue().Accumulate(DeltaValue, EventTags);
+		RequestFlushAttributeChanges();
+
+		// Death isn't something to hold back
+		if (bAttributeEventsSuppressed && !IsAlive())
+		{
+			FlushAttributeChanges();
+		}
+		return;
 	}
+
+	BroadcastHealthChange(DeltaValue, EventTags);
 }
 
 void UGSCCoreComponent::HandleStaminaChange(const float DeltaValue, const FGameplayTagContainer& EventTags)
@@ -171,6 +234,17 @@ void UGSCCoreComponent::HandleStaminaChange(const float DeltaValue, const FGamep
 		return;
 	}
 
+	if (ShouldAccumulateAttributeChanges())
+	{
+		if (!PendingStaminaChange.IsSet())
+		{
+			PendingStaminaChange.Emplace();
+		}
+		PendingStaminaChange.GetValue().Accumulate(DeltaValue, EventTags);
+		RequestFlushAttributeChanges();
+		return;
+	}
+
 	OnStaminaChange.Broadcast(DeltaValue, EventTags);
 }
 
@@ -182,11 +256,29 @@ void UGSCCoreComponent::HandleManaChange(const float DeltaValue, const FGameplay
 		return;
 	}
 
+	if (ShouldAccumulateAttributeChanges())
+	{
+		if (!PendingManaChange.IsSet())
+		{
+			PendingManaChange.Emplace();
+		}
+		PendingManaChange.GetValue().Accumulate(DeltaValue, EventTags);
+		RequestFlushAttributeChanges();
+		return;
+	}
+
 	OnManaChange.Broadcast(DeltaValue, EventTags);
 }
 
 void UGSCCoreComponent::HandleAttributeChange(const FGameplayAttribute Attribute, const float DeltaValue, const FGameplayTagContainer& EventTags)
 {
+	if (ShouldAccumulateAttributeChanges())
+	{
+		PendingAttributeChanges.FindOrAdd(Attribute).Accumulate(DeltaValue, EventTags);
+		RequestFlushAttributeChanges();
+		return;
+	}
+
 	OnAttributeChange.Broadcast(Attribute, DeltaValue, EventTags);
 }
 
@@ -203,14 +295,103 @@ void UGSCCoreComponent::OnAttributeChanged(const FOnAttributeChangeData& Data)
 	}
 
 	const FGameplayEffectModCallbackData* ModData = Data.GEModData;
-	FGameplayTagContainer SourceTags = FGameplayTagContainer();
-	if (ModData)
+	const FGameplayTagContainer* SourceTags = ModData ? ModData->EffectSpec.CapturedSourceTags.GetAggregatedTags() : nullptr;
+
+	const FGameplayTagContainer& EventTags = SourceTags ? *SourceTags : FGameplayTagContainer::EmptyContainer;
+
+	if (ShouldAccumulateAttributeChanges())
 	{
-		SourceTags = *ModData->EffectSpec.CapturedSourceTags.GetAggregatedTags();
+		PendingAttributeChanges.FindOrAdd(Data.Attribute).Accumulate(NewValue - OldValue, EventTags);
+		RequestFlushAttributeChanges();
+		return;
 	}
 
 	// Broadcast attribute change to component
-	OnAttributeChange.Broadcast(Data.Attribute, NewValue - OldValue, SourceTags);
+	OnAttributeChange.Broadcast(Data.Attribute, NewValue - OldValue, EventTags);
+}
+
+void UGSCCoreComponent::FlushAttributeChanges()
+{
+	if (FlushAttributeChangesHandle.IsValid())
+	{
+		FWorldDelegates::OnWorldPostActorTick.Remove(FlushAttributeChangesHandle);
+		FlushAttributeChangesHandle.Reset();
+	}
+
+	// Move pending changes out first, so that changes triggered from BP handlers are queued for the next flush
+	TMap<FGameplayAttribute, FPendingAttributeChange> AttributeChanges = MoveTemp(PendingAttributeChanges);
+	TOptional<FPendingAttributeChange> HealthChange = MoveTemp(PendingHealthChange);
+	TOptional<FPendingAttributeChange> StaminaChange = MoveTemp(PendingStaminaChange);
+	TOptional<FPendingAttributeChange> ManaChange = MoveTemp(PendingManaChange);
+	PendingHealthChange.Reset();
+	PendingStaminaChange.Reset();
+	PendingManaChange.Reset();
+
+	for (const TPair<FGameplayAttribute, FPendingAttributeChange>& Pair : AttributeChanges)
+	{
+		OnAttributeChange.Broadcast(Pair.Key, Pair.Value.DeltaValue, Pair.Value.EventTags);
+	}
+
+	if (StaminaChange.IsSet())
+	{
+		OnStaminaChange.Broadcast(StaminaChange->DeltaValue, StaminaChange->EventTags);
+	}
+
+	if (ManaChange.IsSet())
+	{
+		OnManaChange.Broadcast(ManaChange->DeltaValue, ManaChange->EventTags);
+	}
+
+	if (HealthChange.IsSet())
+	{
+		BroadcastHealthChange(HealthChange->DeltaValue, HealthChange->EventTags);
+	}
+}
+
+void UGSCCoreComponent::SetAttributeEventsSuppressed(const bool bSuppressed)
+{
+	if (bAttributeEventsSuppressed == bSuppressed)
+	{
+		return;
+	}
+
+	bAttributeEventsSuppressed = bSuppressed;
+	if (!bSuppressed)
+	{
+		// Catch up with changes that happened while suppressed
+		FlushAttributeChanges();
+	}
+}
+
+void UGSCCoreComponent::RequestFlushAttributeChanges()
+{
+	// Pending changes are dispatched once events are no longer suppressed
+	if (bAttributeEventsSuppressed)
+	{
+		return;
+	}
+
+	if (!FlushAttributeChangesHandle.IsValid())
+	{
+		FlushAttributeChangesHandle = FWorldDelegates::OnWorldPostActorTick.AddUObject(this, &UGSCCoreComponent::OnWorldPostActorTick);
+	}
+}
+
+void UGSCCoreComponent::OnWorldPostActorTick(UWorld* InWorld, ELevelTick InTickType, float InDeltaSeconds)
+{
+	if (InWorld == GetWorld())
+	{
+		FlushAttributeChanges();
+	}
+}
+
+void UGSCCoreComponent::BroadcastHealthChange(const float DeltaValue, const FGameplayTagContainer& EventTags)
+{
+	OnHealthChange.Broadcast(DeltaValue, EventTags);
+	if (!IsAlive())
+	{
+		Die();
+	}
 }
 
 void UGSCCoreComponent::OnDamageAttributeChanged(const FOnAttributeChangeData& Data)
@@ -431,6 +612,11 @@ bool UGSCCoreComponent::IsUsingAbilityByClass(const TSubclassOf<UGameplayAbility
 		return false;
 	}
 
+	if (IsActiveAbilityIndexValid())
+	{
+		return ActiveAbilityIndex.HasAnyByClass(AbilityClass);
+	}
+
 	return GetActiveAbilitiesByClass(AbilityClass).Num() > 0;
 }
 
@@ -442,6 +628,11 @@ bool UGSCCoreComponent::IsUsingAbilityByTags(const FGameplayTagContainer Ability
 		return false;
 	}
 
+	if (IsActiveAbilityIndexValid())
+	{
+		return ActiveAbilityIndex.HasAnyByTags(AbilityTags);
+	}
+
 	return GetActiveAbilitiesByTags(AbilityTags).Num() > 0;
 }
 
@@ -453,33 +644,18 @@ TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByClass(TSubclass
 		return {};
 	}
 
-	TArray<FGameplayAbilitySpec> Specs = OwnerAbilitySystemComponent->GetActivatableAbilities();
-	TArray<struct FGameplayAbilitySpec*> MatchingGameplayAbilities;
 	TArray<UGameplayAbility*> ActiveAbilities;
 
-	// First, search for matching Abilities for this class
-	for (const FGameplayAbilitySpec& Spec : Specs)
+	if (IsActiveAbilityIndexValid())
 	{
-		if (Spec.Ability && Spec.Ability->GetClass()->IsChildOf(AbilityToSearch))
-		{
-			MatchingGameplayAbilities.Add(const_cast<FGameplayAbilitySpec*>(&Spec));
-		}
+		ActiveAbilityIndex.GetByClass(AbilityToSearch, ActiveAbilities);
+		return ActiveAbilities;
 	}
 
-	// Iterate the list of all ability specs
-	for (const FGameplayAbilitySpec* Spec : MatchingGameplayAbilities)
+	GetActiveAbilitiesFromSpecs([&AbilityToSearch](const FGameplayAbilitySpec& Spec)
 	{
-		// Iterate all instances on this ability spec, which can include instance per execution abilities
-		TArray<UGameplayAbility*> AbilityInstances = Spec->GetAbilityInstances();
-
-		for (UGameplayAbility* ActiveAbility : AbilityInstances)
-		{
-			if (ActiveAbility->IsActive())
-			{
-				ActiveAbilities.Add(ActiveAbility);
-			}
-		}
-	}
+		return Spec.Ability->GetClass()->IsChildOf(AbilityToSearch);
+	}, ActiveAbilities);
 
 	return ActiveAbilities;
 }
@@ -493,25 +669,122 @@ TArray<UGameplayAbility*> UGSCCoreComponent::GetActiveAbilitiesByTags(const FGam
 	}
 
 	TArray<UGameplayAbility*> ActiveAbilities;
-	TArray<FGameplayAbilitySpec*> MatchingGameplayAbilities;
-	OwnerAbilitySystemComponent->GetActivatableGameplayAbilitySpecsByAllMatchingTags(GameplayTagContainer, MatchingGameplayAbilities, false);
 
-	// Iterate the list of all ability specs
-	for (const FGameplayAbilitySpec* Spec : MatchingGameplayAbilities)
+	if (IsActiveAbilityIndexValid())
 	{
-		// Iterate all instances on this ability spec
-		TArray<UGameplayAbility*> AbilityInstances = Spec->GetAbilityInstances();
+		ActiveAbilityIndex.GetByTags(GameplayTagContainer, ActiveAbilities);
+		return ActiveAbilities;
+	}
 
-		for (UGameplayAbility* ActiveAbility : AbilityInstances)
+	GetActiveAbilitiesFromSpecs([&GameplayTagContainer](const FGameplayAbilitySpec& Spec)
+	{
+		return FGSCActiveAbilityIndex::GetAbilityTags(Spec.Ability).HasAll(GameplayTagContainer);
+	}, ActiveAbilities);
+
+	return ActiveAbilities;
+}
+
+bool UGSCCoreComponent::IsActiveAbilityIndexValid() const
+{
+	return OwnerAbilitySystemComponent && ActiveAbilityIndexASC.Get() == OwnerAbilitySystemComponent;
+}
+
+bool UGSCCoreComponent::GetEffectTimeRemainingByTags(const FGameplayTagContainer& GameplayTags, float& TimeRemaining, float& Duration) const
+{
+	TimeRemaining = 0.f;
+	Duration = 0.f;
+
+	if (!OwnerAbilitySystemComponent || GameplayTags.IsEmpty())
+	{
+		return false;
+	}
+
+	const float WorldTime = OwnerAbilitySystemComponent->GetWorld() ? OwnerAbilitySystemComponent->GetWorld()->GetTimeSeconds() : 0.f;
+	if (IsEffectTimelineValid())
+	{
+		return EffectTimeline.GetTimeRemainingAndDuration(GameplayTags, WorldTime, TimeRemaining, Duration);
+	}
+
+	// Slow path, query active effects
+	const TArray<TPair<float, float>> DurationAndTimeRemaining = OwnerAbilitySystemComponent->GetActiveEffectsTimeRemainingAndDuration(FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(GameplayTags));
+	for (int32 Index = 0; Index < DurationAndTimeRemaining.Num(); ++Index)
+	{
+		if (Index == 0 || DurationAndTimeRemaining[Index].Key > TimeRemaining)
+		{
+			TimeRemaining = DurationAndTimeRemaining[Index].Key;
+			Duration = DurationAndTimeRemaining[Index].Value;
+		}
+	}
+
+	return DurationAndTimeRemaining.Num() > 0;
+}
+
+// ReSharper disable once CppPassValueParameterByConstReference
+bool UGSCCoreComponent::GetCooldownTimeRemainingByClass(const TSubclassOf<UGameplayAbility> AbilityClass, float& TimeRemaining, float& Duration) const
+{
+	TimeRemaining = 0.f;
+	Duration = 0.f;
+
+	if (!OwnerAbilitySystemComponent || !AbilityClass)
+	{
+		return false;
+	}
+
+	if (IsEffectTimelineValid())
+	{
+		const float WorldTime = OwnerAbilitySystemComponent->GetWorld() ? OwnerAbilitySystemComponent->GetWorld()->GetTimeSeconds() : 0.f;
+		return EffectTimeline.GetCooldownTimeRemainingAndDuration(AbilityClass, WorldTime, TimeRemaining, Duration);
+	}
+
+	// Slow path, query active effects for the cooldown tags of the ability
+	const FGameplayTagContainer* CooldownTags = AbilityClass.GetDefaultObject()->GetCooldownTags();
+	return CooldownTags && GetEffectTimeRemainingByTags(*CooldownTags, TimeRemaining, Duration);
+}
+
+bool UGSCCoreComponent::IsEffectTimelineValid() const
+{
+	return OwnerAbilitySystemComponent && EffectTimelineASC.Get() == OwnerAbilitySystemComponent;
+}
+
+void UGSCCoreComponent::RegisterActiveGameplayEffectDelegates(const FActiveGameplayEffectHandle ActiveHandle)
+{
+	if (!OwnerAbilitySystemComponent)
+	{
+		return;
+	}
+
+	if (FOnActiveGameplayEffectStackChange* Delegate = OwnerAbilitySystemComponent->OnGameplayEffectStackChangeDelegate(ActiveHandle))
+	{
+		Delegate->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectStackChanged);
+	}
+
+	if (FOnActiveGameplayEffectTimeChange* Delegate = OwnerAbilitySystemComponent->OnGameplayEffectTimeChangeDelegate(ActiveHandle))
+	{
+		Delegate->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectTimeChanged);
+	}
+}
+
+void UGSCCoreComponent::GetActiveAbilitiesFromSpecs(const TFunctionRef<bool(const FGameplayAbilitySpec&)> Predicate, TArray<UGameplayAbility*>& OutActiveAbilities) const
+{
+	check(OwnerAbilitySystemComponent);
+
+	const UAbilitySystemComponent* ASC = OwnerAbilitySystemComponent;
+	for (const FGameplayAbilitySpec& Spec : ASC->GetActivatableAbilities())
+	{
+		if (!Spec.Ability || !Predicate(Spec))
 		{
-			if (ActiveAbility->IsActive())
+			continue;
+		}
+
+		// Iterate all instances on this ability spec, which can include instance per execution abilities
+		for (UGameplayAbility* ActiveAbility : Spec.GetAbilityInstances())
+		{
+			if (ActiveAbility && ActiveAbility->IsActive())
 			{
-				ActiveAbilities.Add(ActiveAbility);
+				OutActiveAbilities.Add(ActiveAbility);
 			}
 		}
 	}
-
-	return ActiveAbilities;;
 }
 
 bool UGSCCoreComponent::ActivateAbilityByClass(const TSubclassOf<UGameplayAbility> AbilityClass, UGSCGameplayAbility*& ActivatedAbility, const bool bAllowRemoteActivation)
@@ -677,26 +950,32 @@ void UGSCCoreComponent::OnActiveGameplayEffectAdded(UAbilitySystemComponent* Tar
 		return;
 	}
 
-	FGameplayTagContainer AssetTags;
-	SpecApplied.GetAllAssetTags(AssetTags);
-
-	FGameplayTagContainer GrantedTags;
-	SpecApplied.GetAllGrantedTags(GrantedTags);
-
-	OnGameplayEffectAdded.Broadcast(AssetTags, GrantedTags, ActiveHandle);
-
-	if (FOnActiveGameplayEffectStackChange* Delegate = OwnerAbilitySystemComponent->OnGameplayEffectStackChangeDelegate(ActiveHandle))
+	// Start tracking effect timing, this also stores the effect tags for stack / time change events
+	const FGSCEffectTimeline::FEntry* Entry = nullptr;
+	if (IsEffectTimelineValid())
 	{
-		Delegate->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectStackChanged);
+		if (const FActiveGameplayEffect* ActiveEffect = OwnerAbilitySystemComponent->GetActiveGameplayEffect(ActiveHandle))
+		{
+			Entry = EffectTimeline.Add(*ActiveEffect);
+		}
 	}
 
-	if (FOnActiveGameplayEffectTimeChange* Delegate = OwnerAbilitySystemComponent->OnGameplayEffectTimeChangeDelegate(ActiveHandle))
+	if (Entry)
 	{
-		Delegate->AddUObject(this, &UGSCCoreComponent::OnActiveGameplayEffectTimeChanged);
+		OnGameplayEffectAdded.Broadcast(Entry->AssetTags, Entry->GrantedTags, ActiveHandle);
+	}
+	else
+	{
+		FGameplayTagContainer AssetTags;
+		SpecApplied.GetAllAssetTags(AssetTags);
+
+		FGameplayTagContainer GrantedTags;
+		SpecApplied.GetAllGrantedTags(GrantedTags);
+
+		OnGameplayEffectAdded.Broadcast(AssetTags, GrantedTags, ActiveHandle);
 	}
 
-	// Store active handles to clear out bound delegates when shutting down listeners
-	GameplayEffectAddedHandles.AddUnique(ActiveHandle);
+	RegisterActiveGameplayEffectDelegates(ActiveHandle);
 }
 
 void UGSCCoreComponent::OnActiveGameplayEffectStackChanged(const FActiveGameplayEffectHandle ActiveHandle, const int32 NewStackCount, const int32 PreviousStackCount)
@@ -706,6 +985,13 @@ void UGSCCoreComponent::OnActiveGameplayEffectStackChanged(const FActiveGameplay
 		return;
 	}
 
+	// Use tags stored in the timeline, without looking up the active effect
+	if (const FGSCEffectTimeline::FEntry* Entry = IsEffectTimelineValid() ? EffectTimeline.Find(ActiveHandle) : nullptr)
+	{
+		OnGameplayEffectStackChange.Broadcast(Entry->AssetTags, Entry->GrantedTags, ActiveHandle, NewStackCount, PreviousStackCount);
+		return;
+	}
+
 	const FActiveGameplayEffect* GameplayEffect = OwnerAbilitySystemComponent->GetActiveGameplayEffect(ActiveHandle);
 	if (!GameplayEffect)
 	{
@@ -728,6 +1014,18 @@ void UGSCCoreComponent::OnActiveGameplayEffectTimeChanged(const FActiveGameplayE
 		return;
 	}
 
+	if (IsEffectTimelineValid())
+	{
+		EffectTimeline.UpdateTime(ActiveHandle, NewStartTime, NewDuration);
+
+		// Use tags stored in the timeline, without looking up the active effect
+		if (const FGSCEffectTimeline::FEntry* Entry = EffectTimeline.Find(ActiveHandle))
+		{
+			OnGameplayEffectTimeChange.Broadcast(Entry->AssetTags, Entry->GrantedTags, ActiveHandle, NewStartTime, NewDuration);
+			return;
+		}
+	}
+
 	const FActiveGameplayEffect* GameplayEffect = OwnerAbilitySystemComponent->GetActiveGameplayEffect(ActiveHandle);
 	if (!GameplayEffect)
 	{
@@ -750,6 +1048,20 @@ void UGSCCoreComponent::OnAnyGameplayEffectRemoved(const FActiveGameplayEffect&
 		return;
 	}
 
+	FGSCEffectTimeline::FEntry RemovedEntry;
+	if (IsEffectTimelineValid() && EffectTimeline.Remove(EffectRemoved.Handle, &RemovedEntry))
+	{
+		OnGameplayEffectStackChange.Broadcast(RemovedEntry.AssetTags, RemovedEntry.GrantedTags, EffectRemoved.Handle, 0, 1);
+		OnGameplayEffectRemoved.Broadcast(RemovedEntry.AssetTags, RemovedEntry.GrantedTags, EffectRemoved.Handle);
+
+		if (RemovedEntry.IsCooldown())
+		{
+			HandleCooldownEnd(RemovedEntry);
+		}
+
+		return;
+	}
+
 	FGameplayTagContainer AssetTags;
 	EffectRemoved.Spec.GetAllAssetTags(AssetTags);
 
@@ -765,6 +1077,16 @@ void UGSCCoreComponent::OnAnyGameplayTagChanged(const FGameplayTag GameplayTag,
 	OnGameplayTagChange.Broadcast(GameplayTag, NewCount);
 }
 
+void UGSCCoreComponent::OnAbilityActivatedForIndex(UGameplayAbility* ActivatedAbility)
+{
+	ActiveAbilityIndex.Add(ActivatedAbility);
+}
+
+void UGSCCoreComponent::OnAbilityEndedForIndex(UGameplayAbility* EndedAbility)
+{
+	ActiveAbilityIndex.Remove(EndedAbility);
+}
+
 void UGSCCoreComponent::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
 {
 	if (!ActivatedAbility)
@@ -778,36 +1100,6 @@ void UGSCCoreComponent::OnAbilityCommitted(UGameplayAbility* ActivatedAbility)
 	HandleCooldownOnAbilityCommit(ActivatedAbility);
 }
 
-void UGSCCoreComponent::OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, const int32 NewCount, const FGameplayAbilitySpecHandle AbilitySpecHandle, const float Duration)
-{
-	if (NewCount != 0)
-	{
-		return;
-	}
-
-	if (!OwnerAbilitySystemComponent)
-	{
-		return;
-	}
-
-	FGameplayAbilitySpec* AbilitySpec = OwnerAbilitySystemComponent->FindAbilitySpecFromHandle(AbilitySpecHandle);
-	if (!AbilitySpec)
-	{
-		// Ability might have been cleared when cooldown expires
-		return;
-	}
-
-	UGameplayAbility* Ability = AbilitySpec->Ability;
-
-	// Broadcast cooldown expiration to BP
-	if (IsValid(Ability))
-	{
-		OnCooldownEnd.Broadcast(Ability, GameplayTag, Duration);
-	}
-
-	OwnerAbilitySystemComponent->RegisterGameplayTagEvent(GameplayTag, EGameplayTagEventType::NewOrRemoved).RemoveAll(this);
-}
-
 void UGSCCoreComponent::HandleCooldownOnAbilityCommit(UGameplayAbility* ActivatedAbility)
 {
 	if (!OwnerAbilitySystemComponent)
@@ -839,23 +1131,29 @@ void UGSCCoreComponent::HandleCooldownOnAbilityCommit(UGameplayAbility* Activate
 		return;
 	}
 
-	FGameplayAbilityActorInfo ActorInfo = ActivatedAbility->GetActorInfo();
-	const FGameplayAbilitySpecHandle AbilitySpecHandle = ActivatedAbility->GetCurrentAbilitySpecHandle();
-
+	// Cooldown effect was added to the timeline before commit callbacks, no need to query active effects.
+	// Cooldown expiration is reported when the cooldown effect gets removed from the timeline (see HandleCooldownEnd).
 	float TimeRemaining = 0.f;
 	float Duration = 0.f;
-	ActivatedAbility->GetCooldownTimeRemainingAndDuration(AbilitySpecHandle, &ActorInfo, TimeRemaining, Duration);
+	GetEffectTimeRemainingByTags(*CooldownTags, TimeRemaining, Duration);
 
 	OnCooldownStart.Broadcast(ActivatedAbility, *CooldownTags, TimeRemaining, Duration);
+}
 
-	// Register delegate to monitor any change to cooldown gameplay tag to be able to figure out when a cooldown expires
-	TArray<FGameplayTag> GameplayTags;
-	CooldownTags->GetGameplayTagArray(GameplayTags);
-	for (const FGameplayTag GameplayTag : GameplayTags)
+void UGSCCoreComponent::HandleCooldownEnd(const FGSCEffectTimeline::FEntry& RemovedCooldown)
+{
+	UGameplayAbility* Ability = const_cast<UGameplayAbility*>(RemovedCooldown.CooldownAbility.Get());
+	if (!IsValid(Ability))
 	{
-		OwnerAbilitySystemComponent->RegisterGameplayTagEvent(GameplayTag)
-			.AddUObject(this, &UGSCCoreComponent::OnCooldownGameplayTagChanged, AbilitySpecHandle, Duration);
+		return;
+	}
 
-		GameplayTagBoundToDelegates.AddUnique(GameplayTag);
+	// Same as a cooldown tag count going to zero
+	for (const FGameplayTag& CooldownTag : RemovedCooldown.GrantedTags)
+	{
+		if (!EffectTimeline.HasTag(CooldownTag))
+		{
+			OnCooldownEnd.Broadcast(Ability, CooldownTag, RemovedCooldown.Duration);
+		}
 	}
 }
@@ -5,6 +5,7 @@
 #include "AttributeSet.h"
 #include "GSCLog.h"
 #include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Abilities/Attributes/GSCDamagePipeline.h"
 #include "UObject/Class.h"
 
 UGSCDeveloperSettings::UGSCDeveloperSettings()
@@ -25,6 +26,16 @@ UGSCDeveloperSettings& UGSCDeveloperSettings::GetMutable()
 	return *Settings;
 }
 
+const UGSCDamagePipeline* UGSCDeveloperSettings::GetDamagePipeline() const
+{
+	if (!LoadedDamagePipeline && !DamagePipeline.IsNull())
+	{
+		LoadedDamagePipeline = DamagePipeline.LoadSynchronous();
+	}
+
+	return LoadedDamagePipeline;
+}
+
 FName UGSCDeveloperSettings::GetCategoryName() const
 {
 	return PluginCategoryName;
@@ -47,6 +58,11 @@ void UGSCDeveloperSettings::PostEditChangeProperty(FPropertyChangedEvent& Proper
 	{
 		SetHideInDetailsViewMetaData(UGSCAttributeSet::StaticClass(), bHideGSCAttributeSetInDetailsView);
 	}
+
+	if (PropertyName == GET_MEMBER_NAME_CHECKED(UGSCDeveloperSettings, DamagePipeline))
+	{
+		LoadedDamagePipeline = nullptr;
+	}
 }
 
 void UGSCDeveloperSettings::SetHideInDetailsViewMetaData(UClass* InClass, const bool bInHideInDetailsView)
@@ -2,6 +2,8 @@
 
 #include "ModularGameplayActors/GSCModularAIController.h"
 #include "Components/GameFrameworkComponentManager.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "Subsystems/GSCSignificanceSubsystem.h"
 
 void AGSCModularAIController::PreInitializeComponents()
 {
@@ -20,3 +22,27 @@ void AGSCModularAIController::EndPlay(const EEndPlayReason::Type EndPlayReason)
 	UGameFrameworkComponentManager::RemoveGameFrameworkComponentReceiver(this);
 	Super::EndPlay(EndPlayReason);
 }
+
+void AGSCModularAIController::OnPossess(APawn* InPawn)
+{
+	Super::OnPossess(InPawn);
+
+	// Let the significance subsystem scale down GAS updates of this pawn when no player is around
+	if (UGSCDeveloperSettings::Get().bEnableAISignificance)
+	{
+		if (UGSCSignificanceSubsystem* SignificanceSubsystem = UGSCSignificanceSubsystem::Get(this))
+		{
+			SignificanceSubsystem->RegisterPawn(InPawn);
+		}
+	}
+}
+
+void AGSCModularAIController::OnUnPossess()
+{
+	if (UGSCSignificanceSubsystem* SignificanceSubsystem = UGSCSignificanceSubsystem::Get(this))
+	{
+		SignificanceSubsystem->UnregisterPawn(GetPawn());
+	}
+
+	Super::OnUnPossess();
+}
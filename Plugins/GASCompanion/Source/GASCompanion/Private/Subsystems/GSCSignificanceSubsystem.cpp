@@ -0,0 +1,275 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Subsystems/GSCSignificanceSubsystem.h"
+
+#include "AbilitySystemComponent.h"
+#include "AbilitySystemGlobals.h"
+#include "GSCLog.h"
+#include "Abilities/GSCBlueprintFunctionLibrary.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "Components/GSCCoreComponent.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+UGSCSignificanceSubsystem* UGSCSignificanceSubsystem::Get(const UObject* WorldContextObject)
+{
+	const UWorld* World = WorldContextObject ? WorldContextObject->GetWorld() : nullptr;
+	return World ? World->GetSubsystem<UGSCSignificanceSubsystem>() : nullptr;
+}
+
+void UGSCSignificanceSubsystem::Deinitialize()
+{
+	for (TPair<TObjectKey<APawn>, FPawnState>& Pair : PawnStates)
+	{
+		Promote(Pair.Value);
+	}
+
+	PawnStates.Reset();
+	NumDemotedPawns = 0;
+
+	Super::Deinitialize();
+}
+
+void UGSCSignificanceSubsystem::Tick(const float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (PawnStates.IsEmpty())
+	{
+		return;
+	}
+
+	const UGSCDeveloperSettings& Settings = UGSCDeveloperSettings::Get();
+	if (!Settings.bEnableAISignificance)
+	{
+		return;
+	}
+
+	TimeSinceLastUpdate += DeltaTime;
+	if (TimeSinceLastUpdate < Settings.SignificanceUpdateInterval)
+	{
+		return;
+	}
+
+	TimeSinceLastUpdate = 0.f;
+
+	Viewpoints.Reset();
+	for (FConstPlayerControllerIterator Iterator = GetWorld()->GetPlayerControllerIterator(); Iterator; ++Iterator)
+	{
+		const APlayerController* PlayerController = Iterator->Get();
+		if (!PlayerController)
+		{
+			continue;
+		}
+
+		FVector ViewLocation;
+		FRotator ViewRotation;
+		PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+		Viewpoints.Emplace(ViewRotation, ViewLocation);
+	}
+
+	UpdateSignificance(Viewpoints);
+}
+
+TStatId UGSCSignificanceSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UGSCSignificanceSubsystem, STATGROUP_Tickables);
+}
+
+void UGSCSignificanceSubsystem::RegisterPawn(APawn* InPawn)
+{
+	if (!IsValid(InPawn) || PawnStates.Contains(InPawn))
+	{
+		return;
+	}
+
+	UAbilitySystemComponent* ASC = UAbilitySystemGlobals::GetAbilitySystemComponentFromActor(InPawn);
+	if (!ASC)
+	{
+		GSC_LOG(Verbose, TEXT("UGSCSignificanceSubsystem::RegisterPawn - %s has no ability system component, skipping"), *GetNameSafe(InPawn))
+		return;
+	}
+
+	FPawnState& State = PawnStates.Add(InPawn);
+	State.Pawn = InPawn;
+	State.AbilitySystemComponent = ASC;
+	State.CoreComponent = UGSCBlueprintFunctionLibrary::GetCompanionCoreComponent(InPawn);
+	State.ComboManagerComponent = InPawn->FindComponentByClass<UGSCComboManagerComponent>();
+}
+
+void UGSCSignificanceSubsystem::UnregisterPawn(APawn* InPawn)
+{
+	FPawnState State;
+	if (!PawnStates.RemoveAndCopyValue(InPawn, State))
+	{
+		return;
+	}
+
+	Promote(State);
+}
+
+void UGSCSignificanceSubsystem::UpdateSignificance(const TConstArrayView<FTransform> InViewpoints)
+{
+	const float Hysteresis = UGSCDeveloperSettings::Get().SignificanceHysteresis;
+
+	for (auto It = PawnStates.CreateIterator(); It; ++It)
+	{
+		FPawnState& State = It.Value();
+		const APawn* Pawn = State.Pawn.Get();
+		if (!Pawn)
+		{
+			// Pawn got destroyed without being unpossessed, nothing left to restore
+			NumDemotedPawns -= State.bSignificant ? 0 : 1;
+			It.RemoveCurrent();
+			continue;
+		}
+
+		// Demoted pawns need to get a bit closer than the boundaries to be promoted again
+		const float DistanceScale = State.bSignificant ? 1.f : 1.f - Hysteresis;
+		const bool bSignificant = IsLocationSignificant(Pawn->GetActorLocation(), InViewpoints, DistanceScale);
+		if (bSignificant == State.bSignificant)
+		{
+			continue;
+		}
+
+		if (bSignificant)
+		{
+			Promote(State);
+		}
+		else
+		{
+			Demote(State);
+		}
+	}
+}
+
+bool UGSCSignificanceSubsystem::IsSignificant(const APawn* InPawn) const
+{
+	const FPawnState* State = PawnStates.Find(InPawn);
+	return !State || State->bSignificant;
+}
+
+int32 UGSCSignificanceSubsystem::GetNumRegisteredPawns() const
+{
+	return PawnStates.Num();
+}
+
+int32 UGSCSignificanceSubsystem::GetNumDemotedPawns() const
+{
+	return NumDemotedPawns;
+}
+
+bool UGSCSignificanceSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+bool UGSCSignificanceSubsystem::IsLocationSignificant(const FVector& InLocation, const TConstArrayView<FTransform> InViewpoints, const float InDistanceScale)
+{
+	const UGSCDeveloperSettings& Settings = UGSCDeveloperSettings::Get();
+	const double SignificantDistanceSquared = FMath::Square(Settings.SignificantDistance * InDistanceScale);
+	const double MaxSignificantDistanceSquared = FMath::Square(Settings.MaxSignificantDistance * InDistanceScale);
+	const double ViewCosine = FMath::Cos(FMath::DegreesToRadians(Settings.SignificanceViewHalfAngle));
+
+	for (const FTransform& Viewpoint : InViewpoints)
+	{
+		const FVector ToLocation = InLocation - Viewpoint.GetLocation();
+		const double DistanceSquared = ToLocation.SizeSquared();
+		if (DistanceSquared <= SignificantDistanceSquared)
+		{
+			return true;
+		}
+
+		if (DistanceSquared > MaxSignificantDistanceSquared)
+		{
+			continue;
+		}
+
+		// Within view range, significant if on screen (approximated with a view cone, since nothing gets rendered on dedicated servers)
+		if (FVector::DotProduct(ToLocation.GetSafeNormal(), Viewpoint.GetRotation().GetForwardVector()) >= ViewCosine)
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UGSCSignificanceSubsystem::Demote(FPawnState& InState)
+{
+	if (!InState.bSignificant)
+	{
+		return;
+	}
+
+	const UGSCDeveloperSettings& Settings = UGSCDeveloperSettings::Get();
+
+	InState.bSignificant = false;
+	NumDemotedPawns++;
+
+	if (UAbilitySystemComponent* ASC = InState.AbilitySystemComponent.Get())
+	{
+		InState.DefaultTickInterval = ASC->GetComponentTickInterval();
+		ASC->SetComponentTickInterval(FMath::Max(InState.DefaultTickInterval, Settings.DemotedAbilitySystemTickInterval));
+
+		// Mixed only replicates effects to the owner, which AI don't have. Full is left alone, as simulated proxies
+		// would lose the effects and granted tags replicated so far.
+		InState.DefaultReplicationMode = ASC->GetReplicationMode();
+		if (InState.DefaultReplicationMode == EGameplayEffectReplicationMode::Mixed)
+		{
+			ASC->SetReplicationMode(EGameplayEffectReplicationMode::Minimal);
+		}
+	}
+
+	if (UGSCCoreComponent* CoreComponent = InState.CoreComponent.Get())
+	{
+		CoreComponent->SetAttributeEventsSuppressed(true);
+	}
+
+	if (UGSCComboManagerComponent* ComboManagerComponent = InState.ComboManagerComponent.Get())
+	{
+		ComboManagerComponent->SetMinimalReplication(true);
+	}
+
+	if (APawn* Pawn = InState.Pawn.Get())
+	{
+		InState.DefaultNetUpdateFrequency = Pawn->GetNetUpdateFrequency();
+		Pawn->SetNetUpdateFrequency(FMath::Min(InState.DefaultNetUpdateFrequency, Settings.DemotedNetUpdateFrequency));
+	}
+}
+
+void UGSCSignificanceSubsystem::Promote(FPawnState& InState)
+{
+	if (InState.bSignificant)
+	{
+		return;
+	}
+
+	InState.bSignificant = true;
+	NumDemotedPawns--;
+
+	if (UAbilitySystemComponent* ASC = InState.AbilitySystemComponent.Get())
+	{
+		ASC->SetComponentTickInterval(InState.DefaultTickInterval);
+		ASC->SetReplicationMode(InState.DefaultReplicationMode);
+	}
+
+	// Broadcasts attribute changes accumulated while demoted
+	if (UGSCCoreComponent* CoreComponent = InState.CoreComponent.Get())
+	{
+		CoreComponent->SetAttributeEventsSuppressed(false);
+	}
+
+	if (UGSCComboManagerComponent* ComboManagerComponent = InState.ComboManagerComponent.Get())
+	{
+		ComboManagerComponent->SetMinimalReplication(false);
+	}
+
+	if (APawn* Pawn = InState.Pawn.Get())
+	{
+		Pawn->SetNetUpdateFrequency(InState.DefaultNetUpdateFrequency);
+		Pawn->ForceNetUpdate();
+	}
+}
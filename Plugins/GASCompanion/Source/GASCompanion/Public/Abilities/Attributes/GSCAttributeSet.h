@@ -7,6 +7,8 @@
 #include "Abilities/Attributes/GSCAttributeSetBase.h"
 #include "GSCAttributeSet.generated.h"
 
+class UGSCDamagePipeline;
+
 /**
  * Contains basic Attributes used in most games, Health, Stamina, Mana.
  * Characters taking damage or using Mana or Stamina as a resource will use this AttributeSet.
@@ -26,6 +28,7 @@
  * ManaRegenRate - Backing attribute for mana regeneration
  *
  * Damage - Meta attribute used by DamageExecution or Gameplay Effect to calculate final damage, which then turns into -Health
+ *          (after going through the Damage Pipeline configured in GAS Companion settings, if any)
  * StaminaDamage - Meta attribute used by DamageExecution or Gameplay Effect to calculate final damage, which then turns into -Stamina
  */
 UCLASS()
@@ -40,6 +43,12 @@ public:
 	virtual void PostGameplayEffectExecute(const FGameplayEffectModCallbackData& Data) override;
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
 
+	/** Overrides the damage pipeline configured in GAS Companion settings, for this AttributeSet only. Pass nullptr to use the project default again. */
+	void SetDamagePipeline(const UGSCDamagePipeline* InDamagePipeline);
+
+	/** Returns the damage pipeline used when the Damage meta attribute is executed, if any */
+	const UGSCDamagePipeline* GetDamagePipeline() const;
+
 	// Current Health, when 0 we expect owner to die unless prevented by an ability. Capped by MaxHealth.
 	// Positive changes can directly use this.
 	// Negative changes to Health should go through Damage meta attribute.
@@ -128,6 +137,10 @@ protected:
 	UFUNCTION()
 	virtual void OnRep_StaminaRegenRate(const FGameplayAttributeData& OldStaminaRegenRate);
 
+	/** Damage pipeline set with SetDamagePipeline(), takes precedence over the one in GAS Companion settings */
+	UPROPERTY(Transient)
+	TObjectPtr<const UGSCDamagePipeline> DamagePipelineOverride;
+
 	virtual void SetAttributeClamped(const FGameplayAttribute& Attribute, const float Value, const float MaxValue);
 
 	virtual void HandleDamageAttribute(const FGSCAttributeSetExecutionData& ExecutionData);
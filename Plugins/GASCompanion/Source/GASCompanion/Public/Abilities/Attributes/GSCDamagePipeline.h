@@ -0,0 +1,158 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AttributeSet.h"
+#include "GameplayTagContainer.h"
+#include "Engine/DataAsset.h"
+#include "GSCDamagePipeline.generated.h"
+
+class UAbilitySystemComponent;
+struct FRandomStream;
+
+/** What a damage pipeline stage does to the incoming damage */
+UENUM(BlueprintType)
+enum class EGSCDamageStageType : uint8
+{
+	/** Damage is multiplied by the stage value */
+	Multiplier,
+
+	/** Stage value (read from the source) is the chance in [0, 1] to multiply damage by Coefficient */
+	CriticalHit,
+
+	/** Damage is reduced by the stage value as a percentage in [0, 1], capped by Coefficient */
+	Resistance,
+
+	/** Damage is multiplied by Coefficient / (Coefficient + stage value), Coefficient being the armor constant */
+	Armor,
+
+	/** Stage value absorbs damage. When read from an attribute, the absorbed amount is removed from that attribute. */
+	Shield
+};
+
+/** A single, ordered step of a damage pipeline */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCDamageStage
+{
+	GENERATED_BODY()
+
+	/** What this stage does to the incoming damage */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage")
+	EGSCDamageStageType Type = EGSCDamageStageType::Multiplier;
+
+	/** Attribute providing the stage value. Read from the source ASC for critical hits, from the target ASC otherwise. Value is used if not set. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage")
+	FGameplayAttribute Attribute;
+
+	/** Stage value used when Attribute is not set, or the ASC to read it from is not available */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage")
+	float Value = 1.f;
+
+	/** Type specific coefficient: critical damage multiplier, maximum resistance or armor constant. Unused for Multiplier and Shield. */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage")
+	float Coefficient = 1.f;
+
+	/** Only evaluate this stage if every one of these tags is in the effect source tags or asset tags (eg. Damage.Type.Fire for a fire resistance) */
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Damage")
+	FGameplayTagContainer RequiredTags;
+};
+
+/** Result of a single damage pipeline stage */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCDamageBreakdownStage
+{
+	GENERATED_BODY()
+
+	/** Index of the stage in the pipeline */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	uint8 StageIndex = 0;
+
+	/** Type of the stage */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	EGSCDamageStageType Type = EGSCDamageStageType::Multiplier;
+
+	/** Damage once this stage was applied */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	float DamageAfter = 0.f;
+};
+
+/** Per stage breakdown of a damage pipeline evaluation. Only holds stages that were evaluated, and is small enough to be sent over the network. */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCDamageBreakdown
+{
+	GENERATED_BODY()
+
+	/** Damage before any stage was applied */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	float IncomingDamage = 0.f;
+
+	/** Damage once every stage was applied */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	float FinalDamage = 0.f;
+
+	/** Whether a critical hit stage succeeded */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	bool bCritical = false;
+
+	/** Evaluated stages, in order */
+	UPROPERTY(BlueprintReadOnly, Category="Damage")
+	TArray<FGSCDamageBreakdownStage> Stages;
+};
+
+/** Everything a damage pipeline needs to know about a damage execution */
+struct FGSCDamagePipelineContext
+{
+	/** ASC of the instigator, used to read critical hit stage attributes */
+	const UAbilitySystemComponent* SourceASC = nullptr;
+
+	/** ASC receiving damage, used to read (and update for shields) other stage attributes */
+	UAbilitySystemComponent* TargetASC = nullptr;
+
+	/** Captured source tags of the effect spec */
+	const FGameplayTagContainer* SourceTags = nullptr;
+
+	/** Asset tags of the effect spec */
+	const FGameplayTagContainer* SpecAssetTags = nullptr;
+
+	/** Optional random stream for critical hits, FMath::FRand() is used otherwise */
+	FRandomStream* RandomStream = nullptr;
+};
+
+/**
+ * DataAsset describing how incoming damage is turned into health loss by GSCAttributeSet.
+ *
+ * Stages (critical hits, resistances, armor, shields, multipliers) are evaluated natively, in order, every time the
+ * Damage meta attribute is executed. The default pipeline is set in the GAS Companion project settings.
+ */
+UCLASS(BlueprintType)
+class GASCOMPANION_API UGSCDamagePipeline : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	/** Ordered list of stages applied to incoming damage */
+	UPROPERTY(EditDefaultsOnly, Category="Damage", meta=(TitleProperty=Type))
+	TArray<FGSCDamageStage> Stages;
+
+	/** If true, the per stage breakdown of each damage execution is sent to the target's GSCCoreComponent, and multicast to clients. */
+	UPROPERTY(EditDefaultsOnly, Category="Damage")
+	bool bBroadcastBreakdown = false;
+
+	/**
+	 * Runs incoming damage through every stage of the pipeline.
+	 *
+	 * @param InContext Source / Target information of the damage execution
+	 * @param InDamage Incoming damage
+	 * @param OutBreakdown If provided, filled with the result of each evaluated stage
+	 * @return Final damage, never negative
+	 */
+	float Evaluate(const FGSCDamagePipelineContext& InContext, float InDamage, FGSCDamageBreakdown* OutBreakdown = nullptr) const;
+
+private:
+	/** Returns whether the stage required tags are satisfied by the context */
+	static bool AreRequiredTagsMet(const FGSCDamageStage& InStage, const FGSCDamagePipelineContext& InContext);
+
+	/** Returns the value of a stage, read from its attribute if possible */
+	static float GetStageValue(const FGSCDamageStage& InStage, const UAbilitySystemComponent* InASC);
+};
@@ -9,6 +9,7 @@
 #include "GSCAbilitySet.generated.h"
 
 class UAbilitySystemComponent;
+struct FStreamableHandle;
 
 /**
  * Data used to store handles to what has been granted by the ability set.
@@ -41,6 +42,9 @@ struct FGSCAbilitySetHandle
 	/** List of delegate that may have been registered to handle input binding when the ability is given on client */
 	TArray<FDelegateHandle> InputBindingDelegateHandles;
 
+	/** Handle keeping the assets of granted abilities loaded (eg. montages), if the Ability Set preloads them */
+	TSharedPtr<FStreamableHandle> PreloadHandle;
+
 	/** Default constructor */
 	FGSCAbilitySetHandle() = default;
 
@@ -58,6 +62,7 @@ struct FGSCAbilitySetHandle
 		EffectHandles.Empty();
 		Attributes.Empty();
 		OwnedTags.Reset();
+		PreloadHandle.Reset();
 	}
 
 	/** Returns a String representation of the Ability Set handle */
@@ -146,6 +151,15 @@ public:
 	UPROPERTY(EditDefaultsOnly, Category="Owned Gameplay Tags")
 	FGameplayTagContainer OwnedTags;
 
+	/**
+	 * If true, assets soft referenced by the Granted Abilities (eg. montages of melee abilities) are loaded asynchronously
+	 * as soon as the set is granted, and kept loaded until it is removed.
+	 *
+	 * This avoids a hitch on the first activation of abilities loading their assets on demand.
+	 */
+	UPROPERTY(EditDefaultsOnly, Category="Abilities")
+	bool bPreloadAbilityAssets = true;
+
 	/**
 	 * Grants itself (Ability Set) to the passed in ASC, adding defined Abilities, Attributes and Effects.
 	 *
@@ -6,6 +6,8 @@
 #include "AbilitySystemComponent.h"
 #include "GSCTypes.h"
 #include "Abilities/GSCAbilitySet.h"
+#include "Abilities/GSCGameplayEventBindingPool.h"
+#include "UObject/ObjectKey.h"
 #include "GSCAbilitySystemComponent.generated.h"
 
 class UGSCAbilityInputBindingComponent;
@@ -83,6 +85,7 @@ struct FGSCMappedAbility
 };
 
 DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnGiveAbility, FGameplayAbilitySpec&);
+DECLARE_MULTICAST_DELEGATE_OneParam(FGSCOnRemoveAbility, FGameplayAbilitySpec&);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnInitAbilityActorInfo);
 
 /**
@@ -156,6 +159,9 @@ public:
 	/** Delegate invoked OnGiveAbility (when an ability is granted and available) */
 	FGSCOnGiveAbility OnGiveAbilityDelegate;
 
+	/** Delegate invoked OnRemoveAbility (when an ability is about to be removed) */
+	FGSCOnRemoveAbility OnRemoveAbilityDelegate;
+
 	//~ Begin UActorComponent interface
 	virtual void BeginPlay() override;
 	//~ End UActorComponent interface
@@ -232,12 +238,26 @@ public:
 	/** Called from GrantDefaultAbilitiesAndAttributes. Determine if ability should be granted, prevents re-adding an ability previously granted in case bResetAbilitiesOnSpawn is set to false */
 	virtual bool ShouldGrantAbility(TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel = 1);
 	
+	/**
+	 * Returns whether an ability of exactly this class is granted at the given level.
+	 *
+	 * Answered from a registry maintained in OnGiveAbility / OnRemoveAbility, without iterating activatable abilities.
+	 * The level is the current level of the ability spec, which may differ from the one it was granted with.
+	 */
+	bool IsAbilityGranted(TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel = 1) const;
+
+	/** Returns the handle of an ability granted with exactly this class and level, or an invalid handle if there is none */
+	FGameplayAbilitySpecHandle FindGrantedAbilityHandle(TSubclassOf<UGameplayAbility> InAbility, const int32 InLevel = 1) const;
+
 	/** Called from GrantDefaultAbilitySets. Determine if ability set should be granted, prevents re-granting a set previously added */
 	virtual bool ShouldGrantAbilitySet(const UGSCAbilitySet* InAbilitySet) const;
 
 	/** Returns true whether the current owner actor is of type PlayerState */
 	bool IsPlayerStateOwner() const;
 
+	/** Returns the pool of gameplay event bindings shared by the ability tasks of this ASC waiting on gameplay events */
+	FGSCGameplayEventBindingPool& GetGameplayEventBindingPool() { return GameplayEventBindingPool; }
+
 protected:
 	// Cached granted Ability Handles
 	UPROPERTY(transient)
@@ -264,6 +284,7 @@ protected:
 
 	//~ Begin UAbilitySystemComponent interface
 	virtual void OnGiveAbility(FGameplayAbilitySpec& AbilitySpec) override;
+	virtual void OnRemoveAbility(FGameplayAbilitySpec& AbilitySpec) override;
 	//~ End UAbilitySystemComponent interface
 
 	/** Called when Ability System Component is initialized */
@@ -275,4 +296,28 @@ protected:
 
 	/** Handler for AbilitySystem OnGiveAbility delegate. Sets up input binding for clients (not authority) when ability is granted and available for binding. */
 	virtual void HandleOnGiveAbility(FGameplayAbilitySpec& AbilitySpec, UGSCAbilityInputBindingComponent* InputComponent, UInputAction* InputAction, EGSCAbilityTriggerEvent TriggerEvent, FGameplayAbilitySpec NewAbilitySpec);
+
+private:
+	/**
+	 * Handles of every granted ability spec, by exact ability class. Used by grant checks instead of iterating (and copying) activatable abilities.
+	 *
+	 * Not keyed by level as a spec level can change after it was granted, the level is checked against the specs instead.
+	 */
+	TMap<TObjectKey<UClass>, TArray<FGameplayAbilitySpecHandle, TInlineAllocator<1>>> GrantedAbilityRegistry;
+
+	/**
+	 * Index of each granted ability spec in ActivatableAbilities, by handle. Lets grant checks read the current level of a spec without iterating activatable abilities.
+	 *
+	 * Specs can move in the array (removals swap them, replication reorders them), stale indices are detected and everything is re-indexed at once.
+	 */
+	mutable TMap<FGameplayAbilitySpecHandle, int32> AbilitySpecIndices;
+
+	/** Returns the granted ability spec with this handle, using AbilitySpecIndices */
+	const FGameplayAbilitySpec* FindIndexedAbilitySpec(const FGameplayAbilitySpecHandle& InHandle) const;
+
+	/** Returns the handle of an ability granted with exactly this class, whatever its level, or an invalid handle if there is none */
+	FGameplayAbilitySpecHandle FindAnyGrantedAbilityHandle(TSubclassOf<UGameplayAbility> InAbility) const;
+
+	/** Gameplay event bindings reused across ability tasks, instead of adding and removing a delegate for each of them */
+	FGSCGameplayEventBindingPool GameplayEventBindingPool;
 };
@@ -23,6 +23,7 @@ struct FGSCGameFeatureAttributeSetMapping;
 struct FGameplayAbilitySpec;
 struct FGameplayAbilitySpecHandle;
 struct FGameplayTagContainer;
+struct FStreamableHandle;
 
 /**
  * Utilities class with a bunch of statics to provide common shared code facilities to grant various things to an ASC.
@@ -46,6 +47,9 @@ public:
 	static void TryGrantAttributes(UAbilitySystemComponent* InASC, const FGSCGameFeatureAttributeSetMapping& InAttributeSetMapping, UAttributeSet*& OutAttributeSet);
 	static void TryGrantGameplayEffect(UAbilitySystemComponent* InASC, const TSubclassOf<UGameplayEffect> InEffectType, const float InLevel, TArray<FActiveGameplayEffectHandle>& OutEffectHandles);
 	static bool TryGrantAbilitySet(UAbilitySystemComponent* InASC, const UGSCAbilitySet* InAbilitySet, FGSCAbilitySetHandle& OutAbilitySetHandle, TArray<TSharedPtr<FComponentRequestHandle>>* OutComponentRequests = nullptr);
+
+	/** Starts loading asynchronously the assets needed by the abilities of the passed in set, returns the handle keeping them loaded (null if there is nothing to load) */
+	static TSharedPtr<FStreamableHandle> TryPreloadAbilitySetAssets(const UGSCAbilitySet* InAbilitySet);
 	
 	/** Helper to return the AttributeSet UObject as a non const pointer, if the passed in ASC has it granted */
 	static UAttributeSet* GetAttributeSet(const UAbilitySystemComponent* InASC, const TSubclassOf<UAttributeSet> InAttributeSet);
@@ -0,0 +1,67 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+
+/**
+ * Native lookup structure used by GSCCoreComponent to answer "which abilities are currently running" queries.
+ *
+ * Active ability instances are tracked from the ASC AbilityActivatedCallbacks / AbilityEndedCallbacks delegates and
+ * stored in buckets keyed by ability class and by ability tag (including all parent tags), so that queries cost
+ * O(result) instead of copying and walking every granted ability spec.
+ *
+ * Only instanced abilities are tracked. Non instanced abilities have no running instance to return.
+ */
+struct GASCOMPANION_API FGSCActiveAbilityIndex
+{
+public:
+	/** Removes all tracked abilities */
+	void Reset();
+
+	/** Resets the index and fills it from the currently active instances of the passed in ASC */
+	void Rebuild(const UAbilitySystemComponent& InASC);
+
+	/** Starts tracking an ability instance. Called when an ability is activated. */
+	void Add(UGameplayAbility* InAbility);
+
+	/** Stops tracking an ability instance. Called when an ability ends. */
+	void Remove(const UGameplayAbility* InAbility);
+
+	/** Appends all active ability instances of the given class, or any of its subclasses, to the output array */
+	void GetByClass(const UClass* InAbilityClass, TArray<UGameplayAbility*>& OutAbilities) const;
+
+	/** Appends all active ability instances that have all the given ability tags to the output array */
+	void GetByTags(const FGameplayTagContainer& InAbilityTags, TArray<UGameplayAbility*>& OutAbilities) const;
+
+	/** Returns whether any active ability instance is of the given class, or any of its subclasses */
+	bool HasAnyByClass(const UClass* InAbilityClass) const;
+
+	/** Returns whether any active ability instance has all the given ability tags */
+	bool HasAnyByTags(const FGameplayTagContainer& InAbilityTags) const;
+
+	/** Returns the ability tags of an ability, handling API differences between engine versions */
+	static const FGameplayTagContainer& GetAbilityTags(const UGameplayAbility* InAbility);
+
+private:
+	using FAbilityBucket = TArray<TWeakObjectPtr<UGameplayAbility>>;
+
+	/** Returns the ability if it is still valid and active */
+	static UGameplayAbility* ResolveActive(const TWeakObjectPtr<UGameplayAbility>& InAbility);
+
+	/** Removes the ability from a bucket, along with any stale entry. Removes the bucket from the map once empty */
+	template<typename KeyType>
+	static void RemoveFromBucket(TMap<KeyType, FAbilityBucket>& InMap, const KeyType& InKey, const UGameplayAbility* InAbility);
+
+	/** Tracked ability instances, per exact ability class */
+	TMap<TObjectKey<UClass>, FAbilityBucket> AbilitiesByClass;
+
+	/** Tracked ability instances, per ability tag and all parents of the ability tags */
+	TMap<FGameplayTag, FAbilityBucket> AbilitiesByTag;
+};
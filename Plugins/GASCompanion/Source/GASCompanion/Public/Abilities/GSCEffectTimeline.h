@@ -0,0 +1,129 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "GameplayTagContainer.h"
+#include "UObject/ObjectKey.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UAbilitySystemComponent;
+class UGameplayAbility;
+struct FActiveGameplayEffect;
+
+/**
+ * Native timeline of the active duration / infinite gameplay effects of an ASC, used by GSCCoreComponent.
+ *
+ * Each active effect is stored once with its asset / granted tags and timing, and indexed by granted tag (including all
+ * parent tags) and, for cooldown effects, by the class of the ability that applied them. Time remaining for a tag or an
+ * ability cooldown is kept up to date as effects are added, removed or have their duration changed, so that polling it
+ * (eg. from HUD widgets every frame) costs a map lookup instead of an active effects query.
+ */
+struct GASCOMPANION_API FGSCEffectTimeline
+{
+public:
+	struct FEntry
+	{
+		FActiveGameplayEffectHandle Handle;
+		FGameplayTagContainer AssetTags;
+		FGameplayTagContainer GrantedTags;
+
+		/** Ability (CDO) that applied this effect as its cooldown, if any */
+		TWeakObjectPtr<const UGameplayAbility> CooldownAbility;
+
+		/** World time the effect started at */
+		float StartTime = 0.f;
+
+		/** Duration of the effect, negative for infinite effects */
+		float Duration = -1.f;
+
+		bool IsInfinite() const { return Duration < 0.f; }
+		bool IsCooldown() const { return CooldownAbility.IsValid(); }
+		float GetEndTime() const { return IsInfinite() ? -1.f : StartTime + Duration; }
+	};
+
+	/** Removes all tracked effects */
+	void Reset();
+
+	/** Resets the timeline and fills it from the currently active gameplay effects of the passed in ASC */
+	void Rebuild(const UAbilitySystemComponent& InASC);
+
+	/** Starts tracking an active gameplay effect. Instant effects are ignored. */
+	const FEntry* Add(const FActiveGameplayEffect& InEffect);
+
+	/** Updates timing of a tracked effect. Called when an effect duration is refreshed or modified. */
+	void UpdateTime(FActiveGameplayEffectHandle InHandle, float InStartTime, float InDuration);
+
+	/**
+	 * Stops tracking an effect. Called when an effect is removed.
+	 *
+	 * @param InHandle Handle of the removed effect
+	 * @param OutEntry Receives the removed entry (optional)
+	 * @return Whether the effect was tracked
+	 */
+	bool Remove(FActiveGameplayEffectHandle InHandle, FEntry* OutEntry = nullptr);
+
+	/** Returns the tracked entry for the given handle */
+	const FEntry* Find(FActiveGameplayEffectHandle InHandle) const;
+
+	/** Appends the handles of all tracked effects to the output array */
+	void GetHandles(TArray<FActiveGameplayEffectHandle>& OutHandles) const;
+
+	/** Returns the number of tracked effects */
+	int32 Num() const;
+
+	/** Returns whether any tracked effect grants the given tag (or one of its child tags) */
+	bool HasTag(const FGameplayTag& InTag) const;
+
+	/**
+	 * Returns the longest time remaining and matching duration of the effects granting the given tag (or one of its child tags).
+	 *
+	 * Infinite effects report -1 for both, unless a finite effect grants the tag as well.
+	 *
+	 * @return Whether any tracked effect grants the tag
+	 */
+	bool GetTimeRemainingAndDuration(const FGameplayTag& InTag, float InWorldTime, float& OutTimeRemaining, float& OutDuration) const;
+
+	/** Same as above, for the longest time remaining of any of the given tags */
+	bool GetTimeRemainingAndDuration(const FGameplayTagContainer& InTags, float InWorldTime, float& OutTimeRemaining, float& OutDuration) const;
+
+	/**
+	 * Returns time remaining and duration of the cooldown applied by abilities of the given class.
+	 *
+	 * @return Whether a cooldown effect applied by this ability class is active
+	 */
+	bool GetCooldownTimeRemainingAndDuration(const UClass* InAbilityClass, float InWorldTime, float& OutTimeRemaining, float& OutDuration) const;
+
+private:
+	/** Aggregated timing of all effects registered under the same key */
+	struct FKeyState
+	{
+		TArray<FActiveGameplayEffectHandle, TInlineAllocator<2>> Handles;
+
+		/** Timing of the finite effect ending last */
+		float StartTime = 0.f;
+		float Duration = -1.f;
+		bool bHasFiniteEffect = false;
+	};
+
+	void Link(const FEntry& InEntry);
+	void Unlink(const FEntry& InEntry);
+	void RecomputeState(FKeyState& InState) const;
+
+	template<typename KeyType>
+	void AddToState(TMap<KeyType, FKeyState>& InMap, const KeyType& InKey, const FEntry& InEntry);
+
+	template<typename KeyType>
+	void RemoveFromState(TMap<KeyType, FKeyState>& InMap, const KeyType& InKey, FActiveGameplayEffectHandle InHandle);
+
+	static bool GetStateTimeRemainingAndDuration(const FKeyState& InState, float InWorldTime, float& OutTimeRemaining, float& OutDuration);
+
+	/** Every tag and parent tag an entry is registered under */
+	static void GetTagKeys(const FEntry& InEntry, TSet<FGameplayTag>& OutTagKeys);
+
+	TMap<FActiveGameplayEffectHandle, FEntry> Entries;
+
+	TMap<FGameplayTag, FKeyState> StatesByTag;
+	TMap<TObjectKey<UClass>, FKeyState> CooldownStatesByAbilityClass;
+};
@@ -109,6 +109,13 @@ public:
 	/** Called on ability end */
 	void AbilityEnded(UGameplayAbility* Ability);
 
+	/**
+	 * Appends the soft referenced assets this ability needs when activated (eg. montages) to the passed in array.
+	 *
+	 * Called on the ability CDO by Ability Sets granting this ability, to load them asynchronously ahead of the first activation.
+	 */
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssetPaths) const {}
+
 protected:
 
 	//~Begin UGameplayAbility interface
@@ -7,6 +7,8 @@
 #include "GSCGameplayAbility_MeleeBase.generated.h"
 
 class UGSCComboManagerComponent;
+struct FStreamableHandle;
+
 /**
  *
  */
@@ -19,13 +21,27 @@ class GASCOMPANION_API UGSCGameplayAbility_MeleeBase : public UGSCGameplayAbilit
 public:
 	UGSCGameplayAbility_MeleeBase();
 
+	//~ Begin UGameplayAbility interface
+	virtual void OnGiveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+	virtual void OnRemoveAbility(const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilitySpec& Spec) override;
+	//~ End UGameplayAbility interface
+
+	//~ Begin UGSCGameplayAbility interface
+	virtual void GetAssetsToPreload(TArray<FSoftObjectPath>& OutAssetPaths) const override;
+	//~ End UGSCGameplayAbility interface
+
 protected:
 	UPROPERTY()
 	TObjectPtr<UGSCComboManagerComponent> ComboManagerComponent;
 
-	/** List of animation montages you want to cycle through when activating this ability */
+	/**
+	 * List of animation montages you want to cycle through when activating this ability.
+	 *
+	 * Montages are soft referenced: they are preloaded asynchronously when this ability is granted, and kept loaded
+	 * until it is removed.
+	 */
 	UPROPERTY(EditDefaultsOnly, Category="Montages")
-	TArray<TObjectPtr<UAnimMontage>> Montages;
+	TArray<TSoftObjectPtr<UAnimMontage>> Montages;
 
 	/** Change to play the montage faster or slower */
 	UPROPERTY(EditDefaultsOnly, Category="Montages")
@@ -46,6 +62,19 @@ protected:
 	UFUNCTION()
 	void OnEventReceived(FGameplayTag EventTag, FGameplayEventData EventData);
 
+	/**
+	 * Returns the montage to play for the current combo index.
+	 *
+	 * Montages are preloaded when the ability is granted. One that did not finish loading yet is loaded synchronously.
+	 */
 	UFUNCTION(BlueprintPure, Category="GAS Companion|Ability|Melee")
 	UAnimMontage* GetNextComboMontage();
+
+	/** Returns a soft reference to the montage to play for the current combo index */
+	UFUNCTION(BlueprintPure, Category="GAS Companion|Ability|Melee")
+	TSoftObjectPtr<UAnimMontage> GetNextComboSoftMontage();
+
+private:
+	/** Keeps Montages loaded while this ability is granted */
+	TSharedPtr<FStreamableHandle> MontagesPreloadHandle;
 };
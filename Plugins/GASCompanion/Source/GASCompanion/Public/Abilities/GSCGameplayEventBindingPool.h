@@ -0,0 +1,62 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AbilitySystemComponent.h"
+#include "GameplayTagContainer.h"
+
+/**
+ * Pool of gameplay event bindings for an ASC, used by GSC ability tasks waiting on gameplay events (eg. UGSCTask_PlayMontageWaitForEvent).
+ *
+ * Every unique tag container is bound once to the ASC, the first time a listener registers for it, and that binding is kept
+ * around once its last listener unregisters. Subsequent listeners (eg. every swing of a melee combo) only add themselves to
+ * the listeners of the existing binding instead of adding and removing a delegate on the ASC every time.
+ *
+ * Bindings are looked up by a hash of the tag container that callers are expected to compute once with HashTags().
+ */
+struct GASCOMPANION_API FGSCGameplayEventBindingPool
+{
+public:
+	/** Returns an order independent hash of the passed in tags, to use as key when registering and unregistering listeners */
+	static uint32 HashTags(const FGameplayTagContainer& InTags);
+
+	/**
+	 * Registers a listener for gameplay events matching any of the passed in tags, binding the tags to the ASC if needed.
+	 *
+	 * @param InASC ASC owning this pool
+	 * @param InTags Tags to match gameplay events against
+	 * @param InTagsHash Hash of InTags, as returned by HashTags()
+	 * @param InDelegate Listener to call when a matching gameplay event happens
+	 * @return Handle to unregister the listener, invalid if tags hash collides with another container (caller is expected to bind to the ASC directly then)
+	 */
+	FDelegateHandle Register(UAbilitySystemComponent& InASC, const FGameplayTagContainer& InTags, uint32 InTagsHash, FGameplayEventTagMulticastDelegate::FDelegate&& InDelegate);
+
+	/** Removes a listener previously registered with the same tags hash. The ASC binding is kept around for later reuse. */
+	void Unregister(uint32 InTagsHash, FDelegateHandle InHandle);
+
+	/** Removes all bindings from the ASC (if still valid) and clears up the pool */
+	void Reset(UAbilitySystemComponent* InASC);
+
+	/** Returns the number of tag containers bound to the ASC */
+	int32 NumBindings() const;
+
+	/** Returns the number of listeners currently registered for the given tags hash */
+	int32 NumListeners(uint32 InTagsHash) const;
+
+private:
+	struct FBinding
+	{
+		FGameplayTagContainer Tags;
+
+		/** Handle of the delegate bound to the ASC for these tags */
+		FDelegateHandle Handle;
+
+		/** Listeners, shared with the delegate bound to the ASC */
+		TSharedRef<FGameplayEventTagMulticastDelegate> Listeners = MakeShared<FGameplayEventTagMulticastDelegate>();
+
+		int32 NumListeners = 0;
+	};
+
+	TMap<uint32, FBinding> Bindings;
+};
@@ -8,6 +8,8 @@
 #include "Animation/AnimMontage.h"
 #include "GSCTask_PlayMontageWaitForEvent.generated.h"
 
+struct FStreamableHandle;
+
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGSCPlayMontageAndWaitForEventDelegate, FGameplayTag, EventTag, FGameplayEventData, EventData);
 
 /**
@@ -88,11 +90,40 @@ public:
         bool bStopWhenAbilityEnds = true,
         float AnimRootMotionTranslationScale = 1.f);
 
+	/**
+	* Same as PlayMontageAndWaitForEvent, with a soft reference to the montage to play.
+	*
+	* If the montage is not loaded yet (eg. not preloaded by the Ability Set granting the ability), it is loaded asynchronously
+	* and played once loading completes, instead of hitching the game thread with a synchronous load.
+	*
+	* @param TaskInstanceName Set to override the name of this task, for later querying
+	* @param MontageToPlay The montage to play on the character, loaded asynchronously if needed
+	* @param EventTags Any gameplay events matching this tag will activate the EventReceived callback. If empty, all events will trigger callback
+	* @param Rate Change to play the montage faster or slower
+	* @param StartSection Change to montage section to play during montage
+	* @param bStopWhenAbilityEnds If true, this montage will be aborted if the ability ends normally. It is always stopped when the ability is explicitly cancelled
+	* @param AnimRootMotionTranslationScale Change to modify size of root motion or set to 0 to block it entirely
+	*/
+	UFUNCTION(BlueprintCallable, Category= "Ability|GAS Companion|Tasks", meta = (HidePin = "OwningAbility", DefaultToSelf = "OwningAbility", BlueprintInternalUseOnly = "TRUE"))
+	static UGSCTask_PlayMontageWaitForEvent* PlaySoftMontageAndWaitForEvent(
+		UGameplayAbility* OwningAbility,
+		FName TaskInstanceName,
+		TSoftObjectPtr<UAnimMontage> MontageToPlay,
+		FGameplayTagContainer EventTags,
+		float Rate = 1.f,
+		FName StartSection = NAME_None,
+		bool bStopWhenAbilityEnds = true,
+		float AnimRootMotionTranslationScale = 1.f);
+
 private:
 	/** Montage that is playing */
 	UPROPERTY()
 	TObjectPtr<UAnimMontage> MontageToPlay;
 
+	/** Soft reference to the montage to play, resolved (and loaded if needed) on activation when MontageToPlay is not set */
+	UPROPERTY()
+	TSoftObjectPtr<UAnimMontage> SoftMontageToPlay;
+
 	/** List of tags to match against gameplay events */
 	UPROPERTY()
 	FGameplayTagContainer EventTags;
@@ -113,6 +144,24 @@ private:
 	UPROPERTY()
 	bool bStopWhenAbilityEnds = true;
 
+	/** Hash of EventTags, computed once on creation to look up pooled gameplay event bindings */
+	uint32 EventTagsHash = 0;
+
+	/** Whether EventHandle was registered with the gameplay event binding pool of a UGSCAbilitySystemComponent */
+	bool bEventHandleFromPool = false;
+
+	/** Pending async load of SoftMontageToPlay */
+	TSharedPtr<FStreamableHandle> MontageLoadHandle;
+
+	/** Binds gameplay events and plays MontageToPlay. Broadcasts OnCancelled if the montage couldn't be played. */
+	void PlayMontage();
+
+	/** Called once SoftMontageToPlay finished async loading */
+	void OnMontageLoaded();
+
+	void BindGameplayEvents(UAbilitySystemComponent& InASC);
+	void UnbindGameplayEvents(UAbilitySystemComponent& InASC);
+
 	/** Checks if the ability is playing a montage and stops that montage, returns true if a montage was stopped, false if not. */
 	bool StopPlayingMontage() const;
 
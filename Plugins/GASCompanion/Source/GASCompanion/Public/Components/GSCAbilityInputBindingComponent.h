@@ -6,6 +6,7 @@
 #include "GameplayAbilitySpec.h"
 #include "Abilities/GSCTypes.h"
 #include "Components/GSCPlayerControlsComponent.h"
+#include "UObject/ObjectKey.h"
 #include "GSCAbilityInputBindingComponent.generated.h"
 
 USTRUCT()
@@ -25,6 +26,11 @@ struct FGSCAbilityInputBinding
  * Modular pawn component that hooks up enhanced input to the ability system input logic
  *
  * Extends from GSCPlayerControlsComponent, so if your Pawn is dealing with Abilities use this component instead.
+ *
+ * Bindings are indexed by InputID, ability spec handle and ability class, so that querying the input action bound to
+ * an ability (eg. from HUD widgets every frame) is a map lookup. The index is rebuilt lazily after a binding change,
+ * or when an ability is granted / removed (through GSCAbilitySystemComponent delegates, or by watching the number of
+ * activatable abilities for other ASCs).
  */
 UCLASS(ClassGroup="GASCompanion", meta=(BlueprintSpawnableComponent))
 class GASCOMPANION_API UGSCAbilityInputBindingComponent : public UGSCPlayerControlsComponent
@@ -145,6 +151,9 @@ public:
 	/** Internal helper to return InputAction from MappedAbilities that match Ability Spec InputID */
 	UInputAction* GetBoundInputActionForAbilitySpec(const FGameplayAbilitySpec* AbilitySpec) const;
 
+	/** Returns the InputAction bound to the given Ability Spec handle, if any */
+	UInputAction* GetBoundInputActionForAbilityHandle(FGameplayAbilitySpecHandle AbilityHandle);
+
 private:
 	UPROPERTY(transient)
 	TObjectPtr<UAbilitySystemComponent> AbilityComponent;
@@ -158,13 +167,51 @@ private:
 	/** List of all enhanced input handles that were bound by the component, that needs clearing when the input component is released */
 	TArray<uint32> RegisteredInputHandles;
 
+	/** Binding index, derived from MappedAbilities */
+	TMap<int32, TObjectPtr<UInputAction>> InputActionsByInputID;
+	TMap<FGameplayAbilitySpecHandle, TObjectPtr<UInputAction>> InputActionsByAbilityHandle;
+	TMap<TObjectKey<UClass>, TObjectPtr<UInputAction>> InputActionsByAbilityClass;
+
+	/** Set whenever bindings, or abilities granted to the ASC, changed since last index rebuild */
+	bool bBindingIndexDirty = true;
+
+	/**
+	 * Index in the activatable abilities of the ASC of each bound ability spec, when the binding index was last built.
+	 *
+	 * Checked against the spec handle on use, so that grants / removals moving or removing bound specs are caught for non GSC ASCs.
+	 */
+	TMap<FGameplayAbilitySpecHandle, int32> BoundAbilitySpecIndices;
+
+	FDelegateHandle OnGiveAbilityDelegateHandle;
+	FDelegateHandle OnRemoveAbilityDelegateHandle;
+
 	void ResetBindings();
 	void RunAbilitySystemSetup();
 
+	/** Starts / stops listening to abilities being granted or removed on AbilityComponent */
+	void RegisterAbilitySystemDelegates();
+	void UnregisterAbilitySystemDelegates();
+
+	void OnAbilityGivenOrRemoved(FGameplayAbilitySpec& AbilitySpec);
+
+	/** Flags the binding index for rebuild on next query */
+	void MarkBindingIndexDirty();
+
+	/** Rebuilds the binding index if needed, and re-applies InputIDs to bound ability specs when it does */
+	void UpdateBindingIndex();
+
+	/** Returns whether every bound ability spec is still at the index it was at when the binding index was built */
+	bool AreBoundAbilitySpecIndicesValid() const;
+
+	/** Re-applies the InputID of a binding to the specs bound to it, found through BoundAbilitySpecIndices */
+	void ApplyInputID(const FGSCAbilityInputBinding& AbilityInputBinding) const;
+
 	/**
-	 * Runs on press / release, and updates inputs ID for specs based on mapped abilities.
+	 * Updates inputs ID for specs based on mapped abilities.
 	 *
-	 * Needs to run everytime to handle the issue with lost inputID when playing as client after first PIE session if BP containing ASC is compiled in Editor. */
+	 * Used for ASCs other than the one bound to this component. For the bound one, UpdateBindingIndex() does the same whenever bindings
+	 * or granted abilities changed, and ApplyInputID() on every press / release for the specs of that input, to handle the issue with lost
+	 * inputID when playing as client after first PIE session if BP containing ASC is compiled in Editor. */
 	void UpdateAbilitySystemBindings(UAbilitySystemComponent* AbilitySystemComponent);
 
 	void OnAbilityInputPressed(UInputAction* InputAction);
@@ -175,6 +222,9 @@ private:
 	void RemoveEntry(const UInputAction* InputAction);
 
 	FGameplayAbilitySpec* FindAbilitySpec(FGameplayAbilitySpecHandle Handle) const;
+
+	/** Same as FindAbilitySpec() for bound abilities, without iterating activatable abilities while BoundAbilitySpecIndices is up to date */
+	FGameplayAbilitySpec* FindBoundAbilitySpec(FGameplayAbilitySpecHandle Handle) const;
 	void TryBindAbilityInput(UInputAction* InputAction, FGSCAbilityInputBinding& AbilityInputBinding);
 
 	static ETriggerEvent GetInputActionTriggerEvent(EGSCAbilityTriggerEvent TriggerEvent);
@@ -11,9 +11,36 @@
 class UAbilitySystemComponent;
 class UGameplayAbility;
 
+/** An ability that failed to activate while the ability queue was opened, waiting to be activated. */
+USTRUCT(BlueprintType)
+struct GASCOMPANION_API FGSCQueuedAbilityInput
+{
+	GENERATED_BODY()
+
+	/** The ability that failed to activate */
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Ability Queue System")
+	TObjectPtr<UGameplayAbility> Ability;
+
+	/** World time (in seconds) at which this input was queued */
+	UPROPERTY(BlueprintReadOnly, Category = "GAS Companion|Ability Queue System")
+	double QueuedTime = 0.0;
+
+	/** Number of times a predicted activation of this input got rejected by the server */
+	int32 RejectedCount = 0;
+};
+
 /**
  * Actor Component responsible for Ability Queueing.
  *
+ * Abilities failing to activate while the queue is opened are stored in a bounded input buffer, each with the time
+ * it was queued at. When the current ability ends, the oldest input still within its lifetime is activated. The
+ * component doesn't tick, everything is driven by ability ended / failed events.
+ *
+ * On predicting clients, the activation of a queued input is locally predicted. If the server rejects the prediction
+ * key (for instance because the previous ability didn't end yet on the server), activation of the input is retried on
+ * next frame, as long as it didn't expire and has retries left (see MaxRejectedRetries). Retried inputs don't go back
+ * in the buffer.
+ *
  * Note that with current implementation, ability activation must be manually handled in BP. Ability Queueing won't work
  * for abilities bound by input with GSCAbilityInputBinding.
  */
@@ -35,6 +62,26 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System")
 	bool bAbilityQueueEnabled = true;
 
+	/**
+	 * Maximum number of inputs kept in the buffer. When full, the oldest input is dropped.
+	 *
+	 * Default of 1 keeps only the last queued ability.
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System", meta = (ClampMin = "1", UIMin = "1", UIMax = "8"))
+	int32 MaxQueuedInputs = 1;
+
+	/**
+	 * Time (in seconds) a queued input stays valid. Expired inputs are discarded instead of being activated.
+	 *
+	 * A value of 0 means queued inputs expire when the queue window is reset (eg. once an ability ended).
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System", meta = (ClampMin = "0.0", UIMin = "0.0", Units = "s"))
+	float QueuedInputLifetime = 0.f;
+
+	/** Number of times an input is retried after its predicted activation got rejected by the server */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "GAS Companion|Ability Queue System", AdvancedDisplay, meta = (ClampMin = "0", UIMin = "0"))
+	int32 MaxRejectedRetries = 2;
+
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
 
@@ -64,6 +111,12 @@ public:
 
     const UGameplayAbility* GetCurrentQueuedAbility() const;
 
+	/** Returns the inputs currently in the buffer, from oldest to newest. */
+	const TArray<FGSCQueuedAbilityInput>& GetQueuedInputs() const;
+
+	/** Discards all queued inputs. */
+	void ClearQueuedInputs();
+
     TArray<TSubclassOf<UGameplayAbility>> GetQueuedAllowedAbilities() const;
 
 	/**
@@ -90,16 +143,42 @@ protected:
 	bool bAbilityQueueOpened = false;
 	bool bAllowAllAbilitiesForAbilityQueue = false;
 
+	/** Input buffer, ordered from oldest to newest */
 	UPROPERTY()
-	TObjectPtr<UGameplayAbility> QueuedAbility;
+	TArray<FGSCQueuedAbilityInput> QueuedInputs;
 	
 	TArray<TSubclassOf<UGameplayAbility>> QueuedAllowedAbilities;
 
 	/**
 	* Reset all variables involved in the Ability Queue System to their original default values.
+	*
+	* Queued inputs that were not consumed yet are kept in the buffer until they are activated or expire.
 	*/
 	virtual void ResetAbilityQueueState();
 
+	/** Adds an input to the buffer, dropping the oldest one if the buffer is full. */
+	void AddQueuedInput(const FGSCQueuedAbilityInput& InQueuedInput);
+
+	/** Removes inputs that are older than QueuedInputLifetime. */
+	void RemoveExpiredQueuedInputs();
+
+	/** Checks whether the given ability is allowed by the currently opened queue window. */
+	bool IsAbilityAllowedForAbilityQueue(const UGameplayAbility* InAbility) const;
+
+	/**
+	 * Tries to activate the queued input, and listens for prediction key rejection on predicting clients.
+	 *
+	 * @return True if the ability was activated (or predicted to be)
+	 */
+	bool ActivateQueuedInput(const FGSCQueuedAbilityInput& InQueuedInput);
+
+	/**
+	 * Called on predicting clients when the server rejected the activation of a queued input.
+	 *
+	 * The input is activated again on next frame if it didn't expire and has retries left.
+	 */
+	void OnQueuedInputRejected(FGSCQueuedAbilityInput InQueuedInput);
+
 	/**
 	* Notify Debug Ability Queue Widget by updating its allowed abilities
 	*/
@@ -5,6 +5,7 @@
 #include "CoreMinimal.h"
 #include "Abilities/GameplayAbility.h"
 #include "Components/ActorComponent.h"
+#include "Components/GSCComboPrediction.h"
 #include "GSCComboManagerComponent.generated.h"
 
 class UGSCCoreComponent;
@@ -52,6 +53,46 @@ public:
 	bool bNextComboAbilityActivated = false;
 
 	virtual void GetLifetimeReplicatedProps(TArray<FLifetimeProperty>& OutLifetimeProps) const override;
+	virtual void PreReplication(IRepChangedPropertyTracker& ChangedPropertyTracker) override;
+
+	/**
+	 * Stops replicating combo state, eg. for AI demoted by the GSC Significance subsystem. Combo state changed in the
+	 * meantime is sent as soon as minimal replication is turned off.
+	 */
+	void SetMinimalReplication(bool bInMinimalReplication);
+
+	/** Returns whether combo state replication is currently turned off */
+	bool IsUsingMinimalReplication() const { return bMinimalReplication; }
+
+	/**
+	 * Returns whether combo state is resolved on this machine: on the server, and on the owning client which predicts
+	 * it from its own montage (combo window notifies) and input.
+	 */
+	bool IsResolvingComboLocally() const;
+
+	/** Returns whether this is the owning client, predicting combo state ahead of the server */
+	bool IsLocallyPredicting() const;
+
+	/** Server: Resolves a combo input received from the owning client, within the prediction window of the active combo ability */
+	void ResolveComboInputFrame(const FGSCComboInputFrame& InFrame);
+
+	/**
+	 * Server: Resolves combo inputs the owning client sends as target data of a combo ability activation.
+	 *
+	 * Keeps listening after the ability ended, until the next activation, so that inputs arriving once the combo ended
+	 * on the server are still acknowledged (and rejected) instead of being left pending on the owning client.
+	 */
+	void ListenForComboInputFrames(UAbilitySystemComponent* InASC, FGameplayAbilitySpecHandle InAbilityHandle, FPredictionKey InActivationPredictionKey);
+
+	/** Server: Activates the next combo ability of the currently active combo */
+	bool ActivateNextComboAbility();
+
+	/**
+	 * Server: Combo window is closing without the next combo activated. Activates it if an input of the owning client
+	 * triggered it after the last tick of the window. Otherwise, inputs the owning client made within this combo window
+	 * can still trigger the next combo when they come late, as long as the combo ability is active.
+	 */
+	void CloseComboWindow();
 
 	/** Setup GetOwner to character and sets references for ability system component and the owner itself. */
 	void SetupOwner();
@@ -83,24 +124,46 @@ protected:
 
 	//~Begin UActorComponent interface
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	virtual void OnRegister() override;
 	//~End UActorComponent interface
 
-	UFUNCTION(Server, Reliable)
-	void ServerActivateComboAbility(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
+	void ActivateComboAbilityInternal(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastActivateComboAbility(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
+	/** Client: Sends the combo input resolved locally to the server, as target data of the active combo ability */
+	void SendComboInputFrame();
 
-	void ActivateComboAbilityInternal(TSubclassOf<UGSCGameplayAbility> AbilityClass, bool bAllowRemoteActivation = true);
+	/** Server: Combo input frames sent by the owning client, see ListenForComboInputFrames() */
+	void OnComboInputFrameReceived(const FGameplayAbilityTargetDataHandle& Data, FGameplayTag ApplicationTag);
+
+	void StopListeningForComboInputFrames();
+
+	/**
+	 * Combo state as seen by the server, replicated as a whole to the owning client only, along with the last input
+	 * frame it accounts for. Filled right before replication. Other clients get the individual combo state properties.
+	 */
+	UPROPERTY(ReplicatedUsing = OnRep_ComboState)
+	FGSCComboState ReplicatedComboState;
 
-	UFUNCTION(Server, Reliable)
-	void ServerSetComboIndex(int32 InComboIndex);
+	UFUNCTION()
+	void OnRep_ComboState();
 
-	UFUNCTION(NetMulticast, Reliable)
-	void MulticastSetComboIndex(int32 InComboIndex);
+	FGSCComboState GetComboState() const;
+	void SetComboState(const FGSCComboState& InComboState);
 
 private:
+	/** Input frames made (owning client) or resolved (server) */
+	FGSCComboPrediction ComboPrediction;
+
+	/** Server: Target data of the combo ability activation input frames are received from */
+	TWeakObjectPtr<UAbilitySystemComponent> ComboInputFrameASC;
+	FGameplayAbilitySpecHandle ComboInputFrameAbilityHandle;
+	FPredictionKey ComboInputFramePredictionKey;
+	FDelegateHandle ComboInputFrameDelegateHandle;
+
+	/** Whether combo state replication is turned off */
+	bool bMinimalReplication = false;
+
 	/** Caches the flags that indicate whether this component has network authority. */
 	void CacheIsNetSimulated();
 };
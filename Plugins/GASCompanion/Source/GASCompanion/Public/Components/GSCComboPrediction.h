@@ -0,0 +1,157 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GameplayAbilityTargetTypes.h"
+#include "GSCComboPrediction.generated.h"
+
+/** Combo state of a GSCComboManagerComponent, replicated from the server as a whole */
+USTRUCT()
+struct GASCOMPANION_API FGSCComboState
+{
+	GENERATED_BODY()
+
+	UPROPERTY()
+	int32 ComboIndex = 0;
+
+	UPROPERTY()
+	bool bComboWindowOpened = false;
+
+	UPROPERTY()
+	bool bShouldTriggerCombo = false;
+
+	UPROPERTY()
+	bool bRequestTriggerCombo = false;
+
+	UPROPERTY()
+	bool bNextComboAbilityActivated = false;
+
+	/** Last input frame of the owning client resolved by the server when this state was replicated */
+	UPROPERTY()
+	uint8 InputFrame = 0;
+
+	/** Whether the server resolved InputFrame to trigger the next combo */
+	UPROPERTY()
+	bool bInputFrameTriggeredCombo = false;
+};
+
+/**
+ * Combo input resolved locally by an owning client, sent to the server as target data of the active combo ability.
+ *
+ * Going through the target data of the ability means the input is carried within the prediction window of the combo
+ * ability activation, instead of requiring RPCs of its own.
+ */
+USTRUCT()
+struct GASCOMPANION_API FGSCComboInputFrame : public FGameplayAbilityTargetData
+{
+	GENERATED_BODY()
+
+	/** Sequence number of this input, wraps around */
+	UPROPERTY()
+	uint8 InputFrame = 0;
+
+	/** Combo index the client was at when the input happened */
+	UPROPERTY()
+	int32 ComboIndex = 0;
+
+	/** Whether the client resolved the input within its combo window (eg. next combo should trigger) */
+	UPROPERTY()
+	bool bTriggerCombo = false;
+
+	virtual UScriptStruct* GetScriptStruct() const override
+	{
+		return StaticStruct();
+	}
+
+	virtual FString ToString() const override;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+};
+
+template<>
+struct TStructOpsTypeTraits<FGSCComboInputFrame> : public TStructOpsTypeTraitsBase2<FGSCComboInputFrame>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Input frame bookkeeping of the combo manager component, used on both ends.
+ *
+ * The owning client resolves combo inputs against its own combo window (driven by the same montage notifies as the
+ * server) and numbers them, along with the combo index they were made at. The server resolves each frame against the
+ * same combo index, so that both ends agree on the combo step an input belongs to regardless of latency, then
+ * replicates the last frame it resolved and its outcome. The client only corrects its predicted state when the server
+ * rejected an input it predicted to trigger the next combo.
+ */
+struct GASCOMPANION_API FGSCComboPrediction
+{
+public:
+	/** Client: Numbers a combo input resolved locally */
+	FGSCComboInputFrame MakeInputFrame(const FGSCComboState& InPredictedState);
+
+	/**
+	 * Server: Resolves an input frame received from the owning client.
+	 *
+	 * The input triggers the next combo if the client resolved it within its combo window, and the server is at the
+	 * same combo index with the next combo not activated yet. The combo window of the server may have closed already
+	 * (see CloseComboWindow()), as long as the combo ability is still active. Inputs for a combo step the next combo
+	 * was already triggered from are acknowledged as triggering, without triggering anything again.
+	 *
+	 * @param InFrame Received input frame
+	 * @param InServerState Current combo state on the server
+	 * @param bInComboActive Whether a combo ability is currently active on the server
+	 * @param bOutTriggerCombo Whether the next combo should trigger
+	 * @return False if the frame is older than (or the same as) the last resolved one and should be ignored
+	 */
+	bool ResolveInputFrame(const FGSCComboInputFrame& InFrame, const FGSCComboState& InServerState, bool bInComboActive, bool& bOutTriggerCombo);
+
+	/** Server: Combo window closed without activating the next combo, late inputs for this combo index are still resolved */
+	void CloseComboWindow(int32 InComboIndex);
+
+	/** Server: Returns whether an input frame triggered the next combo from the given combo index */
+	bool HasTriggeredComboFrom(const int32 InComboIndex) const { return LastTriggeredComboIndex != INDEX_NONE && LastTriggeredComboIndex == InComboIndex; }
+
+	/** Server: Combo step started, either chained from the previous one or starting a new combo */
+	void BeginComboStep(bool bInNewCombo);
+
+	/**
+	 * Client: Reconciles the predicted combo state with the state replicated by the server, once all input frames are
+	 * acknowledged.
+	 *
+	 * @return Whether the predicted state was corrected
+	 */
+	bool Reconcile(const FGSCComboState& InServerState, FGSCComboState& InOutPredictedState);
+
+	/** Client: Returns whether some input frames were not acknowledged by the server yet */
+	bool HasPendingInputFrames(const FGSCComboState& InServerState) const;
+
+	/** Returns the last input frame made (client) or resolved (server) */
+	uint8 GetLastInputFrame() const { return LastInputFrame; }
+
+	/** Returns whether the last input frame was predicted (client) or resolved (server) to trigger the next combo */
+	bool DidLastInputTriggerCombo() const { return bLastInputTriggeredCombo; }
+
+	/** Returns whether frame A was made after frame B, accounting for wrap around */
+	static bool IsNewerInputFrame(const uint8 A, const uint8 B)
+	{
+		return static_cast<int8>(static_cast<uint8>(A - B)) > 0;
+	}
+
+private:
+	uint8 LastInputFrame = 0;
+	int32 LastInputComboIndex = 0;
+	bool bLastInputTriggeredCombo = false;
+
+	/** Client: Last acknowledged frame already reconciled */
+	uint8 LastReconciledInputFrame = 0;
+
+	/** Server: Combo index of the combo window that closed without activating the next combo */
+	int32 ClosedComboWindowIndex = INDEX_NONE;
+
+	/** Server: Combo index of the combo step the next combo was triggered from */
+	int32 LastTriggeredComboIndex = INDEX_NONE;
+};
@@ -7,6 +7,9 @@
 #include "AttributeSet.h"
 #include "GameplayEffectTypes.h"
 #include "GameplayTagContainer.h"
+#include "Abilities/GSCActiveAbilityIndex.h"
+#include "Abilities/GSCEffectTimeline.h"
+#include "Abilities/Attributes/GSCDamagePipeline.h"
 #include "UI/GSCUWHud.h"
 #include "GSCCoreComponent.generated.h"
 
@@ -15,6 +18,7 @@ class UGameplayAbility;
 class UGameplayEffect;
 class UAbilitySystemComponent;
 class UGSCAttributeSetBase;
+struct FGameplayAbilitySpec;
 struct FGameplayAbilitySpecHandle;
 
 /** Structure passed down to Actors Blueprint with PostGameplayEffectExecute Event */
@@ -42,8 +46,8 @@ struct FGSCGameplayEffectExecuteData
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnDeath);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE(FGSCOnInitAbilityActorInfoCore);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGSCOnDefaultAttributeChange, float, DeltaValue, const struct FGameplayTagContainer, EventTags);
-DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnAttributeChange, FGameplayAttribute, Attribute, float, DeltaValue, const struct FGameplayTagContainer, EventTags);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGSCOnDefaultAttributeChange, float, DeltaValue, const struct FGameplayTagContainer&, EventTags);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnAttributeChange, FGameplayAttribute, Attribute, float, DeltaValue, const struct FGameplayTagContainer&, EventTags);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnPreAttributeChange, UGSCAttributeSetBase*, AttributeSet, FGameplayAttribute, Attribute, float, NewValue);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FGSCOnPostGameplayEffectExecute, FGameplayAttribute, Attribute, AActor*, SourceActor, AActor*, TargetActor, const FGameplayTagContainer&, SourceTags, const FGSCGameplayEffectExecuteData, Payload);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGSCOnAbilityActivated, const UGameplayAbility*, Ability);
@@ -57,6 +61,7 @@ DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FGSCOnAbilityCommit, UGameplayAbilit
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FourParams(FGSCOnCooldownChanged, UGameplayAbility*, Ability, const FGameplayTagContainer, CooldownTags, float, TimeRemaining, float, Duration);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnCooldownEnd, UGameplayAbility*, Ability, FGameplayTag, CooldownTag, float, Duration);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FGSCOnDamage, float, DamageAmount, AActor*, SourceCharacter, const struct FGameplayTagContainer&, DamageTags);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FGSCOnDamageBreakdown, const FGSCDamageBreakdown&, Breakdown, AActor*, SourceCharacter);
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_FiveParams(FGSCOnGameplayEffectTimeChange,  FGameplayTagContainer, AssetTags, FGameplayTagContainer, GrantedTags, FActiveGameplayEffectHandle, ActiveHandle, float, NewStartTime, float, NewDuration);
 
 /**
@@ -99,6 +104,7 @@ public:
 
 	// Called from AttributeSet, and trigger BP events
 	virtual void HandleDamage(float DamageAmount, const FGameplayTagContainer& DamageTags, AActor* SourceActor);
+	virtual void HandleDamageBreakdown(const FGSCDamageBreakdown& Breakdown, AActor* SourceActor);
 	virtual void HandleHealthChange(float DeltaValue, const FGameplayTagContainer& EventTags);
 	virtual void HandleStaminaChange(float DeltaValue, const FGameplayTagContainer& EventTags);
 	virtual void HandleManaChange(float DeltaValue, const FGameplayTagContainer& EventTags);
@@ -132,6 +138,15 @@ public:
 	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Abilities")
 	FGSCOnDamage OnDamage;
 
+	/**
+	* Called when character takes damage going through a Damage Pipeline with bBroadcastBreakdown enabled. Called on both server and clients.
+	*
+	* @param Breakdown Incoming damage, final damage and the result of each evaluated stage of the pipeline
+	* @param SourceCharacter The actual actor that did the damage
+	*/
+	UPROPERTY(BlueprintAssignable, Category="GAS Companion|Abilities")
+	FGSCOnDamageBreakdown OnDamageBreakdown;
+
     /**
     * Called when health is changed, either from healing or from being damaged
     * For damage this is called in addition to OnDamaged/OnDeath
@@ -174,6 +189,36 @@ public:
 	FGSCOnAttributeChange OnAttributeChange;
 
 
+	/**
+	 * If true, attribute change events (OnHealthChange, OnStaminaChange, OnManaChange and OnAttributeChange) are not
+	 * broadcast as soon as an attribute changes.
+	 *
+	 * Deltas and event tags are accumulated instead, and a single consolidated event per attribute is broadcast at the
+	 * end of the frame. Useful for characters receiving lots of small changes within a frame (eg. damage over time).
+	 *
+	 * Death is detected when pending health changes are dispatched.
+	 */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category="GAS Companion|Attributes")
+	bool bCoalesceAttributeChanges = false;
+
+	/** Immediately broadcasts attribute changes accumulated so far in this frame (only relevant if bCoalesceAttributeChanges is enabled) */
+	UFUNCTION(BlueprintCallable, Category="GAS Companion|Attributes")
+	void FlushAttributeChanges();
+
+	/**
+	 * Holds back attribute change events (OnHealthChange, OnStaminaChange, OnManaChange and OnAttributeChange), eg. for
+	 * AI demoted by the GSC Significance subsystem.
+	 *
+	 * Changes are accumulated as with bCoalesceAttributeChanges and broadcast as consolidated events once events are
+	 * no longer suppressed. Pending changes are dispatched right away if health drops to zero, so death is never delayed.
+	 */
+	UFUNCTION(BlueprintCallable, Category="GAS Companion|Attributes")
+	void SetAttributeEventsSuppressed(bool bSuppressed);
+
+	/** Returns whether attribute change events are currently held back */
+	UFUNCTION(BlueprintPure, Category="GAS Companion|Attributes")
+	bool AreAttributeEventsSuppressed() const { return bAttributeEventsSuppressed; }
+
 	// Generic Attribute change callback for attributes
 	virtual void OnAttributeChanged(const FOnAttributeChangeData& Data);
 
@@ -272,6 +317,8 @@ public:
 	/**
 	* Returns a list of currently active ability instances that match the given class
 	*
+	* Served from an index of running abilities maintained from ASC activation / end events, without walking granted ability specs.
+	*
 	* @param AbilityToSearch The Gameplay Ability Class to search for
 	*/
 	UFUNCTION(BlueprintCallable, Category="GAS Companion|Abilities")
@@ -282,11 +329,40 @@ public:
 	*
 	* This only returns if the ability is currently running
 	*
+	* Served from an index of running abilities maintained from ASC activation / end events, without walking granted ability specs.
+	*
 	* @param GameplayTagContainer The Ability Tags to search for
 	*/
 	UFUNCTION(BlueprintCallable, Category = "GAS Companion|Abilities")
 	virtual TArray<UGameplayAbility*> GetActiveAbilitiesByTags(const FGameplayTagContainer GameplayTagContainer) const;
 
+	/**
+	* Returns the longest time remaining (and its duration) of the active gameplay effects granting any of the given tags.
+	*
+	* Served from a timeline of active effects maintained from ASC effect added / removed / time changed events, cheap enough
+	* to be polled every frame (eg. from HUD widgets). Infinite effects report -1.
+	*
+	* @param GameplayTags The granted tags to search for (parent tags match effects granting child tags)
+	* @param TimeRemaining Longest time remaining
+	* @param Duration Duration of the effect with the longest time remaining
+	* @return Whether an active effect grants any of the tags
+	*/
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Abilities")
+	bool GetEffectTimeRemainingByTags(const FGameplayTagContainer& GameplayTags, float& TimeRemaining, float& Duration) const;
+
+	/**
+	* Returns time remaining and duration of the cooldown applied by abilities of the given class.
+	*
+	* Served from the same timeline of active effects as GetEffectTimeRemainingByTags(), cheap enough to be polled every frame.
+	*
+	* @param AbilityClass The Gameplay Ability Class whose cooldown to check
+	* @param TimeRemaining Cooldown time remaining
+	* @param Duration Cooldown duration
+	* @return Whether the ability is on cooldown
+	*/
+	UFUNCTION(BlueprintPure, Category = "GAS Companion|Abilities")
+	bool GetCooldownTimeRemainingByClass(TSubclassOf<UGameplayAbility> AbilityClass, float& TimeRemaining, float& Duration) const;
+
 	/**
 	* Attempts to activate the ability that is passed in. This will check costs and requirements before doing so.
 	*
@@ -470,16 +546,84 @@ protected:
 	/** Trigger by ASC when an ability is committed (cost / cooldown are applied)  */
 	void OnAbilityCommitted(UGameplayAbility *ActivatedAbility);
 
-	/** Trigger by ASC when a cooldown tag is changed (new or removed)  */
-	virtual void OnCooldownGameplayTagChanged(const FGameplayTag GameplayTag, int32 NewCount, FGameplayAbilitySpecHandle AbilitySpecHandle, float Duration);
+	/** Trigger by ASC when an ability is activated, to keep track of running abilities */
+	void OnAbilityActivatedForIndex(UGameplayAbility* ActivatedAbility);
+
+	/** Trigger by ASC when an ability ends, to keep track of running abilities */
+	void OnAbilityEndedForIndex(UGameplayAbility* EndedAbility);
 
 	/** Manage cooldown events trigger when an ability is committed */
 	void HandleCooldownOnAbilityCommit(UGameplayAbility* ActivatedAbility);
 
+	/** Sends damage breakdown computed on server to clients */
+	UFUNCTION(NetMulticast, Unreliable)
+	void MulticastDamageBreakdown(const FGSCDamageBreakdown& Breakdown, AActor* SourceActor);
+
+	/** Broadcast OnCooldownEnd for the tags of a removed cooldown effect that no other active effect grants anymore */
+	void HandleCooldownEnd(const FGSCEffectTimeline::FEntry& RemovedCooldown);
+
 private:
-	/** Array of active GE handle bound to delegates that will be fired when the count for the key tag changes to or away from zero */
-	TArray<FActiveGameplayEffectHandle> GameplayEffectAddedHandles;
 
-	/** Array of tags bound to delegates that will be fired when the count for the key tag changes to or away from zero */
-	TArray<FGameplayTag> GameplayTagBoundToDelegates;
+	/** Attribute change accumulated within a frame, when bCoalesceAttributeChanges is enabled */
+	struct FPendingAttributeChange
+	{
+		float DeltaValue = 0.f;
+		FGameplayTagContainer EventTags;
+
+		void Accumulate(const float InDeltaValue, const FGameplayTagContainer& InEventTags)
+		{
+			DeltaValue += InDeltaValue;
+			EventTags.AppendTags(InEventTags);
+		}
+	};
+
+	/** Pending OnAttributeChange events, per attribute */
+	TMap<FGameplayAttribute, FPendingAttributeChange> PendingAttributeChanges;
+
+	/** Pending OnHealthChange / OnStaminaChange / OnManaChange events */
+	TOptional<FPendingAttributeChange> PendingHealthChange;
+	TOptional<FPendingAttributeChange> PendingStaminaChange;
+	TOptional<FPendingAttributeChange> PendingManaChange;
+
+	/** Handle of the end of frame delegate used to dispatch pending attribute changes */
+	FDelegateHandle FlushAttributeChangesHandle;
+
+	/** Whether attribute change events are held back until SetAttributeEventsSuppressed(false) */
+	bool bAttributeEventsSuppressed = false;
+
+	/** Returns whether attribute changes should be accumulated instead of broadcast right away */
+	bool ShouldAccumulateAttributeChanges() const { return bCoalesceAttributeChanges || bAttributeEventsSuppressed; }
+
+	/** Makes sure pending attribute changes get dispatched at the end of the frame */
+	void RequestFlushAttributeChanges();
+
+	/** Triggered at the end of the frame (after all actors ticked) when there are pending attribute changes */
+	void OnWorldPostActorTick(UWorld* InWorld, ELevelTick InTickType, float InDeltaSeconds);
+
+	/** Broadcast OnHealthChange and trigger death events if needed */
+	void BroadcastHealthChange(float DeltaValue, const FGameplayTagContainer& EventTags);
+
+	/** Index of currently running ability instances, fed by the activation / end delegates of the ASC it was registered with */
+	FGSCActiveAbilityIndex ActiveAbilityIndex;
+
+	/** The ASC ActiveAbilityIndex is tracking. Queries fall back to iterating ability specs when it doesn't match OwnerAbilitySystemComponent */
+	TWeakObjectPtr<UAbilitySystemComponent> ActiveAbilityIndexASC;
+
+	/** Returns whether ActiveAbilityIndex is tracking the current OwnerAbilitySystemComponent */
+	bool IsActiveAbilityIndexValid() const;
+
+	/** Timeline of active duration / infinite effects, fed by the effect added / removed / time changed delegates of the ASC it was registered with */
+	FGSCEffectTimeline EffectTimeline;
+
+	/** The ASC EffectTimeline is tracking. Active effect handles bound to stack / time change delegates are the ones in EffectTimeline */
+	TWeakObjectPtr<UAbilitySystemComponent> EffectTimelineASC;
+
+	/** Returns whether EffectTimeline is tracking the current OwnerAbilitySystemComponent */
+	bool IsEffectTimelineValid() const;
+
+	/** Binds stack / time change delegates of an active effect */
+	void RegisterActiveGameplayEffectDelegates(FActiveGameplayEffectHandle ActiveHandle);
+
+	/** Slow path used when ActiveAbilityIndex isn't bound. Iterates ability specs (by reference) and returns active instances of the ones matching the predicate */
+	void GetActiveAbilitiesFromSpecs(TFunctionRef<bool(const FGameplayAbilitySpec&)> Predicate, TArray<UGameplayAbility*>& OutActiveAbilities) const;
 };
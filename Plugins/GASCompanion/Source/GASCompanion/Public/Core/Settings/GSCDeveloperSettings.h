@@ -6,6 +6,7 @@
 #include "GSCDeveloperSettings.generated.h"
 
 class UAttributeSet;
+class UGSCDamagePipeline;
 
 /**
  * Developer Settings for GAS Companion, Attributes and AttributeSets related config.
@@ -25,6 +26,51 @@ public:
 	 */
 	UPROPERTY(config, EditAnywhere, Category = "Attributes", meta = (DisplayName = "Hide GSCAttributeSet Attributes"))
 	bool bHideGSCAttributeSetInDetailsView = false;
+
+	/**
+	 * Damage pipeline used by GSCAttributeSet to turn the Damage meta attribute into health loss (resistances, armor,
+	 * shields, critical hits, etc.).
+	 *
+	 * When not set, damage is applied to health as is.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "Attributes")
+	TSoftObjectPtr<UGSCDamagePipeline> DamagePipeline;
+
+	/**
+	 * If true, pawns possessed by GSCModularAIController are registered with the GSC Significance subsystem on the
+	 * server. AI far from (or outside the view of) every player get demoted: their ability system ticks less often,
+	 * their attribute change events are held back and their gameplay effects / combo state use minimal replication.
+	 */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance")
+	bool bEnableAISignificance = false;
+
+	/** How often (in seconds) significance of registered AI is evaluated */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", EditCondition = "bEnableAISignificance"))
+	float SignificanceUpdateInterval = 0.5f;
+
+	/** AI closer than this distance to a player view point are always significant, whether they're in view or not */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", Units = "cm", EditCondition = "bEnableAISignificance"))
+	float SignificantDistance = 2500.f;
+
+	/** AI within this distance of a player view point are significant only if they're within the view cone of that player */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", Units = "cm", EditCondition = "bEnableAISignificance"))
+	float MaxSignificantDistance = 8000.f;
+
+	/** Half angle of the view cone used to figure out whether AI is on screen for a player */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", ClampMax = "180.0", Units = "deg", EditCondition = "bEnableAISignificance"))
+	float SignificanceViewHalfAngle = 60.f;
+
+	/** Demoted AI must get this much closer (as a fraction of the distances above) to be promoted again, to avoid flip-flopping at the boundaries */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", ClampMax = "1.0", EditCondition = "bEnableAISignificance"))
+	float SignificanceHysteresis = 0.1f;
+
+	/** Tick interval (in seconds) of the ability system component of demoted AI */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", EditCondition = "bEnableAISignificance"))
+	float DemotedAbilitySystemTickInterval = 0.25f;
+
+	/** Net update frequency of demoted AI */
+	UPROPERTY(config, EditAnywhere, Category = "AI Significance", meta = (ClampMin = "0.0", EditCondition = "bEnableAISignificance"))
+	float DemotedNetUpdateFrequency = 2.f;
 	
 	/**
 	 * True if the GAS Companion module should add combo button and its drop-down menu in the level editor toolbar.
@@ -44,6 +90,9 @@ public:
 	static const UGSCDeveloperSettings& Get();
 	static UGSCDeveloperSettings& GetMutable();
 
+	/** Returns the configured damage pipeline, loading it on first use */
+	const UGSCDamagePipeline* GetDamagePipeline() const;
+
 	/**
 	 * The category name for our developer settings
 	 *
@@ -64,4 +113,9 @@ public:
 	/** Adds or remove `HideInDetailsView` class metadata to the passed in UClass. InClass must be a child of UAttributeSet */
 	static void SetHideInDetailsViewMetaData(UClass* InClass, bool bInHideInDetailsView);
 #endif
+
+private:
+	/** Loaded DamagePipeline, kept around to avoid resolving the soft pointer on each damage execution */
+	UPROPERTY(Transient)
+	mutable TObjectPtr<const UGSCDamagePipeline> LoadedDamagePipeline;
 };
@@ -17,4 +17,10 @@ public:
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 	//~ End AActor Interface
+
+protected:
+	//~ Begin AController Interface
+	virtual void OnPossess(APawn* InPawn) override;
+	virtual void OnUnPossess() override;
+	//~ End AController Interface
 };
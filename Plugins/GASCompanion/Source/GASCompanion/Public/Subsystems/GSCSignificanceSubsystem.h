@@ -0,0 +1,106 @@
+// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayEffectTypes.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "UObject/ObjectKey.h"
+#include "GSCSignificanceSubsystem.generated.h"
+
+class APawn;
+class UAbilitySystemComponent;
+class UGSCComboManagerComponent;
+class UGSCCoreComponent;
+
+/**
+ * World Subsystem scaling down GAS updates of AI that no player is looking at.
+ *
+ * Pawns possessed by GSCModularAIController register themselves on the server when bEnableAISignificance is enabled
+ * in GAS Companion developer settings. Every SignificanceUpdateInterval, each registered pawn is checked against the
+ * view point of every player controller: it is significant if it is close enough to a player, or within view range
+ * and view cone of a player.
+ *
+ * Demoted (non significant) pawns have their ability system component ticking at DemotedAbilitySystemTickInterval,
+ * gameplay effects replicated in Minimal mode (only for ASCs already in Mixed mode, switching from Full would drop the
+ * replicated effects simulated proxies rely on), combo state replication turned off, a lower net update frequency and
+ * their GSCCoreComponent attribute change events held back. Everything is restored when the pawn gets promoted again,
+ * including the broadcast of attribute changes and the replication of combo state accumulated in the meantime.
+ */
+UCLASS(DisplayName = "GSC Significance")
+class GASCOMPANION_API UGSCSignificanceSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	/** Returns the significance subsystem of the world of the passed in object, if any */
+	static UGSCSignificanceSubsystem* Get(const UObject* WorldContextObject);
+
+	//~USubsystem interface
+	virtual void Deinitialize() override;
+	//~End of USubsystem interface
+
+	//~FTickableGameObject interface
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+	//~End of FTickableGameObject interface
+
+	/** Starts evaluating significance of the passed in pawn. Pawns are significant until the next evaluation. */
+	void RegisterPawn(APawn* InPawn);
+
+	/** Stops evaluating significance of the passed in pawn, promoting it back first if it was demoted */
+	void UnregisterPawn(APawn* InPawn);
+
+	/**
+	 * Evaluates significance of all registered pawns against the passed in view points, and demotes or promotes pawns
+	 * whose significance changed. Called by Tick() with the view points of all player controllers.
+	 */
+	void UpdateSignificance(TConstArrayView<FTransform> InViewpoints);
+
+	/** Returns whether the pawn is significant. Pawns that are not registered are always significant. */
+	bool IsSignificant(const APawn* InPawn) const;
+
+	/** Returns the number of registered pawns */
+	int32 GetNumRegisteredPawns() const;
+
+	/** Returns the number of registered pawns currently demoted */
+	int32 GetNumDemotedPawns() const;
+
+protected:
+	//~UWorldSubsystem interface
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+	//~End of UWorldSubsystem interface
+
+private:
+	/** Registered pawn, with the components affected by significance and the values to restore on promotion */
+	struct FPawnState
+	{
+		TWeakObjectPtr<APawn> Pawn;
+		TWeakObjectPtr<UAbilitySystemComponent> AbilitySystemComponent;
+		TWeakObjectPtr<UGSCCoreComponent> CoreComponent;
+		TWeakObjectPtr<UGSCComboManagerComponent> ComboManagerComponent;
+
+		bool bSignificant = true;
+
+		float DefaultTickInterval = 0.f;
+		float DefaultNetUpdateFrequency = 0.f;
+		EGameplayEffectReplicationMode DefaultReplicationMode = EGameplayEffectReplicationMode::Mixed;
+	};
+
+	TMap<TObjectKey<APawn>, FPawnState> PawnStates;
+
+	/** View points of player controllers. Kept to avoid reallocating on each update. */
+	TArray<FTransform> Viewpoints;
+
+	/** Time accumulated since the last significance update */
+	float TimeSinceLastUpdate = 0.f;
+
+	/** Number of registered pawns currently demoted */
+	int32 NumDemotedPawns = 0;
+
+	/** Returns whether a pawn at the passed in location is significant for any of the view points */
+	static bool IsLocationSignificant(const FVector& InLocation, TConstArrayView<FTransform> InViewpoints, float InDistanceScale);
+
+	void Demote(FPawnState& InState);
+	void Promote(FPawnState& InState);
+};
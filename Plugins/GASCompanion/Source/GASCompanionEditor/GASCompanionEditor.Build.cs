@@ -24,6 +24,7 @@ public class GASCompanionEditor : ModuleRules
 				"CoreUObject",
 				"Engine",
 				"EngineSettings",
+				"EnhancedInput",
 				"GASCompanion",
 				"GameProjectGeneration",
 				"GameplayTags",
@@ -0,0 +1,220 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "InputAction.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/GSCGameplayAbility_MeleeBase.h"
+#include "Components/GSCAbilityInputBindingComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "GSCTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FGSCAbilityInputBindingComponentSpec, "GASCompanion.Editor.GSCAbilityInputBindingComponent", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 AbilityCount = 64;
+	static constexpr int32 InputActionCount = 8;
+	static constexpr int32 QueryCount = 100000;
+
+	UWorld* World = nullptr;
+	UGSCAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	UGSCAbilityInputBindingComponent* InputBindingComponent = nullptr;
+
+	/** Not a GSC ASC, grants and removals are not notified to the input binding component */
+	UAbilitySystemComponent* PlainAbilitySystemComponent = nullptr;
+
+	TArray<FGameplayAbilitySpecHandle> AbilityHandles;
+	TArray<UInputAction*> InputActions;
+
+END_DEFINE_SPEC(FGSCAbilityInputBindingComponentSpec)
+
+void FGSCAbilityInputBindingComponentSpec::Define()
+{
+	Describe(TEXT("Binding index"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCAbilityInputBindingComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			AbilitySystemComponent = NewObject<UGSCAbilitySystemComponent>(Actor);
+			AbilitySystemComponent->bResetAbilitiesOnSpawn = false;
+			AbilitySystemComponent->RegisterComponent();
+			AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+			InputBindingComponent = NewObject<UGSCAbilityInputBindingComponent>(Actor);
+			InputBindingComponent->RegisterComponent();
+
+			// No input component in tests, this only resolves the Ability System Component
+			InputBindingComponent->SetupPlayerControls(nullptr);
+
+			for (int32 Index = 0; Index < AbilityCount; ++Index)
+			{
+				AbilityHandles.Add(AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCGameplayAbility::StaticClass(), Index + 1)));
+			}
+
+			for (int32 Index = 0; Index < InputActionCount; ++Index)
+			{
+				InputActions.Add(NewObject<UInputAction>(GetTransientPackage()));
+			}
+		});
+
+		It(TEXT("should index bindings by ability handle and input ID"), [this]()
+		{
+			for (int32 Index = 0; Index < AbilityCount; ++Index)
+			{
+				InputBindingComponent->SetInputBinding(InputActions[Index % InputActionCount], EGSCAbilityTriggerEvent::Started, AbilityHandles[Index]);
+			}
+
+			for (int32 Index = 0; Index < AbilityCount; ++Index)
+			{
+				UInputAction* ExpectedInputAction = InputActions[Index % InputActionCount];
+				TestTrue(TEXT("Bound input action by handle"), InputBindingComponent->GetBoundInputActionForAbilityHandle(AbilityHandles[Index]) == ExpectedInputAction);
+
+				const FGameplayAbilitySpec* AbilitySpec = AbilitySystemComponent->FindAbilitySpecFromHandle(AbilityHandles[Index]);
+				if (TestNotNull(TEXT("Ability spec"), AbilitySpec))
+				{
+					TestTrue(TEXT("Bound input action by spec"), InputBindingComponent->GetBoundInputActionForAbilitySpec(AbilitySpec) == ExpectedInputAction);
+				}
+			}
+		});
+
+		It(TEXT("should index bindings by ability class and follow grant and removal"), [this]()
+		{
+			const TSubclassOf<UGameplayAbility> MeleeAbilityClass = UGSCGameplayAbility_MeleeBase::StaticClass();
+			TestNull(TEXT("Not granted"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass));
+
+			const FGameplayAbilitySpecHandle MeleeAbilityHandle = AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(MeleeAbilityClass));
+			TestNull(TEXT("Granted, not bound"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass));
+
+			InputBindingComponent->SetInputBinding(InputActions[0], EGSCAbilityTriggerEvent::Started, MeleeAbilityHandle);
+			TestTrue(TEXT("Bound"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass) == InputActions[0]);
+
+			InputBindingComponent->ClearInputBinding(MeleeAbilityHandle);
+			TestNull(TEXT("Binding cleared"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass));
+			TestNull(TEXT("Binding cleared by handle"), InputBindingComponent->GetBoundInputActionForAbilityHandle(MeleeAbilityHandle));
+
+			InputBindingComponent->SetInputBinding(InputActions[1], EGSCAbilityTriggerEvent::Started, MeleeAbilityHandle);
+			TestTrue(TEXT("Bound again"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass) == InputActions[1]);
+
+			AbilitySystemComponent->ClearAbility(MeleeAbilityHandle);
+			TestNull(TEXT("Ability removed"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass));
+			TestNull(TEXT("Ability removed by handle"), InputBindingComponent->GetBoundInputActionForAbilityHandle(MeleeAbilityHandle));
+		});
+
+		It(TEXT("should answer class queries without scanning specs"), [this]()
+		{
+			for (int32 Index = 0; Index < AbilityCount; ++Index)
+			{
+				InputBindingComponent->SetInputBinding(InputActions[Index % InputActionCount], EGSCAbilityTriggerEvent::Started, AbilityHandles[Index]);
+			}
+
+			const TSubclassOf<UGameplayAbility> AbilityClass = UGSCGameplayAbility::StaticClass();
+			UInputAction* BoundInputAction = nullptr;
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < QueryCount; ++Index)
+			{
+				BoundInputAction = InputBindingComponent->GetBoundInputActionForAbilityClass(AbilityClass);
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			TestNotNull(TEXT("Bound input action"), BoundInputAction);
+			AddInfo(FString::Printf(
+				TEXT("%d class queries with %d bound abilities: %.2f ms"),
+				QueryCount,
+				AbilityCount,
+				ElapsedTime * 1000.0
+			));
+		});
+
+		AfterEach([this]()
+		{
+			AbilityHandles.Reset();
+			InputActions.Reset();
+			InputBindingComponent = nullptr;
+			AbilitySystemComponent = nullptr;
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+
+	Describe(TEXT("Binding index without grant notifications"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCAbilityInputBindingComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			PlainAbilitySystemComponent = NewObject<UAbilitySystemComponent>(Actor);
+			PlainAbilitySystemComponent->RegisterComponent();
+			PlainAbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+			InputBindingComponent = NewObject<UGSCAbilityInputBindingComponent>(Actor);
+			InputBindingComponent->RegisterComponent();
+			InputBindingComponent->SetupPlayerControls(nullptr);
+
+			InputActions.Add(NewObject<UInputAction>(GetTransientPackage()));
+		});
+
+		It(TEXT("should follow a removal and a grant keeping the number of abilities"), [this]()
+		{
+			const TSubclassOf<UGameplayAbility> AbilityClass = UGSCGameplayAbility::StaticClass();
+			const TSubclassOf<UGameplayAbility> MeleeAbilityClass = UGSCGameplayAbility_MeleeBase::StaticClass();
+
+			PlainAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(AbilityClass));
+			const FGameplayAbilitySpecHandle MeleeAbilityHandle = PlainAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(MeleeAbilityClass));
+
+			InputBindingComponent->SetInputBinding(InputActions[0], EGSCAbilityTriggerEvent::Started, MeleeAbilityHandle);
+			TestTrue(TEXT("Bound"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass) == InputActions[0]);
+
+			// Same number of activatable abilities once done
+			PlainAbilitySystemComponent->ClearAbility(MeleeAbilityHandle);
+			const FGameplayAbilitySpecHandle NewMeleeAbilityHandle = PlainAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(MeleeAbilityClass));
+			TestEqual(TEXT("Activatable abilities"), PlainAbilitySystemComponent->GetActivatableAbilities().Num(), 2);
+
+			TestNull(TEXT("Removed ability by handle"), InputBindingComponent->GetBoundInputActionForAbilityHandle(MeleeAbilityHandle));
+			TestNull(TEXT("New ability by handle"), InputBindingComponent->GetBoundInputActionForAbilityHandle(NewMeleeAbilityHandle));
+			TestNull(TEXT("New ability by class"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass));
+		});
+
+		It(TEXT("should follow bound specs moved by a removal"), [this]()
+		{
+			const TSubclassOf<UGameplayAbility> MeleeAbilityClass = UGSCGameplayAbility_MeleeBase::StaticClass();
+
+			const FGameplayAbilitySpecHandle FirstAbilityHandle = PlainAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCGameplayAbility::StaticClass()));
+			PlainAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCGameplayAbility::StaticClass()));
+			const FGameplayAbilitySpecHandle MeleeAbilityHandle = PlainAbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(MeleeAbilityClass));
+
+			InputBindingComponent->SetInputBinding(InputActions[0], EGSCAbilityTriggerEvent::Started, MeleeAbilityHandle);
+			TestTrue(TEXT("Bound"), InputBindingComponent->GetBoundInputActionForAbilityHandle(MeleeAbilityHandle) == InputActions[0]);
+
+			// Removal swaps the last spec (the bound one) into the removed slot
+			PlainAbilitySystemComponent->ClearAbility(FirstAbilityHandle);
+			TestTrue(TEXT("Still bound by handle"), InputBindingComponent->GetBoundInputActionForAbilityHandle(MeleeAbilityHandle) == InputActions[0]);
+			TestTrue(TEXT("Still bound by class"), InputBindingComponent->GetBoundInputActionForAbilityClass(MeleeAbilityClass) == InputActions[0]);
+		});
+
+		AfterEach([this]()
+		{
+			InputActions.Reset();
+			InputBindingComponent = nullptr;
+			PlainAbilitySystemComponent = nullptr;
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+}
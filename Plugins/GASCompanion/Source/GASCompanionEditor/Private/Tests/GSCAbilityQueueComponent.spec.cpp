@@ -0,0 +1,231 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/GSCGameplayAbility_MeleeBase.h"
+#include "Components/GSCAbilityQueueComponent.h"
+#include "GSCTestAbilityQueueComponent.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/AutomationTest.h"
+#include "TimerManager.h"
+#include "GSCTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FGSCAbilityQueueComponentSpec, "GASCompanion.Editor.GSCAbilityQueueComponent", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	UWorld* World = nullptr;
+	UGSCAbilityQueueComponent* AbilityQueueComponent = nullptr;
+
+	const UGameplayAbility* FirstAbility = nullptr;
+	const UGameplayAbility* SecondAbility = nullptr;
+	const UGameplayAbility* ThirdAbility = nullptr;
+
+	UGSCAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	UGSCTestAbilityQueueComponent* TestAbilityQueueComponent = nullptr;
+	FGameplayAbilitySpecHandle AbilityHandle;
+
+	bool IsQueuedAbilityActive() const
+	{
+		const FGameplayAbilitySpec* Spec = AbilitySystemComponent->FindAbilitySpecFromHandle(AbilityHandle);
+		return Spec && Spec->IsActive();
+	}
+
+	void QueueAbility(const UGameplayAbility* InAbility, const double InTime) const
+	{
+		World->TimeSeconds = InTime;
+		AbilityQueueComponent->OnAbilityFailed(InAbility, FGameplayTagContainer());
+	}
+
+END_DEFINE_SPEC(FGSCAbilityQueueComponentSpec)
+
+void FGSCAbilityQueueComponentSpec::Define()
+{
+	Describe(TEXT("Input buffer"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCAbilityQueueComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			AbilityQueueComponent = NewObject<UGSCAbilityQueueComponent>(Actor);
+			AbilityQueueComponent->RegisterComponent();
+			AbilityQueueComponent->OpenAbilityQueue();
+			AbilityQueueComponent->SetAllowAllAbilitiesForAbilityQueue(true);
+
+			FirstAbility = GetDefault<UGameplayAbility>();
+			SecondAbility = GetDefault<UGSCGameplayAbility>();
+			ThirdAbility = GetDefault<UGSCGameplayAbility_MeleeBase>();
+		});
+
+		It(TEXT("should not tick"), [this]()
+		{
+			TestFalse(TEXT("Can ever tick"), AbilityQueueComponent->PrimaryComponentTick.bCanEverTick);
+		});
+
+		It(TEXT("should only keep the last queued ability by default"), [this]()
+		{
+			QueueAbility(FirstAbility, 0.0);
+			QueueAbility(SecondAbility, 0.1);
+
+			TestEqual(TEXT("Queued inputs"), AbilityQueueComponent->GetQueuedInputs().Num(), 1);
+			TestTrue(TEXT("Current queued ability"), AbilityQueueComponent->GetCurrentQueuedAbility() == SecondAbility);
+		});
+
+		It(TEXT("should drop the oldest inputs when the buffer is full"), [this]()
+		{
+			AbilityQueueComponent->MaxQueuedInputs = 2;
+			QueueAbility(FirstAbility, 0.0);
+			QueueAbility(SecondAbility, 0.1);
+			QueueAbility(ThirdAbility, 0.2);
+
+			const TArray<FGSCQueuedAbilityInput>& QueuedInputs = AbilityQueueComponent->GetQueuedInputs();
+			TestEqual(TEXT("Queued inputs"), QueuedInputs.Num(), 2);
+			if (QueuedInputs.Num() == 2)
+			{
+				TestTrue(TEXT("Oldest input"), QueuedInputs[0].Ability == SecondAbility);
+				TestTrue(TEXT("Newest input"), QueuedInputs[1].Ability == ThirdAbility);
+				TestEqual(TEXT("Oldest input time"), QueuedInputs[0].QueuedTime, 0.1, UE_KINDA_SMALL_NUMBER);
+			}
+		});
+
+		It(TEXT("should not queue abilities while the queue is closed or not allowed"), [this]()
+		{
+			AbilityQueueComponent->CloseAbilityQueue();
+			QueueAbility(FirstAbility, 0.0);
+			TestEqual(TEXT("Queued inputs when closed"), AbilityQueueComponent->GetQueuedInputs().Num(), 0);
+
+			AbilityQueueComponent->OpenAbilityQueue();
+			AbilityQueueComponent->SetAllowAllAbilitiesForAbilityQueue(false);
+			AbilityQueueComponent->UpdateAllowedAbilitiesForAbilityQueue({ SecondAbility->GetClass() });
+			QueueAbility(FirstAbility, 0.0);
+			QueueAbility(SecondAbility, 0.1);
+
+			TestEqual(TEXT("Queued inputs"), AbilityQueueComponent->GetQueuedInputs().Num(), 1);
+			TestTrue(TEXT("Current queued ability"), AbilityQueueComponent->GetCurrentQueuedAbility() == SecondAbility);
+		});
+
+		It(TEXT("should discard expired inputs and keep the remaining ones when an ability ends"), [this]()
+		{
+			AbilityQueueComponent->MaxQueuedInputs = 3;
+			AbilityQueueComponent->QueuedInputLifetime = 0.5f;
+			QueueAbility(FirstAbility, 0.0);
+			QueueAbility(SecondAbility, 1.0);
+			QueueAbility(ThirdAbility, 1.0);
+
+			World->TimeSeconds = 1.1;
+			AbilityQueueComponent->OnAbilityEnded(FirstAbility);
+
+			// First one expired, second one got consumed
+			const TArray<FGSCQueuedAbilityInput>& QueuedInputs = AbilityQueueComponent->GetQueuedInputs();
+			TestEqual(TEXT("Queued inputs"), QueuedInputs.Num(), 1);
+			TestTrue(TEXT("Remaining input"), AbilityQueueComponent->GetCurrentQueuedAbility() == ThirdAbility);
+
+			World->TimeSeconds = 2.0;
+			AbilityQueueComponent->OnAbilityEnded(FirstAbility);
+			TestEqual(TEXT("Queued inputs after expiry"), AbilityQueueComponent->GetQueuedInputs().Num(), 0);
+		});
+
+		It(TEXT("should clear the remaining inputs when the queue window is reset without a lifetime"), [this]()
+		{
+			AbilityQueueComponent->MaxQueuedInputs = 3;
+			QueueAbility(FirstAbility, 0.0);
+			QueueAbility(SecondAbility, 0.1);
+			QueueAbility(ThirdAbility, 0.2);
+
+			World->TimeSeconds = 10.0;
+			AbilityQueueComponent->OnAbilityEnded(FirstAbility);
+			TestEqual(TEXT("Queued inputs after the ability ended"), AbilityQueueComponent->GetQueuedInputs().Num(), 0);
+
+			// An input buffered in the next window is not affected by the previous one
+			AbilityQueueComponent->OpenAbilityQueue();
+			AbilityQueueComponent->SetAllowAllAbilitiesForAbilityQueue(true);
+			QueueAbility(SecondAbility, 10.1);
+			TestTrue(TEXT("Current queued ability"), AbilityQueueComponent->GetCurrentQueuedAbility() == SecondAbility);
+		});
+
+		AfterEach([this]()
+		{
+			AbilityQueueComponent = nullptr;
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+
+	Describe(TEXT("Rejected predictions"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCAbilityQueueComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			AbilitySystemComponent = NewObject<UGSCAbilitySystemComponent>(Actor);
+			AbilitySystemComponent->bResetAbilitiesOnSpawn = false;
+			AbilitySystemComponent->RegisterComponent();
+			AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+			AbilityHandle = AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCGameplayAbility::StaticClass()));
+
+			// Test actor is not a pawn, set the Ability System Component SetupOwner() would have found
+			TestAbilityQueueComponent = NewObject<UGSCTestAbilityQueueComponent>(Actor);
+			TestAbilityQueueComponent->RegisterComponent();
+			TestAbilityQueueComponent->OwnerAbilitySystemComponent = AbilitySystemComponent;
+		});
+
+		It(TEXT("should retry a rejected input on next frame instead of putting it back in the buffer"), [this]()
+		{
+			FGSCQueuedAbilityInput QueuedInput;
+			QueuedInput.Ability = GetMutableDefault<UGSCGameplayAbility>();
+			TestAbilityQueueComponent->SimulateQueuedInputRejected(QueuedInput);
+
+			TestFalse(TEXT("Ability active before next frame"), IsQueuedAbilityActive());
+			TestEqual(TEXT("Queued inputs"), TestAbilityQueueComponent->GetQueuedInputs().Num(), 0);
+
+			World->GetTimerManager().Tick(0.1f);
+			TestTrue(TEXT("Ability active on next frame"), IsQueuedAbilityActive());
+		});
+
+		It(TEXT("should discard a rejected input with no retries left"), [this]()
+		{
+			FGSCQueuedAbilityInput QueuedInput;
+			QueuedInput.Ability = GetMutableDefault<UGSCGameplayAbility>();
+			QueuedInput.RejectedCount = TestAbilityQueueComponent->MaxRejectedRetries;
+			TestAbilityQueueComponent->SimulateQueuedInputRejected(QueuedInput);
+
+			World->GetTimerManager().Tick(0.1f);
+			TestFalse(TEXT("Ability active"), IsQueuedAbilityActive());
+		});
+
+		It(TEXT("should discard a rejected input that expired"), [this]()
+		{
+			TestAbilityQueueComponent->QueuedInputLifetime = 0.5f;
+
+			FGSCQueuedAbilityInput QueuedInput;
+			QueuedInput.Ability = GetMutableDefault<UGSCGameplayAbility>();
+			QueuedInput.QueuedTime = 0.0;
+			World->TimeSeconds = 1.0;
+			TestAbilityQueueComponent->SimulateQueuedInputRejected(QueuedInput);
+
+			World->GetTimerManager().Tick(0.1f);
+			TestFalse(TEXT("Ability active"), IsQueuedAbilityActive());
+		});
+
+		AfterEach([this]()
+		{
+			TestAbilityQueueComponent = nullptr;
+			AbilitySystemComponent = nullptr;
+			AbilityHandle = FGameplayAbilitySpecHandle();
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+}
@@ -0,0 +1,138 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "Abilities/GSCAbilitySet.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCAbilitySystemUtils.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Abilities/GSCGameplayAbility_MeleeBase.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFeatures/GSCGameFeatureTypes.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "GSCTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FGSCAbilitySystemComponentSpec, "GASCompanion.Editor.GSCAbilitySystemComponent", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 AbilitySetSize = 512;
+
+	UWorld* World = nullptr;
+	UGSCAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	UGSCAbilitySet* AbilitySet = nullptr;
+
+END_DEFINE_SPEC(FGSCAbilitySystemComponentSpec)
+
+void FGSCAbilitySystemComponentSpec::Define()
+{
+	Describe(TEXT("Ability grant registry"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCAbilitySystemComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			AbilitySystemComponent = NewObject<UGSCAbilitySystemComponent>(Actor);
+			AbilitySystemComponent->bResetAbilitiesOnSpawn = false;
+			AbilitySystemComponent->RegisterComponent();
+			AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+			// Large set of unique (class, level) pairs
+			AbilitySet = NewObject<UGSCAbilitySet>(GetTransientPackage());
+			for (int32 Index = 0; Index < AbilitySetSize; ++Index)
+			{
+				FGSCGameFeatureAbilityMapping& Mapping = AbilitySet->GrantedAbilities.AddDefaulted_GetRef();
+				Mapping.AbilityType = UGSCGameplayAbility::StaticClass();
+				Mapping.Level = Index + 1;
+			}
+		});
+
+		It(TEXT("should grant every ability of a large set only once"), [this]()
+		{
+			FGSCAbilitySetHandle FirstHandle;
+			const double GrantStartTime = FPlatformTime::Seconds();
+			TestTrue(TEXT("Ability set granted"), AbilitySystemComponent->GiveAbilitySet(AbilitySet, FirstHandle));
+			const double GrantTime = FPlatformTime::Seconds() - GrantStartTime;
+
+			TestEqual(TEXT("Granted abilities"), AbilitySystemComponent->GetActivatableAbilities().Num(), AbilitySetSize);
+
+			// Regrant, as done on respawn. Nothing new should be granted and existing handles should be returned.
+			FGSCAbilitySetHandle SecondHandle;
+			const double RegrantStartTime = FPlatformTime::Seconds();
+			TestTrue(TEXT("Ability set regranted"), AbilitySystemComponent->GiveAbilitySet(AbilitySet, SecondHandle));
+			const double RegrantTime = FPlatformTime::Seconds() - RegrantStartTime;
+
+			TestEqual(TEXT("Granted abilities after regrant"), AbilitySystemComponent->GetActivatableAbilities().Num(), AbilitySetSize);
+			TestTrue(TEXT("Regrant returned existing handles"), SecondHandle.Abilities == FirstHandle.Abilities);
+
+			AddInfo(FString::Printf(TEXT("Ability set of %d abilities: grant %.2f ms, regrant %.2f ms"), AbilitySetSize, GrantTime * 1000.0, RegrantTime * 1000.0));
+		});
+
+		It(TEXT("should match granted ability specs by class and level"), [this]()
+		{
+			FGSCAbilitySetHandle Handle;
+			AbilitySystemComponent->GiveAbilitySet(AbilitySet, Handle);
+
+			for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+			{
+				TestTrue(TEXT("Is ability granted"), AbilitySystemComponent->IsAbilityGranted(Spec.Ability->GetClass(), Spec.Level));
+				TestTrue(TEXT("Granted ability handle"), AbilitySystemComponent->FindGrantedAbilityHandle(Spec.Ability->GetClass(), Spec.Level) == Spec.Handle);
+			}
+
+			TestFalse(TEXT("Level not granted"), FGSCAbilitySystemUtils::IsAbilityGranted(AbilitySystemComponent, UGSCGameplayAbility::StaticClass(), AbilitySetSize + 1));
+			TestFalse(TEXT("Class not granted"), FGSCAbilitySystemUtils::IsAbilityGranted(AbilitySystemComponent, UGameplayAbility::StaticClass(), 1));
+			TestFalse(TEXT("Should not grant again"), AbilitySystemComponent->ShouldGrantAbility(UGSCGameplayAbility::StaticClass(), 1));
+		});
+
+		It(TEXT("should follow ability spec level changes"), [this]()
+		{
+			const FGameplayAbilitySpecHandle AbilityHandle = AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCGameplayAbility_MeleeBase::StaticClass(), 1));
+			FGameplayAbilitySpec* AbilitySpec = AbilitySystemComponent->FindAbilitySpecFromHandle(AbilityHandle);
+			if (!TestNotNull(TEXT("Ability spec"), AbilitySpec))
+			{
+				return;
+			}
+
+			AbilitySpec->Level = 3;
+			AbilitySystemComponent->MarkAbilitySpecDirty(*AbilitySpec);
+
+			TestFalse(TEXT("Granted level no longer matches"), AbilitySystemComponent->IsAbilityGranted(UGSCGameplayAbility_MeleeBase::StaticClass(), 1));
+			TestTrue(TEXT("Should grant at the previous level"), AbilitySystemComponent->ShouldGrantAbility(UGSCGameplayAbility_MeleeBase::StaticClass(), 1));
+			TestTrue(TEXT("Granted at the new level"), AbilitySystemComponent->FindGrantedAbilityHandle(UGSCGameplayAbility_MeleeBase::StaticClass(), 3) == AbilityHandle);
+			TestFalse(TEXT("Should not grant at the new level"), AbilitySystemComponent->ShouldGrantAbility(UGSCGameplayAbility_MeleeBase::StaticClass(), 3));
+		});
+
+		It(TEXT("should forget abilities once removed"), [this]()
+		{
+			FGSCAbilitySetHandle Handle;
+			AbilitySystemComponent->GiveAbilitySet(AbilitySet, Handle);
+
+			AbilitySystemComponent->ClearAbility(AbilitySystemComponent->FindGrantedAbilityHandle(UGSCGameplayAbility::StaticClass(), 1));
+			TestFalse(TEXT("Removed ability"), FGSCAbilitySystemUtils::IsAbilityGranted(AbilitySystemComponent, UGSCGameplayAbility::StaticClass(), 1));
+			TestTrue(TEXT("Should grant again"), AbilitySystemComponent->ShouldGrantAbility(UGSCGameplayAbility::StaticClass(), 1));
+			TestTrue(TEXT("Other abilities kept"), FGSCAbilitySystemUtils::IsAbilityGranted(AbilitySystemComponent, UGSCGameplayAbility::StaticClass(), 2));
+
+			// The removal moved another spec in its place, its handle should still be found
+			for (const FGameplayAbilitySpec& Spec : AbilitySystemComponent->GetActivatableAbilities())
+			{
+				TestTrue(TEXT("Granted ability handle after removal"), AbilitySystemComponent->FindGrantedAbilityHandle(Spec.Ability->GetClass(), Spec.Level) == Spec.Handle);
+			}
+
+			AbilitySystemComponent->ClearAbilitySet(Handle);
+			TestFalse(TEXT("Ability set cleared"), FGSCAbilitySystemUtils::IsAbilityGranted(AbilitySystemComponent, UGSCGameplayAbility::StaticClass(), 2));
+		});
+
+		AfterEach([this]()
+		{
+			AbilitySystemComponent = nullptr;
+			AbilitySet = nullptr;
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+}
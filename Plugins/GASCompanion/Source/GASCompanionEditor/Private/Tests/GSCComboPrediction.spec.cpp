@@ -0,0 +1,838 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "Algo/BinarySearch.h"
+#include "Animation/AnimNotifyQueue.h"
+#include "Animations/GSCComboWindowNotifyState.h"
+#include "Animations/GSCTriggerComboNotify.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "Components/GSCComboPrediction.h"
+#include "Components/GSCCoreComponent.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Character.h"
+#include "GameFramework/PlayerController.h"
+#include "GSCTestComboAbility.h"
+#include "GSCTestComboManagerComponent.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "GSCTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FGSCComboPredictionSpec, "GASCompanion.Editor.GSCComboPrediction", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	/** Combo montage timings, as set up with the combo window and trigger combo notifies */
+	static constexpr double MontageLength = 0.8;
+	static constexpr double ComboWindowStart = 0.3;
+	static constexpr double TriggerComboTime = 0.35;
+	static constexpr double ComboWindowEnd = 0.6;
+	static constexpr int32 MaxComboIndex = 3;
+
+	static constexpr double TickDeltaTime = 1.0 / 120.0;
+	static constexpr double NetUpdateInterval = 1.0 / 30.0;
+	static constexpr double SimulationDuration = 120.0;
+	static constexpr double SettleDuration = 3.0;
+	static constexpr int32 NumSimulations = 8;
+
+	/** Emulated connection, one way. 150ms RTT and 5% packet loss, lost reliable packets are resent after a round trip. */
+	struct FEmulatedLink
+	{
+		double OneWayLatency = 0.075;
+		float PacketLoss = 0.05f;
+		FRandomStream Stream;
+		double LastReliableArrivalTime = 0.0;
+
+		explicit FEmulatedLink(const int32 InSeed)
+			: Stream(InSeed)
+		{
+		}
+
+		/** Reliable messages arrive in order */
+		double GetReliableArrivalTime(const double InNow)
+		{
+			double ArrivalTime = InNow + OneWayLatency;
+			while (Stream.FRand() < PacketLoss)
+			{
+				ArrivalTime += OneWayLatency * 2.0;
+			}
+
+			LastReliableArrivalTime = FMath::Max(ArrivalTime, LastReliableArrivalTime);
+			return LastReliableArrivalTime;
+		}
+
+		bool ShouldDropUnreliable()
+		{
+			return Stream.FRand() < PacketLoss;
+		}
+	};
+
+	/**
+	 * Combo montage of one end. Test worlds have no animation instance to play montages on, the combo window and trigger
+	 * combo notifies are called on the character mesh at the montage times instead.
+	 */
+	struct FEmulatedMontage
+	{
+		ACharacter* Character = nullptr;
+		UGSCTestComboAbility* Ability = nullptr;
+
+		/** Whether the notifies run with authority, NotifyTick only runs on the server */
+		bool bHasAuthority = false;
+
+		double StartTime = -1.0;
+		int32 NumActivations = 0;
+		bool bInComboWindow = false;
+		bool bComboWindowDone = false;
+		bool bTriggerComboDone = false;
+	};
+
+	struct FSimulationResult
+	{
+		int32 NumInputs = 0;
+		int32 NumLateInputs = 0;
+		int32 NumCorrections = 0;
+		TArray<int32> ServerComboIndices;
+		TArray<int32> ClientComboIndices;
+		bool bSettled = false;
+	};
+
+	UWorld* World = nullptr;
+	UGSCComboWindowNotifyState* ComboWindowNotify = nullptr;
+	UGSCTriggerComboNotify* TriggerComboNotify = nullptr;
+
+	UAbilitySystemComponent* ServerASC = nullptr;
+	UGSCTestComboManagerComponent* ServerComboManager = nullptr;
+	FGameplayAbilitySpecHandle ServerAbilityHandle;
+	FEmulatedMontage ServerMontage;
+
+	/** Prediction key of the server activation combo input frames are received for */
+	FPredictionKey ServerInputFramePredictionKey;
+
+	UAbilitySystemComponent* ClientASC = nullptr;
+	UGSCTestComboManagerComponent* ClientComboManager = nullptr;
+	FGameplayAbilitySpecHandle ClientAbilityHandle;
+	FEmulatedMontage ClientMontage;
+
+	/** Combo input frames the owning client sent as target data, net serialized */
+	TArray<TArray<uint8>> SentInputFrames;
+	FPredictionKey SentInputFramePredictionKey;
+	FDelegateHandle SentInputFrameDelegateHandle;
+
+	/** Spawns a character with an ability system, core and combo manager components, granted the combo ability */
+	ACharacter* SpawnCombatant(const bool bInOwningClient, UAbilitySystemComponent*& OutASC, UGSCTestComboManagerComponent*& OutComboManager, FGameplayAbilitySpecHandle& OutAbilityHandle, FEmulatedMontage& OutMontage) const
+	{
+		ACharacter* Character = World->SpawnActor<ACharacter>();
+		if (!Character)
+		{
+			return nullptr;
+		}
+
+		if (bInOwningClient)
+		{
+			// Locally controlled, as the character of the owning client. The server character is remote controlled.
+			if (APlayerController* PlayerController = World->SpawnActor<APlayerController>())
+			{
+				PlayerController->Possess(Character);
+			}
+		}
+
+		OutASC = NewObject<UAbilitySystemComponent>(Character);
+		OutASC->RegisterComponent();
+		OutASC->InitAbilityActorInfo(Character, Character);
+
+		UGSCCoreComponent* CoreComponent = NewObject<UGSCCoreComponent>(Character);
+		CoreComponent->RegisterComponent();
+		CoreComponent->SetupOwner();
+		CoreComponent->RegisterAbilitySystemDelegates(OutASC);
+
+		OutComboManager = NewObject<UGSCTestComboManagerComponent>(Character);
+		OutComboManager->RegisterComponent();
+		OutComboManager->SetupOwner();
+		if (bInOwningClient)
+		{
+			OutComboManager->SimulateOwningClient();
+		}
+
+		OutAbilityHandle = OutASC->GiveAbility(FGameplayAbilitySpec(UGSCTestComboAbility::StaticClass()));
+		const FGameplayAbilitySpec* Spec = OutASC->FindAbilitySpecFromHandle(OutAbilityHandle);
+
+		OutMontage = FEmulatedMontage();
+		OutMontage.Character = Character;
+		OutMontage.Ability = Spec ? Cast<UGSCTestComboAbility>(Spec->GetPrimaryInstance()) : nullptr;
+		OutMontage.bHasAuthority = !bInOwningClient;
+		return Character;
+	}
+
+	void EndComboWindow(FEmulatedMontage& InOutMontage) const
+	{
+		InOutMontage.bInComboWindow = false;
+		InOutMontage.bComboWindowDone = true;
+		static_cast<UAnimNotifyState*>(ComboWindowNotify)->NotifyEnd(InOutMontage.Character->GetMesh(), nullptr, FAnimNotifyEventReference());
+	}
+
+	/** Calls the notifies of the montage reached by the given time, and ends the combo ability with the montage */
+	void TickMontage(FEmulatedMontage& InOutMontage, const double InNow) const
+	{
+		if (InOutMontage.StartTime < 0.0)
+		{
+			return;
+		}
+
+		USkeletalMeshComponent* Mesh = InOutMontage.Character->GetMesh();
+		const double MontageTime = InNow - InOutMontage.StartTime;
+		if (MontageTime >= MontageLength)
+		{
+			if (InOutMontage.bInComboWindow)
+			{
+				EndComboWindow(InOutMontage);
+			}
+
+			InOutMontage.StartTime = -1.0;
+			InOutMontage.Ability->SimulateMontageEnded();
+			return;
+		}
+
+		if (!InOutMontage.bInComboWindow && !InOutMontage.bComboWindowDone && MontageTime >= ComboWindowStart)
+		{
+			InOutMontage.bInComboWindow = true;
+			static_cast<UAnimNotifyState*>(ComboWindowNotify)->NotifyBegin(Mesh, nullptr, ComboWindowEnd - ComboWindowStart, FAnimNotifyEventReference());
+		}
+
+		if (InOutMontage.bInComboWindow && !InOutMontage.bTriggerComboDone && MontageTime >= TriggerComboTime)
+		{
+			InOutMontage.bTriggerComboDone = true;
+			static_cast<UAnimNotify*>(TriggerComboNotify)->Notify(Mesh, nullptr, FAnimNotifyEventReference());
+		}
+
+		if (!InOutMontage.bInComboWindow)
+		{
+			return;
+		}
+
+		if (MontageTime >= ComboWindowEnd)
+		{
+			EndComboWindow(InOutMontage);
+		}
+		else if (InOutMontage.bHasAuthority)
+		{
+			static_cast<UAnimNotifyState*>(ComboWindowNotify)->NotifyTick(Mesh, nullptr, TickDeltaTime, FAnimNotifyEventReference());
+		}
+	}
+
+	/** Plays the montage of a combo ability activated since the last call, interrupting the previous one. Returns whether it did. */
+	bool SyncActivation(FEmulatedMontage& InOutMontage, const double InNow) const
+	{
+		const int32 NumActivations = InOutMontage.Ability->ActivatedComboIndices.Num();
+		if (NumActivations == InOutMontage.NumActivations)
+		{
+			return false;
+		}
+
+		InOutMontage.NumActivations = NumActivations;
+		if (InOutMontage.bInComboWindow)
+		{
+			EndComboWindow(InOutMontage);
+		}
+
+		InOutMontage.StartTime = InNow;
+		InOutMontage.bInComboWindow = false;
+		InOutMontage.bComboWindowDone = false;
+		InOutMontage.bTriggerComboDone = false;
+		return true;
+	}
+
+	bool SyncServerActivation(const double InNow)
+	{
+		if (!SyncActivation(ServerMontage, InNow))
+		{
+			return false;
+		}
+
+		// Every controller is local in a standalone world, listen for the inputs of the owning client as the combo
+		// ability does on a server
+		ServerInputFramePredictionKey = ServerMontage.Ability->GetCurrentActivationInfo().GetActivationPredictionKey();
+		ServerComboManager->ListenForComboInputFrames(ServerASC, ServerAbilityHandle, ServerInputFramePredictionKey);
+		return true;
+	}
+
+	bool SyncClientActivation(const double InNow)
+	{
+		if (!SyncActivation(ClientMontage, InNow))
+		{
+			return false;
+		}
+
+		// Combo input frames of this activation, as ServerSetReplicatedTargetData() runs locally in a standalone world
+		ClientASC->AbilityTargetDataSetDelegate(ClientAbilityHandle, SentInputFramePredictionKey).Remove(SentInputFrameDelegateHandle);
+		SentInputFramePredictionKey = ClientMontage.Ability->GetCurrentActivationInfo().GetActivationPredictionKey();
+		SentInputFrameDelegateHandle = ClientASC->AbilityTargetDataSetDelegate(ClientAbilityHandle, SentInputFramePredictionKey).AddLambda([this](const FGameplayAbilityTargetDataHandle& Data, FGameplayTag ApplicationTag)
+		{
+			ClientASC->ConsumeClientReplicatedTargetData(ClientAbilityHandle, SentInputFramePredictionKey);
+
+			const FGameplayAbilityTargetData* TargetData = Data.Get(0);
+			if (!TargetData || TargetData->GetScriptStruct() != FGSCComboInputFrame::StaticStruct())
+			{
+				AddError(TEXT("Combo input sent as unexpected target data"));
+				return;
+			}
+
+			FGSCComboInputFrame Frame = *static_cast<const FGSCComboInputFrame*>(TargetData);
+			FMemoryWriter Writer(SentInputFrames.AddDefaulted_GetRef());
+			bool bSuccess = false;
+			Frame.NetSerialize(Writer, nullptr, bSuccess);
+		});
+
+		return true;
+	}
+
+	/** Server: Receives a combo input frame sent by the owning client as target data of the combo ability */
+	void ReceiveInputFrame(const TArray<uint8>& InBytes) const
+	{
+		FGSCComboInputFrame* Frame = new FGSCComboInputFrame();
+		FMemoryReader Reader(InBytes);
+		bool bSuccess = false;
+		Frame->NetSerialize(Reader, nullptr, bSuccess);
+
+		const FGameplayAbilityTargetDataHandle DataHandle(Frame);
+		ServerASC->ServerSetReplicatedTargetData(ServerAbilityHandle, ServerInputFramePredictionKey, DataHandle, FGameplayTag(), FPredictionKey());
+	}
+
+	/** Player starts a combo, activating the combo ability on the owning client then on the server */
+	void StartCombo(const double InNow)
+	{
+		ClientComboManager->ActivateComboAbility(UGSCTestComboAbility::StaticClass());
+		SyncClientActivation(InNow);
+
+		ServerASC->TryActivateAbility(ServerAbilityHandle);
+		SyncServerActivation(InNow);
+	}
+
+	void TickMontages(const double InNow)
+	{
+		TickMontage(ServerMontage, InNow);
+		TickMontage(ClientMontage, InNow);
+	}
+
+	/**
+	 * Runs a player chaining combos on an owning client against the server over the emulated connection.
+	 *
+	 * The player presses attack once per combo montage at a random time around the combo window (sometimes too early or
+	 * too late), until the last combo, then waits a bit after the combo ended to start the next one. Inputs stop for
+	 * the last few seconds to let both ends settle.
+	 */
+	FSimulationResult RunSimulation(const int32 InSeed)
+	{
+		enum class EMessageType : uint8
+		{
+			ActivateCombo,
+			InputFrame,
+			ComboState
+		};
+
+		struct FMessage
+		{
+			double ArrivalTime = 0.0;
+			EMessageType Type = EMessageType::ActivateCombo;
+			TArray<uint8> InputFrame;
+			FGSCComboState ComboState;
+		};
+
+		const auto Enqueue = [](TArray<FMessage>& InQueue, const FMessage& InMessage)
+		{
+			const int32 Index = Algo::UpperBoundBy(InQueue, InMessage.ArrivalTime, [](const FMessage& Message) { return Message.ArrivalTime; });
+			InQueue.Insert(InMessage, Index);
+		};
+
+		const auto Dequeue = [](TArray<FMessage>& InQueue, const double InNow, FMessage& OutMessage)
+		{
+			if (InQueue.IsEmpty() || InQueue[0].ArrivalTime > InNow)
+			{
+				return false;
+			}
+
+			OutMessage = InQueue[0];
+			InQueue.RemoveAt(0);
+			return true;
+		};
+
+		FEmulatedLink ClientToServer(InSeed);
+		FEmulatedLink ServerToClient(InSeed + 1);
+		FRandomStream PlayerStream(InSeed + 2);
+
+		TArray<FMessage> ServerQueue;
+		TArray<FMessage> ClientQueue;
+
+		FSimulationResult Result;
+
+		double NextNetUpdateTime = 0.0;
+		double NextInputTime = 0.5;
+		double LastMontageStartTime = -1.0;
+		bool bInputDone = false;
+		bool bWasComboActive = false;
+
+		double Now = 0.0;
+
+		// Next combo abilities activated by the server, ClientTryActivateAbility() on the owning client
+		const auto SendClientActivation = [&]()
+		{
+			FMessage Activation;
+			Activation.Type = EMessageType::ActivateCombo;
+			Activation.ArrivalTime = ServerToClient.GetReliableArrivalTime(Now);
+			Enqueue(ClientQueue, Activation);
+		};
+
+		for (int32 TickIndex = 0; Now < SimulationDuration + SettleDuration; Now = ++TickIndex * TickDeltaTime)
+		{
+			// Server
+			FMessage Message;
+			while (Dequeue(ServerQueue, Now, Message))
+			{
+				if (Message.Type == EMessageType::ActivateCombo)
+				{
+					// First combo, predicted by the owning client. A combo still active here isn't activated again.
+					if (!ServerMontage.Ability->IsActive())
+					{
+						ServerASC->TryActivateAbility(ServerAbilityHandle);
+						SyncServerActivation(Now);
+					}
+				}
+				else
+				{
+					const bool bInComboWindow = ServerMontage.bInComboWindow;
+					ReceiveInputFrame(Message.InputFrame);
+					if (SyncServerActivation(Now))
+					{
+						Result.NumLateInputs += bInComboWindow ? 0 : 1;
+						SendClientActivation();
+					}
+				}
+			}
+
+			TickMontage(ServerMontage, Now);
+			if (SyncServerActivation(Now))
+			{
+				SendClientActivation();
+			}
+
+			if (Now >= NextNetUpdateTime)
+			{
+				NextNetUpdateTime += NetUpdateInterval;
+				if (!ServerToClient.ShouldDropUnreliable())
+				{
+					FMessage Snapshot;
+					Snapshot.Type = EMessageType::ComboState;
+					Snapshot.ArrivalTime = Now + ServerToClient.OneWayLatency;
+					Snapshot.ComboState = ServerComboManager->SimulatePreReplication();
+					Enqueue(ClientQueue, Snapshot);
+				}
+			}
+
+			// Owning client
+			while (Dequeue(ClientQueue, Now, Message))
+			{
+				if (Message.Type == EMessageType::ActivateCombo)
+				{
+					ClientASC->ClientTryActivateAbility(ClientAbilityHandle);
+					SyncClientActivation(Now);
+				}
+				else
+				{
+					const int32 PredictedComboIndex = ClientComboManager->ComboIndex;
+					const bool bPredictedTriggerCombo = ClientComboManager->bShouldTriggerCombo;
+					ClientComboManager->SimulateComboStateReplicated(Message.ComboState);
+					Result.NumCorrections += PredictedComboIndex != ClientComboManager->ComboIndex || bPredictedTriggerCombo != ClientComboManager->bShouldTriggerCombo ? 1 : 0;
+				}
+			}
+
+			TickMontage(ClientMontage, Now);
+
+			// Player
+			const bool bComboActive = ClientMontage.Ability->IsActive();
+			if (bComboActive && ClientMontage.StartTime != LastMontageStartTime)
+			{
+				LastMontageStartTime = ClientMontage.StartTime;
+				bInputDone = ClientComboManager->ComboIndex >= MaxComboIndex;
+				NextInputTime = ClientMontage.StartTime + PlayerStream.FRandRange(ComboWindowStart - 0.1, ComboWindowEnd + 0.05);
+			}
+
+			if (bWasComboActive && !bComboActive)
+			{
+				NextInputTime = Now + PlayerStream.FRandRange(0.5, 0.8);
+			}
+
+			bWasComboActive = bComboActive;
+
+			if (Now >= SimulationDuration || Now < NextInputTime)
+			{
+				continue;
+			}
+
+			if (!bComboActive)
+			{
+				// First combo goes through regular ability activation
+				Result.NumInputs++;
+				ClientComboManager->ActivateComboAbility(UGSCTestComboAbility::StaticClass());
+				if (!SyncClientActivation(Now))
+				{
+					AddError(FString::Printf(TEXT("Seed %d: combo ability didn't activate on the owning client"), InSeed));
+					break;
+				}
+
+				LastMontageStartTime = ClientMontage.StartTime;
+				bWasComboActive = true;
+				bInputDone = false;
+				NextInputTime = ClientMontage.StartTime + PlayerStream.FRandRange(ComboWindowStart - 0.1, ComboWindowEnd + 0.05);
+
+				FMessage Activation;
+				Activation.Type = EMessageType::ActivateCombo;
+				Activation.ArrivalTime = ClientToServer.GetReliableArrivalTime(Now);
+				Enqueue(ServerQueue, Activation);
+			}
+			else if (!bInputDone)
+			{
+				// Sent as target data of the active combo ability
+				Result.NumInputs++;
+				bInputDone = true;
+				ClientComboManager->ActivateComboAbility(UGSCTestComboAbility::StaticClass());
+
+				for (TArray<uint8>& InputFrame : SentInputFrames)
+				{
+					FMessage Input;
+					Input.Type = EMessageType::InputFrame;
+					Input.ArrivalTime = ClientToServer.GetReliableArrivalTime(Now);
+					Input.InputFrame = MoveTemp(InputFrame);
+					Enqueue(ServerQueue, Input);
+				}
+
+				SentInputFrames.Reset();
+			}
+		}
+
+		Result.ServerComboIndices = ServerMontage.Ability->ActivatedComboIndices;
+		Result.ClientComboIndices = ClientMontage.Ability->ActivatedComboIndices;
+		Result.bSettled = ServerQueue.IsEmpty()
+			&& !ServerMontage.Ability->IsActive()
+			&& !ClientMontage.Ability->IsActive()
+			&& ServerComboManager->ComboIndex == ClientComboManager->ComboIndex;
+		return Result;
+	}
+
+END_DEFINE_SPEC(FGSCComboPredictionSpec)
+
+void FGSCComboPredictionSpec::Define()
+{
+	Describe(TEXT("Input frames"), [this]()
+	{
+		It(TEXT("should number input frames and ignore stale ones"), [this]()
+		{
+			FGSCComboPrediction Client;
+			FGSCComboPrediction Server;
+
+			FGSCComboState PredictedState;
+			const FGSCComboInputFrame FirstFrame = Client.MakeInputFrame(PredictedState);
+			const FGSCComboInputFrame SecondFrame = Client.MakeInputFrame(PredictedState);
+			TestEqual(TEXT("First frame"), static_cast<int32>(FirstFrame.InputFrame), 1);
+			TestEqual(TEXT("Second frame"), static_cast<int32>(SecondFrame.InputFrame), 2);
+
+			bool bTriggerCombo = false;
+			FGSCComboState ServerState;
+			TestTrue(TEXT("Second frame resolved"), Server.ResolveInputFrame(SecondFrame, ServerState, true, bTriggerCombo));
+			TestFalse(TEXT("First frame ignored once second frame is resolved"), Server.ResolveInputFrame(FirstFrame, ServerState, true, bTriggerCombo));
+			TestFalse(TEXT("Duplicate frame ignored"), Server.ResolveInputFrame(SecondFrame, ServerState, true, bTriggerCombo));
+			TestEqual(TEXT("Last resolved frame"), static_cast<int32>(Server.GetLastInputFrame()), static_cast<int32>(SecondFrame.InputFrame));
+		});
+
+		It(TEXT("should handle input frames wrapping around"), [this]()
+		{
+			TestTrue(TEXT("0 is newer than 255"), FGSCComboPrediction::IsNewerInputFrame(0, 255));
+			TestTrue(TEXT("10 is newer than 250"), FGSCComboPrediction::IsNewerInputFrame(10, 250));
+			TestFalse(TEXT("255 is older than 0"), FGSCComboPrediction::IsNewerInputFrame(255, 0));
+			TestFalse(TEXT("Same frame is not newer"), FGSCComboPrediction::IsNewerInputFrame(42, 42));
+
+			FGSCComboPrediction Client;
+			FGSCComboState ServerState;
+			for (int32 Index = 0; Index < 300; ++Index)
+			{
+				const FGSCComboInputFrame Frame = Client.MakeInputFrame(FGSCComboState());
+				ServerState.InputFrame = Frame.InputFrame;
+			}
+
+			TestFalse(TEXT("No pending frames once the last one wrapped around is acknowledged"), Client.HasPendingInputFrames(ServerState));
+		});
+
+		It(TEXT("should resolve inputs against the combo step they were made in"), [this]()
+		{
+			FGSCComboPrediction Server;
+
+			FGSCComboState ServerState;
+			ServerState.ComboIndex = 1;
+			ServerState.bComboWindowOpened = true;
+
+			FGSCComboInputFrame Frame;
+			Frame.bTriggerCombo = true;
+
+			bool bTriggerCombo = false;
+			Frame.InputFrame = 1;
+			Frame.ComboIndex = 0;
+			Server.ResolveInputFrame(Frame, ServerState, true, bTriggerCombo);
+			TestFalse(TEXT("Input made in a previous combo step doesn't trigger"), bTriggerCombo);
+
+			Frame.InputFrame = 2;
+			Frame.ComboIndex = 1;
+			Server.ResolveInputFrame(Frame, ServerState, false, bTriggerCombo);
+			TestFalse(TEXT("Input doesn't trigger without an active combo ability"), bTriggerCombo);
+
+			Frame.InputFrame = 3;
+			Frame.bTriggerCombo = false;
+			Server.ResolveInputFrame(Frame, ServerState, true, bTriggerCombo);
+			TestFalse(TEXT("Input made outside of the client combo window doesn't trigger"), bTriggerCombo);
+
+			Frame.InputFrame = 4;
+			Frame.bTriggerCombo = true;
+			Server.ResolveInputFrame(Frame, ServerState, true, bTriggerCombo);
+			TestTrue(TEXT("Input made in the same combo step triggers"), bTriggerCombo);
+			TestTrue(TEXT("Outcome replicated to the client"), Server.DidLastInputTriggerCombo());
+
+			// Server activated the next combo from this combo step, a repeated input is acknowledged without triggering again
+			ServerState.bNextComboAbilityActivated = true;
+			Frame.InputFrame = 5;
+			Server.ResolveInputFrame(Frame, ServerState, true, bTriggerCombo);
+			TestFalse(TEXT("Repeated input doesn't trigger again"), bTriggerCombo);
+			TestTrue(TEXT("Repeated input acknowledged as triggering"), Server.DidLastInputTriggerCombo());
+		});
+
+		It(TEXT("should resolve late inputs while the combo ability is active"), [this]()
+		{
+			FGSCComboPrediction Server;
+
+			FGSCComboState ServerState;
+			ServerState.ComboIndex = 2;
+			Server.CloseComboWindow(ServerState.ComboIndex);
+			ServerState.ComboIndex = 0;
+
+			FGSCComboInputFrame Frame;
+			Frame.InputFrame = 1;
+			Frame.ComboIndex = 2;
+			Frame.bTriggerCombo = true;
+
+			bool bTriggerCombo = false;
+			Server.ResolveInputFrame(Frame, ServerState, true, bTriggerCombo);
+			TestTrue(TEXT("Input made within the closed combo window triggers"), bTriggerCombo);
+			TestTrue(TEXT("Triggered from closed combo window"), Server.HasTriggeredComboFrom(2));
+
+			Server.BeginComboStep(false);
+			Frame.InputFrame = 2;
+			Frame.ComboIndex = 3;
+			Server.ResolveInputFrame(Frame, ServerState, true, bTriggerCombo);
+			TestFalse(TEXT("Input for another combo step doesn't trigger once the next step started"), bTriggerCombo);
+		});
+
+		It(TEXT("should keep predicted state while input frames are pending"), [this]()
+		{
+			FGSCComboPrediction Client;
+
+			FGSCComboState PredictedState;
+			PredictedState.ComboIndex = 1;
+			PredictedState.bComboWindowOpened = true;
+			PredictedState.bShouldTriggerCombo = true;
+			Client.MakeInputFrame(PredictedState);
+			Client.MakeInputFrame(PredictedState);
+
+			FGSCComboState ServerState;
+			ServerState.InputFrame = 1;
+			ServerState.bInputFrameTriggeredCombo = false;
+
+			TestTrue(TEXT("Frames pending"), Client.HasPendingInputFrames(ServerState));
+			TestFalse(TEXT("No correction while frames are pending"), Client.Reconcile(ServerState, PredictedState));
+			TestTrue(TEXT("Still predicting next combo"), PredictedState.bShouldTriggerCombo);
+
+			ServerState.InputFrame = 2;
+			ServerState.bInputFrameTriggeredCombo = true;
+			TestFalse(TEXT("No correction when the server agrees"), Client.Reconcile(ServerState, PredictedState));
+			TestEqual(TEXT("Combo index"), PredictedState.ComboIndex, 1);
+		});
+
+		It(TEXT("should correct inputs rejected by the server"), [this]()
+		{
+			FGSCComboPrediction Client;
+
+			FGSCComboState PredictedState;
+			PredictedState.ComboIndex = 1;
+			PredictedState.bComboWindowOpened = true;
+			PredictedState.bShouldTriggerCombo = true;
+			Client.MakeInputFrame(PredictedState);
+
+			FGSCComboState ServerState;
+			ServerState.InputFrame = 1;
+			ServerState.bInputFrameTriggeredCombo = false;
+
+			TestTrue(TEXT("Corrected while in the same combo step"), Client.Reconcile(ServerState, PredictedState));
+			TestFalse(TEXT("Next combo won't trigger"), PredictedState.bShouldTriggerCombo);
+			TestEqual(TEXT("Combo index kept"), PredictedState.ComboIndex, 1);
+			TestFalse(TEXT("Reconciled once"), Client.Reconcile(ServerState, PredictedState));
+
+			// Next combo step predicted when the client combo window closed
+			PredictedState.bShouldTriggerCombo = true;
+			Client.MakeInputFrame(PredictedState);
+			PredictedState.ComboIndex = 2;
+			PredictedState.bShouldTriggerCombo = false;
+
+			ServerState.InputFrame = 2;
+			TestTrue(TEXT("Corrected after the predicted combo step"), Client.Reconcile(ServerState, PredictedState));
+			TestEqual(TEXT("Combo reset"), PredictedState.ComboIndex, 0);
+		});
+
+		It(TEXT("should net serialize input frames"), [this]()
+		{
+			FGSCComboInputFrame Frame;
+			Frame.InputFrame = 200;
+			Frame.ComboIndex = 3;
+			Frame.bTriggerCombo = true;
+
+			TArray<uint8> Bytes;
+			FMemoryWriter Writer(Bytes);
+			bool bSuccess = false;
+			Frame.NetSerialize(Writer, nullptr, bSuccess);
+			TestTrue(TEXT("Serialized"), bSuccess);
+
+			FGSCComboInputFrame ReadFrame;
+			FMemoryReader Reader(Bytes);
+			ReadFrame.NetSerialize(Reader, nullptr, bSuccess);
+			TestTrue(TEXT("Deserialized"), bSuccess);
+			TestEqual(TEXT("Input frame"), static_cast<int32>(ReadFrame.InputFrame), static_cast<int32>(Frame.InputFrame));
+			TestEqual(TEXT("Combo index"), ReadFrame.ComboIndex, Frame.ComboIndex);
+			TestTrue(TEXT("Trigger combo"), ReadFrame.bTriggerCombo);
+		});
+	});
+
+	Describe(TEXT("Emulated network"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCComboPredictionSpec"));
+
+			SentInputFrames.Reset();
+			SentInputFramePredictionKey = FPredictionKey();
+			SentInputFrameDelegateHandle.Reset();
+			ServerInputFramePredictionKey = FPredictionKey();
+
+			const ACharacter* ServerCharacter = SpawnCombatant(false, ServerASC, ServerComboManager, ServerAbilityHandle, ServerMontage);
+			const ACharacter* ClientCharacter = SpawnCombatant(true, ClientASC, ClientComboManager, ClientAbilityHandle, ClientMontage);
+			if (!ServerCharacter || !ClientCharacter || !ServerMontage.Ability || !ClientMontage.Ability)
+			{
+				return AddError(TEXT("Unable to spawn test characters"));
+			}
+
+			ComboWindowNotify = NewObject<UGSCComboWindowNotifyState>(GetTransientPackage());
+			TriggerComboNotify = NewObject<UGSCTriggerComboNotify>(GetTransientPackage());
+		});
+
+		It(TEXT("should resolve combo state on the server and predict it on the owning client"), [this]()
+		{
+			TestTrue(TEXT("Server resolving combo"), ServerComboManager->IsResolvingComboLocally());
+			TestFalse(TEXT("Server not predicting"), ServerComboManager->IsLocallyPredicting());
+			TestTrue(TEXT("Owning client resolving combo"), ClientComboManager->IsResolvingComboLocally());
+			TestTrue(TEXT("Owning client predicting"), ClientComboManager->IsLocallyPredicting());
+			TestFalse(TEXT("Owning client not authoritative"), ClientComboManager->IsOwnerActorAuthoritative());
+		});
+
+		It(TEXT("should activate the next combo from an input received once the server combo window closed"), [this]()
+		{
+			StartCombo(0.0);
+			TickMontages(0.55);
+
+			// Input at the end of the combo window, predicted to trigger the next combo
+			ClientComboManager->ActivateComboAbility(UGSCTestComboAbility::StaticClass());
+			TestTrue(TEXT("Owning client should trigger combo"), ClientComboManager->bShouldTriggerCombo);
+			TestEqual(TEXT("Input frames sent"), SentInputFrames.Num(), 1);
+
+			// Both combo windows close before the input reaches the server
+			TickMontages(0.65);
+			TestEqual(TEXT("Owning client predicted next combo index"), ClientComboManager->ComboIndex, 1);
+			TestEqual(TEXT("Server combo index"), ServerComboManager->ComboIndex, 0);
+
+			if (SentInputFrames.Num() != 1)
+			{
+				return;
+			}
+
+			ReceiveInputFrame(SentInputFrames[0]);
+			TestTrue(TEXT("Server activated next combo"), SyncServerActivation(0.7));
+			TestEqual(TEXT("Server combo index"), ServerComboManager->ComboIndex, 1);
+
+			ClientASC->ClientTryActivateAbility(ClientAbilityHandle);
+			TestTrue(TEXT("Owning client activated next combo"), SyncClientActivation(0.75));
+			TestEqual(TEXT("Owning client combo index"), ClientComboManager->ComboIndex, 1);
+			TestTrue(TEXT("Same combo index for every combo ability activated"), ClientMontage.Ability->ActivatedComboIndices == ServerMontage.Ability->ActivatedComboIndices);
+
+			ClientComboManager->SimulateComboStateReplicated(ServerComboManager->SimulatePreReplication());
+			TestEqual(TEXT("Owning client combo index once reconciled"), ClientComboManager->ComboIndex, 1);
+		});
+
+		It(TEXT("should correct a combo input rejected by the server"), [this]()
+		{
+			StartCombo(0.0);
+			TickMontages(0.55);
+
+			ClientComboManager->ActivateComboAbility(UGSCTestComboAbility::StaticClass());
+			TickMontages(0.65);
+			TestEqual(TEXT("Owning client predicted next combo index"), ClientComboManager->ComboIndex, 1);
+
+			// Input reaches the server once the combo ended there
+			TickMontages(0.85);
+			TestFalse(TEXT("Server combo ended"), ServerMontage.Ability->IsActive());
+			TestFalse(TEXT("Owning client combo ended"), ClientMontage.Ability->IsActive());
+
+			if (SentInputFrames.Num() != 1)
+			{
+				return AddError(TEXT("Input frame not sent"));
+			}
+
+			ReceiveInputFrame(SentInputFrames[0]);
+			TestFalse(TEXT("Server didn't activate next combo"), SyncServerActivation(0.9));
+
+			const FGSCComboState ServerState = ServerComboManager->SimulatePreReplication();
+			TestEqual(TEXT("Input frame acknowledged"), static_cast<int32>(ServerState.InputFrame), 1);
+			TestFalse(TEXT("Input frame rejected"), ServerState.bInputFrameTriggeredCombo);
+
+			ClientComboManager->SimulateComboStateReplicated(ServerState);
+			TestEqual(TEXT("Owning client combo reset"), ClientComboManager->ComboIndex, 0);
+			TestEqual(TEXT("Server combo index"), ServerComboManager->ComboIndex, 0);
+		});
+
+		for (int32 Seed = 0; Seed < NumSimulations; ++Seed)
+		{
+			It(FString::Printf(TEXT("should play the same combo steps on both ends at 150ms RTT and 5%% packet loss (seed %d)"), Seed), [this, Seed]()
+			{
+				const FSimulationResult Result = RunSimulation(Seed);
+
+				AddInfo(FString::Printf(
+					TEXT("%d inputs, %d combo abilities activated (%d from late inputs), %d corrections"),
+					Result.NumInputs,
+					Result.ServerComboIndices.Num(),
+					Result.NumLateInputs,
+					Result.NumCorrections
+				));
+
+				TestTrue(TEXT("Combo chained up to the last combo"), Result.ServerComboIndices.Contains(MaxComboIndex));
+				TestEqual(TEXT("Same number of combo abilities activated"), Result.ClientComboIndices.Num(), Result.ServerComboIndices.Num());
+				TestTrue(TEXT("Same combo index for every combo ability activated"), Result.ClientComboIndices == Result.ServerComboIndices);
+				TestTrue(TEXT("Settled"), Result.bSettled);
+			});
+		}
+
+		AfterEach([this]()
+		{
+			ServerASC = nullptr;
+			ServerComboManager = nullptr;
+			ServerMontage = FEmulatedMontage();
+			ClientASC = nullptr;
+			ClientComboManager = nullptr;
+			ClientMontage = FEmulatedMontage();
+			ComboWindowNotify = nullptr;
+			TriggerComboNotify = nullptr;
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+}
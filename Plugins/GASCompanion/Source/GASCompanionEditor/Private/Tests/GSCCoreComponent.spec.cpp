@@ -0,0 +1,240 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "Abilities/GSCGameplayAbility.h"
+#include "Components/GSCCoreComponent.h"
+#include "GSCTestAttributeChangeListener.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "NativeGameplayTags.h"
+#include "GSCTestWorld.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Core_Burn, "GASCompanion.Test.Core.Burn");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Core_Poison, "GASCompanion.Test.Core.Poison");
+
+BEGIN_DEFINE_SPEC(FGSCCoreComponentSpec, "GASCompanion.Editor.GSCCoreComponent", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 GrantedAbilityCount = 128;
+	static constexpr int32 ActiveAbilityCount = 4;
+	static constexpr int32 QueryCount = 10000;
+
+	UWorld* World = nullptr;
+	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	UGSCCoreComponent* CoreComponent = nullptr;
+	TArray<FGameplayAbilitySpecHandle> GrantedHandles;
+	UGSCTestAttributeChangeListener* Listener = nullptr;
+
+	/** Active ability lookup as it was done prior to the active ability index: copies the spec array and walks every spec */
+	static int32 LegacyNumActiveAbilitiesByClass(const UAbilitySystemComponent* InASC, const UClass* InAbilityClass)
+	{
+		int32 Count = 0;
+		TArray<FGameplayAbilitySpec> Specs = InASC->GetActivatableAbilities();
+		for (const FGameplayAbilitySpec& Spec : Specs)
+		{
+			if (Spec.Ability && Spec.Ability->GetClass()->IsChildOf(InAbilityClass))
+			{
+				for (const UGameplayAbility* Instance : Spec.GetAbilityInstances())
+				{
+					Count += Instance && Instance->IsActive() ? 1 : 0;
+				}
+			}
+		}
+
+		return Count;
+	}
+
+END_DEFINE_SPEC(FGSCCoreComponentSpec)
+
+void FGSCCoreComponentSpec::Define()
+{
+	Describe(TEXT("Active Abilities"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCCoreComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			AbilitySystemComponent = NewObject<UAbilitySystemComponent>(Actor);
+			AbilitySystemComponent->RegisterComponent();
+			AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+			CoreComponent = NewObject<UGSCCoreComponent>(Actor);
+			CoreComponent->RegisterComponent();
+			CoreComponent->SetupOwner();
+			CoreComponent->RegisterAbilitySystemDelegates(AbilitySystemComponent);
+
+			GrantedHandles.Reset();
+			for (int32 Index = 0; Index < GrantedAbilityCount; ++Index)
+			{
+				GrantedHandles.Add(AbilitySystemComponent->GiveAbility(FGameplayAbilitySpec(UGSCGameplayAbility::StaticClass(), Index + 1)));
+			}
+		});
+
+		It(TEXT("should return abilities activated before the index was registered"), [this]()
+		{
+			TestTrue(TEXT("Ability activated"), AbilitySystemComponent->TryActivateAbility(GrantedHandles[0]));
+
+			CoreComponent->RegisterAbilitySystemDelegates(AbilitySystemComponent);
+
+			TestEqual(TEXT("Active abilities by class"), CoreComponent->GetActiveAbilitiesByClass(UGSCGameplayAbility::StaticClass()).Num(), 1);
+		});
+
+		It(TEXT("should match iterating ability specs"), [this]()
+		{
+			for (int32 Index = 0; Index < ActiveAbilityCount; ++Index)
+			{
+				TestTrue(TEXT("Ability activated"), AbilitySystemComponent->TryActivateAbility(GrantedHandles[Index * 8]));
+			}
+
+			const int32 Expected = LegacyNumActiveAbilitiesByClass(AbilitySystemComponent, UGSCGameplayAbility::StaticClass());
+			TestEqual(TEXT("Active abilities from specs"), Expected, ActiveAbilityCount);
+			TestEqual(TEXT("Active abilities by class"), CoreComponent->GetActiveAbilitiesByClass(UGSCGameplayAbility::StaticClass()).Num(), Expected);
+			TestEqual(TEXT("Active abilities by base class"), CoreComponent->GetActiveAbilitiesByClass(UGameplayAbility::StaticClass()).Num(), Expected);
+			TestEqual(TEXT("Active abilities by empty tags"), CoreComponent->GetActiveAbilitiesByTags(FGameplayTagContainer()).Num(), Expected);
+			TestTrue(TEXT("Is using ability by class"), CoreComponent->IsUsingAbilityByClass(UGSCGameplayAbility::StaticClass()));
+		});
+
+		It(TEXT("should drop abilities once they end or are removed"), [this]()
+		{
+			TestTrue(TEXT("Ability activated"), AbilitySystemComponent->TryActivateAbility(GrantedHandles[0]));
+			TestTrue(TEXT("Ability activated"), AbilitySystemComponent->TryActivateAbility(GrantedHandles[1]));
+
+			AbilitySystemComponent->CancelAbilityHandle(GrantedHandles[0]);
+			TestEqual(TEXT("Active abilities after cancel"), CoreComponent->GetActiveAbilitiesByClass(UGSCGameplayAbility::StaticClass()).Num(), 1);
+
+			AbilitySystemComponent->ClearAbility(GrantedHandles[1]);
+			TestEqual(TEXT("Active abilities after clear"), CoreComponent->GetActiveAbilitiesByClass(UGSCGameplayAbility::StaticClass()).Num(), 0);
+			TestFalse(TEXT("Is using ability by class"), CoreComponent->IsUsingAbilityByClass(UGSCGameplayAbility::StaticClass()));
+		});
+
+		It(TEXT("should query active abilities faster than iterating ability specs"), [this]()
+		{
+			for (int32 Index = 0; Index < ActiveAbilityCount; ++Index)
+			{
+				AbilitySystemComponent->TryActivateAbility(GrantedHandles[Index * 8]);
+			}
+
+			UClass* AbilityClass = UGSCGameplayAbility::StaticClass();
+			int32 LegacyFound = 0;
+			int32 IndexFound = 0;
+
+			const double LegacyStartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < QueryCount; ++Query)
+			{
+				LegacyFound += LegacyNumActiveAbilitiesByClass(AbilitySystemComponent, AbilityClass);
+			}
+			const double LegacyTime = FPlatformTime::Seconds() - LegacyStartTime;
+
+			const double IndexStartTime = FPlatformTime::Seconds();
+			for (int32 Query = 0; Query < QueryCount; ++Query)
+			{
+				IndexFound += CoreComponent->GetActiveAbilitiesByClass(AbilityClass).Num();
+			}
+			const double IndexTime = FPlatformTime::Seconds() - IndexStartTime;
+
+			TestEqual(TEXT("Same results"), IndexFound, LegacyFound);
+			AddInfo(FString::Printf(
+				TEXT("%d queries with %d granted / %d active abilities: spec iteration %.2f ms, active ability index %.2f ms"),
+				QueryCount,
+				GrantedAbilityCount,
+				ActiveAbilityCount,
+				LegacyTime * 1000.0,
+				IndexTime * 1000.0
+			));
+
+			// The index only visits the active abilities of the class, spec iteration visits every granted ability
+			TestTrue(TEXT("Active ability index is faster than spec iteration"), IndexTime < LegacyTime);
+		});
+
+		AfterEach([this]()
+		{
+			AbilitySystemComponent = nullptr;
+			CoreComponent = nullptr;
+			GrantedHandles.Reset();
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+
+	Describe(TEXT("Attribute Change Coalescing"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			World = FGSCTestWorld::Create(TEXT("GSCCoreComponentSpec"));
+
+			AActor* Actor = World->SpawnActor<AActor>();
+			if (!Actor)
+			{
+				return AddError(TEXT("Unable to spawn test actor"));
+			}
+
+			CoreComponent = NewObject<UGSCCoreComponent>(Actor);
+			CoreComponent->RegisterComponent();
+			CoreComponent->SetStartupAbilitiesGranted(true);
+
+			Listener = NewObject<UGSCTestAttributeChangeListener>();
+			Listener->AddToRoot();
+			CoreComponent->OnStaminaChange.AddDynamic(Listener, &UGSCTestAttributeChangeListener::OnAttributeChange);
+			CoreComponent->OnManaChange.AddDynamic(Listener, &UGSCTestAttributeChangeListener::OnAttributeChange);
+		});
+
+		It(TEXT("should broadcast the sum of the changes of a frame and the union of their tags"), [this]()
+		{
+			CoreComponent->bCoalesceAttributeChanges = true;
+
+			CoreComponent->HandleStaminaChange(-5.f, FGameplayTagContainer(TAG_GSCTest_Core_Burn));
+			CoreComponent->HandleStaminaChange(-3.f, FGameplayTagContainer(TAG_GSCTest_Core_Poison));
+			TestEqual(TEXT("Broadcasts before flush"), Listener->DeltaValues.Num(), 0);
+
+			CoreComponent->FlushAttributeChanges();
+			if (!TestEqual(TEXT("Broadcasts after flush"), Listener->DeltaValues.Num(), 1))
+			{
+				return;
+			}
+
+			TestEqual(TEXT("Coalesced delta"), Listener->DeltaValues[0], -8.f);
+			TestTrue(TEXT("Has tags of the first change"), Listener->EventTags[0].HasTagExact(TAG_GSCTest_Core_Burn));
+			TestTrue(TEXT("Has tags of the second change"), Listener->EventTags[0].HasTagExact(TAG_GSCTest_Core_Poison));
+		});
+
+		It(TEXT("should broadcast the sum of a suppressed burst once no longer suppressed"), [this]()
+		{
+			CoreComponent->SetAttributeEventsSuppressed(true);
+
+			CoreComponent->HandleManaChange(-10.f, FGameplayTagContainer(TAG_GSCTest_Core_Burn));
+			CoreComponent->HandleManaChange(4.f, FGameplayTagContainer());
+			CoreComponent->HandleManaChange(-2.f, FGameplayTagContainer(TAG_GSCTest_Core_Poison));
+			TestEqual(TEXT("Broadcasts while suppressed"), Listener->DeltaValues.Num(), 0);
+
+			CoreComponent->SetAttributeEventsSuppressed(false);
+			if (!TestEqual(TEXT("Broadcasts once restored"), Listener->DeltaValues.Num(), 1))
+			{
+				return;
+			}
+
+			TestEqual(TEXT("Coalesced delta"), Listener->DeltaValues[0], -8.f);
+			TestEqual(TEXT("Coalesced tags"), Listener->EventTags[0].Num(), 2);
+		});
+
+		AfterEach([this]()
+		{
+			CoreComponent = nullptr;
+
+			if (Listener)
+			{
+				Listener->RemoveFromRoot();
+				Listener = nullptr;
+			}
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+}
@@ -0,0 +1,236 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "NativeGameplayTags.h"
+#include "Abilities/Attributes/GSCAttributeSet.h"
+#include "Abilities/Attributes/GSCDamagePipeline.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+#include "GSCTestWorld.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Damage_Fire, "GASCompanion.Test.Damage.Fire");
+
+BEGIN_DEFINE_SPEC(FGSCDamagePipelineSpec, "GASCompanion.Editor.GSCDamagePipeline", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 BenchmarkExecutionCount = 100000;
+
+	UGSCDamagePipeline* Pipeline = nullptr;
+
+	UWorld* World = nullptr;
+	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	UGSCAttributeSet* AttributeSet = nullptr;
+
+	static FGSCDamageStage MakeStage(const EGSCDamageStageType InType, const float InValue, const float InCoefficient = 1.f)
+	{
+		FGSCDamageStage Stage;
+		Stage.Type = InType;
+		Stage.Value = InValue;
+		Stage.Coefficient = InCoefficient;
+		return Stage;
+	}
+
+	float Evaluate(const float InDamage, FGSCDamageBreakdown* OutBreakdown = nullptr, const FGameplayTagContainer* InSourceTags = nullptr) const
+	{
+		FGSCDamagePipelineContext Context;
+		Context.SourceTags = InSourceTags;
+		return Pipeline->Evaluate(Context, InDamage, OutBreakdown);
+	}
+
+	void CreateWorld()
+	{
+		World = FGSCTestWorld::Create(TEXT("GSCDamagePipelineSpec"));
+
+		AActor* Actor = World->SpawnActor<AActor>();
+		AbilitySystemComponent = NewObject<UAbilitySystemComponent>(Actor);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+		AttributeSet = NewObject<UGSCAttributeSet>(Actor);
+		AbilitySystemComponent->AddAttributeSetSubobject(AttributeSet);
+		AttributeSet->SetDamagePipeline(Pipeline);
+	}
+
+END_DEFINE_SPEC(FGSCDamagePipelineSpec)
+
+void FGSCDamagePipelineSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		Pipeline = NewObject<UGSCDamagePipeline>(GetTransientPackage());
+	});
+
+	Describe(TEXT("Stages"), [this]()
+	{
+		It(TEXT("should return damage as is without stages"), [this]()
+		{
+			TestEqual(TEXT("Damage"), Evaluate(42.f), 42.f);
+		});
+
+		It(TEXT("should apply multipliers"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Multiplier, 1.5f));
+			TestEqual(TEXT("Damage"), Evaluate(10.f), 15.f);
+		});
+
+		It(TEXT("should apply critical hits based on chance"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::CriticalHit, 1.f, 2.f));
+
+			FGSCDamageBreakdown Breakdown;
+			TestEqual(TEXT("Critical damage"), Evaluate(10.f, &Breakdown), 20.f);
+			TestTrue(TEXT("Critical breakdown"), Breakdown.bCritical);
+
+			Pipeline->Stages[0].Value = 0.f;
+			TestEqual(TEXT("Non critical damage"), Evaluate(10.f, &Breakdown), 10.f);
+			TestFalse(TEXT("Non critical breakdown"), Breakdown.bCritical);
+		});
+
+		It(TEXT("should cap resistances"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Resistance, 0.9f, 0.75f));
+			TestEqual(TEXT("Damage"), Evaluate(100.f), 25.f);
+		});
+
+		It(TEXT("should reduce damage with armor"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Armor, 100.f, 100.f));
+			TestEqual(TEXT("Damage"), Evaluate(100.f), 50.f);
+		});
+
+		It(TEXT("should absorb damage with shields"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Shield, 30.f));
+			TestEqual(TEXT("Partially absorbed"), Evaluate(100.f), 70.f);
+			TestEqual(TEXT("Fully absorbed"), Evaluate(20.f), 0.f);
+		});
+
+		It(TEXT("should only evaluate stages with matching tags"), [this]()
+		{
+			FGSCDamageStage FireResistance = MakeStage(EGSCDamageStageType::Resistance, 0.5f);
+			FireResistance.RequiredTags.AddTag(TAG_GSCTest_Damage_Fire);
+			Pipeline->Stages.Add(FireResistance);
+
+			FGameplayTagContainer FireTags;
+			FireTags.AddTag(TAG_GSCTest_Damage_Fire);
+
+			TestEqual(TEXT("Fire damage"), Evaluate(100.f, nullptr, &FireTags), 50.f);
+			TestEqual(TEXT("Other damage"), Evaluate(100.f), 100.f);
+		});
+
+		It(TEXT("should evaluate stages in order and fill the breakdown"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Shield, 20.f));
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Multiplier, 2.f));
+
+			FGSCDamageBreakdown Breakdown;
+			TestEqual(TEXT("Damage"), Evaluate(50.f, &Breakdown), 60.f);
+			TestEqual(TEXT("Incoming damage"), Breakdown.IncomingDamage, 50.f);
+			TestEqual(TEXT("Final damage"), Breakdown.FinalDamage, 60.f);
+			TestEqual(TEXT("Breakdown stages"), Breakdown.Stages.Num(), 2);
+			if (Breakdown.Stages.Num() == 2)
+			{
+				TestEqual(TEXT("First stage"), Breakdown.Stages[0].DamageAfter, 30.f);
+				TestEqual(TEXT("Second stage"), Breakdown.Stages[1].DamageAfter, 60.f);
+			}
+		});
+
+		It(TEXT("should be deterministic with a random stream"), [this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::CriticalHit, 0.5f, 2.f));
+
+			FRandomStream FirstStream(1234);
+			FRandomStream SecondStream(1234);
+			FGSCDamagePipelineContext FirstContext;
+			FirstContext.RandomStream = &FirstStream;
+			FGSCDamagePipelineContext SecondContext;
+			SecondContext.RandomStream = &SecondStream;
+
+			for (int32 Index = 0; Index < 64; ++Index)
+			{
+				TestEqual(TEXT("Same damage"), Pipeline->Evaluate(FirstContext, 10.f), Pipeline->Evaluate(SecondContext, 10.f));
+			}
+		});
+	});
+
+	Describe(TEXT("GSCAttributeSet"), [this]()
+	{
+		BeforeEach([this]()
+		{
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Multiplier, 1.5f));
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Resistance, 0.2f));
+			Pipeline->Stages.Add(MakeStage(EGSCDamageStageType::Armor, 100.f, 100.f));
+
+			// Mana acts as a mana shield
+			FGSCDamageStage ManaShield = MakeStage(EGSCDamageStageType::Shield, 0.f);
+			ManaShield.Attribute = UGSCAttributeSet::GetManaAttribute();
+			Pipeline->Stages.Add(ManaShield);
+
+			CreateWorld();
+		});
+
+		It(TEXT("should consume shield attributes"), [this]()
+		{
+			AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetMaxManaAttribute(), 100.f);
+			AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetManaAttribute(), 4.f);
+
+			FGSCDamagePipelineContext Context;
+			Context.TargetASC = AbilitySystemComponent;
+
+			// 10 * 1.5 * 0.8 * 0.5 = 6, 4 absorbed by mana
+			TestEqual(TEXT("Damage"), Pipeline->Evaluate(Context, 10.f), 2.f);
+			TestEqual(TEXT("Mana"), AbilitySystemComponent->GetNumericAttribute(UGSCAttributeSet::GetManaAttribute()), 0.f);
+		});
+
+		It(TEXT("should apply damage executions through the pipeline"), [this]()
+		{
+			constexpr float MaxHealth = 10000000.f;
+			AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetMaxHealthAttribute(), MaxHealth);
+			AbilitySystemComponent->SetNumericAttributeBase(UGSCAttributeSet::GetHealthAttribute(), MaxHealth);
+
+			UGameplayEffect* DamageEffect = NewObject<UGameplayEffect>(GetTransientPackage(), TEXT("GE_GSCDamagePipelineSpec"));
+			DamageEffect->DurationPolicy = EGameplayEffectDurationType::Instant;
+			FGameplayModifierInfo& Modifier = DamageEffect->Modifiers.AddDefaulted_GetRef();
+			Modifier.Attribute = UGSCAttributeSet::GetDamageAttribute();
+			Modifier.ModifierOp = EGameplayModOp::Additive;
+			Modifier.ModifierMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(10.f));
+
+			const FGameplayEffectSpec Spec(DamageEffect, AbilitySystemComponent->MakeEffectContext(), 1.f);
+
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < BenchmarkExecutionCount; ++Index)
+			{
+				AbilitySystemComponent->ApplyGameplayEffectSpecToSelf(Spec);
+			}
+			const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+			// 10 * 1.5 * 0.8 * 0.5 = 6 per execution
+			const float ExpectedHealth = MaxHealth - 6.f * BenchmarkExecutionCount;
+			TestEqual(TEXT("Health"), AbilitySystemComponent->GetNumericAttribute(UGSCAttributeSet::GetHealthAttribute()), ExpectedHealth, 1.f);
+			AddInfo(FString::Printf(
+				TEXT("%d damage executions through a %d stages pipeline: %.2f ms (%.0f executions / s)"),
+				BenchmarkExecutionCount,
+				Pipeline->Stages.Num(),
+				ElapsedTime * 1000.0,
+				ElapsedTime > 0.0 ? BenchmarkExecutionCount / ElapsedTime : 0.0
+			));
+		});
+
+		AfterEach([this]()
+		{
+			AbilitySystemComponent = nullptr;
+			AttributeSet = nullptr;
+
+			FGSCTestWorld::Destroy(World);
+		});
+	});
+
+	AfterEach([this]()
+	{
+		Pipeline = nullptr;
+	});
+}
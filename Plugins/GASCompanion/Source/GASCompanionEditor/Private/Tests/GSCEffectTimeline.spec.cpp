@@ -0,0 +1,233 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "GameplayEffect.h"
+#include "NativeGameplayTags.h"
+#include "Abilities/GSCEffectTimeline.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameplayEffectComponents/TargetTagsGameplayEffectComponent.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "GSCTestWorld.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Timeline_Skill, "GASCompanion.Test.Timeline.Skill");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Timeline_Skill_Fireball, "GASCompanion.Test.Timeline.Skill.Fireball");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_Timeline_Buff, "GASCompanion.Test.Timeline.Buff");
+
+BEGIN_DEFINE_SPEC(FGSCEffectTimelineSpec, "GASCompanion.Editor.GSCEffectTimeline", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 BenchmarkEffectCount = 32;
+	static constexpr int32 BenchmarkQueryCount = 100000;
+
+	UWorld* World = nullptr;
+	UAbilitySystemComponent* AbilitySystemComponent = nullptr;
+	FGSCEffectTimeline Timeline;
+
+	static UGameplayEffect* MakeEffect(const float InDuration, const FGameplayTag& InGrantedTag)
+	{
+		UGameplayEffect* Effect = NewObject<UGameplayEffect>(GetTransientPackage());
+		if (InDuration < 0.f)
+		{
+			Effect->DurationPolicy = EGameplayEffectDurationType::Infinite;
+		}
+		else
+		{
+			Effect->DurationPolicy = EGameplayEffectDurationType::HasDuration;
+			Effect->DurationMagnitude = FGameplayEffectModifierMagnitude(FScalableFloat(InDuration));
+		}
+
+		FInheritedTagContainer GrantedTags;
+		GrantedTags.Added.AddTag(InGrantedTag);
+		Effect->FindOrAddComponent<UTargetTagsGameplayEffectComponent>().SetAndApplyTargetTagChanges(GrantedTags);
+		return Effect;
+	}
+
+	FActiveGameplayEffectHandle ApplyEffect(const float InDuration, const FGameplayTag& InGrantedTag) const
+	{
+		return AbilitySystemComponent->ApplyGameplayEffectToSelf(MakeEffect(InDuration, InGrantedTag), 1.f, AbilitySystemComponent->MakeEffectContext());
+	}
+
+	const FGSCEffectTimeline::FEntry* ApplyAndTrack(const float InDuration, const FGameplayTag& InGrantedTag)
+	{
+		const FActiveGameplayEffect* ActiveEffect = AbilitySystemComponent->GetActiveGameplayEffect(ApplyEffect(InDuration, InGrantedTag));
+		return ActiveEffect ? Timeline.Add(*ActiveEffect) : nullptr;
+	}
+
+END_DEFINE_SPEC(FGSCEffectTimelineSpec)
+
+void FGSCEffectTimelineSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = FGSCTestWorld::Create(TEXT("GSCEffectTimelineSpec"));
+
+		AActor* Actor = World->SpawnActor<AActor>();
+		AbilitySystemComponent = NewObject<UAbilitySystemComponent>(Actor);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+
+		Timeline.Reset();
+	});
+
+	Describe(TEXT("Tracking"), [this]()
+	{
+		It(TEXT("should report time remaining of finite effects"), [this]()
+		{
+			const FGSCEffectTimeline::FEntry* Entry = ApplyAndTrack(10.f, TAG_GSCTest_Timeline_Skill_Fireball);
+			if (!TestNotNull(TEXT("Entry"), Entry))
+			{
+				return;
+			}
+
+			float TimeRemaining = 0.f;
+			float Duration = 0.f;
+			TestTrue(TEXT("Has time remaining"), Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Skill_Fireball.GetTag(), Entry->StartTime + 4.f, TimeRemaining, Duration));
+			TestEqual(TEXT("Time remaining"), TimeRemaining, 6.f);
+			TestEqual(TEXT("Duration"), Duration, 10.f);
+
+			Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Skill_Fireball.GetTag(), Entry->StartTime + 20.f, TimeRemaining, Duration);
+			TestEqual(TEXT("Time remaining once expired"), TimeRemaining, 0.f);
+		});
+
+		It(TEXT("should match parent tags of granted tags"), [this]()
+		{
+			ApplyAndTrack(10.f, TAG_GSCTest_Timeline_Skill_Fireball);
+
+			TestTrue(TEXT("Granted tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Skill_Fireball));
+			TestTrue(TEXT("Parent tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Skill));
+			TestFalse(TEXT("Unrelated tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Buff));
+		});
+
+		It(TEXT("should report -1 for infinite effects"), [this]()
+		{
+			ApplyAndTrack(-1.f, TAG_GSCTest_Timeline_Buff);
+
+			float TimeRemaining = 0.f;
+			float Duration = 0.f;
+			TestTrue(TEXT("Has infinite effect"), Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Buff.GetTag(), 0.f, TimeRemaining, Duration));
+			TestEqual(TEXT("Time remaining"), TimeRemaining, -1.f);
+			TestEqual(TEXT("Duration"), Duration, -1.f);
+		});
+
+		It(TEXT("should report the effect ending last"), [this]()
+		{
+			const FGSCEffectTimeline::FEntry* Entry = ApplyAndTrack(5.f, TAG_GSCTest_Timeline_Skill_Fireball);
+			ApplyAndTrack(8.f, TAG_GSCTest_Timeline_Skill);
+			if (!TestNotNull(TEXT("Entry"), Entry))
+			{
+				return;
+			}
+
+			float TimeRemaining = 0.f;
+			float Duration = 0.f;
+			Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Skill.GetTag(), Entry->StartTime, TimeRemaining, Duration);
+			TestEqual(TEXT("Parent tag duration"), Duration, 8.f);
+
+			Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Skill_Fireball.GetTag(), Entry->StartTime, TimeRemaining, Duration);
+			TestEqual(TEXT("Child tag duration"), Duration, 5.f);
+		});
+
+		It(TEXT("should report refreshed effects"), [this]()
+		{
+			ApplyAndTrack(10.f, TAG_GSCTest_Timeline_Buff);
+			const FGSCEffectTimeline::FEntry* ShortEntry = ApplyAndTrack(2.f, TAG_GSCTest_Timeline_Buff);
+			if (!TestNotNull(TEXT("Entry"), ShortEntry))
+			{
+				return;
+			}
+
+			// Refreshing the short effect makes it the one ending last
+			const FActiveGameplayEffectHandle ShortHandle = ShortEntry->Handle;
+			const float StartTime = ShortEntry->StartTime;
+			Timeline.UpdateTime(ShortHandle, StartTime + 1.f, 20.f);
+
+			float TimeRemaining = 0.f;
+			float Duration = 0.f;
+			Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Buff.GetTag(), StartTime + 1.f, TimeRemaining, Duration);
+			TestEqual(TEXT("Time remaining"), TimeRemaining, 20.f);
+			TestEqual(TEXT("Duration"), Duration, 20.f);
+
+			// And removing it falls back to the other one
+			Timeline.Remove(ShortHandle);
+			Timeline.GetTimeRemainingAndDuration(TAG_GSCTest_Timeline_Buff.GetTag(), StartTime + 1.f, TimeRemaining, Duration);
+			TestEqual(TEXT("Duration after removal"), Duration, 10.f);
+		});
+
+		It(TEXT("should stop tracking removed effects"), [this]()
+		{
+			const FActiveGameplayEffectHandle Handle = ApplyAndTrack(10.f, TAG_GSCTest_Timeline_Skill_Fireball)->Handle;
+
+			FGSCEffectTimeline::FEntry RemovedEntry;
+			TestTrue(TEXT("Removed"), Timeline.Remove(Handle, &RemovedEntry));
+			TestTrue(TEXT("Removed entry"), RemovedEntry.Handle == Handle && RemovedEntry.GrantedTags.HasTagExact(TAG_GSCTest_Timeline_Skill_Fireball));
+			TestFalse(TEXT("Granted tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Skill_Fireball));
+			TestFalse(TEXT("Parent tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Skill));
+			TestEqual(TEXT("Num"), Timeline.Num(), 0);
+			TestFalse(TEXT("Removed twice"), Timeline.Remove(Handle));
+		});
+
+		It(TEXT("should rebuild from active effects"), [this]()
+		{
+			ApplyEffect(10.f, TAG_GSCTest_Timeline_Skill_Fireball);
+			ApplyEffect(-1.f, TAG_GSCTest_Timeline_Buff);
+
+			Timeline.Rebuild(*AbilitySystemComponent);
+			TestEqual(TEXT("Num"), Timeline.Num(), 2);
+			TestTrue(TEXT("Finite effect tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Skill));
+			TestTrue(TEXT("Infinite effect tag"), Timeline.HasTag(TAG_GSCTest_Timeline_Buff));
+		});
+	});
+
+	Describe(TEXT("Benchmark"), [this]()
+	{
+		It(TEXT("should poll time remaining faster than an active effects query"), [this]()
+		{
+			for (int32 Index = 0; Index < BenchmarkEffectCount; ++Index)
+			{
+				ApplyEffect(5.f + Index, Index % 2 ? TAG_GSCTest_Timeline_Skill_Fireball : TAG_GSCTest_Timeline_Buff);
+			}
+			Timeline.Rebuild(*AbilitySystemComponent);
+
+			FGameplayTagContainer Tags;
+			Tags.AddTag(TAG_GSCTest_Timeline_Skill_Fireball);
+			const FGameplayEffectQuery Query = FGameplayEffectQuery::MakeQuery_MatchAnyOwningTags(Tags);
+			const float WorldTime = World->GetTimeSeconds();
+
+			float TimeRemaining = 0.f;
+			float Duration = 0.f;
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < BenchmarkQueryCount; ++Index)
+			{
+				Timeline.GetTimeRemainingAndDuration(Tags, WorldTime, TimeRemaining, Duration);
+			}
+			const double TimelineTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < BenchmarkQueryCount; ++Index)
+			{
+				AbilitySystemComponent->GetActiveEffectsTimeRemainingAndDuration(Query);
+			}
+			const double QueryTime = FPlatformTime::Seconds() - StartTime;
+
+			TestEqual(TEXT("Duration of the effect ending last"), Duration, 5.f + BenchmarkEffectCount - 1);
+			AddInfo(FString::Printf(
+				TEXT("%d polls with %d active effects: timeline %.2f ms, active effects query %.2f ms"),
+				BenchmarkQueryCount,
+				BenchmarkEffectCount,
+				TimelineTime * 1000.0,
+				QueryTime * 1000.0
+			));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		Timeline.Reset();
+		AbilitySystemComponent = nullptr;
+
+		FGSCTestWorld::Destroy(World);
+	});
+}
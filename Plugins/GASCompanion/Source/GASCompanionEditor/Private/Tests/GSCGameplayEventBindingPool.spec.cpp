@@ -0,0 +1,213 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "NativeGameplayTags.h"
+#include "Abilities/GSCAbilitySet.h"
+#include "Abilities/GSCAbilitySystemComponent.h"
+#include "Abilities/GSCAbilitySystemUtils.h"
+#include "Abilities/GSCGameplayEventBindingPool.h"
+#include "Engine/Engine.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "GSCTestWorld.h"
+
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_EventPool_Hit, "GASCompanion.Test.EventPool.Hit");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_EventPool_Combo, "GASCompanion.Test.EventPool.Combo");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_GSCTest_EventPool_Other, "GASCompanion.Test.EventPool.Other");
+
+BEGIN_DEFINE_SPEC(FGSCGameplayEventBindingPoolSpec, "GASCompanion.Editor.GSCGameplayEventBindingPool", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 BenchmarkOtherBindingCount = 32;
+	static constexpr int32 BenchmarkActivationCount = 10000;
+
+	UWorld* World = nullptr;
+	UGSCAbilitySystemComponent* AbilitySystemComponent = nullptr;
+
+	static FGameplayTagContainer MakeTags(const FGameplayTag& InFirstTag, const FGameplayTag& InSecondTag)
+	{
+		FGameplayTagContainer Tags;
+		Tags.AddTag(InFirstTag);
+		Tags.AddTag(InSecondTag);
+		return Tags;
+	}
+
+	void SendEvent(const FGameplayTag& InEventTag) const
+	{
+		FGameplayEventData Payload;
+		Payload.EventTag = InEventTag;
+		AbilitySystemComponent->HandleGameplayEvent(InEventTag, &Payload);
+	}
+
+	FDelegateHandle RegisterCounter(const FGameplayTagContainer& InTags, int32& InOutCount) const
+	{
+		return AbilitySystemComponent->GetGameplayEventBindingPool().Register(
+			*AbilitySystemComponent,
+			InTags,
+			FGSCGameplayEventBindingPool::HashTags(InTags),
+			FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([&InOutCount](FGameplayTag, const FGameplayEventData*)
+			{
+				InOutCount++;
+			})
+		);
+	}
+
+END_DEFINE_SPEC(FGSCGameplayEventBindingPoolSpec)
+
+void FGSCGameplayEventBindingPoolSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = FGSCTestWorld::Create(TEXT("GSCGameplayEventBindingPoolSpec"));
+
+		AActor* Actor = World->SpawnActor<AActor>();
+		AbilitySystemComponent = NewObject<UGSCAbilitySystemComponent>(Actor);
+		AbilitySystemComponent->RegisterComponent();
+		AbilitySystemComponent->InitAbilityActorInfo(Actor, Actor);
+	});
+
+	Describe(TEXT("HashTags"), [this]()
+	{
+		It(TEXT("should not depend on tags order"), [this]()
+		{
+			const FGameplayTagContainer Tags = MakeTags(TAG_GSCTest_EventPool_Hit, TAG_GSCTest_EventPool_Combo);
+			const FGameplayTagContainer ReversedTags = MakeTags(TAG_GSCTest_EventPool_Combo, TAG_GSCTest_EventPool_Hit);
+			TestEqual(TEXT("Same tags in a different order"), FGSCGameplayEventBindingPool::HashTags(Tags), FGSCGameplayEventBindingPool::HashTags(ReversedTags));
+		});
+
+		It(TEXT("should differ for different tags"), [this]()
+		{
+			const FGameplayTagContainer Tags = MakeTags(TAG_GSCTest_EventPool_Hit, TAG_GSCTest_EventPool_Combo);
+			const FGameplayTagContainer OtherTags = MakeTags(TAG_GSCTest_EventPool_Hit, TAG_GSCTest_EventPool_Other);
+			TestNotEqual(TEXT("Different tags"), FGSCGameplayEventBindingPool::HashTags(Tags), FGSCGameplayEventBindingPool::HashTags(OtherTags));
+			TestNotEqual(TEXT("Subset of tags"), FGSCGameplayEventBindingPool::HashTags(Tags), FGSCGameplayEventBindingPool::HashTags(FGameplayTagContainer(TAG_GSCTest_EventPool_Hit)));
+		});
+	});
+
+	Describe(TEXT("Bindings"), [this]()
+	{
+		It(TEXT("should dispatch matching gameplay events to registered listeners only"), [this]()
+		{
+			const FGameplayTagContainer Tags = MakeTags(TAG_GSCTest_EventPool_Hit, TAG_GSCTest_EventPool_Combo);
+			const uint32 TagsHash = FGSCGameplayEventBindingPool::HashTags(Tags);
+
+			int32 FirstCount = 0;
+			int32 SecondCount = 0;
+			const FDelegateHandle FirstHandle = RegisterCounter(Tags, FirstCount);
+			RegisterCounter(Tags, SecondCount);
+
+			SendEvent(TAG_GSCTest_EventPool_Hit);
+			SendEvent(TAG_GSCTest_EventPool_Other);
+			TestEqual(TEXT("First listener"), FirstCount, 1);
+			TestEqual(TEXT("Second listener"), SecondCount, 1);
+
+			AbilitySystemComponent->GetGameplayEventBindingPool().Unregister(TagsHash, FirstHandle);
+			SendEvent(TAG_GSCTest_EventPool_Combo);
+			TestEqual(TEXT("Unregistered listener"), FirstCount, 1);
+			TestEqual(TEXT("Remaining listener"), SecondCount, 2);
+			TestEqual(TEXT("Num listeners"), AbilitySystemComponent->GetGameplayEventBindingPool().NumListeners(TagsHash), 1);
+		});
+
+		It(TEXT("should reuse the same binding across register / unregister cycles"), [this]()
+		{
+			FGSCGameplayEventBindingPool& Pool = AbilitySystemComponent->GetGameplayEventBindingPool();
+			const FGameplayTagContainer Tags = MakeTags(TAG_GSCTest_EventPool_Hit, TAG_GSCTest_EventPool_Combo);
+			const FGameplayTagContainer ReversedTags = MakeTags(TAG_GSCTest_EventPool_Combo, TAG_GSCTest_EventPool_Hit);
+			const uint32 TagsHash = FGSCGameplayEventBindingPool::HashTags(Tags);
+
+			int32 Count = 0;
+			for (int32 Index = 0; Index < 100; ++Index)
+			{
+				Pool.Unregister(TagsHash, RegisterCounter(Index % 2 ? Tags : ReversedTags, Count));
+			}
+
+			RegisterCounter(Tags, Count);
+			TestEqual(TEXT("Num bindings"), Pool.NumBindings(), 1);
+
+			// Every leaked ASC binding would broadcast the event to the listeners once more
+			SendEvent(TAG_GSCTest_EventPool_Hit);
+			TestEqual(TEXT("Event received once"), Count, 1);
+		});
+
+		It(TEXT("should remove bindings from the ASC on reset"), [this]()
+		{
+			FGSCGameplayEventBindingPool& Pool = AbilitySystemComponent->GetGameplayEventBindingPool();
+
+			int32 Count = 0;
+			RegisterCounter(FGameplayTagContainer(TAG_GSCTest_EventPool_Hit), Count);
+			Pool.Reset(AbilitySystemComponent);
+
+			SendEvent(TAG_GSCTest_EventPool_Hit);
+			TestEqual(TEXT("Num bindings"), Pool.NumBindings(), 0);
+			TestEqual(TEXT("Event not received"), Count, 0);
+		});
+	});
+
+	Describe(TEXT("Preload"), [this]()
+	{
+		It(TEXT("should not request a load for sets without assets to preload"), [this]()
+		{
+			UGSCAbilitySet* AbilitySet = NewObject<UGSCAbilitySet>(GetTransientPackage());
+			TestFalse(TEXT("Empty set"), FGSCAbilitySystemUtils::TryPreloadAbilitySetAssets(AbilitySet).IsValid());
+
+			AbilitySet->bPreloadAbilityAssets = false;
+			TestFalse(TEXT("Preload disabled"), FGSCAbilitySystemUtils::TryPreloadAbilitySetAssets(AbilitySet).IsValid());
+		});
+	});
+
+	Describe(TEXT("Benchmark"), [this]()
+	{
+		It(TEXT("should bind gameplay events of an activation faster than a direct ASC binding"), [this]()
+		{
+			// Other tasks waiting on gameplay events of the same ASC
+			for (int32 Index = 0; Index < BenchmarkOtherBindingCount; ++Index)
+			{
+				AbilitySystemComponent->AddGameplayEventTagContainerDelegate(FGameplayTagContainer(TAG_GSCTest_EventPool_Other), FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([](FGameplayTag, const FGameplayEventData*) {}));
+			}
+
+			FGSCGameplayEventBindingPool& Pool = AbilitySystemComponent->GetGameplayEventBindingPool();
+			const FGameplayTagContainer Tags = MakeTags(TAG_GSCTest_EventPool_Hit, TAG_GSCTest_EventPool_Combo);
+			const uint32 TagsHash = FGSCGameplayEventBindingPool::HashTags(Tags);
+			auto MakeDelegate = []()
+			{
+				return FGameplayEventTagMulticastDelegate::FDelegate::CreateLambda([](FGameplayTag, const FGameplayEventData*) {});
+			};
+
+			double StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < BenchmarkActivationCount; ++Index)
+			{
+				Pool.Unregister(TagsHash, Pool.Register(*AbilitySystemComponent, Tags, TagsHash, MakeDelegate()));
+			}
+			const double PoolTime = FPlatformTime::Seconds() - StartTime;
+
+			StartTime = FPlatformTime::Seconds();
+			for (int32 Index = 0; Index < BenchmarkActivationCount; ++Index)
+			{
+				AbilitySystemComponent->RemoveGameplayEventTagContainerDelegate(Tags, AbilitySystemComponent->AddGameplayEventTagContainerDelegate(Tags, MakeDelegate()));
+			}
+			const double DirectTime = FPlatformTime::Seconds() - StartTime;
+
+			TestEqual(TEXT("Num bindings"), Pool.NumBindings(), 1);
+			AddInfo(FString::Printf(
+				TEXT("%d activations with %d other event bindings: pooled %.2f ms, direct ASC binding %.2f ms"),
+				BenchmarkActivationCount,
+				BenchmarkOtherBindingCount,
+				PoolTime * 1000.0,
+				DirectTime * 1000.0
+			));
+		});
+	});
+
+	AfterEach([this]()
+	{
+		if (AbilitySystemComponent)
+		{
+			AbilitySystemComponent->GetGameplayEventBindingPool().Reset(AbilitySystemComponent);
+			AbilitySystemComponent = nullptr;
+		}
+
+		FGSCTestWorld::Destroy(World);
+	});
+}
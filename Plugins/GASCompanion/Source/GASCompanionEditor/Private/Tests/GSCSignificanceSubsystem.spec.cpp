@@ -0,0 +1,282 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#include "AbilitySystemComponent.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "Components/GSCCoreComponent.h"
+#include "Core/Settings/GSCDeveloperSettings.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/AutomationTest.h"
+#include "ModularGameplayActors/GSCModularCharacter.h"
+#include "Subsystems/GSCSignificanceSubsystem.h"
+#include "GSCTestWorld.h"
+
+BEGIN_DEFINE_SPEC(FGSCSignificanceSubsystemSpec, "GASCompanion.Editor.GSCSignificanceSubsystem", EAutomationTestFlags::ProductFilter | EAutomationTestFlags::EditorContext)
+
+	static constexpr int32 CrowdSize = 500;
+	static constexpr int32 CrowdColumns = 25;
+	static constexpr float CrowdSpacing = 1000.f;
+	static constexpr int32 BenchmarkUpdateCount = 100;
+	static constexpr int32 BenchmarkFrameCount = 120;
+
+	UWorld* World = nullptr;
+	UGSCSignificanceSubsystem* Subsystem = nullptr;
+	TArray<AGSCModularCharacter*> Crowd;
+
+	/** Player looking down the X axis, from the origin */
+	TArray<FTransform> Viewpoints = { FTransform(FRotator::ZeroRotator, FVector::ZeroVector) };
+
+	AGSCModularCharacter* SpawnCharacter(const FVector& InLocation) const
+	{
+		FActorSpawnParameters SpawnParameters;
+		SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+		return World->SpawnActor<AGSCModularCharacter>(InLocation, FRotator::ZeroRotator, SpawnParameters);
+	}
+
+	void SpawnCrowd()
+	{
+		// Grid in front of the player, spreading both sides of the view direction
+		for (int32 Index = 0; Index < CrowdSize; ++Index)
+		{
+			const int32 Row = Index / CrowdColumns;
+			const int32 Column = Index % CrowdColumns - CrowdColumns / 2;
+			if (AGSCModularCharacter* Character = SpawnCharacter(FVector(Row * CrowdSpacing, Column * CrowdSpacing, 0.f)))
+			{
+				Crowd.Add(Character);
+				Subsystem->RegisterPawn(Character);
+			}
+		}
+	}
+
+	/** Same rules as the subsystem, without hysteresis */
+	static bool IsExpectedSignificant(const FVector& InLocation)
+	{
+		const UGSCDeveloperSettings& Settings = UGSCDeveloperSettings::Get();
+		const double Distance = InLocation.Size();
+		if (Distance <= Settings.SignificantDistance)
+		{
+			return true;
+		}
+
+		return Distance <= Settings.MaxSignificantDistance
+			&& FVector::DotProduct(InLocation.GetSafeNormal(), FVector::ForwardVector) >= FMath::Cos(FMath::DegreesToRadians(Settings.SignificanceViewHalfAngle));
+	}
+
+	/** Ticks the world at 60 fps, returns the time spent */
+	double TickWorld() const
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < BenchmarkFrameCount; ++Index)
+		{
+			World->Tick(LEVELTICK_All, 1.f / 60.f);
+		}
+		return FPlatformTime::Seconds() - StartTime;
+	}
+
+END_DEFINE_SPEC(FGSCSignificanceSubsystemSpec)
+
+void FGSCSignificanceSubsystemSpec::Define()
+{
+	BeforeEach([this]()
+	{
+		World = FGSCTestWorld::Create(TEXT("GSCSignificanceSubsystemSpec"));
+
+		Subsystem = World->GetSubsystem<UGSCSignificanceSubsystem>();
+		Crowd.Reset();
+	});
+
+	It(TEXT("should demote pawns far from or behind players"), [this]()
+	{
+		if (!TestNotNull(TEXT("Subsystem"), Subsystem))
+		{
+			return;
+		}
+
+		SpawnCrowd();
+		TestEqual(TEXT("Registered pawns"), Subsystem->GetNumRegisteredPawns(), CrowdSize);
+
+		Subsystem->UpdateSignificance(Viewpoints);
+
+		int32 ExpectedDemotedCount = 0;
+		for (const AGSCModularCharacter* Character : Crowd)
+		{
+			const bool bExpectedSignificant = IsExpectedSignificant(Character->GetActorLocation());
+			ExpectedDemotedCount += bExpectedSignificant ? 0 : 1;
+			TestEqual(*FString::Printf(TEXT("%s significance"), *Character->GetActorLocation().ToString()), Subsystem->IsSignificant(Character), bExpectedSignificant);
+		}
+
+		TestEqual(TEXT("Demoted pawns"), Subsystem->GetNumDemotedPawns(), ExpectedDemotedCount);
+		TestTrue(TEXT("Some pawns demoted"), ExpectedDemotedCount > 0);
+		TestTrue(TEXT("Some pawns significant"), ExpectedDemotedCount < CrowdSize);
+	});
+
+	It(TEXT("should throttle and restore ability system and combo components"), [this]()
+	{
+		const UGSCDeveloperSettings& Settings = UGSCDeveloperSettings::Get();
+
+		AGSCModularCharacter* Character = SpawnCharacter(FVector(Settings.MaxSignificantDistance * 2.f, 0.f, 0.f));
+		if (!TestNotNull(TEXT("Character"), Character))
+		{
+			return;
+		}
+
+		UGSCCoreComponent* CoreComponent = NewObject<UGSCCoreComponent>(Character);
+		CoreComponent->RegisterComponent();
+		UGSCComboManagerComponent* ComboManagerComponent = NewObject<UGSCComboManagerComponent>(Character);
+		ComboManagerComponent->RegisterComponent();
+
+		UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		const float DefaultTickInterval = ASC->GetComponentTickInterval();
+		const EGameplayEffectReplicationMode DefaultReplicationMode = ASC->GetReplicationMode();
+		const float DefaultNetUpdateFrequency = Character->GetNetUpdateFrequency();
+
+		Subsystem->RegisterPawn(Character);
+		Subsystem->UpdateSignificance(Viewpoints);
+
+		TestFalse(TEXT("Demoted"), Subsystem->IsSignificant(Character));
+		TestEqual(TEXT("Demoted tick interval"), ASC->GetComponentTickInterval(), FMath::Max(DefaultTickInterval, Settings.DemotedAbilitySystemTickInterval));
+		TestTrue(TEXT("Demoted replication mode"), ASC->GetReplicationMode() == EGameplayEffectReplicationMode::Minimal);
+		TestTrue(TEXT("Demoted attribute events"), CoreComponent->AreAttributeEventsSuppressed());
+		TestTrue(TEXT("Demoted combo replication"), ComboManagerComponent->IsUsingMinimalReplication());
+		TestTrue(TEXT("Demoted net update frequency"), Character->GetNetUpdateFrequency() <= Settings.DemotedNetUpdateFrequency);
+
+		Character->SetActorLocation(FVector::ZeroVector);
+		Subsystem->UpdateSignificance(Viewpoints);
+
+		TestTrue(TEXT("Promoted"), Subsystem->IsSignificant(Character));
+		TestEqual(TEXT("Restored tick interval"), ASC->GetComponentTickInterval(), DefaultTickInterval);
+		TestTrue(TEXT("Restored replication mode"), ASC->GetReplicationMode() == DefaultReplicationMode);
+		TestFalse(TEXT("Restored attribute events"), CoreComponent->AreAttributeEventsSuppressed());
+		TestFalse(TEXT("Restored combo replication"), ComboManagerComponent->IsUsingMinimalReplication());
+		TestEqual(TEXT("Restored net update frequency"), Character->GetNetUpdateFrequency(), DefaultNetUpdateFrequency);
+	});
+
+	It(TEXT("should only promote pawns once within hysteresis"), [this]()
+	{
+		const UGSCDeveloperSettings& Settings = UGSCDeveloperSettings::Get();
+
+		// Behind the player, just outside of the significant distance
+		AGSCModularCharacter* Character = SpawnCharacter(FVector(-Settings.SignificantDistance * 1.01f, 0.f, 0.f));
+		if (!TestNotNull(TEXT("Character"), Character))
+		{
+			return;
+		}
+
+		Subsystem->RegisterPawn(Character);
+		Subsystem->UpdateSignificance(Viewpoints);
+		TestFalse(TEXT("Demoted"), Subsystem->IsSignificant(Character));
+
+		// Back within the significant distance, but not past the hysteresis margin
+		Character->SetActorLocation(FVector(-Settings.SignificantDistance * (1.f - Settings.SignificanceHysteresis * 0.5f), 0.f, 0.f));
+		Subsystem->UpdateSignificance(Viewpoints);
+		TestFalse(TEXT("Still demoted within hysteresis"), Subsystem->IsSignificant(Character));
+
+		Character->SetActorLocation(FVector(-Settings.SignificantDistance * (1.f - Settings.SignificanceHysteresis * 2.f), 0.f, 0.f));
+		Subsystem->UpdateSignificance(Viewpoints);
+		TestTrue(TEXT("Promoted past hysteresis"), Subsystem->IsSignificant(Character));
+	});
+
+	It(TEXT("should keep the replication mode of ability system components in full mode"), [this]()
+	{
+		AGSCModularCharacter* Character = SpawnCharacter(FVector(UGSCDeveloperSettings::Get().MaxSignificantDistance * 2.f, 0.f, 0.f));
+		if (!TestNotNull(TEXT("Character"), Character))
+		{
+			return;
+		}
+
+		UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		ASC->SetReplicationMode(EGameplayEffectReplicationMode::Full);
+
+		Subsystem->RegisterPawn(Character);
+		Subsystem->UpdateSignificance(Viewpoints);
+
+		TestFalse(TEXT("Demoted"), Subsystem->IsSignificant(Character));
+		TestTrue(TEXT("Replication mode while demoted"), ASC->GetReplicationMode() == EGameplayEffectReplicationMode::Full);
+		TestTrue(TEXT("Tick interval while demoted"), ASC->GetComponentTickInterval() >= UGSCDeveloperSettings::Get().DemotedAbilitySystemTickInterval);
+
+		Subsystem->UnregisterPawn(Character);
+		TestTrue(TEXT("Replication mode once promoted"), ASC->GetReplicationMode() == EGameplayEffectReplicationMode::Full);
+	});
+
+	It(TEXT("should promote pawns when unregistered"), [this]()
+	{
+		AGSCModularCharacter* Character = SpawnCharacter(FVector(-UGSCDeveloperSettings::Get().MaxSignificantDistance * 2.f, 0.f, 0.f));
+		if (!TestNotNull(TEXT("Character"), Character))
+		{
+			return;
+		}
+
+		UAbilitySystemComponent* ASC = Character->GetAbilitySystemComponent();
+		const EGameplayEffectReplicationMode DefaultReplicationMode = ASC->GetReplicationMode();
+
+		Subsystem->RegisterPawn(Character);
+		Subsystem->UpdateSignificance(Viewpoints);
+		TestEqual(TEXT("Demoted pawns"), Subsystem->GetNumDemotedPawns(), 1);
+
+		Subsystem->UnregisterPawn(Character);
+		TestEqual(TEXT("Demoted pawns"), Subsystem->GetNumDemotedPawns(), 0);
+		TestEqual(TEXT("Registered pawns"), Subsystem->GetNumRegisteredPawns(), 0);
+		TestTrue(TEXT("Restored replication mode"), ASC->GetReplicationMode() == DefaultReplicationMode);
+	});
+
+	It(TEXT("should update significance of a crowd of AI"), [this]()
+	{
+		SpawnCrowd();
+
+		// Player walking through the crowd, turning around
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 Index = 0; Index < BenchmarkUpdateCount; ++Index)
+		{
+			Viewpoints[0] = FTransform(FRotator(0.f, Index * 7.f, 0.f), FVector(Index * 200.f, 0.f, 0.f));
+			Subsystem->UpdateSignificance(Viewpoints);
+		}
+		const double ElapsedTime = FPlatformTime::Seconds() - StartTime;
+
+		TestEqual(TEXT("Registered pawns"), Subsystem->GetNumRegisteredPawns(), CrowdSize);
+		AddInfo(FString::Printf(
+			TEXT("%d significance updates of %d AI: %.3f ms per update, %d AI demoted after the last update"),
+			BenchmarkUpdateCount,
+			CrowdSize,
+			ElapsedTime * 1000.0 / BenchmarkUpdateCount,
+			Subsystem->GetNumDemotedPawns()
+		));
+	});
+
+	It(TEXT("should reduce the world tick cost of a demoted crowd of AI"), [this]()
+	{
+		SpawnCrowd();
+
+		// First frame pays for the tick functions registration
+		World->Tick(LEVELTICK_All, 1.f / 60.f);
+
+		// Nobody to look at the crowd, every pawn gets demoted
+		Subsystem->UpdateSignificance(TConstArrayView<FTransform>());
+		TestEqual(TEXT("Demoted pawns"), Subsystem->GetNumDemotedPawns(), CrowdSize);
+		const double DemotedTime = TickWorld();
+
+		for (AGSCModularCharacter* Character : Crowd)
+		{
+			Subsystem->UnregisterPawn(Character);
+		}
+		TestEqual(TEXT("Demoted pawns once unregistered"), Subsystem->GetNumDemotedPawns(), 0);
+		const double SignificantTime = TickWorld();
+
+		// Replication savings (Minimal mode, net update frequency) need a net driver and are not measured here
+		AddInfo(FString::Printf(
+			TEXT("%d frames with %d AI: %.3f ms per frame significant, %.3f ms per frame demoted"),
+			BenchmarkFrameCount,
+			CrowdSize,
+			SignificantTime * 1000.0 / BenchmarkFrameCount,
+			DemotedTime * 1000.0 / BenchmarkFrameCount
+		));
+	});
+
+	AfterEach([this]()
+	{
+		Crowd.Reset();
+		Subsystem = nullptr;
+
+		FGSCTestWorld::Destroy(World);
+	});
+}
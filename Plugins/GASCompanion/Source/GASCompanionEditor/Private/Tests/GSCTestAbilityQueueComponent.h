@@ -0,0 +1,20 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/GSCAbilityQueueComponent.h"
+#include "GSCTestAbilityQueueComponent.generated.h"
+
+/** Ability Queue Component exposing the prediction rejection handler, so that specs can simulate a server rejection */
+UCLASS(Transient)
+class UGSCTestAbilityQueueComponent : public UGSCAbilityQueueComponent
+{
+	GENERATED_BODY()
+
+public:
+	void SimulateQueuedInputRejected(const FGSCQueuedAbilityInput& InQueuedInput)
+	{
+		OnQueuedInputRejected(InQueuedInput);
+	}
+};
@@ -0,0 +1,29 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameplayTagContainer.h"
+#include "UObject/Object.h"
+#include "GSCTestAttributeChangeListener.generated.h"
+
+/** Records the events of GSCCoreComponent attribute change delegates, for specs to bind dynamic delegates to */
+UCLASS(Transient)
+class UGSCTestAttributeChangeListener : public UObject
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY()
+	TArray<float> DeltaValues;
+
+	UPROPERTY()
+	TArray<FGameplayTagContainer> EventTags;
+
+	UFUNCTION()
+	void OnAttributeChange(const float DeltaValue, const FGameplayTagContainer& InEventTags)
+	{
+		DeltaValues.Add(DeltaValue);
+		EventTags.Add(InEventTags);
+	}
+};
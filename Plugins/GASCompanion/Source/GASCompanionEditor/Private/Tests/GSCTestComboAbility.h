@@ -0,0 +1,62 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Abilities/GSCGameplayAbility_MeleeBase.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "GSCTestComboAbility.generated.h"
+
+/**
+ * Melee ability for specs running combos without animation instance. Test worlds can't play the combo montages, which
+ * the harness emulates instead: the ability stays active until SimulateMontageEnded() rather than being cancelled by
+ * its montage task.
+ */
+UCLASS(Transient)
+class UGSCTestComboAbility : public UGSCGameplayAbility_MeleeBase
+{
+	GENERATED_BODY()
+
+public:
+	UGSCTestComboAbility()
+	{
+		// Next combos activate the same instance again, as combo abilities set up in Blueprint do
+		InstancingPolicy = EGameplayAbilityInstancingPolicy::InstancedPerActor;
+		bRetriggerInstancedAbility = true;
+	}
+
+	/** Combo index every activation started with (eg. the combo montage played) */
+	TArray<int32> ActivatedComboIndices;
+
+	void SimulateMontageEnded()
+	{
+		OnMontageCompleted(FGameplayTag(), FGameplayEventData());
+	}
+
+protected:
+	virtual void ActivateAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const FGameplayEventData* TriggerEventData) override
+	{
+		bActivating = true;
+		Super::ActivateAbility(Handle, ActorInfo, ActivationInfo, TriggerEventData);
+		bActivating = false;
+
+		if (ComboManagerComponent && IsActive())
+		{
+			ActivatedComboIndices.Add(ComboManagerComponent->ComboIndex);
+		}
+	}
+
+	virtual void EndAbility(const FGameplayAbilitySpecHandle Handle, const FGameplayAbilityActorInfo* ActorInfo, const FGameplayAbilityActivationInfo ActivationInfo, const bool bReplicateEndAbility, const bool bWasCancelled) override
+	{
+		// Montage task cancels right away without an animation instance to play the montage on
+		if (bActivating && bWasCancelled)
+		{
+			return;
+		}
+
+		Super::EndAbility(Handle, ActorInfo, ActivationInfo, bReplicateEndAbility, bWasCancelled);
+	}
+
+private:
+	bool bActivating = false;
+};
@@ -0,0 +1,38 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Components/GSCComboManagerComponent.h"
+#include "GSCTestComboManagerComponent.generated.h"
+
+/**
+ * Combo Manager Component exposing its net role and combo state replication, so that specs can run a server and an
+ * owning client in the same (standalone) world
+ */
+UCLASS(Transient)
+class UGSCTestComboManagerComponent : public UGSCComboManagerComponent
+{
+	GENERATED_BODY()
+
+public:
+	/** Behaves as the component of an autonomous proxy: predicting combo state while locally controlled */
+	void SimulateOwningClient()
+	{
+		bCachedIsNetSimulated = true;
+	}
+
+	/** Server: Snapshot of the combo state replicated to the owning client, as taken in PreReplication() */
+	FGSCComboState SimulatePreReplication()
+	{
+		ReplicatedComboState = GetComboState();
+		return ReplicatedComboState;
+	}
+
+	/** Client: Receives the combo state replicated by the server */
+	void SimulateComboStateReplicated(const FGSCComboState& InComboState)
+	{
+		ReplicatedComboState = InComboState;
+		OnRep_ComboState();
+	}
+};
@@ -0,0 +1,33 @@
+﻿// Copyright 2021 Mickael Daniel. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+
+/** Game worlds for specs that need to spawn actors and register components, each with its own world context */
+struct FGSCTestWorld
+{
+	/** Creates a game world and begins play in it */
+	static UWorld* Create(const TCHAR* InName)
+	{
+		UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, InName);
+		FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+		WorldContext.SetCurrentWorld(World);
+		World->InitializeActorsForPlay(FURL());
+		World->BeginPlay();
+		return World;
+	}
+
+	/** Destroys a world created with Create() along with its world context, and resets the pointer */
+	static void Destroy(UWorld*& InOutWorld)
+	{
+		if (InOutWorld)
+		{
+			GEngine->DestroyWorldContext(InOutWorld);
+			InOutWorld->DestroyWorld(false);
+			InOutWorld = nullptr;
+		}
+	}
+};
@@ -72,8 +72,6 @@ FHoudiniEngine::HoudiniEngineInstance = nullptr;
 
 FHoudiniEngine::FHoudiniEngine()
 	: LicenseType(HAPI_LICENSE_NONE)
-	, HoudiniEngineSchedulerThread(nullptr)
-	, HoudiniEngineScheduler(nullptr)
 	, HoudiniEngineManagerThread(nullptr)
 	, HoudiniEngineManager(nullptr)
 	//, bHAPIVersionMismatch(false)
@@ -227,10 +225,9 @@ FHoudiniEngine::StartupModule()
 	// We do not automatically try to start a session when starting up the module now.
 	bFirstSessionCreated = false;
 
-	// Create HAPI scheduler and processing thread.
-	HoudiniEngineScheduler = new FHoudiniEngineScheduler();
-	HoudiniEngineSchedulerThread = FRunnableThread::Create(
-		HoudiniEngineScheduler, TEXT("HoudiniSchedulerThread"), 0, TPri_Normal);
+	// Create HAPI schedulers and processing threads, one per session.
+	// More are created later if sessions are restarted with a higher session count.
+	CreateSchedulers(GetDefault<UHoudiniRuntimeSettings>()->NumSessions);
 
 	// Create Houdini Asset Manager
 	HoudiniEngineManager = new FHoudiniEngineManager();
@@ -353,22 +350,39 @@ FHoudiniEngine::ShutdownModule()
 	FUnrealObjectInputManager::DestroySingleton();
 
 	// Do scheduler and thread clean up.
-	if (HoudiniEngineScheduler)
-		HoudiniEngineScheduler->Stop();
-
-	if (HoudiniEngineSchedulerThread)
 	{
-		//HoudiniEngineSchedulerThread->Kill( true );
-		HoudiniEngineSchedulerThread->WaitForCompletion();
+		FScopeLock ScopeLock(&SchedulersCriticalSection);
 
-		delete HoudiniEngineSchedulerThread;
-		HoudiniEngineSchedulerThread = nullptr;
-	}
+		// Stop all the schedulers first so they can all wind down at the same time
+		for (FHoudiniEngineScheduler* HoudiniEngineScheduler : HoudiniEngineSchedulers)
+		{
+			if (HoudiniEngineScheduler)
+				HoudiniEngineScheduler->Stop();
+		}
 
-	if ( HoudiniEngineScheduler )
-	{
-		delete HoudiniEngineScheduler;
-		HoudiniEngineScheduler = nullptr;
+		for (FRunnableThread*& HoudiniEngineSchedulerThread : HoudiniEngineSchedulerThreads)
+		{
+			if (HoudiniEngineSchedulerThread)
+			{
+				//HoudiniEngineSchedulerThread->Kill( true );
+				HoudiniEngineSchedulerThread->WaitForCompletion();
+
+				delete HoudiniEngineSchedulerThread;
+				HoudiniEngineSchedulerThread = nullptr;
+			}
+		}
+
+		for (FHoudiniEngineScheduler*& HoudiniEngineScheduler : HoudiniEngineSchedulers)
+		{
+			if (HoudiniEngineScheduler)
+			{
+				delete HoudiniEngineScheduler;
+				HoudiniEngineScheduler = nullptr;
+			}
+		}
+
+		HoudiniEngineSchedulerThreads.Empty();
+		HoudiniEngineSchedulers.Empty();
 	}
 
 	// Do manager clean up.
@@ -400,15 +414,85 @@ FHoudiniEngine::ShutdownModule()
 void
 FHoudiniEngine::AddTask(const FHoudiniEngineTask & InTask)
 {
-	if ( HoudiniEngineScheduler )
-		HoudiniEngineScheduler->AddTask(InTask);
+	// Add the task info before scheduling the task, a fast task could otherwise
+	// have its result overwritten by this initial working state.
+	{
+		FScopeLock ScopeLock(&CriticalSection);
+		FHoudiniEngineTaskInfo TaskInfo;
+		TaskInfo.TaskType = InTask.TaskType;
+		TaskInfo.TaskState = EHoudiniEngineTaskState::Working;
 
-	FScopeLock ScopeLock(&CriticalSection);
-	FHoudiniEngineTaskInfo TaskInfo;
-	TaskInfo.TaskType = InTask.TaskType;
-	TaskInfo.TaskState = EHoudiniEngineTaskState::Working;
+		TaskInfos.Add(InTask.HapiGUID, TaskInfo);
+	}
+
+	FScopeLock ScopeLock(&SchedulersCriticalSection);
+
+	// Make sure we have a scheduler for each session
+	CreateSchedulers(GetNumSessions());
 
-	TaskInfos.Add(InTask.HapiGUID, TaskInfo);
+	const int32 NumSchedulingSessions = GetNumSchedulingSessions();
+	if (NumSchedulingSessions <= 0)
+		return;
+
+	int32 SchedulerIndex = InTask.SessionIndex;
+	if (SchedulerIndex < 0)
+	{
+		// Not pinned to a session, use the least busy scheduler
+		SchedulerIndex = 0;
+		for (int32 Idx = 1; Idx < NumSchedulingSessions; Idx++)
+		{
+			if (HoudiniEngineSchedulers[Idx]->GetNumPendingTasks() < HoudiniEngineSchedulers[SchedulerIndex]->GetNumPendingTasks())
+				SchedulerIndex = Idx;
+		}
+	}
+	else if (SchedulerIndex >= NumSchedulingSessions)
+	{
+		// The session count was lowered since the task was pinned
+		SchedulerIndex %= NumSchedulingSessions;
+	}
+
+	HoudiniEngineSchedulers[SchedulerIndex]->AddTask(InTask);
+}
+
+int32
+FHoudiniEngine::GetSessionIndexForNode(const HAPI_NodeId& InNodeId) const
+{
+	const int32 NumSchedulingSessions = GetNumSchedulingSessions();
+	if (InNodeId < 0 || NumSchedulingSessions <= 1)
+		return 0;
+
+	return static_cast<int32>(GetTypeHash(InNodeId) % static_cast<uint32>(NumSchedulingSessions));
+}
+
+int32
+FHoudiniEngine::GetNumSchedulingSessions() const
+{
+	FScopeLock ScopeLock(&SchedulersCriticalSection);
+
+	// Without any session started, tasks still go to the first scheduler (and fail there)
+	return FMath::Min(FMath::Max(GetNumSessions(), 1), HoudiniEngineSchedulers.Num());
+}
+
+void
+FHoudiniEngine::CreateSchedulers(int32 InNumSchedulers)
+{
+	FScopeLock ScopeLock(&SchedulersCriticalSection);
+
+	InNumSchedulers = FMath::Max(InNumSchedulers, 1);
+	while (HoudiniEngineSchedulers.Num() < InNumSchedulers)
+	{
+		const int32 SessionIndex = HoudiniEngineSchedulers.Num();
+		FHoudiniEngineScheduler* HoudiniEngineScheduler = new FHoudiniEngineScheduler(SessionIndex);
+
+		// Keep the original name for the main session's thread
+		const FString ThreadName = SessionIndex == 0
+			? FString(TEXT("HoudiniSchedulerThread"))
+			: FString::Printf(TEXT("HoudiniSchedulerThread%d"), SessionIndex);
+
+		HoudiniEngineSchedulers.Add(HoudiniEngineScheduler);
+		HoudiniEngineSchedulerThreads.Add(FRunnableThread::Create(
+			HoudiniEngineScheduler, *ThreadName, 0, TPri_Normal));
+	}
 }
 
 void
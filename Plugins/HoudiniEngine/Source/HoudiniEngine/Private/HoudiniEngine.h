@@ -204,7 +204,14 @@ public:
 		void SetHapiNotificationStartedTime(const double& InTime) { HapiNotificationStarted = InTime; };
 
 		// Register task for execution.
+		// The task runs on the scheduler of its SessionIndex, or on the least busy one if it isn't pinned.
 		virtual void AddTask(const FHoudiniEngineTask & InTask);
+		// Returns the session a node's tasks should be pinned to.
+		// Tasks for the same node always end up on the same scheduler, so they run in order,
+		// while different nodes are spread over all the sessions and can cook concurrently.
+		virtual int32 GetSessionIndexForNode(const HAPI_NodeId& InNodeId) const;
+		// Returns the number of sessions tasks can be scheduled on.
+		int32 GetNumSchedulingSessions() const;
 		// Register task info.
 		virtual void AddTaskInfo(const FGuid& InHapiGUID, const FHoudiniEngineTaskInfo & InTaskInfo);
 		// Remove task info.
@@ -348,10 +355,15 @@ public:
 		// Map of task statuses.
 		TMap<FGuid, FHoudiniEngineTaskInfo> TaskInfos;
 
-		// Thread used to execute the scheduler.
-		FRunnableThread * HoudiniEngineSchedulerThread;
-		// Scheduler used to schedule HAPI instantiation and cook tasks. 
-		FHoudiniEngineScheduler * HoudiniEngineScheduler;
+		// Creates schedulers and their threads until we have one per session.
+		void CreateSchedulers(int32 InNumSchedulers);
+
+		// Threads used to execute the schedulers.
+		TArray<FRunnableThread *> HoudiniEngineSchedulerThreads;
+		// Schedulers used to schedule HAPI instantiation and cook tasks, one per session.
+		TArray<FHoudiniEngineScheduler *> HoudiniEngineSchedulers;
+		// Synchronization primitive for the scheduler arrays.
+		mutable FCriticalSection SchedulersCriticalSection;
 
 		// Thread used to execute the manager.
 		FRunnableThread * HoudiniEngineManagerThread;
@@ -41,6 +41,17 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineAccessorTimers(
 
 #define THRIFT_MAX_CHUNKSIZE			10 * 1024 * 1024
 
+// Size of attribute values transferred over HAPI, for the cook telemetry.
+// Strings are accounted as string handles.
+template<typename DataType>
+static int64 GetHapiTransferSize(int64 NumValues)
+{
+	if constexpr (std::is_same_v<DataType, FString>)
+		return NumValues * sizeof(HAPI_StringHandle);
+	else
+		return NumValues * sizeof(DataType);
+}
+
 struct FHoudiniRawAttributeData
 {
 	// This structure is used to store data before it is converted to a different type.
@@ -410,6 +421,8 @@ template<typename DataType> bool FHoudiniHapiAccessor::GetAttributeArrayData(con
 		HOUDINI_LOG_ERROR(TEXT("Not an array storage types"));
 		return false;
 	}
+	H_SCOPED_COOK_STAGE(AttributeFetch);
+
 	DataArray.SetNum(AttributeInfo.totalArrayElements);
 	Sizes.SetNum(IndexCount);
 
@@ -566,7 +579,10 @@ bool FHoudiniHapiAccessor::GetHeightFieldDataViaSession(const HAPI_Session* Sess
 	HAPI_Result Result = FHoudiniApi::GetHeightFieldData(Session, NodeId, PartId, Results, IndexStart, IndexCount);
 
 	if(Result == HAPI_Result::HAPI_RESULT_SUCCESS)
+	{
+		FHoudiniEngineTelemetry::Get().AddBytesReceived(GetHapiTransferSize<float>(IndexCount));
 		return true;
+	}
 
 	// HAPI returned an error, handle it gracefully.
 	HOUDINI_LOG_ERROR(TEXT("FHoudiniApi::GetHeightFieldData Failed: %s"), *FHoudiniEngineUtils::GetErrorDescription(Result));
@@ -577,6 +593,7 @@ bool FHoudiniHapiAccessor::GetHeightFieldDataViaSession(const HAPI_Session* Sess
 bool FHoudiniHapiAccessor::GetHeightFieldData(TArray<float>& Results, int IndexCount)
 {
 	H_SCOPED_FUNCTION_TIMER();
+	H_SCOPED_COOK_STAGE(AttributeFetch);
 
 	int64 TotalSize = Results.Num() * sizeof(Results[0]);
 	int64 NumSessions = bAllowMultiThreading ? FHoudiniEngine::Get().GetNumSessions() : 1;
@@ -625,6 +642,7 @@ bool FHoudiniHapiAccessor::GetAttributeDataMultiSession(const HAPI_AttributeInfo
 	// This is the actual main function for getting data.
 
 	H_SCOPED_FUNCTION_DYNAMIC_LABEL(FString::Printf(TEXT("FHoudiniAttributeAccessor::GetAttributeDataMultiSession (%s)"), ANSI_TO_TCHAR(AttributeName.GetData())));
+	H_SCOPED_COOK_STAGE(AttributeFetch);
 
 	if (!AttributeInfo.exists)
 		return false;
@@ -868,6 +886,12 @@ HAPI_Result FHoudiniHapiAccessor::SendHapiData(const HAPI_Session* Session, cons
 
 	Timer.Stop();
 
+	if (Result == HAPI_RESULT_SUCCESS)
+	{
+		const int64 NumTuples = RunLengths.Num() > 0 ? RunLengths.Num() : IndexCount;
+		FHoudiniEngineTelemetry::Get().AddBytesSent(GetHapiTransferSize<DataType>(NumTuples * AttributeInfo.tupleSize));
+	}
+
 	return Result;
 }
 
@@ -959,6 +983,10 @@ HAPI_Result FHoudiniHapiAccessor::FetchHapiData(const HAPI_Session* Session, con
 
 	if (!TempAttributeInfo.exists)
 		Result = HAPI_RESULT_FAILURE;
+
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniEngineTelemetry::Get().AddBytesReceived(GetHapiTransferSize<DataType>((int64)IndexCount * TempAttributeInfo.tupleSize));
+
 	return Result;
 }
 
@@ -1013,6 +1041,10 @@ HAPI_Result FHoudiniHapiAccessor::FetchHapiDataArray(const HAPI_Session* Session
 
 	if (!TempAttributeInfo.exists)
 		Result = HAPI_RESULT_FAILURE;
+
+	if (Result == HAPI_RESULT_SUCCESS)
+		FHoudiniEngineTelemetry::Get().AddBytesReceived(GetHapiTransferSize<DataType>(TempAttributeInfo.totalArrayElements) + (int64)IndexCount * sizeof(int));
+
 	return Result;
 }
 
@@ -1514,6 +1546,8 @@ bool FHoudiniHapiAccessor::GetAttributeStrings(HAPI_AttributeOwner Owner, FHoudi
 
 bool FHoudiniHapiAccessor::GetAttributeStrings(const HAPI_AttributeInfo& InAttrInfo, FHoudiniEngineIndexedStringMap& StringArray, int IndexStart, int IndexCount)
 {
+	H_SCOPED_COOK_STAGE(AttributeFetch);
+
 	StringArray = {};
 
 	int Count = IndexCount == -1 ? InAttrInfo.count : IndexCount;
@@ -1531,6 +1565,8 @@ bool FHoudiniHapiAccessor::GetAttributeStrings(const HAPI_AttributeInfo& InAttrI
 		if (Result != HAPI_RESULT_SUCCESS)
 			return false;
 
+		FHoudiniEngineTelemetry::Get().AddBytesReceived(GetHapiTransferSize<FString>(Count));
+
 		StringArray.InitializeFromStringHandles(StringHandles);
 	}
 	else
@@ -35,6 +35,7 @@
 #include "HoudiniDataLayerUtils.h"
 #include "HoudiniEngine.h"
 #include "HoudiniEngineOutputStats.h"
+#include "HoudiniEngineTimers.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniFoliageTools.h"
@@ -292,11 +293,15 @@ FHoudiniEngineBakeUtils::BakeCookable(
 	if (!IsValid(InCookableToBake))
 		return false;
 
+	FHoudiniEngineTelemetry::FScopedRecord TelemetryRecord(InCookableToBake, TEXT("Bake"));
+	H_SCOPED_COOK_STAGE(Bake);
+
 	// Handle proxies: if the output has any current proxies, first refine them
 	bool bNeedsToReCook;
 	if (!CheckForAndRefineHoudiniProxyMesh(InCookableToBake, BakeSettings.bReplaceActors, InBakeOption, bInRemoveHACOutputOnSuccess, BakeSettings.bRecenterBakedActors, bNeedsToReCook))
 	{
 		// Either the component is invalid, or needs a recook to refine a proxy mesh
+		TelemetryRecord.SetResult(bNeedsToReCook ? EHoudiniCookTelemetryResult::Cancelled : EHoudiniCookTelemetryResult::Failed);
 		return false;
 	}
 
@@ -326,6 +331,8 @@ FHoudiniEngineBakeUtils::BakeCookable(
 	{
 		FHoudiniOutputTranslator::ClearAndRemoveOutputs(InCookableToBake->GetOutputs(), EHoudiniClearFlags::EHoudiniClear_Actors);
 	}
+
+	TelemetryRecord.SetResult(bSuccess ? EHoudiniCookTelemetryResult::Success : EHoudiniCookTelemetryResult::Failed);
 	
 	return bSuccess;
 }
@@ -352,6 +359,8 @@ FHoudiniEngineBakeUtils::BakeCookableToActors(
 	// Save the created packages
 	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
 
+	FHoudiniEngineTelemetry::Get().AddOutputStats(BakedObjectData.BakeStats);
+
 	// Recenter and select the baked actors
 	if (!InCookable->GetIsPCG() && GEditor && NewActors.Num() > 0)
 		GEditor->SelectNone(false, true);
@@ -657,6 +666,7 @@ FHoudiniEngineBakeUtils::BakeCookableToAssets(
 	// Save the created packages
 	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
 
+	FHoudiniEngineTelemetry::Get().AddOutputStats(BakedObjectData.BakeStats);
 
 	//FHoudiniBakeLevelInstanceUtils::CreateLevelInstances(
 	//	InCookable, NewActors, BakedObjectData);
@@ -4879,6 +4889,8 @@ FHoudiniEngineBakeUtils::BakeBlueprints(UHoudiniCookable* InCookable, const FHou
 
 	FHoudiniEngineBakeUtils::SaveBakedPackages(BakedObjectData.PackagesToSave);
 
+	FHoudiniEngineTelemetry::Get().AddOutputStats(BakedObjectData.BakeStats);
+
 	// Sync the CB to the baked objects
 	if(GEditor && BakedObjectData.Blueprints.Num() > 0)
 	{
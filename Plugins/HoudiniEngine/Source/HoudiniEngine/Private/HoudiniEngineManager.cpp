@@ -33,6 +33,7 @@
 #include "HoudiniAssetBlueprintComponent.h"
 #include "HoudiniAssetComponent.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineTimers.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniParameterTranslator.h"
 #include "HoudiniPDGManager.h"
@@ -65,10 +66,29 @@ static TAutoConsoleVariable<float> CVarHoudiniEngineTickTimeLimit(
 	TEXT("HoudiniEngine.TickTimeLimit"),
 	1.0,
 	TEXT("Time limit after which HDA processing will be stopped, until the next tick of the Houdini Engine Manager.\n")
+	TEXT("The creation of an HDA's outputs is also spread over multiple ticks when it exceeds this limit.\n")
 	TEXT("<= 0.0: No Limit\n")
 	TEXT("1.0: Default\n")
 );
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyRefinementInBackground(
+	TEXT("HoudiniEngine.ProxyRefinementInBackground"),
+	1,
+	TEXT("Whether the timer based refinement of proxy meshes to static meshes is done in the background, over multiple ticks.\n")
+	TEXT("Proxies visible in the active viewport are refined first. Refinement on save and before PIE is always done immediately.\n")
+	TEXT("0: Refine all the proxy meshes of an HDA at once, with a progress dialog\n")
+	TEXT("1: Default\n")
+);
+
+static TAutoConsoleVariable<float> CVarHoudiniEngineProxyRefinementTimeLimit(
+	TEXT("HoudiniEngine.ProxyRefinementTimeLimit"),
+	0.02,
+	TEXT("Time spent refining proxy meshes in the background per tick of the Houdini Engine Manager.\n")
+	TEXT("At least one output is refined per tick.\n")
+	TEXT("<= 0.0: No Limit\n")
+	TEXT("0.02: Default\n")
+);
+
 static TAutoConsoleVariable<float> CVarHoudiniEngineLiveSyncTickTime(
 	TEXT("HoudiniEngine.LiveSyncTickTime"),
 	1.0,
@@ -89,6 +109,7 @@ FHoudiniEngineManager::FHoudiniEngineManager()
 	, SyncedUnrealViewportLookatPosition(FVector::ZeroVector)
 	, ZeroOffsetValue(0.f)
 	, bOffsetZeroed(false)
+	, ProcessingEndTime(0.0)
 {
 
 }
@@ -274,6 +295,7 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 	// Time limit for processing
 	double dCookableProcessTimeLimit = CVarHoudiniEngineTickTimeLimit.GetValueOnAnyThread();
 	double dCookableProcessStartTime = FPlatformTime::Seconds();
+	ProcessingEndTime = dCookableProcessTimeLimit > 0.0 ? dCookableProcessStartTime + dCookableProcessTimeLimit : 0.0;
 
 	// Process all the cookables in the list
 	for (UHoudiniCookable* CurrentCookable : CookablesToProcess)
@@ -372,6 +394,19 @@ FHoudiniEngineManager::Tick(float DeltaTime)
 #endif
 	}
 
+	// Drop the output processing states of cookables that have stopped processing their outputs
+	// (deleted, rebuilt...) before we could finish
+	for (auto It = OutputProcessingStates.CreateIterator(); It; ++It)
+	{
+		UHoudiniCookable* CurrentCookable = It.Key().Get();
+		if (!IsValid(CurrentCookable) || CurrentCookable->GetCurrentState() != EHoudiniAssetState::Processing)
+			It.RemoveCurrent();
+	}
+
+	// Background proxy mesh refinement
+	double dRefinementTimeLimit = CVarHoudiniEngineProxyRefinementTimeLimit.GetValueOnAnyThread();
+	ProxyRefinementQueue.Tick(dRefinementTimeLimit > 0.0 ? FPlatformTime::Seconds() + dRefinementTimeLimit : 0.0);
+
 	//
 	// Node Deletion
 	//
@@ -499,6 +534,10 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 		return;
 	}
 
+	// Stage timings go to the telemetry record of the cookable's current cook
+	FHoudiniEngineTelemetry& Telemetry = FHoudiniEngineTelemetry::Get();
+	FHoudiniEngineTelemetry::FScopedActiveCookable TelemetryScope(HC);
+
 	switch (CurrentStateToProcess)
 	{
 		case EHoudiniAssetState::NeedInstantiation:
@@ -639,6 +678,10 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 						// The cookable is now instantiating
 						NextState = EHoudiniAssetState::Instantiating;
 
+						// The instantiation is accounted in the record of the first cook
+						Telemetry.BeginRecord(HC, TEXT("Cook"));
+						Telemetry.BeginStage(HC, EHoudiniCookStage::Instantiate);
+
 						// Update the Task GUID
 						HC->HapiGUID = TaskGuid;
 
@@ -665,6 +708,10 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 			EHoudiniAssetState NewState = EHoudiniAssetState::Instantiating;
 			if (UpdateInstantiating(HC, NewState , HC->bDoSlateNotifications))
 			{
+				Telemetry.EndStage(HC, EHoudiniCookStage::Instantiate);
+				if (NewState != EHoudiniAssetState::PreCook)
+					Telemetry.EndRecord(HC, EHoudiniCookTelemetryResult::Failed);
+
 				// We need to update the HAC's state
 				HC->SetCurrentState(NewState);
 				EnableEditorAutoSave(HC);
@@ -684,18 +731,29 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 			if(HC->IsInputSupported() && HC->InputData->NeedsToWaitForInputHoudiniAssets())
 				break;
 
+			// The record may have been opened by the instantiation of the HDA
+			const bool bHadTelemetryRecord = Telemetry.HasOpenRecord(HC);
+			if (!bHadTelemetryRecord)
+				Telemetry.BeginRecord(HC, TEXT("Cook"));
+
+			FHoudiniEngineTelemetry::FScopedActiveCookable PreCookTelemetryScope(HC);
+
 			if(MyHABC)
 				MyHABC->OnPrePreCook();
 
 			// Update all the HAPI nodes, parameters, inputs etc...
-			PreCook(HC);
+			{
+				H_SCOPED_COOK_STAGE(PreCook);
+				PreCook(HC);
+			}
 
 			if (MyHABC)
 				MyHABC->OnPostPreCook();
 
 			// Create a Cooking task only if necessary
 			bool bCookStarted = false;
-			if (IsCookingEnabledForCookable(HC))
+			const bool bCookingEnabled = IsCookingEnabledForCookable(HC);
+			if (bCookingEnabled)
 			{
 				TArray<int32> NodesToCook;
 
@@ -731,6 +789,8 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 					HC->SetCurrentState(EHoudiniAssetState::Cooking);
 					HC->HapiGUID = TaskGUID;
 					bCookStarted = true;
+
+					Telemetry.BeginStage(HC, EHoudiniCookStage::Cook);
 				}
 			}
 
@@ -741,6 +801,15 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 				HC->bNeedToUpdateEditorProperties = true;
 	#endif
 				HC->SetCurrentState(EHoudiniAssetState::None);
+
+				// Nothing was cooked. End the record with its result: failed if the cook couldn't start, successful if
+				// it only covers the instantiation. A record opened just for this pre-cook has nothing worth keeping.
+				if (bCookingEnabled)
+					Telemetry.EndRecord(HC, EHoudiniCookTelemetryResult::Failed);
+				else if (bHadTelemetryRecord)
+					Telemetry.EndRecord(HC, EHoudiniCookTelemetryResult::Success);
+				else
+					Telemetry.DiscardRecord(HC);
 			}
 			break;
 		}
@@ -756,6 +825,10 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 			{
 				HC->bLastCookSuccess = bCookSuccess;
 
+				Telemetry.EndStage(HC, EHoudiniCookStage::Cook);
+				if (NewState != EHoudiniAssetState::PostCook)
+					Telemetry.EndRecord(HC, EHoudiniCookTelemetryResult::Failed);
+
 				// We need to update the HAC's state
 				HC->SetCurrentState(NewState);
 				EnableEditorAutoSave(HC);
@@ -779,7 +852,13 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 			if(MyHABC)
 				MyHABC->OnPreOutputProcessing();
 
-			if (PostCook(HC))
+			bool bPostCookSuccess = false;
+			{
+				H_SCOPED_COOK_STAGE(PostCook);
+				bPostCookSuccess = PostCook(HC);
+			}
+
+			if (bPostCookSuccess)
 			{
 				// Cook was successful, process the results
 				NewState = EHoudiniAssetState::PreProcess;
@@ -788,6 +867,7 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 			{
 				// Cook failed, skip output processing
 				NewState = EHoudiniAssetState::None;
+				Telemetry.EndRecord(HC, EHoudiniCookTelemetryResult::Failed);
 			}
 			HC->SetCurrentState(NewState);
 			break;
@@ -804,7 +884,37 @@ FHoudiniEngineManager::ProcessCookable(UHoudiniCookable* HC)
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::ProcessCookable - Processing);
 
-			UpdateProcess(HC);
+			// If the parameters/inputs have been modified while we were processing the outputs,
+			// stop now: the outputs will be recreated after the next cook anyway
+			if (OutputProcessingStates.Contains(HC)
+				&& (HC->HasRecookBeenRequested()
+					|| (HC->IsParameterSupported() && HC->NeedUpdateParameters())
+					|| (HC->IsInputSupported() && HC->NeedUpdateInputs())))
+			{
+				CancelProcess(HC);
+				break;
+			}
+
+			// Outputs are processed over multiple ticks if needed, stay in this state until we're done
+			bool bProcessFinished = false;
+			{
+				H_SCOPED_COOK_STAGE(OutputProcessing);
+				bProcessFinished = UpdateProcess(HC);
+			}
+
+			if (!bProcessFinished)
+				break;
+
+			if (Telemetry.HasOpenRecord(HC))
+			{
+				for (const UHoudiniOutput* Output : HC->GetOutputs())
+				{
+					if (IsValid(Output))
+						Telemetry.AddObjectsProduced(HC, StaticEnum<EHoudiniOutputType>()->GetNameStringByValue((int64)Output->GetType()), Output->GetOutputObjects().Num());
+				}
+
+				Telemetry.EndRecord(HC, EHoudiniCookTelemetryResult::Success);
+			}
 
 			HC->HandleOnPostOutputProcessing();
 			if (MyHABC)
@@ -1255,6 +1365,9 @@ FHoudiniEngineManager::StartTaskAssetCooking(
 	Task.bUseOutputNodes = bUseOutputNodes;
 	Task.bOutputTemplateGeos = bOutputTemplateGeos;
 
+	// Pin the cook to the asset's session, cooks of other assets can run concurrently on the other sessions
+	Task.SessionIndex = FHoudiniEngine::Get().GetSessionIndexForNode(AssetId);
+
 	FHoudiniEngine::Get().AddTask(Task);
 
 	return true;
@@ -1338,6 +1451,9 @@ FHoudiniEngineManager::PreCook(UHoudiniCookable* HC)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineManager::PreCook);
 
+	// The cook will replace the proxy meshes that were waiting to be refined
+	ProxyRefinementQueue.Cancel(HC);
+
 	if (HC->IsOutputSupported())
 	{
 		// Remove all Cooked (layers) before cooking so we don't received cooked data in Houdini
@@ -1617,14 +1733,42 @@ FHoudiniEngineManager::UpdateProcess(UHoudiniCookable* HC)
 {
 	// We should only process after a succesfull cook
 	if (!HC->bLastCookSuccess)
-		return false;
+	{
+		OutputProcessingStates.Remove(HC);
+		return true;
+	}
 
 	bool bNeedsToTriggerViewportUpdate = false;
 	bool bHasHoudiniStaticMeshOutput = false;
 
 	// ?? this was unused
 	//bool bForceOutputUpdate = HAC->HasRebuildBeenRequested() || HAC->HasRecookBeenRequested();
-	FHoudiniOutputTranslator::ProcessOutputs(HC, bHasHoudiniStaticMeshOutput);
+	TSharedPtr<FHoudiniOutputProcessingState>& State = OutputProcessingStates.FindOrAdd(HC);
+	if (!State.IsValid())
+	{
+		State = FHoudiniOutputTranslator::BeginProcessOutputs(HC);
+		if (!State.IsValid())
+		{
+			OutputProcessingStates.Remove(HC);
+			return true;
+		}
+	}
+
+	if (!FHoudiniOutputTranslator::ContinueProcessOutputs(HC, *State, ProcessingEndTime))
+	{
+		// Not done yet, let the user know how far we are
+		if (HC->bDoSlateNotifications)
+		{
+			FString Notification = FString::Format(TEXT("{0} :\nProcessing outputs {1} / {2}..."),
+				{ HC->GetDisplayName(), FString::FromInt(State->GetNumProcessedOutputs()), FString::FromInt(State->GetNumOutputs()) });
+			FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString(Notification), false);
+		}
+
+		return false;
+	}
+
+	bHasHoudiniStaticMeshOutput = State->bHasHoudiniStaticMeshOutput;
+	OutputProcessingStates.Remove(HC);
 	
 	if (HC->IsProxySupported())
 		HC->ProxyData->bNoProxyMeshNextCookRequested = false;
@@ -1688,6 +1832,22 @@ FHoudiniEngineManager::UpdateProcess(UHoudiniCookable* HC)
 	return true;
 }
 
+void
+FHoudiniEngineManager::CancelProcess(UHoudiniCookable* HC)
+{
+	OutputProcessingStates.Remove(HC);
+
+	FHoudiniEngineTelemetry::Get().EndRecord(HC, EHoudiniCookTelemetryResult::Cancelled);
+
+	HOUDINI_LOG_MESSAGE(TEXT("%s: Output processing cancelled, the asset needs to be updated."), *HC->GetDisplayName());
+
+	if (HC->bDoSlateNotifications)
+		FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString(HC->GetDisplayName() + " :\nOutput processing cancelled"), false);
+
+	// Going back to None will trigger a new cook, since the cookable needs an update
+	HC->SetCurrentState(EHoudiniAssetState::None);
+}
+
 bool
 FHoudiniEngineManager::StartTaskAssetRebuild(const HAPI_NodeId& InAssetId, FGuid& OutTaskGUID)
 {
@@ -1742,6 +1902,8 @@ FHoudiniEngineManager::StartTaskAssetDelete(const HAPI_NodeId& InNodeId, FGuid&
 	// Create asset deletion task object and submit it for processing.
 	FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetDeletion, OutTaskGUID);
 	Task.AssetId = OBJNodeToDelete;
+	// Use the same session as the asset's cooks, so the deletion is queued after any pending cook
+	Task.SessionIndex = FHoudiniEngine::Get().GetSessionIndexForNode(InNodeId);
 	FHoudiniEngine::Get().AddTask(Task);
 
 	return true;
@@ -1843,6 +2005,13 @@ FHoudiniEngineManager::BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniCookab
 		return;
 	}
 
+	if (CVarHoudiniEngineProxyRefinementInBackground.GetValueOnAnyThread() != 0)
+	{
+		// The meshes will be built over the next ticks
+		ProxyRefinementQueue.Enqueue(HC);
+		return;
+	}
+
 #if WITH_EDITOR
 	AActor *Owner = HC->GetOwner();
 	FString Name = Owner ? Owner->GetName() : HC->GetName();
@@ -35,12 +35,14 @@
 //#include "Misc/SingleThreadRunnable.h"
 
 #include "HoudiniPDGManager.h"
+#include "HoudiniProxyRefinementQueue.h"
 
 class UHoudiniAsset;
 class UHoudiniAssetComponent;
 class UHoudiniCookable;
 
 struct FHoudiniEngineTaskInfo;
+struct FHoudiniOutputProcessingState;
 struct FGuid;
 
 enum class EHoudiniAssetState : uint8;
@@ -63,8 +65,12 @@ public:
 
 	// Build UStaticMesh for all UHoudiniStaticMesh on a Cookable.
 	// This is fired by the OnRefinedMeshesTimerDelegate on a Cookable.
+	// Unless disabled by HoudiniEngine.ProxyRefinementInBackground, the cookable is queued for background refinement.
 	void BuildStaticMeshesForAllHoudiniStaticMeshes(UHoudiniCookable* HC);
 
+	// Queue of the cookables whose proxy meshes are being refined in the background
+	FHoudiniProxyRefinementQueue& GetProxyRefinementQueue() { return ProxyRefinementQueue; }
+
 	void StartPDGCommandlet()
 	{
 		if (!IsPDGCommandletRunningOrConnected())
@@ -146,8 +152,14 @@ protected:
 	bool PostCook(UHoudiniCookable* HC);
 
 	bool StartTaskAssetProcess(UHoudiniCookable* HC); 
+
+	// Creates the cookable's outputs, until the current tick's processing time limit is reached.
+	// Returns true once all outputs have been processed, false if processing needs to continue on the next tick.
 	bool UpdateProcess(UHoudiniCookable* HC);
 
+	// Stops processing the outputs of a cookable, so they are rebuilt after the next cook
+	void CancelProcess(UHoudiniCookable* HC);
+
 	// Starts a rebuild task (delete then re instantiate)
 	// The NodeID should be invalidated after a successful call
 	bool StartTaskAssetRebuild(
@@ -198,6 +210,9 @@ private:
 	// The PDG Manager, handles all registered PDG Asset Links
 	FHoudiniPDGManager PDGManager;
 
+	// Refines proxy meshes to static meshes over multiple ticks
+	FHoudiniProxyRefinementQueue ProxyRefinementQueue;
+
 	// For ViewportSync: The camera transform that Hapi and Unreal currently agree with.
 	FVector SyncedHoudiniViewportPivotPosition;
 	FQuat SyncedHoudiniViewportQuat;
@@ -216,4 +231,10 @@ private:
 
 	// Indicates which objects disable auto-saving
 	TSet<TWeakObjectPtr<const UObject>> AutosaveDisablerObjects;
+
+	// Output processing state of the cookables whose outputs are being processed over multiple ticks
+	TMap<TWeakObjectPtr<UHoudiniCookable>, TSharedPtr<FHoudiniOutputProcessingState>> OutputProcessingStates;
+
+	// Time (FPlatformTime::Seconds()) at which the current tick should stop processing cookables, 0 if unlimited
+	double ProcessingEndTime;
 };
\ No newline at end of file
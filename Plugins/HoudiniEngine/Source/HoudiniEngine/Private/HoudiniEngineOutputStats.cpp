@@ -41,6 +41,11 @@ void FHoudiniEngineOutputStats::NotifyPackageUpdated(int32 NumUpdated)
 	NumPackagesUpdated += NumUpdated;
 }
 
+void FHoudiniEngineOutputStats::NotifyMeshBuilt(const FString& MeshName, const FHoudiniEngineMeshBuildTimings& Timings)
+{
+	MeshBuildTimings.Add(MeshName, Timings);
+}
+
 void FHoudiniEngineOutputStats::NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated)
 {
 	const int32 Count = OutputObjectsCreated.FindOrAdd(ObjectTypeName, 0);
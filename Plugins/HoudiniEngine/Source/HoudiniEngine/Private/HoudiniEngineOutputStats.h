@@ -29,6 +29,17 @@
 #include "CoreMinimal.h"
 #include "UObject/Class.h"
 
+// Time spent creating a static mesh, in seconds
+struct HOUDINIENGINE_API FHoudiniEngineMeshBuildTimings
+{
+	// Filling the mesh descriptions, collisions and settings of the mesh
+	double PrepareTime = 0.0;
+	// Batch build the mesh's render data was built in, shared with the other meshes of the batch
+	double BuildTime = 0.0;
+	// Number of meshes built in the same batch
+	int32 NumMeshesInBuild = 0;
+};
+
 struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 {
 	FHoudiniEngineOutputStats();
@@ -36,6 +47,9 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	int32 NumPackagesCreated;
 	int32 NumPackagesUpdated;
 
+	// Build timings of the static meshes, by mesh name
+	TMap<FString, FHoudiniEngineMeshBuildTimings> MeshBuildTimings;
+
 	// These FStrings should preferably be EHoudiniOutputType enum
 	// Move the OUtput enums into a separate header to avoid circular dependencies.
 	TMap<FString, int32> OutputObjectsCreated;
@@ -45,6 +59,9 @@ struct HOUDINIENGINE_API FHoudiniEngineOutputStats
 	void NotifyPackageCreated(int32 NumCreated);
 	void NotifyPackageUpdated(int32 NumUpdated);
 
+	// Static mesh built
+	void NotifyMeshBuilt(const FString& MeshName, const FHoudiniEngineMeshBuildTimings& Timings);
+
 	// Objects created
 	void NotifyObjectsCreated(const FString& ObjectTypeName, int32 NumCreated);
 	template<typename EnumT>
@@ -34,15 +34,46 @@
 const uint32
 FHoudiniEngineScheduler::InitialTaskSize = 256u;
 
-// Update frequency in (ms) for polling the scheduler
+// Update frequency in (s) for polling the scheduler, and max sleep time between two HAPI status polls
 const float
 FHoudiniEngineScheduler::UpdateFrequency = 0.1f;
 
-FHoudiniEngineScheduler::FHoudiniEngineScheduler()
+// Sleep time in (s) before the first HAPI status poll, doubled after each poll
+const float
+FHoudiniEngineScheduler::MinPollInterval = 0.0002f;
+
+const float
+FHoudiniEngineScheduler::PollBackoffFactor = 2.0f;
+
+FHoudiniEnginePollBackoff::FHoudiniEnginePollBackoff(float InMinInterval, float InMaxInterval, float InBackoffFactor)
+	: MinInterval(InMinInterval)
+	, MaxInterval(FMath::Max(InMinInterval, InMaxInterval))
+	, BackoffFactor(FMath::Max(InBackoffFactor, 1.0f))
+	, CurrentInterval(InMinInterval)
+{
+}
+
+float
+FHoudiniEnginePollBackoff::NextInterval()
+{
+	const float Interval = CurrentInterval;
+	CurrentInterval = FMath::Min(CurrentInterval * BackoffFactor, MaxInterval);
+	return Interval;
+}
+
+void
+FHoudiniEnginePollBackoff::Reset()
+{
+	CurrentInterval = MinInterval;
+}
+
+FHoudiniEngineScheduler::FHoudiniEngineScheduler(int32 InSessionIndex)
 	: WakeUpEvent(FEventRef(EEventMode::AutoReset))
 	, Tasks(nullptr)
 	, PositionWrite(0u)
 	, PositionRead(0u)
+	, NumPendingTasks(0)
+	, SessionIndex(FMath::Max(InSessionIndex, 0))
 	, bStopping(false)
 {
 	//  Make sure size is power of two.
@@ -70,6 +101,15 @@ FHoudiniEngineScheduler::~FHoudiniEngineScheduler()
 	}
 }
 
+const HAPI_Session*
+FHoudiniEngineScheduler::GetSession() const
+{
+	// All sessions are connected to the same server, so nodes created on one session are visible from the others.
+	// Fall back to the main session if ours was not (re)started, ie. the session count was lowered.
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession(SessionIndex);
+	return Session ? Session : FHoudiniEngine::Get().GetSession();
+}
+
 void
 FHoudiniEngineScheduler::TaskDescription(
 	FHoudiniEngineTaskInfo & TaskInfo,
@@ -185,7 +225,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	if(!StdString.empty())
 		NativeNodeLabel = StdString.c_str();
 
-	Result = FHoudiniApi::CreateNode(FHoudiniEngine::Get().GetSession(), -1, &AssetNameString[0], NativeNodeLabel, false, &AssetId);
+	Result = FHoudiniApi::CreateNode(GetSession(), -1, &AssetNameString[0], NativeNodeLabel, false, &AssetId);
 
 	if (Result != HAPI_RESULT_SUCCESS)
 	{
@@ -212,12 +252,15 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 	if (AssetName.Contains(TEXT("::Cop/")))
 		bTryCOPNet = true;
 
+	FHoudiniEnginePollBackoff PollBackoff(MinPollInterval, UpdateFrequency, PollBackoffFactor);
+
 	// We need to spin until instantiation is finished.
 	while (true)
 	{
 		int Status = HAPI_STATE_STARTING_COOK;
-		HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+		Result = FHoudiniApi::GetStatus(GetSession(), HAPI_STATUS_COOK_STATE, &Status);
+		if (Result != HAPI_RESULT_SUCCESS)
+			HOUDINI_LOG_ERROR(TEXT("Hapi failed: %s"), *FHoudiniEngineUtils::GetErrorDescription(GetSession()));
 
 		if (Status == HAPI_STATE_READY)
 		{
@@ -233,9 +276,9 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		else if (Status == HAPI_STATE_READY_WITH_FATAL_ERRORS || Status == HAPI_STATE_READY_WITH_COOK_ERRORS)
 		{
 			// There was an error while instantiating.
-			FString CookResultString = FHoudiniEngineUtils::GetCookResult();
+			FString CookResultString = FHoudiniEngineUtils::GetCookResult(GetSession());
 			int32 CookResult = static_cast<int32>(HAPI_RESULT_SUCCESS);
-			FHoudiniApi::GetStatus(FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult);
+			FHoudiniApi::GetStatus(GetSession(), HAPI_STATUS_COOK_RESULT, &CookResult);
 
 			// If the asset is a cop node, we need to create obj/geo/cop subnet
 			// in order to be able to instantiate it properly
@@ -258,14 +301,14 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 				// Create an OBJ node
 				HAPI_NodeId UnrealContentNodeId = -1;
 				Result = FHoudiniEngineUtils::CreateNode(
-					-1, "Object/subnet", opName, true, &UnrealContentNodeId);
+					-1, "Object/subnet", opName, true, &UnrealContentNodeId, GetSession());
 
 				// Create a geo "grandparent" node 
 				HAPI_NodeId GrandParentGEOId = -1;
 				if (Result == HAPI_RESULT_SUCCESS)
 				{
 					Result = FHoudiniEngineUtils::CreateNode(
-						UnrealContentNodeId, TEXT("geo"), opName, true, &GrandParentGEOId);
+						UnrealContentNodeId, TEXT("geo"), opName, true, &GrandParentGEOId, GetSession());
 				}
 
 				// And a parent COP net
@@ -274,14 +317,14 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 				{
 					// Create the node and wait for the ready status
 					Result = FHoudiniEngineUtils::CreateNode(
-						GrandParentGEOId, TEXT("copnet"), opName, true, &ParentCOPId);
+						GrandParentGEOId, TEXT("copnet"), opName, true, &ParentCOPId, GetSession());
 				}
 
 				if (Result == HAPI_RESULT_SUCCESS && ParentCOPId >= 0)
 				{
 					// Attempt to create the HDA in the copnet we just created
 					Result = FHoudiniApi::CreateNode(
-						FHoudiniEngine::Get().GetSession(),
+						GetSession(),
 						ParentCOPId,
 						&AssetNameString[0], 
 						NativeNodeLabel,
@@ -292,17 +335,18 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 					{
 						// Failed - clean up any parent node we might have created
 						if(ParentCOPId >= 0)
-							FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(),	ParentCOPId);
+							FHoudiniApi::DeleteNode(GetSession(),	ParentCOPId);
 
 						if (GrandParentGEOId >= 0)
-							FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), GrandParentGEOId);
+							FHoudiniApi::DeleteNode(GetSession(), GrandParentGEOId);
 
 						if (UnrealContentNodeId >= 0)
-							FHoudiniApi::DeleteNode(FHoudiniEngine::Get().GetSession(), UnrealContentNodeId);
+							FHoudiniApi::DeleteNode(GetSession(), UnrealContentNodeId);
 					}
 					else
 					{
 						// Retry with the cop node in the subnets
+						PollBackoff.Reset();
 						continue;
 					}
 				}
@@ -350,7 +394,7 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 		{
 			// Reset update time.
 			LastUpdateTime = FPlatformTime::Seconds();
-			const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState();
+			const FString& CookStateMessage = FHoudiniEngineUtils::GetCookState(GetSession());
 
 			AddResponseMessageTaskInfo(
 				HAPI_RESULT_SUCCESS,
@@ -359,8 +403,8 @@ FHoudiniEngineScheduler::TaskInstantiateAsset(const FHoudiniEngineTask & Task)
 				AssetId, Task, CookStateMessage);
 		}
 
-		// We want to yield.
-		FPlatformProcess::SleepNoStats(UpdateFrequency);
+		// We want to yield, briefly at first so fast instantiations don't wait for a full update.
+		FPlatformProcess::SleepNoStats(PollBackoff.NextInterval());
 	}
 }
 
@@ -424,7 +468,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 	EHoudiniEngineTaskState GlobalTaskResult = EHoudiniEngineTaskState::Success;
 	for (auto& CurrentNodeId : NodesToCook)
 	{
-		Result = FHoudiniApi::CookNode(FHoudiniEngine::Get().GetSession(), CurrentNodeId, &CookOptions);
+		Result = FHoudiniApi::CookNode(GetSession(), CurrentNodeId, &CookOptions);
 		if (Result != HAPI_RESULT_SUCCESS)
 		{
 			AddResponseMessageTaskInfo(
@@ -447,13 +491,15 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 
 		// Initialize last update time.
 		double LastUpdateTime = FPlatformTime::Seconds();
+		FHoudiniEnginePollBackoff PollBackoff(MinPollInterval, UpdateFrequency, PollBackoffFactor);
 
 		// We need to spin until cooking is finished.
 		while (true)
 		{
 			int32 Status = HAPI_STATE_STARTING_COOK;
-			HOUDINI_CHECK_ERROR_GET(&Result, FHoudiniApi::GetStatus(
-				FHoudiniEngine::Get().GetSession(), HAPI_STATUS_COOK_STATE, &Status));
+			Result = FHoudiniApi::GetStatus(GetSession(), HAPI_STATUS_COOK_STATE, &Status);
+			if (Result != HAPI_RESULT_SUCCESS)
+				HOUDINI_LOG_ERROR(TEXT("Hapi failed: %s"), *FHoudiniEngineUtils::GetErrorDescription(GetSession()));
 
 			if (Status == HAPI_STATE_READY)
 			{
@@ -497,7 +543,7 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 				LastUpdateTime = FPlatformTime::Seconds();
 
 				// Retrieve status string.
-				const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState();
+				const FString & CookStateMessage = FHoudiniEngineUtils::GetCookState(GetSession());
 
 				AddResponseMessageTaskInfo(
 					HAPI_RESULT_SUCCESS,
@@ -506,8 +552,8 @@ FHoudiniEngineScheduler::TaskCookAsset(const FHoudiniEngineTask & Task)
 					AssetId, Task, CookStateMessage);
 			}
 
-			// We want to yield.
-			FPlatformProcess::SleepNoStats(UpdateFrequency);
+			// We want to yield, briefly at first so fast cooks don't wait for a full update.
+			FPlatformProcess::SleepNoStats(PollBackoff.NextInterval());
 		}
 	}	
 
@@ -567,8 +613,8 @@ FHoudiniEngineScheduler::TaskDeleteAsset(const FHoudiniEngineTask & Task)
 		TEXT("AssetId = %d"),
 		*Task.ActorName, Task.AssetId);
 
-	if (FHoudiniEngineUtils::IsHoudiniNodeValid(Task.AssetId))
-		FHoudiniEngineUtils::DestroyHoudiniAsset(Task.AssetId);
+	if (FHoudiniEngineUtils::IsHoudiniNodeValid(Task.AssetId, GetSession()))
+		FHoudiniEngineUtils::DestroyHoudiniAsset(Task.AssetId, GetSession());
 
 	// We do not insert task info as this is a fire and forget operation.
 	// At this point component most likely does not exist.
@@ -580,7 +626,7 @@ FHoudiniEngineScheduler::AddResponseTaskInfo(
 	HAPI_NodeId AssetId, const FHoudiniEngineTask & Task)
 {
 	FHoudiniEngineTaskInfo TaskInfo(Result, AssetId, TaskType, TaskState);
-	FString StatusString = FHoudiniEngineUtils::GetErrorDescription();
+	FString StatusString = FHoudiniEngineUtils::GetErrorDescription(GetSession());
 
 	//TaskInfo.bLoadedComponent = Task.bLoadedComponent;
 
@@ -662,13 +708,15 @@ FHoudiniEngineScheduler::ProcessQueuedTasks()
 				}
 			}
 
+			NumPendingTasks--;
+
 			if (!bTaskProcessed)
 				break;
 		}
 
 		if (FPlatformProcess::SupportsMultithreading())
 		{
-			// We want to yield for a bit.
+			// We want to yield for a bit, AddTask() and Stop() wake us up right away.
 			WakeUpEvent->Wait(UpdateFrequency * 1000.0f);
 		}
 		else
@@ -737,6 +785,12 @@ bool FHoudiniEngineScheduler::HasPendingTasks()
 	return (PositionWrite != PositionRead);
 }
 
+int32
+FHoudiniEngineScheduler::GetNumPendingTasks() const
+{
+	return NumPendingTasks.load();
+}
+
 void
 FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 {
@@ -788,6 +842,7 @@ FHoudiniEngineScheduler::AddTask(const FHoudiniEngineTask & Task)
 	// Store task.
 	Tasks[PositionWrite] = Task;
 	PositionWrite++;
+	NumPendingTasks++;
 
 	// Wrap around if required.
 	PositionWrite &= (TaskCount - 1);
@@ -807,6 +862,9 @@ void
 FHoudiniEngineScheduler::Stop()
 {
 	bStopping = true;
+
+	// Don't wait for the next update to notice we're stopping
+	WakeUpEvent->Trigger();
 }
 
 void
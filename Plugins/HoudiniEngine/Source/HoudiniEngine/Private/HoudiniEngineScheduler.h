@@ -33,11 +33,34 @@
 #include "HAL/RunnableThread.h"
 #include "Misc/SingleThreadRunnable.h"
 
+#include <atomic>
+
+// Adaptive sleep interval used when polling HAPI for the status of an asynchronous instantiation or cook.
+// Starts at a sub-millisecond interval so fast cooks are picked up right away, then backs off exponentially
+// up to a maximum interval so long cooks don't flood the session with status requests.
+struct FHoudiniEnginePollBackoff
+{
+	FHoudiniEnginePollBackoff(float InMinInterval, float InMaxInterval, float InBackoffFactor);
+
+	// Returns the time (in seconds) to sleep before the next poll, and backs off the following one.
+	float NextInterval();
+
+	// Restarts from the minimum interval.
+	void Reset();
+
+private:
+
+	float MinInterval;
+	float MaxInterval;
+	float BackoffFactor;
+	float CurrentInterval;
+};
+
 class FHoudiniEngineScheduler : public FRunnable, FSingleThreadRunnable
 {
 public:
 
-	FHoudiniEngineScheduler();
+	FHoudiniEngineScheduler(int32 InSessionIndex = 0);
 	virtual ~FHoudiniEngineScheduler();
 
 	// FRunnable methods.
@@ -50,6 +73,12 @@ public:
 
 	bool HasPendingTasks();
 
+	// Returns the number of queued tasks, including the one being processed.
+	int32 GetNumPendingTasks() const;
+
+	// Index of the session this scheduler runs its tasks on.
+	int32 GetSessionIndex() const { return SessionIndex; }
+
 	// Adds a task.
 	void AddTask(const FHoudiniEngineTask & Task);
 
@@ -74,6 +103,9 @@ protected:
 	// Process queued tasks. 
 	void ProcessQueuedTasks();
 
+	// Returns the session used by this scheduler, or the main session if it is no longer available.
+	const HAPI_Session* GetSession() const;
+
 	// Task : instantiate an asset. 
 	void TaskInstantiateAsset(const FHoudiniEngineTask & Task);
 
@@ -97,9 +129,15 @@ private:
 	// Initial number of tasks in our circular queue. 
 	static const uint32 InitialTaskSize;
 
-	// Frequency update (sleep time between each update)
+	// Frequency update (max sleep time between each update)
 	static const float UpdateFrequency;
 
+	// Sleep time before the first status update of an instantiation or a cook.
+	static const float MinPollInterval;
+
+	// Factor applied to the sleep time after each status update, until it reaches UpdateFrequency.
+	static const float PollBackoffFactor;
+
 	// Synchronization primitive. 
 	FCriticalSection CriticalSection;
 
@@ -118,6 +156,12 @@ private:
 	// Size of the circular queue. 
 	uint32 TaskCount;
 
+	// Number of queued tasks, including the one being processed.
+	std::atomic<int32> NumPendingTasks;
+
+	// Index of the session this scheduler runs its tasks on.
+	int32 SessionIndex;
+
 	// Stopping flag. 
 	bool bStopping;
 };
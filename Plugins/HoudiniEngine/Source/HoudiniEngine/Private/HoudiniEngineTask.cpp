@@ -36,6 +36,7 @@ FHoudiniEngineTask::FHoudiniEngineTask()
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(-1)
 {
 	HapiGUID.Invalidate();
 	OtherNodeIds.Empty();
@@ -50,6 +51,7 @@ FHoudiniEngineTask::FHoudiniEngineTask(EHoudiniEngineTaskType InTaskType, FGuid
 	, bOutputTemplateGeos(false)
 	, AssetLibraryId(-1)
 	, AssetHapiName(-1)
+	, SessionIndex(-1)
 {
 	OtherNodeIds.Empty();
 }
@@ -108,6 +108,10 @@ struct HOUDINIENGINE_API FHoudiniEngineTask
 	// HAPI name of the asset.
 	int32 AssetHapiName;
 
+	// Index of the session (and scheduler thread) this task is pinned to.
+	// -1 lets FHoudiniEngine pick the least busy scheduler.
+	int32 SessionIndex;
+
 	// Is set to true if component has been loaded.
 	//bool bLoadedComponent;
 };
@@ -0,0 +1,655 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniEngineTelemetry.h"
+
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineOutputStats.h"
+#include "HoudiniCookable.h"
+
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Policies/PrettyJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineTelemetryEnable(
+	TEXT("HoudiniEngine.Telemetry.Enable"),
+	1,
+	TEXT("Whether the plugin collects telemetry (stage timings, HAPI bytes, objects produced) about the cooks and bakes of the HDAs.\n")
+	TEXT("0: Disabled\n")
+	TEXT("1: Enabled\n")
+	TEXT("Default is 1.")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineTelemetryBufferSize(
+	TEXT("HoudiniEngine.Telemetry.BufferSize"),
+	256,
+	TEXT("Number of cook / bake records kept by the telemetry. Once full, new records replace the oldest ones.\n")
+	TEXT("Default is 256.")
+);
+
+static FAutoConsoleCommand CCmdHoudiniEngineTelemetryDump(
+	TEXT("HoudiniEngine.Telemetry.Dump"),
+	TEXT("Logs the cook telemetry: the timings aggregated by HDA and the most recent records.\n")
+	TEXT("Optional argument: number of recent records to log (default is 10)."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		int32 NumRecentRecords = 10;
+		if (Args.Num() > 0)
+			LexFromString(NumRecentRecords, *Args[0]);
+
+		FHoudiniEngineTelemetry::Get().LogReport(NumRecentRecords);
+	}));
+
+static FAutoConsoleCommand CCmdHoudiniEngineTelemetryExport(
+	TEXT("HoudiniEngine.Telemetry.Export"),
+	TEXT("Exports the cook telemetry records.\n")
+	TEXT("Optional argument: path of the exported file, or \"csv\" / \"json\" to export to Saved/HoudiniEngine/Telemetry.\n")
+	TEXT("Files with a .csv extension are written as CSV, others as JSON (default)."),
+	FConsoleCommandWithArgsDelegate::CreateLambda([](const TArray<FString>& Args)
+	{
+		FString Extension = TEXT("json");
+		FString FilePath;
+		if (Args.Num() > 0)
+		{
+			if (Args[0].Equals(TEXT("csv"), ESearchCase::IgnoreCase) || Args[0].Equals(TEXT("json"), ESearchCase::IgnoreCase))
+				Extension = Args[0].ToLower();
+			else
+				FilePath = Args[0];
+		}
+
+		if (FilePath.IsEmpty())
+		{
+			FilePath = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("HoudiniEngine"), TEXT("Telemetry"),
+				FString::Printf(TEXT("CookTelemetry_%s.%s"), *FDateTime::Now().ToString(), *Extension));
+		}
+
+		FHoudiniEngineTelemetry::Get().ExportToFile(FilePath);
+	}));
+
+static FAutoConsoleCommand CCmdHoudiniEngineTelemetryReset(
+	TEXT("HoudiniEngine.Telemetry.Reset"),
+	TEXT("Clears the cook telemetry records."),
+	FConsoleCommandDelegate::CreateLambda([]() { FHoudiniEngineTelemetry::Get().Reset(); }));
+
+int32
+FHoudiniCookTelemetryRecord::GetNumObjectsProduced() const
+{
+	int32 NumObjects = 0;
+	for (const auto& Pair : ObjectsProduced)
+		NumObjects += Pair.Value;
+
+	return NumObjects;
+}
+
+FHoudiniEngineTelemetry&
+FHoudiniEngineTelemetry::Get()
+{
+	static FHoudiniEngineTelemetry Telemetry;
+	return Telemetry;
+}
+
+bool
+FHoudiniEngineTelemetry::IsEnabled()
+{
+	return CVarHoudiniEngineTelemetryEnable.GetValueOnAnyThread() != 0;
+}
+
+const TCHAR*
+FHoudiniEngineTelemetry::GetStageName(EHoudiniCookStage InStage)
+{
+	switch (InStage)
+	{
+		case EHoudiniCookStage::Instantiate:		return TEXT("Instantiate");
+		case EHoudiniCookStage::PreCook:			return TEXT("PreCook");
+		case EHoudiniCookStage::Cook:				return TEXT("Cook");
+		case EHoudiniCookStage::PostCook:			return TEXT("PostCook");
+		case EHoudiniCookStage::AttributeFetch:		return TEXT("AttributeFetch");
+		case EHoudiniCookStage::MeshBuild:			return TEXT("MeshBuild");
+		case EHoudiniCookStage::Instancer:			return TEXT("Instancer");
+		case EHoudiniCookStage::Landscape:			return TEXT("Landscape");
+		case EHoudiniCookStage::OutputProcessing:	return TEXT("OutputProcessing");
+		case EHoudiniCookStage::Bake:				return TEXT("Bake");
+		default:									break;
+	}
+
+	return TEXT("Unknown");
+}
+
+const TCHAR*
+FHoudiniEngineTelemetry::GetResultName(EHoudiniCookTelemetryResult InResult)
+{
+	switch (InResult)
+	{
+		case EHoudiniCookTelemetryResult::Pending:		return TEXT("Pending");
+		case EHoudiniCookTelemetryResult::Success:		return TEXT("Success");
+		case EHoudiniCookTelemetryResult::Failed:		return TEXT("Failed");
+		case EHoudiniCookTelemetryResult::Cancelled:	return TEXT("Cancelled");
+	}
+
+	return TEXT("Unknown");
+}
+
+TSharedPtr<FHoudiniEngineTelemetry::FOpenRecord>
+FHoudiniEngineTelemetry::CreateRecord(UHoudiniCookable* HC, const FString& InOperation) const
+{
+	if (!IsEnabled() || !IsValid(HC))
+		return nullptr;
+
+	TSharedPtr<FOpenRecord> OpenRecord = MakeShared<FOpenRecord>();
+	OpenRecord->StartSeconds = FPlatformTime::Seconds();
+	OpenRecord->Record.StartTime = FDateTime::Now();
+	OpenRecord->Record.CookableName = HC->GetDisplayName();
+	OpenRecord->Record.Operation = InOperation;
+	OpenRecord->Record.AssetName = HC->GetHoudiniAssetName();
+
+	return OpenRecord;
+}
+
+void
+FHoudiniEngineTelemetry::BeginRecord(UHoudiniCookable* HC, const FString& InOperation)
+{
+	TSharedPtr<FOpenRecord> OpenRecord = CreateRecord(HC, InOperation);
+	if (!OpenRecord.IsValid())
+		return;
+
+	// Drop the records of cookables that have been destroyed before finishing
+	for (auto It = OpenRecords.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().ResolveObjectPtr())
+			It.RemoveCurrent();
+	}
+
+	OpenRecords.Add(FObjectKey(HC), OpenRecord);
+}
+
+void
+FHoudiniEngineTelemetry::EndRecord(const UHoudiniCookable* HC, EHoudiniCookTelemetryResult InResult)
+{
+	TSharedPtr<FOpenRecord> OpenRecord;
+	if (OpenRecords.RemoveAndCopyValue(FObjectKey(HC), OpenRecord) && OpenRecord.IsValid())
+		CloseRecord(*OpenRecord, InResult);
+}
+
+void
+FHoudiniEngineTelemetry::CloseRecord(FOpenRecord& InOpenRecord, EHoudiniCookTelemetryResult InResult)
+{
+	const double Now = FPlatformTime::Seconds();
+	FHoudiniCookTelemetryRecord& Record = InOpenRecord.Record;
+
+	// Close the stages that are still running
+	for (int32 StageIdx = 0; StageIdx < (int32)EHoudiniCookStage::Count; StageIdx++)
+	{
+		if (InOpenRecord.StageStartSeconds[StageIdx] > 0.0)
+			Record.StageTimes[StageIdx] += Now - InOpenRecord.StageStartSeconds[StageIdx];
+	}
+
+	for (const FStageFrame& Frame : InOpenRecord.StageStack)
+		Record.StageTimes[(int32)Frame.Stage] += Now - Frame.StartTime;
+
+	InOpenRecord.StageStack.Empty();
+
+	Record.TotalTime = Now - InOpenRecord.StartSeconds;
+	Record.Result = InResult;
+
+	// The record may still be active if it is closed from within its scope (FScopedActiveCookable), so copy it
+	// instead of moving it: it stays valid until the scope pops it from the active records.
+	FScopeLock Lock(&ActiveRecordsLock);
+	AddToRingBuffer(FHoudiniCookTelemetryRecord(Record));
+}
+
+void
+FHoudiniEngineTelemetry::DiscardRecord(const UHoudiniCookable* HC)
+{
+	OpenRecords.Remove(FObjectKey(HC));
+}
+
+bool
+FHoudiniEngineTelemetry::HasOpenRecord(const UHoudiniCookable* HC) const
+{
+	return OpenRecords.Contains(FObjectKey(HC));
+}
+
+void
+FHoudiniEngineTelemetry::BeginStage(const UHoudiniCookable* HC, EHoudiniCookStage InStage)
+{
+	TSharedPtr<FOpenRecord>* OpenRecord = OpenRecords.Find(FObjectKey(HC));
+	if (OpenRecord)
+		(*OpenRecord)->StageStartSeconds[(int32)InStage] = FPlatformTime::Seconds();
+}
+
+void
+FHoudiniEngineTelemetry::EndStage(const UHoudiniCookable* HC, EHoudiniCookStage InStage)
+{
+	TSharedPtr<FOpenRecord>* OpenRecord = OpenRecords.Find(FObjectKey(HC));
+	if (!OpenRecord)
+		return;
+
+	double& StageStart = (*OpenRecord)->StageStartSeconds[(int32)InStage];
+	if (StageStart > 0.0)
+	{
+		(*OpenRecord)->Record.StageTimes[(int32)InStage] += FPlatformTime::Seconds() - StageStart;
+		StageStart = 0.0;
+	}
+}
+
+void
+FHoudiniEngineTelemetry::PushStage(EHoudiniCookStage InStage)
+{
+	if (ActiveRecords.IsEmpty())
+		return;
+
+	FOpenRecord& OpenRecord = *ActiveRecords.Last();
+	const double Now = FPlatformTime::Seconds();
+
+	// Pause the enclosing stage, stage times are exclusive
+	if (!OpenRecord.StageStack.IsEmpty())
+	{
+		FStageFrame& Parent = OpenRecord.StageStack.Last();
+		OpenRecord.Record.StageTimes[(int32)Parent.Stage] += Now - Parent.StartTime;
+	}
+
+	OpenRecord.StageStack.Add({ InStage, Now });
+}
+
+void
+FHoudiniEngineTelemetry::PopStage()
+{
+	if (ActiveRecords.IsEmpty())
+		return;
+
+	FOpenRecord& OpenRecord = *ActiveRecords.Last();
+	if (OpenRecord.StageStack.IsEmpty())
+		return;
+
+	const double Now = FPlatformTime::Seconds();
+	const FStageFrame Frame = OpenRecord.StageStack.Pop(EAllowShrinking::No);
+	OpenRecord.Record.StageTimes[(int32)Frame.Stage] += Now - Frame.StartTime;
+
+	// Resume the enclosing stage
+	if (!OpenRecord.StageStack.IsEmpty())
+		OpenRecord.StageStack.Last().StartTime = Now;
+}
+
+void
+FHoudiniEngineTelemetry::AddBytesReceived(int64 InNumBytes)
+{
+	if (!IsEnabled())
+		return;
+
+	FScopeLock Lock(&ActiveRecordsLock);
+	if (!ActiveRecords.IsEmpty())
+		FPlatformAtomics::InterlockedAdd(&ActiveRecords.Last()->Record.BytesReceived, InNumBytes);
+}
+
+void
+FHoudiniEngineTelemetry::AddBytesSent(int64 InNumBytes)
+{
+	if (!IsEnabled())
+		return;
+
+	FScopeLock Lock(&ActiveRecordsLock);
+	if (!ActiveRecords.IsEmpty())
+		FPlatformAtomics::InterlockedAdd(&ActiveRecords.Last()->Record.BytesSent, InNumBytes);
+}
+
+void
+FHoudiniEngineTelemetry::AddObjectsProduced(const UHoudiniCookable* HC, const FString& InObjectType, int32 InNumObjects)
+{
+	TSharedPtr<FOpenRecord>* OpenRecord = OpenRecords.Find(FObjectKey(HC));
+	if (OpenRecord && InNumObjects > 0)
+		(*OpenRecord)->Record.ObjectsProduced.FindOrAdd(InObjectType) += InNumObjects;
+}
+
+void
+FHoudiniEngineTelemetry::AddOutputStats(const FHoudiniEngineOutputStats& InStats)
+{
+	if (ActiveRecords.IsEmpty())
+		return;
+
+	TMap<FString, int32>& ObjectsProduced = ActiveRecords.Last()->Record.ObjectsProduced;
+	for (const TMap<FString, int32>* Objects : { &InStats.OutputObjectsCreated, &InStats.OutputObjectsUpdated, &InStats.OutputObjectsReplaced })
+	{
+		for (const auto& Pair : *Objects)
+			ObjectsProduced.FindOrAdd(Pair.Key) += Pair.Value;
+	}
+}
+
+bool
+FHoudiniEngineTelemetry::PushActiveCookable(const UHoudiniCookable* HC)
+{
+	TSharedPtr<FOpenRecord>* OpenRecord = OpenRecords.Find(FObjectKey(HC));
+	if (!OpenRecord)
+		return false;
+
+	PushActiveRecord(*OpenRecord);
+	return true;
+}
+
+void
+FHoudiniEngineTelemetry::PushActiveRecord(const TSharedPtr<FOpenRecord>& InOpenRecord)
+{
+	FScopeLock Lock(&ActiveRecordsLock);
+	ActiveRecords.Add(InOpenRecord);
+}
+
+void
+FHoudiniEngineTelemetry::PopActiveRecord()
+{
+	FScopeLock Lock(&ActiveRecordsLock);
+	if (!ActiveRecords.IsEmpty())
+		ActiveRecords.Pop(EAllowShrinking::No);
+}
+
+void
+FHoudiniEngineTelemetry::AddToRingBuffer(FHoudiniCookTelemetryRecord&& InRecord)
+{
+	const int32 Capacity = FMath::Max(1, CVarHoudiniEngineTelemetryBufferSize.GetValueOnAnyThread());
+
+	// The buffer size has changed, put the records back in order before resizing
+	if (OldestRecordIndex != 0 && Records.Num() != Capacity)
+	{
+		TArray<FHoudiniCookTelemetryRecord> OrderedRecords;
+		GetRecords(OrderedRecords);
+		Records = MoveTemp(OrderedRecords);
+		OldestRecordIndex = 0;
+	}
+
+	// Drop the oldest records if the buffer has shrunk
+	if (Records.Num() > Capacity)
+		Records.RemoveAt(0, Records.Num() - Capacity);
+
+	if (Records.Num() < Capacity)
+	{
+		Records.Add(MoveTemp(InRecord));
+	}
+	else
+	{
+		Records[OldestRecordIndex] = MoveTemp(InRecord);
+		OldestRecordIndex = (OldestRecordIndex + 1) % Capacity;
+	}
+}
+
+void
+FHoudiniEngineTelemetry::GetRecords(TArray<FHoudiniCookTelemetryRecord>& OutRecords) const
+{
+	OutRecords.Empty(Records.Num());
+	for (int32 Idx = 0; Idx < Records.Num(); Idx++)
+		OutRecords.Add(Records[(OldestRecordIndex + Idx) % Records.Num()]);
+}
+
+void
+FHoudiniEngineTelemetry::GetSummaries(TArray<FHoudiniCookTelemetrySummary>& OutSummaries) const
+{
+	OutSummaries.Empty();
+
+	TArray<FHoudiniCookTelemetryRecord> OrderedRecords;
+	GetRecords(OrderedRecords);
+	for (const FHoudiniCookTelemetryRecord& Record : OrderedRecords)
+	{
+		// Records of cookables without an asset (ie node sync) are aggregated by cookable
+		const FString& AssetName = Record.AssetName.IsEmpty() ? Record.CookableName : Record.AssetName;
+
+		FHoudiniCookTelemetrySummary* Summary = OutSummaries.FindByPredicate([&](const FHoudiniCookTelemetrySummary& S)
+		{
+			return S.AssetName == AssetName && S.Operation == Record.Operation;
+		});
+
+		if (!Summary)
+		{
+			Summary = &OutSummaries.AddDefaulted_GetRef();
+			Summary->AssetName = AssetName;
+			Summary->Operation = Record.Operation;
+		}
+
+		Summary->NumRecords++;
+		if (Record.Result != EHoudiniCookTelemetryResult::Success)
+			Summary->NumFailed++;
+
+		Summary->TotalTime += Record.TotalTime;
+		Summary->MaxTime = FMath::Max(Summary->MaxTime, Record.TotalTime);
+		for (int32 StageIdx = 0; StageIdx < (int32)EHoudiniCookStage::Count; StageIdx++)
+			Summary->StageTimes[StageIdx] += Record.StageTimes[StageIdx];
+
+		Summary->BytesReceived += Record.BytesReceived;
+		Summary->BytesSent += Record.BytesSent;
+		Summary->NumObjectsProduced += Record.GetNumObjectsProduced();
+	}
+}
+
+void
+FHoudiniEngineTelemetry::Reset()
+{
+	Records.Empty();
+	OldestRecordIndex = 0;
+}
+
+FString
+FHoudiniEngineTelemetry::ToJson() const
+{
+	TArray<FHoudiniCookTelemetryRecord> OrderedRecords;
+	GetRecords(OrderedRecords);
+
+	TArray<FHoudiniCookTelemetrySummary> Summaries;
+	GetSummaries(Summaries);
+
+	auto WriteStageTimes = [](const TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>>& Writer, const double* StageTimes)
+	{
+		Writer->WriteObjectStart(TEXT("stages"));
+		for (int32 StageIdx = 0; StageIdx < (int32)EHoudiniCookStage::Count; StageIdx++)
+			Writer->WriteValue(GetStageName((EHoudiniCookStage)StageIdx), StageTimes[StageIdx]);
+		Writer->WriteObjectEnd();
+	};
+
+	FString Json;
+	TSharedRef<TJsonWriter<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>> Writer = TJsonWriterFactory<TCHAR, TPrettyJsonPrintPolicy<TCHAR>>::Create(&Json);
+	Writer->WriteObjectStart();
+
+	Writer->WriteArrayStart(TEXT("summaries"));
+	for (const FHoudiniCookTelemetrySummary& Summary : Summaries)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("asset"), Summary.AssetName);
+		Writer->WriteValue(TEXT("operation"), Summary.Operation);
+		Writer->WriteValue(TEXT("count"), Summary.NumRecords);
+		Writer->WriteValue(TEXT("failed"), Summary.NumFailed);
+		Writer->WriteValue(TEXT("totalTime"), Summary.TotalTime);
+		Writer->WriteValue(TEXT("averageTime"), Summary.GetAverageTime());
+		Writer->WriteValue(TEXT("maxTime"), Summary.MaxTime);
+		WriteStageTimes(Writer, Summary.StageTimes);
+		Writer->WriteValue(TEXT("bytesReceived"), Summary.BytesReceived);
+		Writer->WriteValue(TEXT("bytesSent"), Summary.BytesSent);
+		Writer->WriteValue(TEXT("objectsProduced"), Summary.NumObjectsProduced);
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteArrayStart(TEXT("records"));
+	for (const FHoudiniCookTelemetryRecord& Record : OrderedRecords)
+	{
+		Writer->WriteObjectStart();
+		Writer->WriteValue(TEXT("cookable"), Record.CookableName);
+		Writer->WriteValue(TEXT("asset"), Record.AssetName);
+		Writer->WriteValue(TEXT("operation"), Record.Operation);
+		Writer->WriteValue(TEXT("result"), GetResultName(Record.Result));
+		Writer->WriteValue(TEXT("startTime"), Record.StartTime.ToIso8601());
+		Writer->WriteValue(TEXT("totalTime"), Record.TotalTime);
+		WriteStageTimes(Writer, Record.StageTimes);
+		Writer->WriteValue(TEXT("bytesReceived"), Record.BytesReceived);
+		Writer->WriteValue(TEXT("bytesSent"), Record.BytesSent);
+		Writer->WriteObjectStart(TEXT("objectsProduced"));
+		for (const auto& Pair : Record.ObjectsProduced)
+			Writer->WriteValue(Pair.Key, Pair.Value);
+		Writer->WriteObjectEnd();
+		Writer->WriteObjectEnd();
+	}
+	Writer->WriteArrayEnd();
+
+	Writer->WriteObjectEnd();
+	Writer->Close();
+
+	return Json;
+}
+
+FString
+FHoudiniEngineTelemetry::ToCsv() const
+{
+	TArray<FHoudiniCookTelemetryRecord> OrderedRecords;
+	GetRecords(OrderedRecords);
+
+	// Names may contain commas, quote them
+	auto Quote = [](const FString& InString)
+	{
+		return TEXT("\"") + InString.Replace(TEXT("\""), TEXT("\"\"")) + TEXT("\"");
+	};
+
+	FString Csv = TEXT("Cookable,Asset,Operation,Result,StartTime,TotalTime");
+	for (int32 StageIdx = 0; StageIdx < (int32)EHoudiniCookStage::Count; StageIdx++)
+		Csv += FString::Printf(TEXT(",%s"), GetStageName((EHoudiniCookStage)StageIdx));
+	Csv += TEXT(",BytesReceived,BytesSent,ObjectsProduced\n");
+
+	for (const FHoudiniCookTelemetryRecord& Record : OrderedRecords)
+	{
+		Csv += FString::Printf(TEXT("%s,%s,%s,%s,%s,%f"),
+			*Quote(Record.CookableName), *Quote(Record.AssetName), *Record.Operation,
+			GetResultName(Record.Result), *Record.StartTime.ToIso8601(), Record.TotalTime);
+
+		for (int32 StageIdx = 0; StageIdx < (int32)EHoudiniCookStage::Count; StageIdx++)
+			Csv += FString::Printf(TEXT(",%f"), Record.StageTimes[StageIdx]);
+
+		Csv += FString::Printf(TEXT(",%lld,%lld,%d\n"), Record.BytesReceived, Record.BytesSent, Record.GetNumObjectsProduced());
+	}
+
+	return Csv;
+}
+
+bool
+FHoudiniEngineTelemetry::ExportToFile(const FString& InFilePath) const
+{
+	const bool bCsv = FPaths::GetExtension(InFilePath).Equals(TEXT("csv"), ESearchCase::IgnoreCase);
+	if (!FFileHelper::SaveStringToFile(bCsv ? ToCsv() : ToJson(), *InFilePath))
+	{
+		HOUDINI_LOG_ERROR(TEXT("Failed to export the cook telemetry to %s."), *InFilePath);
+		return false;
+	}
+
+	HOUDINI_LOG_MESSAGE(TEXT("Exported %d cook telemetry records to %s."), Records.Num(), *InFilePath);
+	return true;
+}
+
+void
+FHoudiniEngineTelemetry::LogReport(int32 InNumRecentRecords) const
+{
+	TArray<FHoudiniCookTelemetrySummary> Summaries;
+	GetSummaries(Summaries);
+
+	// Slowest assets first
+	Summaries.Sort([](const FHoudiniCookTelemetrySummary& A, const FHoudiniCookTelemetrySummary& B) { return A.TotalTime > B.TotalTime; });
+
+	auto FormatStageTimes = [](const double* StageTimes, int32 InNumRecords)
+	{
+		FString Stages;
+		for (int32 StageIdx = 0; StageIdx < (int32)EHoudiniCookStage::Count; StageIdx++)
+		{
+			if (StageTimes[StageIdx] > 0.0)
+				Stages += FString::Printf(TEXT(" %s=%.3fs"), GetStageName((EHoudiniCookStage)StageIdx), StageTimes[StageIdx] / FMath::Max(1, InNumRecords));
+		}
+		return Stages;
+	};
+
+	HOUDINI_LOG_MESSAGE(TEXT("Houdini Engine cook telemetry: %d records."), Records.Num());
+	for (const FHoudiniCookTelemetrySummary& Summary : Summaries)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("  %s (%s): %d records (%d failed), average %.3fs, max %.3fs, %.2f MB received, %.2f MB sent, %d objects. Average stages:%s"),
+			*Summary.AssetName, *Summary.Operation, Summary.NumRecords, Summary.NumFailed, Summary.GetAverageTime(), Summary.MaxTime,
+			Summary.BytesReceived / 1000000.0, Summary.BytesSent / 1000000.0, Summary.NumObjectsProduced,
+			*FormatStageTimes(Summary.StageTimes, Summary.NumRecords));
+	}
+
+	TArray<FHoudiniCookTelemetryRecord> OrderedRecords;
+	GetRecords(OrderedRecords);
+
+	const int32 FirstRecord = FMath::Max(0, OrderedRecords.Num() - InNumRecentRecords);
+	if (FirstRecord < OrderedRecords.Num())
+		HOUDINI_LOG_MESSAGE(TEXT("Most recent records:"));
+
+	for (int32 Idx = FirstRecord; Idx < OrderedRecords.Num(); Idx++)
+	{
+		const FHoudiniCookTelemetryRecord& Record = OrderedRecords[Idx];
+		HOUDINI_LOG_MESSAGE(TEXT("  [%s] %s %s - %s: %.3fs, %.2f MB received, %.2f MB sent, %d objects. Stages:%s"),
+			*Record.StartTime.ToString(), *Record.CookableName, *Record.Operation, GetResultName(Record.Result), Record.TotalTime,
+			Record.BytesReceived / 1000000.0, Record.BytesSent / 1000000.0, Record.GetNumObjectsProduced(),
+			*FormatStageTimes(Record.StageTimes, 1));
+	}
+}
+
+FHoudiniEngineTelemetry::FScopedActiveCookable::FScopedActiveCookable(const UHoudiniCookable* HC)
+{
+	bPushed = FHoudiniEngineTelemetry::Get().PushActiveCookable(HC);
+}
+
+FHoudiniEngineTelemetry::FScopedActiveCookable::~FScopedActiveCookable()
+{
+	if (bPushed)
+		FHoudiniEngineTelemetry::Get().PopActiveRecord();
+}
+
+FHoudiniEngineTelemetry::FScopedStage::FScopedStage(EHoudiniCookStage InStage)
+{
+	// Stages are only timed on the game thread, where the cookables are processed
+	if (!IsInGameThread())
+		return;
+
+	FHoudiniEngineTelemetry::Get().PushStage(InStage);
+	bPushed = true;
+}
+
+FHoudiniEngineTelemetry::FScopedStage::~FScopedStage()
+{
+	if (bPushed)
+		FHoudiniEngineTelemetry::Get().PopStage();
+}
+
+FHoudiniEngineTelemetry::FScopedRecord::FScopedRecord(UHoudiniCookable* HC, const FString& InOperation)
+{
+	FHoudiniEngineTelemetry& Telemetry = FHoudiniEngineTelemetry::Get();
+	OpenRecord = Telemetry.CreateRecord(HC, InOperation);
+	if (OpenRecord.IsValid())
+		Telemetry.PushActiveRecord(OpenRecord);
+}
+
+FHoudiniEngineTelemetry::FScopedRecord::~FScopedRecord()
+{
+	if (!OpenRecord.IsValid())
+		return;
+
+	FHoudiniEngineTelemetry& Telemetry = FHoudiniEngineTelemetry::Get();
+	Telemetry.PopActiveRecord();
+	Telemetry.CloseRecord(*OpenRecord, Result);
+}
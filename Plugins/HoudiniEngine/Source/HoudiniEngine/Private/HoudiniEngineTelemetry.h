@@ -0,0 +1,275 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/DateTime.h"
+#include "UObject/ObjectKey.h"
+
+class UHoudiniCookable;
+struct FHoudiniEngineOutputStats;
+
+// Stages of the processing of a cookable, timed by the cook telemetry.
+// Stage times are exclusive: the time spent in a nested stage (ie fetching attributes while building meshes)
+// is only accounted in the nested stage.
+enum class EHoudiniCookStage : uint8
+{
+	// Instantiation of the HDA in the Houdini session
+	Instantiate,
+	// Upload of the parameters, inputs and transform before the cook
+	PreCook,
+	// Cook of the HDA in the Houdini session
+	Cook,
+	// Update of the parameters, inputs and outputs after the cook
+	PostCook,
+	// Attribute and heightfield data read from HAPI
+	AttributeFetch,
+	// Creation of the meshes and their components
+	MeshBuild,
+	// Creation of the instancers
+	Instancer,
+	// Creation of the landscapes
+	Landscape,
+	// Output processing that isn't accounted in one of the stages above
+	OutputProcessing,
+	// Bake of the outputs
+	Bake,
+
+	Count
+};
+
+enum class EHoudiniCookTelemetryResult : uint8
+{
+	Pending,
+	Success,
+	Failed,
+	Cancelled
+};
+
+// Telemetry of one cook (or bake) of a cookable
+struct HOUDINIENGINE_API FHoudiniCookTelemetryRecord
+{
+	// Display name of the cookable
+	FString CookableName;
+	// Name of the cookable's Houdini Asset, empty if it doesn't have one
+	FString AssetName;
+	// "Cook" or "Bake"
+	FString Operation;
+
+	// When the record was started
+	FDateTime StartTime;
+	// Wall time, in seconds, from the start to the end of the record
+	double TotalTime = 0.0;
+	// Exclusive time spent in each stage, in seconds
+	double StageTimes[(int32)EHoudiniCookStage::Count] = {};
+
+	// Bytes of attribute and heightfield data transferred over HAPI
+	int64 BytesReceived = 0;
+	int64 BytesSent = 0;
+
+	// Number of output objects produced, by output / object type
+	TMap<FString, int32> ObjectsProduced;
+
+	EHoudiniCookTelemetryResult Result = EHoudiniCookTelemetryResult::Pending;
+
+	double GetStageTime(EHoudiniCookStage InStage) const { return StageTimes[(int32)InStage]; }
+	int32 GetNumObjectsProduced() const;
+};
+
+// Aggregated telemetry of all the records of an asset / operation
+struct HOUDINIENGINE_API FHoudiniCookTelemetrySummary
+{
+	FString AssetName;
+	FString Operation;
+
+	int32 NumRecords = 0;
+	int32 NumFailed = 0;
+
+	double TotalTime = 0.0;
+	double MaxTime = 0.0;
+	double StageTimes[(int32)EHoudiniCookStage::Count] = {};
+
+	int64 BytesReceived = 0;
+	int64 BytesSent = 0;
+	int32 NumObjectsProduced = 0;
+
+	double GetAverageTime() const { return NumRecords > 0 ? TotalTime / NumRecords : 0.0; }
+};
+
+// Collects per-cookable cook telemetry: stage timings, bytes transferred over HAPI and objects produced.
+// Records are opened when a cookable starts cooking (or baking) and closed once its outputs have been processed.
+// Closed records are kept in a session-wide ring buffer that can be dumped to the log or exported to JSON / CSV
+// with the HoudiniEngine.Telemetry.* console commands.
+//
+// Stage timings, bytes and objects go to the "active" record: the record of the cookable currently being processed
+// by the game thread (see FScopedActiveCookable). Bytes can be added from any thread.
+struct HOUDINIENGINE_API FHoudiniEngineTelemetry
+{
+private:
+
+	struct FOpenRecord;
+
+public:
+
+	static FHoudiniEngineTelemetry& Get();
+
+	// Returns true if telemetry is being collected (HoudiniEngine.Telemetry.Enable)
+	static bool IsEnabled();
+
+	static const TCHAR* GetStageName(EHoudiniCookStage InStage);
+	static const TCHAR* GetResultName(EHoudiniCookTelemetryResult InResult);
+
+	// Opens a record for the cookable, replacing the cookable's current open record if any
+	void BeginRecord(UHoudiniCookable* HC, const FString& InOperation);
+
+	// Closes the cookable's open record and adds it to the ring buffer
+	void EndRecord(const UHoudiniCookable* HC, EHoudiniCookTelemetryResult InResult);
+
+	// Drops the cookable's open record without keeping it, ie when a cook didn't start after all
+	void DiscardRecord(const UHoudiniCookable* HC);
+
+	bool HasOpenRecord(const UHoudiniCookable* HC) const;
+
+	// Stages that span multiple ticks (instantiation, cook) are timed from their begin to their end
+	void BeginStage(const UHoudiniCookable* HC, EHoudiniCookStage InStage);
+	void EndStage(const UHoudiniCookable* HC, EHoudiniCookStage InStage);
+
+	// Stages that run within a single call are timed with FScopedStage / H_SCOPED_COOK_STAGE
+	void PushStage(EHoudiniCookStage InStage);
+	void PopStage();
+
+	// Bytes transferred over HAPI, can be called from any thread
+	void AddBytesReceived(int64 InNumBytes);
+	void AddBytesSent(int64 InNumBytes);
+
+	// Objects produced by the cookable, added to its open record
+	void AddObjectsProduced(const UHoudiniCookable* HC, const FString& InObjectType, int32 InNumObjects);
+
+	// Objects created, updated or replaced, added to the active record (ie for bakes)
+	void AddOutputStats(const FHoudiniEngineOutputStats& InStats);
+
+	// Copies the records of the ring buffer, oldest first
+	void GetRecords(TArray<FHoudiniCookTelemetryRecord>& OutRecords) const;
+
+	// Aggregates the records of the ring buffer by asset and operation
+	void GetSummaries(TArray<FHoudiniCookTelemetrySummary>& OutSummaries) const;
+
+	int32 Num() const { return Records.Num(); }
+
+	// Empties the ring buffer. Open records are kept.
+	void Reset();
+
+	FString ToJson() const;
+	FString ToCsv() const;
+
+	// Writes the records to a file, as CSV if the file has a .csv extension, as JSON otherwise
+	bool ExportToFile(const FString& InFilePath) const;
+
+	// Logs the summaries and the most recent records
+	void LogReport(int32 InNumRecentRecords = 10) const;
+
+	// Sets the cookable whose open record is active for the lifetime of this object
+	struct HOUDINIENGINE_API FScopedActiveCookable
+	{
+		FScopedActiveCookable(const UHoudiniCookable* HC);
+		~FScopedActiveCookable();
+
+	private:
+		bool bPushed = false;
+	};
+
+	// Times a stage of the active record for the lifetime of this object
+	struct HOUDINIENGINE_API FScopedStage
+	{
+		FScopedStage(EHoudiniCookStage InStage);
+		~FScopedStage();
+
+	private:
+		bool bPushed = false;
+	};
+
+	// Opens a record and makes it active for the lifetime of this object.
+	// The record is independent of the cookable's open record, if any.
+	struct HOUDINIENGINE_API FScopedRecord
+	{
+		FScopedRecord(UHoudiniCookable* HC, const FString& InOperation);
+		~FScopedRecord();
+
+		void SetResult(EHoudiniCookTelemetryResult InResult) { Result = InResult; }
+
+	private:
+		TSharedPtr<FOpenRecord> OpenRecord;
+		EHoudiniCookTelemetryResult Result = EHoudiniCookTelemetryResult::Success;
+	};
+
+private:
+
+	struct FStageFrame
+	{
+		EHoudiniCookStage Stage;
+		double StartTime;
+	};
+
+	struct FOpenRecord
+	{
+		FHoudiniCookTelemetryRecord Record;
+		double StartSeconds = 0.0;
+
+		// Start of the stages timed with BeginStage / EndStage, 0 if not started
+		double StageStartSeconds[(int32)EHoudiniCookStage::Count] = {};
+
+		// Stages timed with PushStage / PopStage, innermost last
+		TArray<FStageFrame> StageStack;
+	};
+
+	TSharedPtr<FOpenRecord> CreateRecord(UHoudiniCookable* HC, const FString& InOperation) const;
+
+	// Closes the stages of a record and adds it to the ring buffer
+	void CloseRecord(FOpenRecord& InOpenRecord, EHoudiniCookTelemetryResult InResult);
+
+	bool PushActiveCookable(const UHoudiniCookable* HC);
+	void PushActiveRecord(const TSharedPtr<FOpenRecord>& InOpenRecord);
+	void PopActiveRecord();
+
+	// Adds a closed record to the ring buffer, overwriting the oldest one when full
+	void AddToRingBuffer(FHoudiniCookTelemetryRecord&& InRecord);
+
+	// Open records, by cookable
+	TMap<FObjectKey, TSharedPtr<FOpenRecord>> OpenRecords;
+
+	// Records receiving stage timings, bytes and objects, the last one is active
+	TArray<TSharedPtr<FOpenRecord>> ActiveRecords;
+
+	// Guards ActiveRecords against the worker threads adding bytes
+	mutable FCriticalSection ActiveRecordsLock;
+
+	// Ring buffer of the closed records
+	TArray<FHoudiniCookTelemetryRecord> Records;
+	// Index of the oldest record once the buffer is full
+	int32 OldestRecordIndex = 0;
+};
@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include "HoudiniEngineTelemetry.h"
+
 // Adds a new cpu profile event with the name of the function
 #define H_SCOPED_FUNCTION_TIMER() \
 				TRACE_CPUPROFILER_EVENT_SCOPE_STR(__FUNCTION__)
@@ -39,3 +41,7 @@
 #define H_SCOPED_FUNCTION_STATIC_LABEL(__LABEL) \
 				TRACE_CPUPROFILER_EVENT_SCOPE_STR(__LABEL)
 
+// Accounts the time spent in the current scope to a stage of the cook telemetry
+// of the cookable being processed. See FHoudiniEngineTelemetry.
+#define H_SCOPED_COOK_STAGE(__STAGE) \
+				FHoudiniEngineTelemetry::FScopedStage PREPROCESSOR_JOIN(HoudiniCookStage_, __LINE__)(EHoudiniCookStage::__STAGE)
@@ -95,6 +95,7 @@
 
 #include "HoudiniEngineAttributes.h"
 #include "Serialization/JsonSerializer.h"
+#include "Hash/xxhash.h"
 
 #if WITH_EDITOR
 	#include "EditorFramework/AssetImportData.h"
@@ -112,6 +113,12 @@ TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer(
 	TEXT("When enabled, the plugin will output timings during the Mesh creation.\n")
 );
 
+TAutoConsoleVariable<int32> CVarHoudiniEngineMeshPartContentHash(
+	TEXT("HoudiniEngine.MeshPartContentHash"),
+	1,
+	TEXT("When enabled, the content of recooked mesh parts is hashed so that meshes created from parts that did not change are reused instead of being rebuilt.\n")
+);
+
 FHoudiniEngineUtils::FOnHoudiniProxyMeshesRefinedDelegate FHoudiniEngineUtils::OnHoudiniProxyMeshesRefinedDelegate = FHoudiniEngineUtils::FOnHoudiniProxyMeshesRefinedDelegate();
 
 // HAPI_Result strings
@@ -274,9 +281,9 @@ FHoudiniEngineUtils::GetErrorDescription(HAPI_Result Result)
 }
 
 const FString
-FHoudiniEngineUtils::GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity)
+FHoudiniEngineUtils::GetStatusString(HAPI_StatusType status_type, HAPI_StatusVerbosity verbosity, const HAPI_Session* InSession)
 {
-	const HAPI_Session* SessionPtr = FHoudiniEngine::Get().GetSession();
+	const HAPI_Session* SessionPtr = InSession ? InSession : FHoudiniEngine::Get().GetSession();
 	if (!SessionPtr)
 	{
 		// No valid session
@@ -333,21 +340,21 @@ FHoudiniEngineUtils::HapiGetString(int32 StringHandle)
 
 
 const FString
-FHoudiniEngineUtils::GetCookResult()
+FHoudiniEngineUtils::GetCookResult(const HAPI_Session* InSession)
 {
-	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_RESULT, HAPI_STATUSVERBOSITY_MESSAGES);
+	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_RESULT, HAPI_STATUSVERBOSITY_MESSAGES, InSession);
 }
 
 const FString
-FHoudiniEngineUtils::GetCookState()
+FHoudiniEngineUtils::GetCookState(const HAPI_Session* InSession)
 {
-	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS);
+	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_COOK_STATE, HAPI_STATUSVERBOSITY_ERRORS, InSession);
 }
 
 const FString
-FHoudiniEngineUtils::GetErrorDescription()
+FHoudiniEngineUtils::GetErrorDescription(const HAPI_Session* InSession)
 {
-	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_CALL_RESULT, HAPI_STATUSVERBOSITY_ERRORS);
+	return FHoudiniEngineUtils::GetStatusString(HAPI_STATUS_CALL_RESULT, HAPI_STATUSVERBOSITY_ERRORS, InSession);
 }
 
 const FString
@@ -1608,23 +1615,25 @@ FHoudiniEngineUtils::IsInitialized()
 }
 
 bool
-FHoudiniEngineUtils::IsHoudiniNodeValid(HAPI_NodeId NodeId)
+FHoudiniEngineUtils::IsHoudiniNodeValid(HAPI_NodeId NodeId, const HAPI_Session* InSession)
 {
 	if (NodeId < 0)
 		return false;
 
+	const HAPI_Session* SessionPtr = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+
 	HAPI_NodeInfo NodeInfo;
 	FHoudiniApi::NodeInfo_Init(&NodeInfo);
 	bool ValidationAnswer = true;
 
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetNodeInfo(
-		FHoudiniEngine::Get().GetSession(), NodeId, &NodeInfo))
+		SessionPtr, NodeId, &NodeInfo))
 	{
 		return false;
 	}
 
 	if (HAPI_RESULT_SUCCESS != FHoudiniApi::IsNodeValid(
-		FHoudiniEngine::Get().GetSession(), NodeId,
+		SessionPtr, NodeId,
 		NodeInfo.uniqueHoudiniNodeId, &ValidationAnswer))
 	{
 		return false;
@@ -1643,10 +1652,10 @@ FHoudiniEngineUtils::HapiDisconnectAsset(HAPI_NodeId HostAssetId, int32 InputInd
 }
 
 bool
-FHoudiniEngineUtils::DestroyHoudiniAsset(HAPI_NodeId AssetId)
+FHoudiniEngineUtils::DestroyHoudiniAsset(HAPI_NodeId AssetId, const HAPI_Session* InSession)
 {
 	if (HAPI_RESULT_SUCCESS == FHoudiniApi::DeleteNode(
-		FHoudiniEngine::Get().GetSession(), AssetId))
+		InSession ? InSession : FHoudiniEngine::Get().GetSession(), AssetId))
 	{
 		return true;
 	}
@@ -7241,13 +7250,16 @@ FHoudiniEngineUtils::CreateNode(
 	const FString& InOperatorName,
 	const FString& InNodeLabel,
 	HAPI_Bool bInCookOnCreation,
-	HAPI_NodeId* OutNewNodeId)
+	HAPI_NodeId* OutNewNodeId,
+	const HAPI_Session* InSession)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::CreateNode);
 
+	const HAPI_Session* SessionPtr = InSession ? InSession : FHoudiniEngine::Get().GetSession();
+
 	// Call HAPI::CreateNode
 	HAPI_Result Result = FHoudiniApi::CreateNode(
-		FHoudiniEngine::Get().GetSession(),
+		SessionPtr,
 		InParentNodeId, H_TCHAR_TO_UTF8(*InOperatorName), H_TCHAR_TO_UTF8(*InNodeLabel), bInCookOnCreation, OutNewNodeId);
 
 	// Return now if CreateNode failed
@@ -7259,7 +7271,7 @@ FHoudiniEngineUtils::CreateNode(
 	while (CurrentStatus > HAPI_State::HAPI_STATE_MAX_READY_STATE)
 	{
 		if (HAPI_RESULT_SUCCESS != FHoudiniApi::GetStatus(
-			FHoudiniEngine::Get().GetSession(),
+			SessionPtr,
 			HAPI_StatusType::HAPI_STATUS_COOK_STATE, &CurrentStatus))
 		{
 			// Exit the loop if GetStatus somehow fails
@@ -7300,6 +7312,214 @@ FHoudiniEngineUtils::HapiGetCookCount(HAPI_NodeId InNodeId)
 	return CookCount;
 }
 
+template<typename DataType>
+static bool
+HashPartAttributeData(FHoudiniHapiAccessor& InAccessor, const HAPI_AttributeInfo& InAttribInfo, FXxHash64Builder& InOutBuilder)
+{
+	TArray<DataType> Data;
+	if (!InAccessor.GetAttributeData(InAttribInfo, Data))
+		return false;
+
+	InOutBuilder.Update(Data.GetData(), Data.Num() * sizeof(DataType));
+	return true;
+}
+
+template<>
+bool
+HashPartAttributeData<FString>(FHoudiniHapiAccessor& InAccessor, const HAPI_AttributeInfo& InAttribInfo, FXxHash64Builder& InOutBuilder)
+{
+	TArray<FString> Data;
+	if (!InAccessor.GetAttributeData(InAttribInfo, Data))
+		return false;
+
+	for (const FString& Value : Data)
+	{
+		const int32 Len = Value.Len();
+		InOutBuilder.Update(&Len, sizeof(Len));
+		InOutBuilder.Update(*Value, Len * sizeof(TCHAR));
+	}
+
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetPartContentHash(
+	HAPI_NodeId InGeoId,
+	HAPI_PartId InPartId,
+	uint64& OutHash)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::HapiGetPartContentHash);
+
+	OutHash = 0;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(Session, InGeoId, InPartId, &PartInfo), false);
+
+	FXxHash64Builder Builder;
+
+	// Part counts
+	const int32 Counts[] = {
+		(int32)PartInfo.type, PartInfo.faceCount, PartInfo.vertexCount, PartInfo.pointCount,
+		PartInfo.attributeCounts[HAPI_ATTROWNER_VERTEX], PartInfo.attributeCounts[HAPI_ATTROWNER_POINT],
+		PartInfo.attributeCounts[HAPI_ATTROWNER_PRIM], PartInfo.attributeCounts[HAPI_ATTROWNER_DETAIL],
+		PartInfo.isInstanced ? 1 : 0 };
+	Builder.Update(Counts, sizeof(Counts));
+
+	// Vertex list
+	if (PartInfo.vertexCount > 0)
+	{
+		TArray<int32> VertexList;
+		VertexList.SetNumUninitialized(PartInfo.vertexCount);
+		HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetVertexList(
+			Session, InGeoId, InPartId, VertexList.GetData(), 0, PartInfo.vertexCount), false);
+		Builder.Update(VertexList.GetData(), VertexList.Num() * sizeof(int32));
+	}
+
+	// Point and prim groups, used for splits, colliders, LODs, sockets...
+	const HAPI_GroupType GroupTypes[] = { HAPI_GROUPTYPE_POINT, HAPI_GROUPTYPE_PRIM };
+	for (const HAPI_GroupType GroupType : GroupTypes)
+	{
+		TArray<FString> GroupNames;
+		if (!FHoudiniEngineUtils::HapiGetGroupNames(InGeoId, InPartId, GroupType, PartInfo.isInstanced, GroupNames))
+			continue;
+
+		for (const FString& GroupName : GroupNames)
+		{
+			Builder.Update(*GroupName, GroupName.Len() * sizeof(TCHAR));
+
+			bool bAllEquals = false;
+			TArray<int32> GroupMembership;
+			if (FHoudiniEngineUtils::HapiGetGroupMembership(InGeoId, PartInfo, GroupType, GroupName, GroupMembership, bAllEquals))
+				Builder.Update(GroupMembership.GetData(), GroupMembership.Num() * sizeof(int32));
+		}
+	}
+
+	// Attributes
+	const HAPI_AttributeOwner Owners[] = { HAPI_ATTROWNER_VERTEX, HAPI_ATTROWNER_POINT, HAPI_ATTROWNER_PRIM, HAPI_ATTROWNER_DETAIL };
+	for (const HAPI_AttributeOwner Owner : Owners)
+	{
+		TArray<FString> AttributeNames = FHoudiniEngineUtils::GetAttributeNames(Session, InGeoId, InPartId, Owner);
+		for (const FString& AttributeName : AttributeNames)
+		{
+			FHoudiniHapiAccessor Accessor(InGeoId, InPartId, H_TCHAR_TO_UTF8(*AttributeName));
+			HAPI_AttributeInfo AttribInfo;
+			if (!Accessor.GetInfo(AttribInfo, Owner))
+				continue;
+
+			Builder.Update(*AttributeName, AttributeName.Len() * sizeof(TCHAR));
+			const int32 AttribCounts[] = {
+				(int32)AttribInfo.owner, (int32)AttribInfo.storage, (int32)AttribInfo.typeInfo,
+				AttribInfo.count, AttribInfo.tupleSize, AttribInfo.totalArrayElements };
+			Builder.Update(AttribCounts, sizeof(AttribCounts));
+
+			bool bHashed = true;
+			switch (AttribInfo.storage)
+			{
+				case HAPI_STORAGETYPE_INT:
+					bHashed = HashPartAttributeData<int32>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_INT64:
+					bHashed = HashPartAttributeData<int64>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_UINT8:
+					bHashed = HashPartAttributeData<uint8>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_INT8:
+					bHashed = HashPartAttributeData<int8>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_INT16:
+					bHashed = HashPartAttributeData<int16>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_FLOAT:
+					bHashed = HashPartAttributeData<float>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_FLOAT64:
+					bHashed = HashPartAttributeData<double>(Accessor, AttribInfo, Builder);
+					break;
+				case HAPI_STORAGETYPE_STRING:
+					bHashed = HashPartAttributeData<FString>(Accessor, AttribInfo, Builder);
+					break;
+				default:
+					// Array and dictionary attributes aren't used by mesh outputs,
+					// their sizes hashed above are enough to detect most changes.
+					break;
+			}
+
+			// If we fail to read some data, we can't tell if the part has changed
+			if (!bHashed)
+				return false;
+		}
+	}
+
+	OutHash = Builder.Finalize().Hash;
+	return true;
+}
+
+bool
+FHoudiniEngineUtils::HapiGetPartLayoutHash(
+	HAPI_NodeId InGeoId,
+	HAPI_PartId InPartId,
+	uint64& OutHash)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniEngineUtils::HapiGetPartLayoutHash);
+
+	OutHash = 0;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+	HAPI_PartInfo PartInfo;
+	FHoudiniApi::PartInfo_Init(&PartInfo);
+	HOUDINI_CHECK_ERROR_RETURN(FHoudiniApi::GetPartInfo(Session, InGeoId, InPartId, &PartInfo), false);
+
+	FXxHash64Builder Builder;
+
+	// Part counts
+	const int32 Counts[] = {
+		(int32)PartInfo.type, PartInfo.faceCount, PartInfo.vertexCount, PartInfo.pointCount,
+		PartInfo.attributeCounts[HAPI_ATTROWNER_VERTEX], PartInfo.attributeCounts[HAPI_ATTROWNER_POINT],
+		PartInfo.attributeCounts[HAPI_ATTROWNER_PRIM], PartInfo.attributeCounts[HAPI_ATTROWNER_DETAIL],
+		PartInfo.isInstanced ? 1 : 0 };
+	Builder.Update(Counts, sizeof(Counts));
+
+	// Point and prim group names, but not their membership
+	const HAPI_GroupType GroupTypes[] = { HAPI_GROUPTYPE_POINT, HAPI_GROUPTYPE_PRIM };
+	for (const HAPI_GroupType GroupType : GroupTypes)
+	{
+		TArray<FString> GroupNames;
+		if (!FHoudiniEngineUtils::HapiGetGroupNames(InGeoId, InPartId, GroupType, PartInfo.isInstanced, GroupNames))
+			continue;
+
+		for (const FString& GroupName : GroupNames)
+			Builder.Update(*GroupName, GroupName.Len() * sizeof(TCHAR));
+	}
+
+	// Attribute names and infos, but not their data
+	const HAPI_AttributeOwner Owners[] = { HAPI_ATTROWNER_VERTEX, HAPI_ATTROWNER_POINT, HAPI_ATTROWNER_PRIM, HAPI_ATTROWNER_DETAIL };
+	for (const HAPI_AttributeOwner Owner : Owners)
+	{
+		TArray<FString> AttributeNames = FHoudiniEngineUtils::GetAttributeNames(Session, InGeoId, InPartId, Owner);
+		for (const FString& AttributeName : AttributeNames)
+		{
+			FHoudiniHapiAccessor Accessor(InGeoId, InPartId, H_TCHAR_TO_UTF8(*AttributeName));
+			HAPI_AttributeInfo AttribInfo;
+			if (!Accessor.GetInfo(AttribInfo, Owner))
+				continue;
+
+			Builder.Update(*AttributeName, AttributeName.Len() * sizeof(TCHAR));
+			const int32 AttribCounts[] = {
+				(int32)AttribInfo.owner, (int32)AttribInfo.storage, (int32)AttribInfo.typeInfo,
+				AttribInfo.count, AttribInfo.tupleSize, AttribInfo.totalArrayElements };
+			Builder.Update(AttribCounts, sizeof(AttribCounts));
+		}
+	}
+
+	OutHash = Builder.Finalize().Hash;
+	return true;
+}
+
 bool
 FHoudiniEngineUtils::GetLevelPathAttribute(
 	HAPI_NodeId InGeoId,
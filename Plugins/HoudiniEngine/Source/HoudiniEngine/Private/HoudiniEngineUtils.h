@@ -61,6 +61,7 @@ TArray<char> HOUDINIENGINE_API HoudiniTCHARToUTF(const TCHAR * Text);
 #define H_TCHAR_TO_UTF8(_H_UNREAL_STRING) HoudiniTCHARToUTF(_H_UNREAL_STRING).GetData()
 
 extern TAutoConsoleVariable<float> CVarHoudiniEngineMeshBuildTimer;
+extern TAutoConsoleVariable<int32> CVarHoudiniEngineMeshPartContentHash;
 
 class FHoudiniParameterWidgetMetaData : public ISlateMetaData
 {
@@ -134,21 +135,24 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 		static HAPI_Result HapiCommitGeo(HAPI_NodeId InNodeId);
 
 		// Return a specified HAPI status string.
+		// Uses the main session if InSession is null.
 		static const FString GetStatusString(
 			HAPI_StatusType status_type, 
-			HAPI_StatusVerbosity verbosity);
+			HAPI_StatusVerbosity verbosity,
+			const HAPI_Session* InSession = nullptr);
 
 		// HAPI : Return the string that corresponds to the given string handle.
 		static FString HapiGetString(int32 StringHandle);
 
 		// Return a string representing cooking result.
-		static const FString GetCookResult();
+		static const FString GetCookResult(const HAPI_Session* InSession = nullptr);
 
 		// Return a string indicating cook state.
-		static const FString GetCookState();
+		static const FString GetCookState(const HAPI_Session* InSession = nullptr);
 
 		// Return a string error description.
-		static const FString GetErrorDescription();
+		// Uses the main session if InSession is null.
+		static const FString GetErrorDescription(const HAPI_Session* InSession = nullptr);
 
 		// Return a string description of error from a given error code.
 		static const FString GetErrorDescription(HAPI_Result Result);
@@ -179,15 +183,31 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 
 		// Wrapper for the CreateNode function
 		// As HAPI_CreateNode is an async call, this function actually waits for the node creation to be done before returning
+		// Uses the main session if InSession is null.
 		static HAPI_Result CreateNode(
 			HAPI_NodeId InParentNodeId, 
 			const FString& InOperatorName,
 			const FString& InNodeLabel,
 			HAPI_Bool bInCookOnCreation, 
-			HAPI_NodeId* OutNewNodeId);
+			HAPI_NodeId* OutNewNodeId,
+			const HAPI_Session* InSession = nullptr);
 
 		static int32 HapiGetCookCount(HAPI_NodeId InNodeId);
 
+		// HAPI : Hash the content of a part: its counts, vertex list, groups and the data of all its attributes.
+		// Unlike the cook count, which is per node, this lets us detect which parts of a recooked geo actually changed.
+		static bool HapiGetPartContentHash(
+			HAPI_NodeId InGeoId,
+			HAPI_PartId InPartId,
+			uint64& OutHash);
+
+		// HAPI : Hash the layout of a part: its counts, group names and the names and infos of its attributes.
+		// Doesn't read any geometry data, so it is a cheap way to tell that a part has changed before hashing its content.
+		static bool HapiGetPartLayoutHash(
+			HAPI_NodeId InGeoId,
+			HAPI_PartId InPartId,
+			uint64& OutHash);
+
 		// HAPI : Retrieve the asset node's object transform. **/
 		static bool HapiGetAssetTransform(
 			HAPI_NodeId InNodeId,
@@ -236,7 +256,8 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			TArray<FVector>& OutVectorData);
 
 		// Return true if asset is valid.
-		static bool IsHoudiniNodeValid(HAPI_NodeId AssetId);
+		// Uses the main session if InSession is null.
+		static bool IsHoudiniNodeValid(HAPI_NodeId AssetId, const HAPI_Session* InSession = nullptr);
 
 		// HAPI : Retrieve HAPI_ObjectInfo's from given asset node id.
 		static bool HapiGetObjectInfos(
@@ -506,7 +527,8 @@ struct HOUDINIENGINE_API FHoudiniEngineUtils
 			int32 InputIndex);
 
 		// Destroy asset, returns the status.
-		static bool DestroyHoudiniAsset(HAPI_NodeId AssetId);
+		// Uses the main session if InSession is null.
+		static bool DestroyHoudiniAsset(HAPI_NodeId AssetId, const HAPI_Session* InSession = nullptr);
 
 		// Deletes the specified HAPI node by id.
 		static bool DeleteHoudiniNode(HAPI_NodeId InNodeId);
@@ -279,6 +279,9 @@ UHoudiniGeoImporter::CreateStaticMeshes(
 		TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>>& AssignementMaterials = CurOutput->GetAssignementMaterials();
 		TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>>& ReplacementMaterials = CurOutput->GetReplacementMaterials();
 
+		// The static meshes of all the parts are built together once they have all been created
+		FHoudiniPendingStaticMeshBuilds PendingBuilds;
+
 		// Iterate on all of the output's HGPO, creating meshes as we go
 		for (const FHoudiniGeoPartObject& CurHGPO : CurOutput->GetHoudiniGeoPartObjects())
 		{
@@ -291,6 +294,7 @@ UHoudiniGeoImporter::CreateStaticMeshes(
 			UObject* const OuterComponent = nullptr;
 			constexpr bool bForceRebuild = true;
 			constexpr bool bSplitMeshSupport = false;
+			constexpr bool bTreatExistingMaterialsAsUpToDate = false;
 			FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 				CurHGPO,
 				PackageParams,
@@ -304,7 +308,10 @@ UHoudiniGeoImporter::CreateStaticMeshes(
 				EHoudiniStaticMeshMethod::FMeshDescription,
 				bSplitMeshSupport,
 				InStaticMeshGenerationProperties,
-				InMeshBuildSettings);
+				InMeshBuildSettings,
+				bTreatExistingMaterialsAsUpToDate,
+				nullptr,
+				&PendingBuilds);
 
 			for (auto& CurMat : AssignementMaterials)
 			{
@@ -315,6 +322,9 @@ UHoudiniGeoImporter::CreateStaticMeshes(
 			}
 		}
 
+		// Build the static meshes of all the parts in a single batch
+		FHoudiniMeshTranslator::BuildPendingStaticMeshes(PendingBuilds);
+
 		// Add all output objects and materials
 		for (auto CurOutputPair : NewOutputObjects)
 		{
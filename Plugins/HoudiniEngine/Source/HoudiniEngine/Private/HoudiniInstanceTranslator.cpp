@@ -29,6 +29,7 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineRuntimeUtils.h"
 #include "HoudiniEngineString.h"
+#include "HoudiniEngineTimers.h"
 #include "HoudiniEngineUtils.h"
 #include "HoudiniEnginePrivatePCH.h"
 #include "HoudiniGenericAttribute.h"
@@ -140,6 +141,7 @@ FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(
 	const TMap<FHoudiniOutputObjectIdentifier, FHoudiniInstancerPartData>* InPreBuiltInstancedOutputPartData)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs);
+	H_SCOPED_COOK_STAGE(Instancer);
 
 	USceneComponent* ParentComponent = Cast<USceneComponent>(InOuterComponent);
 	if (!ParentComponent)
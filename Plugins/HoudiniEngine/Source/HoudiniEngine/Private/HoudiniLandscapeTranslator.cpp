@@ -87,6 +87,7 @@ FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
 	TArray<UPackage*>& OutCreatedPackages)
 {
 	H_SCOPED_FUNCTION_TIMER();
+	H_SCOPED_COOK_STAGE(Landscape);
 
 	FHoudiniLandscapeSettings LandscapeSettings;
 
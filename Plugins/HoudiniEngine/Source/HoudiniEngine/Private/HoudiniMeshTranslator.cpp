@@ -34,7 +34,9 @@
 #include "HoudiniGeoPartObject.h"
 #include "HoudiniGenericAttribute.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniEngineOutputStats.h"
 #include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniEngineTimers.h"
 #include "HoudiniMaterialTranslator.h"
 #include "HoudiniAssetActor.h"
 #include "HoudiniInstanceTranslator.h"
@@ -67,6 +69,9 @@
 #include "Components/SkeletalMeshComponent.h"
 
 #include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "Async/ParallelFor.h"
+
+#include <atomic>
 
 #include "EditorSupportDelegates.h"
 #include "HoudiniGeometryCollectionTranslator.h"
@@ -96,6 +101,7 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	bool bInDestroyProxies)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput);
+	H_SCOPED_COOK_STAGE(MeshBuild);
 
 	if (!IsValid(InOutput))
 		return false;
@@ -111,6 +117,12 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>>& AssignementMaterials = InOutput->GetAssignementMaterials();
 	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>>& ReplacementMaterials = InOutput->GetReplacementMaterials();
 
+	// Collects the static mesh build timings of the whole output
+	FHoudiniEngineOutputStats MeshBuildStats;
+
+	// The static meshes of all the parts are built together once they have all been created
+	FHoudiniPendingStaticMeshBuilds PendingBuilds;
+
 	bool InForceRebuild = false; 
 	if (InOutput->HasAnyCurrentProxy() && InStaticMeshMethod != EHoudiniStaticMeshMethod::UHoudiniStaticMesh)
 	{
@@ -159,7 +171,23 @@ FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 			bSplitMeshSupport,
 			InSMGenerationProperties,
 			InMeshBuildSettings,
-			bInTreatExistingMaterialsAsUpToDate);
+			bInTreatExistingMaterialsAsUpToDate,
+			&MeshBuildStats,
+			&PendingBuilds);
+	}
+
+	// Build the static meshes of all the parts in a single batch
+	FHoudiniMeshTranslator::BuildPendingStaticMeshes(PendingBuilds, &MeshBuildStats);
+
+	if (CVarHoudiniEngineMeshBuildTimer.GetValueOnAnyThread() != 0.0)
+	{
+		for (const auto& CurrentTimings : MeshBuildStats.MeshBuildTimings)
+		{
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Static Mesh %s: prepared in %f seconds, built in a batch of %d meshes in %f seconds."),
+				*CurrentTimings.Key, CurrentTimings.Value.PrepareTime,
+				CurrentTimings.Value.NumMeshesInBuild, CurrentTimings.Value.BuildTime);
+		}
 	}
 
 	return FHoudiniMeshTranslator::CreateOrUpdateAllComponents(
@@ -714,7 +742,9 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	bool bSplitMeshSupport,
 	const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 	const FMeshBuildSettings& InSMBuildSettings,
-	bool bInTreatExistingMaterialsAsUpToDate)
+	bool bInTreatExistingMaterialsAsUpToDate,
+	FHoudiniEngineOutputStats* OutStats,
+	FHoudiniPendingStaticMeshBuilds* OutPendingBuilds)
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject);
 
@@ -727,6 +757,65 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 		return true;
 	}
 
+	// The geo has recooked, but that doesn't mean this part has changed.
+	// Compare the part's hashes with the ones of the meshes we created for it last time.
+	// Hashing the content reads the data of all the part's attributes, so it is done once per cook: before building
+	// when the part's layout hasn't changed (to compare it), or after building the part otherwise.
+	// When rebuilding is forced, there's no need to hash the part at all.
+	uint64 PartLayoutHash = 0;
+	uint64 PartContentHash = 0;
+	bool bHasPartContentHash = false;
+	const bool bHasPartLayoutHash = !InForceRebuild
+		&& CVarHoudiniEngineMeshPartContentHash.GetValueOnAnyThread() != 0
+		&& FHoudiniEngineUtils::HapiGetPartLayoutHash(InHGPO.GeoId, InHGPO.PartId, PartLayoutHash);
+
+	if (bHasPartLayoutHash)
+	{
+		TArray<FHoudiniOutputObjectIdentifier> PartIdentifiers;
+		bool bSameLayout = true;
+		for (const auto& CurrentPair : InOutputObjects)
+		{
+			if (!CurrentPair.Key.Matches(InHGPO))
+				continue;
+
+			if (CurrentPair.Value.PartLayoutHash != PartLayoutHash)
+			{
+				bSameLayout = false;
+				break;
+			}
+
+			PartIdentifiers.Add(CurrentPair.Key);
+		}
+
+		if (bSameLayout && PartIdentifiers.Num() > 0)
+			bHasPartContentHash = FHoudiniEngineUtils::HapiGetPartContentHash(InHGPO.GeoId, InHGPO.PartId, PartContentHash);
+
+		bool bCanReusePart = bHasPartContentHash && !InHGPO.bHasMaterialsChanged;
+		for (int32 Idx = 0; bCanReusePart && Idx < PartIdentifiers.Num(); Idx++)
+		{
+			const FHoudiniOutputObject& CurrentObject = InOutputObjects[PartIdentifiers[Idx]];
+			if (CurrentObject.PartContentHash != PartContentHash
+				|| (CurrentObject.OutputObject && !IsValid(CurrentObject.OutputObject))
+				|| (CurrentObject.ProxyObject && !IsValid(CurrentObject.ProxyObject)))
+			{
+				bCanReusePart = false;
+			}
+		}
+
+		if (bCanReusePart && PartIdentifiers.Num() > 0)
+		{
+			// Only reuse this part's meshes, the other parts of the geo may have been rebuilt already
+			for (const FHoudiniOutputObjectIdentifier& PartIdentifier : PartIdentifiers)
+				OutOutputObjects.Add(PartIdentifier, InOutputObjects[PartIdentifier]);
+
+			HOUDINI_LOG_MESSAGE(
+				TEXT("Creating Static Meshes: Object [%d %s], Geo [%d], Part [%d %s] has not changed - reusing %d existing mesh(es)."),
+				InHGPO.ObjectId, *InHGPO.ObjectName, InHGPO.GeoId, InHGPO.PartId, *InHGPO.PartName, PartIdentifiers.Num());
+
+			return true;
+		}
+	}
+
 	// Create a new mesh translator to handle the output data creation
 	FHoudiniMeshTranslator CurrentTranslator;
 	CurrentTranslator.ForceRebuild = InForceRebuild;
@@ -741,6 +830,8 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	CurrentTranslator.SetStaticMeshGenerationProperties(InSMGenerationProperties);
 	CurrentTranslator.SetStaticMeshBuildSettings(InSMBuildSettings);
 	CurrentTranslator.SetOuterComponent(InOuterComponent);
+	CurrentTranslator.SetOutputStats(OutStats);
+	CurrentTranslator.SetDeferredStaticMeshBuilds(OutPendingBuilds);
 
 	// TODO: Fetch from settings/HAC
 	CurrentTranslator.DefaultMeshSmoothing = 1;
@@ -770,6 +861,23 @@ FHoudiniMeshTranslator::CreateStaticMeshFromHoudiniGeoPartObject(
 	OutOutputObjects = CurrentTranslator.OutputObjects;
 	AssignmentMaterialMap = CurrentTranslator.OutputAssignmentMaterials;
 
+	// Keep track of the content we created this part's meshes from
+	if (bHasPartLayoutHash)
+	{
+		// First build of the part, or its layout changed: hash it now so that the next cook can reuse its meshes
+		if (!bHasPartContentHash)
+			bHasPartContentHash = FHoudiniEngineUtils::HapiGetPartContentHash(InHGPO.GeoId, InHGPO.PartId, PartContentHash);
+
+		for (auto& CurrentPair : OutOutputObjects)
+		{
+			if (!CurrentPair.Key.Matches(InHGPO))
+				continue;
+
+			CurrentPair.Value.PartLayoutHash = PartLayoutHash;
+			CurrentPair.Value.PartContentHash = bHasPartContentHash ? PartContentHash : 0;
+		}
+	}
+
 	return true;
 }
 
@@ -3318,57 +3426,23 @@ FHoudiniMeshTranslator::CreateStaticMesh_MeshDescription()
 			FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(SM, PropertyAttributes, 0, bDeferPostEditChangePropertyCalls);
 		}
 
+		const double PrepareTime = FPlatformTime::Seconds() - tick;
 		if (bDoTiming)
 		{
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Pre SM->Build() in %f seconds."), FPlatformTime::Seconds() - tick);
-			tick = FPlatformTime::Seconds();
-		}
-
-		// BUILD the Static Mesh
-		// bSilent doesnt add the Build Errors...
-		double build_start = FPlatformTime::Seconds();
-		TArray<FText> SMBuildErrors;
-		SM->Build(true, &SMBuildErrors);		
-
-		if (bDoTiming)
-		{			
-			tick = FPlatformTime::Seconds();
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - StaticMesh->Build() executed in %f seconds."), tick - build_start);
+			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Pre SM->Build() in %f seconds."), PrepareTime);
 		}
 
-		// This replaces the call to RefreshCollision below, but without CreateNavCollision
-		// as it is already called by UStaticMesh::PostBuildInternal as part of the ::Build call,
-		// and can be expensive depending on the vert/poly count of the mesh
-		// RefreshCollisionChange(*SM);
-		{
-			for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
-			{
-				UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-				if (StaticMeshComponent->GetStaticMesh() == SM)
-				{
-					// it needs to recreate IF it already has been created
-					if (StaticMeshComponent->IsPhysicsStateCreated())
-					{
-						StaticMeshComponent->RecreatePhysicsState();
-					}
-				}
-			}
-
-			FEditorSupportDelegates::RedrawAllViewports.Broadcast();
-		}
-
-		SM->GetOnMeshChanged().Broadcast();
+		// The mesh will be built along with the other splits
+		PendingStaticMeshBuilds.Meshes.Add(TPair<UStaticMesh*, double>(SM, PrepareTime));
+	}
 
-		UPackage* MeshPackage = SM->GetOutermost();
-		if (IsValid(MeshPackage))
-		{
-			MeshPackage->MarkPackageDirty();
-		}
+	// BUILD the Static Meshes
+	tick = FPlatformTime::Seconds();
+	FlushPendingStaticMeshBuilds();
 
-		if (bDoTiming)
-		{
-			HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - Post SM->Build() in %f seconds."), FPlatformTime::Seconds() - tick);
-		}
+	if (bDoTiming)
+	{
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMesh_MeshDescription() - SM->Build() and Post SM->Build() in %f seconds."), FPlatformTime::Seconds() - tick);
 	}
 
 	// !!! No need to call InvalidatePhysicsData / CreatePhysicsMeshes / GetNavCollision()->Setup
@@ -3458,6 +3532,19 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 	// Map of object identifiers to package params
 	TMap<FHoudiniOutputObjectIdentifier, FHoudiniPackageParams> ObjectIdentifiersToPackageParams;
 
+	// Per split buffers, reused across splits to avoid reallocating them for every split and attribute.
+	TArray<int32> IndicesMapper;
+	TArray<int32> NeededVertices;
+	TArray<int32> TriangleIndices;
+	TArray<int32> SplitValidWedges;
+	TArray<float> SplitNormals;
+	TArray<float> SplitTangentU;
+	TArray<float> SplitTangentV;
+	TArray<float> SplitColors;
+	TArray<float> SplitAlphas;
+	TArray<TArray<float>> SplitUVSets;
+	SplitUVSets.SetNum(MAX_STATIC_TEXCOORDS);
+
 	// Iterate through all detected split groups we care about and split geometry.
 	bool bMainGeoOrFirstLODFound = false;
 	for (int32 SplitId = 0; SplitId < AllSplitGroups.Num(); SplitId++)
@@ -3636,20 +3723,15 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			// - Vertices unused by the split will be set to -1
 			// - Used vertices will have their value set to the "NewIndex"
 			// So that IndicesMapper[ oldIndex ] => newIndex
-			TArray<int32> IndicesMapper;
-			IndicesMapper.SetNumUninitialized(SplitVertexList.Num());
-			for (int32 n = 0; n < IndicesMapper.Num(); n++)
-				IndicesMapper[n] = -1;
+			IndicesMapper.Init(-1, SplitVertexList.Num());
 
 			int32 CurrentMapperIndex = 0;
 
 			// NeededVertices:
 			// Array containing the old index of the needed vertices for the current split
 			// NeededVertices[ newIndex ] => oldIndex
-			TArray< int32 > NeededVertices;
-			NeededVertices.Reserve(SplitVertexList.Num() / 3);
-			TArray< int32 > TriangleIndices;
-			TriangleIndices.Reserve(SplitVertexList.Num());
+			NeededVertices.Reset(SplitVertexList.Num() / 3);
+			TriangleIndices.Reset(SplitVertexList.Num());
 
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Build IndicesMapper and NeededVertices);
@@ -3710,6 +3792,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				}
 			}
 
+			// The wedges used by this split, shared by all the attribute transfers below.
+			FHoudiniMeshTranslator::GetSplitValidWedges(SplitVertexList, SplitValidWedges);
+
 			//--------------------------------------------------------------------------------------------------------------------- 
 			// NORMALS 
 			//--------------------------------------------------------------------------------------------------------------------- 
@@ -3718,9 +3803,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			UpdatePartNormalsIfNeeded();
 
 			// Get the normals for this split
-			TArray<float> SplitNormals;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoNormals, PartNormals, SplitNormals);
+			FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+				SplitVertexList, SplitValidWedges, AttribInfoNormals, PartNormals, SplitNormals);
 
 			// Check that the number of normal we retrieved is correct
 			int32 NormalCount = SplitNormals.Num() / 3;
@@ -3736,8 +3820,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			// TANGENTS
 			//--------------------------------------------------------------------------------------------------------------------- 
 
-			TArray<float> SplitTangentU;
-			TArray<float> SplitTangentV;
+			SplitTangentU.Reset();
+			SplitTangentV.Reset();
 			int32 TangentUCount = 0;
 			int32 TangentVCount = 0;
 			// No need to read the tangents if we want unreal to recompute them after		
@@ -3751,12 +3835,12 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				UpdatePartTangentsIfNeeded();
 
 				// Get the Tangents for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentU, PartTangentU, SplitTangentU);
+				FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+					SplitVertexList, SplitValidWedges, AttribInfoTangentU, PartTangentU, SplitTangentU);
 
 				// Get the binormals for this split
-				FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-					SplitVertexList, AttribInfoTangentV, PartTangentV, SplitTangentV);
+				FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+					SplitVertexList, SplitValidWedges, AttribInfoTangentV, PartTangentV, SplitTangentV);
 
 				if ((SplitTangentU.Num() <= 0 || SplitTangentV.Num() <= 0))
 					bReadTangents = false;
@@ -3795,17 +3879,15 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			UpdatePartColorsIfNeeded();
 
 			// Get the colors values for this split
-			TArray<float> SplitColors;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoColors, PartColors, SplitColors);
+			FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+				SplitVertexList, SplitValidWedges, AttribInfoColors, PartColors, SplitColors);
 
 			// Extract this part's alpha values if needed
 			UpdatePartAlphasIfNeeded();
 
 			// Get the colors values for this split
-			TArray<float> SplitAlphas;
-			FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
-				SplitVertexList, AttribInfoAlpha, PartAlphas, SplitAlphas);
+			FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+				SplitVertexList, SplitValidWedges, AttribInfoAlpha, PartAlphas, SplitAlphas);
 
 			const int32 ColorsCount = AttribInfoColors.exists ? SplitColors.Num() / AttribInfoColors.tupleSize : 0;
 			const bool bSplitColorValid = AttribInfoColors.exists && (AttribInfoColors.tupleSize >= 3) && ColorsCount > 0;
@@ -3820,12 +3902,10 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 
 			// See if we need to transfer uv point attributes to vertex attributes.
 			int32 NumUVLayers = 0;
-			TArray<TArray<float>> SplitUVSets;
-			SplitUVSets.SetNum(MAX_STATIC_TEXCOORDS);
 			for (int32 TexCoordIdx = 0; TexCoordIdx < MAX_STATIC_TEXCOORDS; ++TexCoordIdx)
 			{
-				FHoudiniMeshTranslator::TransferPartAttributesToSplit<float>(
-					SplitVertexList, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
+				FHoudiniMeshTranslator::GatherPartAttributesToSplit<float>(
+					SplitVertexList, SplitValidWedges, AttribInfoUVSets[TexCoordIdx], PartUVSets[TexCoordIdx], SplitUVSets[TexCoordIdx]);
 				if (SplitUVSets[TexCoordIdx].Num() > 0)
 				{
 					NumUVLayers++;
@@ -3873,16 +3953,15 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 			{
 				TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Vertex Positions);
 
-				bool bHasInvalidPositionIndexData = false;
-				for (int32 VertexPositionIdx = 0; VertexPositionIdx < NumVertexPositions; ++VertexPositionIdx)
-				//ParallelFor(NumVertexPositions, [&](uint32 VertexPositionIdx)
+				std::atomic<bool> bHasInvalidPositionIndexData = false;
+				ParallelFor(NumVertexPositions, [&](int32 VertexPositionIdx)
 				{
 					int32 NeededVertexIndex = NeededVertices[VertexPositionIdx];
 					if (!PartPositions.IsValidIndex(NeededVertexIndex * 3 + 2))
 					{
 						// Error retrieving positions.
 						bHasInvalidPositionIndexData = true;
-						continue;
+						return;
 					}
 
 					// We need to swap Z and Y coordinate here, and convert from m to cm. 
@@ -3891,7 +3970,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 						PartPositions[NeededVertexIndex * 3 + 2] * HAPI_UNREAL_SCALE_FACTOR_POSITION,
 						PartPositions[NeededVertexIndex * 3 + 1] * HAPI_UNREAL_SCALE_FACTOR_POSITION
 					));
-				}//);
+				});
 
 				if (bHasInvalidPositionIndexData)
 				{
@@ -3911,8 +3990,8 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 				TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::CreateHoudiniStaticMesh -- Set Triangle Indices & Per Vertex Instance Attribute Values);
 
 				// Now add the triangles to the mesh
-				for (int32 TriangleIdx = 0; TriangleIdx < NumTriangles; ++TriangleIdx)
-				// ParallelFor(NumTriangles, [&](uint32 TriangleIdx)
+				// Each triangle only writes its own indices and per vertex instance attributes.
+				ParallelFor(NumTriangles, [&](int32 TriangleIdx)
 				{
 					// TODO: add some additional intermediate consts for index calculations to make the indexing
 					// TODO: code a bit more readable
@@ -3965,9 +4044,9 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 									TangentU.Y = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
 									TangentU.Z = SplitTangentU[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
 
-									TangentU.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
-									TangentU.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
-									TangentU.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
+									TangentV.X = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 0];
+									TangentV.Y = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 2];
+									TangentV.Z = SplitTangentV[TriVertIdx0 * 3 + 3 * ElementIdx + 1];
 
 									FoundStaticMesh->SetTriangleVertexUTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentU);
 									FoundStaticMesh->SetTriangleVertexVTangent(TriangleIdx, TriWindingIndex[ElementIdx], TangentV);
@@ -4034,7 +4113,7 @@ FHoudiniMeshTranslator::CreateHoudiniStaticMesh()
 							}
 						}
 					}
-				}
+				});
 			}
 
 			FMeshBuildSettings BuildSettings;
@@ -5177,6 +5256,107 @@ int32 FHoudiniMeshTranslator::TransferPartAttributesToSplit(
 	return ValidWedgeCount;
 }
 
+int32
+FHoudiniMeshTranslator::GetSplitValidWedges(
+	const TArray<int32>& InVertexList,
+	TArray<int32>& OutValidWedges)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::GetSplitValidWedges);
+
+	OutValidWedges.Reset(InVertexList.Num());
+	for (int32 WedgeIdx = 0; WedgeIdx < InVertexList.Num(); ++WedgeIdx)
+	{
+		// Wedges set to -1 are not part of the split.
+		if (InVertexList[WedgeIdx] >= 0)
+			OutValidWedges.Add(WedgeIdx);
+	}
+
+	return OutValidWedges.Num();
+}
+
+int32
+FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+	const TArray<int32>& InVertexList,
+	const TArray<int32>& InValidWedges,
+	const HAPI_AttributeInfo& InAttribInfo,
+	const TArray<float>& InData,
+	TArray<float>& OutVertexData)
+{
+	return FHoudiniMeshTranslator::GatherPartAttributesToSplit<float>(
+		InVertexList, InValidWedges, InAttribInfo, InData, OutVertexData);
+}
+
+template <typename TYPE>
+int32 FHoudiniMeshTranslator::GatherPartAttributesToSplit(
+	const TArray<int32>& InVertexList,
+	const TArray<int32>& InValidWedges,
+	const HAPI_AttributeInfo& InAttribInfo,
+	const TArray<TYPE>& InData,
+	TArray<TYPE>& OutVertexData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::GatherPartAttributesToSplit);
+
+	// OutVertexData is usually reused from a previous split, so clear it without releasing its memory.
+	// Every early out must leave it empty, as TransferPartAttributesToSplit() would leave a new array.
+	OutVertexData.Reset();
+
+	if (!InAttribInfo.exists || InAttribInfo.tupleSize <= 0)
+		return 0;
+
+	if (InData.Num() <= 0)
+		return 0;
+
+	const int32 TupleSize = InAttribInfo.tupleSize;
+	const int32 ValidWedgeCount = InValidWedges.Num();
+
+	// Detail attributes with a single value end up with no data in TransferPartAttributesToSplit(),
+	// as none of the wedges are counted as valid. Keep the same behavior.
+	if (InAttribInfo.owner == HAPI_ATTROWNER_DETAIL && TupleSize == 1)
+		return 0;
+
+	if (InAttribInfo.owner != HAPI_ATTROWNER_POINT
+		&& InAttribInfo.owner != HAPI_ATTROWNER_VERTEX
+		&& InAttribInfo.owner != HAPI_ATTROWNER_PRIM
+		&& InAttribInfo.owner != HAPI_ATTROWNER_DETAIL)
+	{
+		// Invalid attribute owner, shouldn't happen
+		check(false);
+		return 0;
+	}
+
+	// Each valid wedge writes its own tuple in the output, so the result doesn't depend on scheduling.
+	const HAPI_AttributeOwner Owner = InAttribInfo.owner;
+	OutVertexData.SetNumUninitialized(ValidWedgeCount * TupleSize);
+	ParallelFor(ValidWedgeCount, [&](int32 OutWedgeIdx)
+	{
+		const int32 WedgeIdx = InValidWedges[OutWedgeIdx];
+
+		int32 InIdx = 0;
+		switch (Owner)
+		{
+			case HAPI_ATTROWNER_POINT:
+				InIdx = InVertexList[WedgeIdx] * TupleSize;
+				break;
+			case HAPI_ATTROWNER_VERTEX:
+				InIdx = WedgeIdx * TupleSize;
+				break;
+			case HAPI_ATTROWNER_PRIM:
+				InIdx = (WedgeIdx / 3) * TupleSize;
+				break;
+			default:
+				break;
+		}
+
+		const int32 OutIdx = OutWedgeIdx * TupleSize;
+		for (int32 TupleIdx = 0; TupleIdx < TupleSize; TupleIdx++)
+		{
+			OutVertexData[OutIdx + TupleIdx] = InData[InIdx + TupleIdx];
+		}
+	});
+
+	return ValidWedgeCount;
+}
+
 bool
 FHoudiniMeshTranslator::TryToFindPropertyOnSourceModel(
 	UStaticMesh* const InStaticMesh,
@@ -6355,17 +6535,9 @@ FHoudiniMeshTranslator::UpdateMeshBuildSettings(
 }
 
 
-void 
-FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescription, FHoudiniGroupedMeshPrimitives& SplitMeshData)
+void
+FHoudiniMeshTranslator::CreateMeshDescriptionPolygonGroups(FMeshDescription* MeshDescription)
 {
-	bool bHasNormal = SplitMeshData.Normals.Num() > 0;
-	bool bHasTangents = SplitMeshData.TangentU.Num() > 0 && SplitMeshData.TangentV.Num() > 0;
-	bool bHasRGB = SplitMeshData.Colors.Num() > 0;
-	bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
-	bool bHasAlpha = SplitMeshData.Alphas.Num() > 0;
-	int UVSetCount = PartUVSets.Num();
-	uint32 FaceCount = SplitMeshData.Indices.Num() / 3;
-
 	// Create a Polygon Group for each material slot
 	TPolygonGroupAttributesRef<FName> PolygonGroupImportedMaterialSlotNames =
 		MeshDescription->PolygonGroupAttributes().GetAttributesRef<FName>(MeshAttribute::PolygonGroup::ImportedMaterialSlotName);
@@ -6391,6 +6563,20 @@ FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescription,
 				FName(CurrentMatAssignement.Value ? *(CurrentMatAssignement.Value->GetName()) : *(CurrentMatAssignement.Key.MaterialObjectPath));
 		}
 	}
+}
+
+void 
+FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescription, FHoudiniGroupedMeshPrimitives& SplitMeshData)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::BuildMeshDescription);
+
+	bool bHasNormal = SplitMeshData.Normals.Num() > 0;
+	bool bHasTangents = SplitMeshData.TangentU.Num() > 0 && SplitMeshData.TangentV.Num() > 0;
+	bool bHasRGB = SplitMeshData.Colors.Num() > 0;
+	bool bHasRGBA = bHasRGB && AttribInfoColors.tupleSize == 4;
+	bool bHasAlpha = SplitMeshData.Alphas.Num() > 0;
+	int UVSetCount = PartUVSets.Num();
+	uint32 FaceCount = SplitMeshData.Indices.Num() / 3;
 
 	TVertexAttributesRef<FVector3f> VertexPositions = MeshDescription->VertexAttributes().GetAttributesRef<FVector3f>(MeshAttribute::Vertex::Position);
 
@@ -6554,7 +6740,7 @@ FHoudiniMeshTranslator::BuildMeshDescription(FMeshDescription* MeshDescription,
 	int32 WedgeFaceSmoothCount = SplitMeshData.FaceSmoothingMasks.Num() / 3;
 
 	// Get valid count of vertex indices for this split.
-	const int32 SplitVertexCount = AllSplitVertexCounts[SplitMeshData.SplitGroupName];
+	const int32 SplitVertexCount = AllSplitVertexCounts.FindChecked(SplitMeshData.SplitGroupName);
 
 
 	// FaceSmoothing masks must be initialized even if we don't have a value from Houdini!
@@ -7468,12 +7654,21 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 	// Loop through and build each mesh.
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
+	// Create the meshes and pull their data from Houdini first, so that the mesh descriptions
+	// of all the meshes can then be built in parallel
+	for (auto & It : MeshesToBuild.Meshes)
+	{
+		PrepareStaticMeshFromSplitGroups(It.Key, It.Value);
+	}
+
+	BuildSplitGroupMeshDescriptions(MeshesToBuild);
+
 	for (auto & It : MeshesToBuild.Meshes)
 	{
 		CreateStaticMeshFromSplitGroups(It.Key, It.Value);
 	}
 
-	// Once all meshes have been built, patch up custom collision refences
+	// Custom collision refences are patched up once all meshes have been built
 	for (auto& It : MeshesToBuild.Meshes)
 	{
 		auto & Mesh =  It.Value;
@@ -7482,22 +7677,21 @@ FHoudiniMeshTranslator::CreateStaticMeshesFromSplitGroups()
 			auto * Owner = MeshesToBuild.Meshes.Find(Mesh.CustomCollisionOwner);
 			if (Owner && Owner->UnrealStaticMesh)
 			{
-				Owner->UnrealStaticMesh->ComplexCollisionMesh = Mesh.UnrealStaticMesh;
-#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
-				Owner->UnrealStaticMesh->SetCustomizedCollision(true);
-#else
-				Owner->UnrealStaticMesh->bCustomizedCollision = true;
-#endif
+				PendingStaticMeshBuilds.CustomCollisions.Add(
+					TPair<UStaticMesh*, UStaticMesh*>(Owner->UnrealStaticMesh, Mesh.UnrealStaticMesh));
 			}
 		}
 	}
 
+	// Build all the meshes at once
+	FlushPendingStaticMeshBuilds();
+
 	return true;
 
 }
 
 bool
-FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName, FHoudiniSplitGroupMesh& SplitMeshData)
+FHoudiniMeshTranslator::PrepareStaticMeshFromSplitGroups(const FString& MeshName, FHoudiniSplitGroupMesh& SplitMeshData)
 {
 	double TimeStart = FPlatformTime::Seconds();
 
@@ -7550,20 +7744,88 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 	}
 
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
-	// Build Description based off the Houdini data.
+	// Pull the Houdini data of each LOD. Their mesh descriptions are filled afterwards by BuildSplitGroupMeshDescriptions().
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
+	SplitMeshData.LODMeshDescriptions.SetNum(NumLODs);
 	for(int LODIndex = 0; LODIndex < NumLODs; LODIndex++)
 	{
-
 		auto & RenderGroup = SplitMeshData.SplitMeshData[SplitMeshData.LODRenders[LODIndex]];
 
 		RenderGroup.VertexList = AllSplitVertexLists[RenderGroup.SplitGroupName];
 		PullMeshData(RenderGroup, SplitMeshData.UnrealStaticMesh, LODIndex, bReadTangents);
 
-		FMeshDescription* MeshDescription = SplitMeshData.UnrealStaticMesh->CreateMeshDescription(LODIndex);
-		FStaticMeshAttributes(*MeshDescription).Register();
-		BuildMeshDescription(MeshDescription, RenderGroup);
+		// Create the polygon groups now, as pulling the next LODs / meshes can add assignment materials
+		FMeshDescription& MeshDescription = SplitMeshData.LODMeshDescriptions[LODIndex];
+		FStaticMeshAttributes(MeshDescription).Register();
+		CreateMeshDescriptionPolygonGroups(&MeshDescription);
+	}
+
+	SplitMeshData.PrepareTime = FPlatformTime::Seconds() - TimeStart;
+
+	return true;
+}
+
+void
+FHoudiniMeshTranslator::BuildSplitGroupMeshDescriptions(FHoudiniMeshToBuild& MeshesToBuild)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::BuildSplitGroupMeshDescriptions);
+
+	double TimeStart = FPlatformTime::Seconds();
+
+	TArray<TPair<FMeshDescription*, FHoudiniGroupedMeshPrimitives*>> MeshDescriptionsToBuild;
+	for (auto& It : MeshesToBuild.Meshes)
+	{
+		FHoudiniSplitGroupMesh& SplitMeshData = It.Value;
+		if (!IsValid(SplitMeshData.UnrealStaticMesh))
+			continue;
+
+		for (int32 LODIndex = 0; LODIndex < SplitMeshData.LODMeshDescriptions.Num(); LODIndex++)
+		{
+			MeshDescriptionsToBuild.Add(TPair<FMeshDescription*, FHoudiniGroupedMeshPrimitives*>(
+				&SplitMeshData.LODMeshDescriptions[LODIndex], &SplitMeshData.SplitMeshData[SplitMeshData.LODRenders[LODIndex]]));
+		}
+	}
+
+	// All the data has been pulled already, so the descriptions can be filled in parallel
+	ParallelFor(MeshDescriptionsToBuild.Num(), [&](int32 Index)
+	{
+		BuildMeshDescription(MeshDescriptionsToBuild[Index].Key, *MeshDescriptionsToBuild[Index].Value);
+	});
+
+	// Each mesh's prepare time includes an equal share of the parallel build
+	const double BuildTimePerMesh = MeshesToBuild.Meshes.Num() > 0 ? (FPlatformTime::Seconds() - TimeStart) / MeshesToBuild.Meshes.Num() : 0.0;
+	for (auto& It : MeshesToBuild.Meshes)
+		It.Value.PrepareTime += BuildTimePerMesh;
+
+	if (bDoTiming)
+		HOUDINI_LOG_MESSAGE(TEXT("BuildSplitGroupMeshDescriptions() built %d mesh descriptions in %f seconds."), MeshDescriptionsToBuild.Num(), FPlatformTime::Seconds() - TimeStart);
+}
+
+bool
+FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName, FHoudiniSplitGroupMesh& SplitMeshData)
+{
+	double TimeStart = FPlatformTime::Seconds();
+
+	if (!IsValid(SplitMeshData.UnrealStaticMesh))
+		return false;
+
+	FHoudiniOutputObject* OutputObject = OutputObjects.Find(SplitMeshData.OutputObjectIdentifier);
+	if (!OutputObject)
+		return false;
+
+	int NumLODs = SplitMeshData.LODRenders.Num();
+
+	//-----------------------------------------------------------------------------------------------------------------------------------------------
+	// Commit the mesh descriptions built off the Houdini data.
+	//-----------------------------------------------------------------------------------------------------------------------------------------------
+
+	for(int LODIndex = 0; LODIndex < NumLODs; LODIndex++)
+	{
+
+		auto & RenderGroup = SplitMeshData.SplitMeshData[SplitMeshData.LODRenders[LODIndex]];
+
+		SplitMeshData.UnrealStaticMesh->CreateMeshDescription(LODIndex, MoveTemp(SplitMeshData.LODMeshDescriptions[LODIndex]));
 
 		bool bHasNormal = RenderGroup.Normals.Num() > 0;
 		bool bHasTangents = RenderGroup.TangentU.Num() > 0 || RenderGroup.TangentV.Num() > 0;
@@ -7686,20 +7948,93 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 	// Finalize mesh
 	//-----------------------------------------------------------------------------------------------------------------------------------------------
 
-	double BuildTimeStart = FPlatformTime::Seconds();
-
-	TArray<FText> SMBuildErrors;
 #if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
 	SplitMeshData.UnrealStaticMesh->SetImportVersion(EImportStaticMeshVersion::LastVersion);
 #else
 	SplitMeshData.UnrealStaticMesh->ImportVersion = EImportStaticMeshVersion::LastVersion;
 #endif
-	SplitMeshData.UnrealStaticMesh->Build(true, &SMBuildErrors);
 
+	// The render data is built along with the other splits in FlushPendingStaticMeshBuilds()
+	double TimeEnd = FPlatformTime::Seconds();
+	PendingStaticMeshBuilds.Meshes.Add(TPair<UStaticMesh*, double>(SplitMeshData.UnrealStaticMesh, SplitMeshData.PrepareTime + TimeEnd - TimeStart));
+
+	//-----------------------------------------------------------------------------------------------------------------------------------------------
+	// Print results.
+	//-----------------------------------------------------------------------------------------------------------------------------------------------
+
+	if (bDoTiming)
+		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMeshFromSplitGroups() executed in %f seconds."), TimeEnd - TimeStart);
+
+	return true;
+}
+
+void
+FHoudiniMeshTranslator::FlushPendingStaticMeshBuilds()
+{
+	if (!DeferredStaticMeshBuilds)
+	{
+		BuildPendingStaticMeshes(PendingStaticMeshBuilds, OutputStats);
+		return;
+	}
+
+	// The caller builds the meshes of all the parts at once
+	DeferredStaticMeshBuilds->Meshes.Append(PendingStaticMeshBuilds.Meshes);
+	DeferredStaticMeshBuilds->CustomCollisions.Append(PendingStaticMeshBuilds.CustomCollisions);
+	PendingStaticMeshBuilds.Meshes.Empty();
+	PendingStaticMeshBuilds.CustomCollisions.Empty();
+}
+
+void
+FHoudiniMeshTranslator::BuildPendingStaticMeshes(
+	FHoudiniPendingStaticMeshBuilds& InPendingBuilds,
+	FHoudiniEngineOutputStats* OutStats)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniMeshTranslator::BuildPendingStaticMeshes);
+
+	const bool bDoTiming = CVarHoudiniEngineMeshBuildTimer.GetValueOnAnyThread() != 0.0;
+
+	TArray<UStaticMesh*> StaticMeshes;
+	StaticMeshes.Reserve(InPendingBuilds.Meshes.Num());
+	for (const TPair<UStaticMesh*, double>& PendingBuild : InPendingBuilds.Meshes)
+	{
+		if (IsValid(PendingBuild.Key))
+			StaticMeshes.AddUnique(PendingBuild.Key);
+	}
+
+	if (StaticMeshes.Num() <= 0)
+	{
+		InPendingBuilds.Meshes.Empty();
+		InPendingBuilds.CustomCollisions.Empty();
+		return;
+	}
+
+	// BUILD the Static Meshes
+	// A single batch build lets UE build the render data of all the meshes in parallel
+	// bSilent doesnt add the Build Errors...
+	double BuildStart = FPlatformTime::Seconds();
+	TArray<FText> SMBuildErrors;
+	UStaticMesh::FBuildParameters BuildParameters;
+	BuildParameters.bInSilent = true;
+	BuildParameters.OutErrors = &SMBuildErrors;
+	UStaticMesh::BatchBuild(StaticMeshes, BuildParameters);
+
+	double BuildTime = FPlatformTime::Seconds() - BuildStart;
+	if (bDoTiming)
+		HOUDINI_LOG_MESSAGE(TEXT("UStaticMesh::BatchBuild() of %d meshes executed in %f seconds."), StaticMeshes.Num(), BuildTime);
+
+	// This replaces the call to RefreshCollision, but without CreateNavCollision
+	// as it is already called by UStaticMesh::PostBuildInternal as part of the build,
+	// and can be expensive depending on the vert/poly count of the mesh
+	// Iterate on the components only once for all the built meshes.
+	TSet<UStaticMesh*> BuiltStaticMeshes(StaticMeshes);
 	for (FThreadSafeObjectIterator Iter(UStaticMeshComponent::StaticClass()); Iter; ++Iter)
 	{
 		UStaticMeshComponent* StaticMeshComponent = Cast<UStaticMeshComponent>(*Iter);
-		if (StaticMeshComponent->GetStaticMesh() == SplitMeshData.UnrealStaticMesh)
+		if (!StaticMeshComponent)
+			continue;
+
+		UStaticMesh* ComponentStaticMesh = StaticMeshComponent->GetStaticMesh();
+		if (ComponentStaticMesh && BuiltStaticMeshes.Contains(ComponentStaticMesh))
 		{
 			// it needs to recreate IF it already has been created
 			if (StaticMeshComponent->IsPhysicsStateCreated())
@@ -7711,27 +8046,51 @@ FHoudiniMeshTranslator::CreateStaticMeshFromSplitGroups(const FString& MeshName,
 
 	FEditorSupportDelegates::RedrawAllViewports.Broadcast();
 
-	SplitMeshData.UnrealStaticMesh->GetOnMeshChanged().Broadcast();
-
-	UPackage* MeshPackage = SplitMeshData.UnrealStaticMesh->GetOutermost();
-	if (IsValid(MeshPackage))
+	TSet<UPackage*> DirtiedPackages;
+	for (UStaticMesh* SM : StaticMeshes)
 	{
-		MeshPackage->MarkPackageDirty();
+		SM->GetOnMeshChanged().Broadcast();
+
+		UPackage* MeshPackage = SM->GetOutermost();
+		if (IsValid(MeshPackage) && !DirtiedPackages.Contains(MeshPackage))
+		{
+			MeshPackage->MarkPackageDirty();
+			DirtiedPackages.Add(MeshPackage);
+		}
 	}
 
-	double BuildTimeEnd = FPlatformTime::Seconds();
-	if (bDoTiming)
-		HOUDINI_LOG_MESSAGE(TEXT("StaticMesh->Build() executed in %f seconds."), BuildTimeEnd - BuildTimeStart);
+	if (OutStats)
+	{
+		for (const TPair<UStaticMesh*, double>& PendingBuild : InPendingBuilds.Meshes)
+		{
+			if (!IsValid(PendingBuild.Key))
+				continue;
 
-	//-----------------------------------------------------------------------------------------------------------------------------------------------
-	// Print results.
-	//-----------------------------------------------------------------------------------------------------------------------------------------------
+			FHoudiniEngineMeshBuildTimings Timings;
+			Timings.PrepareTime = PendingBuild.Value;
+			Timings.BuildTime = BuildTime;
+			Timings.NumMeshesInBuild = StaticMeshes.Num();
+			OutStats->NotifyMeshBuilt(PendingBuild.Key->GetName(), Timings);
+		}
+	}
 
-	double TimeEnd = FPlatformTime::Seconds();
-	if (bDoTiming)
-		HOUDINI_LOG_MESSAGE(TEXT("CreateStaticMeshFromSplitGroups() executed in %f seconds."), TimeEnd - TimeStart);
+	// Once all meshes have been built, assign the custom complex collisions to their owner
+	for (const TPair<UStaticMesh*, UStaticMesh*>& CustomCollision : InPendingBuilds.CustomCollisions)
+	{
+		UStaticMesh* OwnerStaticMesh = CustomCollision.Key;
+		if (!IsValid(OwnerStaticMesh))
+			continue;
 
-	return true;
+		OwnerStaticMesh->ComplexCollisionMesh = CustomCollision.Value;
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 7
+		OwnerStaticMesh->SetCustomizedCollision(true);
+#else
+		OwnerStaticMesh->bCustomizedCollision = true;
+#endif
+	}
+
+	InPendingBuilds.Meshes.Empty();
+	InPendingBuilds.CustomCollisions.Empty();
 }
 
 void FHoudiniMeshTranslator::UpdateSplitGroups()
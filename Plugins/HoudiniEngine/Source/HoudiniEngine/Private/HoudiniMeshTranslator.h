@@ -37,6 +37,7 @@
 #include "HoudiniEngineAttributes.h"
 #include "UObject/ObjectMacros.h"
 #include "PhysicsEngine/AggregateGeom.h"
+#include "MeshDescription.h"
 
 #include "HoudiniMeshTranslator.generated.h"
 
@@ -52,6 +53,7 @@ class UHoudiniStaticMeshComponent;
 struct FKAggregateGeom;
 struct FHoudiniGenericAttribute;
 struct FHoudiniMeshesToBuild;
+struct FHoudiniEngineOutputStats;
 
 UENUM()
 enum class EHoudiniSplitType : uint8
@@ -141,6 +143,11 @@ struct FHoudiniSplitGroupMesh
 	// Output identifier.
 	FHoudiniOutputObjectIdentifier OutputObjectIdentifier;
 
+	// Mesh descriptions of each LOD, filled before being committed to UnrealStaticMesh.
+	TArray<FMeshDescription> LODMeshDescriptions;
+	// Time spent creating the mesh and pulling its data, in seconds.
+	double PrepareTime = 0.0;
+
 };
 
 struct FHoudiniMeshToBuild
@@ -149,6 +156,17 @@ struct FHoudiniMeshToBuild
 	TMap<FString, FHoudiniSplitGroupMesh> Meshes;
 };
 
+struct FHoudiniPendingStaticMeshBuilds
+{
+	// Static meshes whose mesh descriptions are ready, with the time spent preparing them.
+	TArray<TPair<UStaticMesh*, double>> Meshes;
+
+	// Custom complex collision meshes (Value) to assign to their owner mesh (Key) once everything is built.
+	TArray<TPair<UStaticMesh*, UStaticMesh*>> CustomCollisions;
+
+	bool IsEmpty() const { return Meshes.Num() <= 0 && CustomCollisions.Num() <= 0; };
+};
+
 struct HOUDINIENGINE_API FHoudiniMeshTranslator
 {
 	public:
@@ -184,7 +202,15 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			bool bSplitMeshSupport,
 			const FHoudiniStaticMeshGenerationProperties& InSMGenerationProperties,
 			const FMeshBuildSettings& InMeshBuildSettings,
-			bool bInTreatExistingMaterialsAsUpToDate = false);
+			bool bInTreatExistingMaterialsAsUpToDate = false,
+			FHoudiniEngineOutputStats* OutStats = nullptr,
+			FHoudiniPendingStaticMeshBuilds* OutPendingBuilds = nullptr);
+
+		// Builds the render data of all the pending static meshes with a single batch build,
+		// then updates their components and packages once and assigns their custom collisions.
+		static void BuildPendingStaticMeshes(
+			FHoudiniPendingStaticMeshBuilds& InPendingBuilds,
+			FHoudiniEngineOutputStats* OutStats = nullptr);
 
 		static bool CreateOrUpdateAllComponents(
 			UHoudiniOutput* InOutput,
@@ -215,6 +241,31 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 			const TArray<TYPE>& InData,
 			TArray<TYPE>& OutSplitData);
 
+		// Fills OutValidWedges with the index of every wedge of InVertexList that belongs to the split (ie >= 0).
+		// The result can be shared by all the GatherPartAttributesToSplit() calls made for the same split.
+		static int32 GetSplitValidWedges(
+			const TArray<int32>& InVertexList,
+			TArray<int32>& OutValidWedges);
+
+		// Parallel version of TransferRegularPointAttributesToVertices().
+		// Produces the same output, but gathers the attribute values over the precomputed valid wedges
+		// and reuses OutVertexData's allocation so it can be pooled across splits.
+		static int32 GatherRegularPointAttributesToVertices(
+			const TArray<int32>& InVertexList,
+			const TArray<int32>& InValidWedges,
+			const HAPI_AttributeInfo& InAttribInfo,
+			const TArray<float>& InData,
+			TArray<float>& OutVertexData);
+
+		// Parallel version of TransferPartAttributesToSplit(), see GatherRegularPointAttributesToVertices().
+		template <typename TYPE>
+		static int32 GatherPartAttributesToSplit(
+			const TArray<int32>& InVertexList,
+			const TArray<int32>& InValidWedges,
+			const HAPI_AttributeInfo& InAttribInfo,
+			const TArray<TYPE>& InData,
+			TArray<TYPE>& OutSplitData);
+
 		// Try to find the named InPropertyName property on the source model at InSourceModelIndex on InStaticMesh.
 		static bool TryToFindPropertyOnSourceModel(
 			UStaticMesh* const InStaticMesh,
@@ -290,6 +341,11 @@ struct HOUDINIENGINE_API FHoudiniMeshTranslator
 
 		void SetStaticMeshBuildSettings(const FMeshBuildSettings& InMBS) { StaticMeshBuildSettings = InMBS; };
 
+		void SetOutputStats(FHoudiniEngineOutputStats* InOutputStats) { OutputStats = InOutputStats; };
+
+		// When set, the static meshes are added to these pending builds instead of being built by the translator
+		void SetDeferredStaticMeshBuilds(FHoudiniPendingStaticMeshBuilds* InDeferredBuilds) { DeferredStaticMeshBuilds = InDeferredBuilds; };
+
 		// Create a StaticMesh using the MeshDescription format
 		bool CreateStaticMesh_MeshDescription();
 
@@ -569,6 +625,17 @@ protected:
 		// Whether or not to do timing.
 		bool bDoTiming = false;
 
+		// Static meshes whose mesh descriptions are ready, and their custom collisions.
+		// Their render data is built all at once by FlushPendingStaticMeshBuilds().
+		FHoudiniPendingStaticMeshBuilds PendingStaticMeshBuilds;
+
+		// If set, the pending static meshes are handed over to these builds instead of being built here,
+		// so that the caller can build the meshes of all the parts of an output in a single batch.
+		FHoudiniPendingStaticMeshBuilds* DeferredStaticMeshBuilds = nullptr;
+
+		// Receives the static mesh build timings, can be null
+		FHoudiniEngineOutputStats* OutputStats = nullptr;
+
 		// Default Mesh Build settings to be used when generating Static Meshes
 		FMeshBuildSettings StaticMeshBuildSettings;
 
@@ -576,6 +643,11 @@ protected:
 		// mesh descriptions. They are used by the split mesh generation code.
 		////////////////////////////////////////////////////////////////////////////////////////
 		
+		// Creates a polygon group for each of the current output assignment materials.
+		void CreateMeshDescriptionPolygonGroups(FMeshDescription* MeshDesc);
+
+		// Fills the mesh description's geometry with the split's pulled data.
+		// Only reads the translator's data, so can be called on worker threads.
 		void BuildMeshDescription(FMeshDescription *MeshDesc, FHoudiniGroupedMeshPrimitives & SplitMeshData);
 
 		void ProcessMaterials(UStaticMesh* FoundStaticMesh, FHoudiniGroupedMeshPrimitives& SplitMeshData);
@@ -596,8 +668,18 @@ protected:
 
 		void AddDefaultMesh(FHoudiniMeshToBuild & MeshesToBuild, const FString & Name);
 
+		// Creates the static mesh and its output object, and pulls the data of each of its LODs from Houdini.
+		bool PrepareStaticMeshFromSplitGroups(const FString & Name, FHoudiniSplitGroupMesh & Mesh);
+
+		// Builds the mesh descriptions of all the prepared meshes' LODs on worker threads.
+		void BuildSplitGroupMeshDescriptions(FHoudiniMeshToBuild & MeshesToBuild);
+
+		// Commits the mesh descriptions of a prepared mesh, and sets up its settings and collisions.
 		bool CreateStaticMeshFromSplitGroups(const FString & Name, FHoudiniSplitGroupMesh & Mesh);
 
+		// Builds the pending static meshes, or hands them over to DeferredStaticMeshBuilds if set.
+		void FlushPendingStaticMeshBuilds();
+
 		bool CreateHoudiniStaticMeshFromSplitGroups(const FString& Name, FHoudiniSplitGroupMesh& Mesh,
 			TMap<HAPI_NodeId, TObjectPtr<UMaterialInterface>> & MapHoudiniMatIdToUnrealInterface,
 			TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>> & MapHoudiniMatAttributesToUnrealInterface,
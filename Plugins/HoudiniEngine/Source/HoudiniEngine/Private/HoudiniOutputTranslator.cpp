@@ -129,14 +129,37 @@ FHoudiniOutputTranslator::ProcessOutputs(
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::ProcessOutputs-Cookable);
 
-	if (!IsValid(HC))
+	bOutHasHoudiniStaticMeshOutput = false;
+
+	TSharedPtr<FHoudiniOutputProcessingState> State = BeginProcessOutputs(HC);
+	if (!State.IsValid())
 		return false;
 
-	if (!HC->IsOutputSupported() || !HC->OutputData)
+	// Process all the outputs at once
+	if (!ContinueProcessOutputs(HC, *State, 0.0))
 		return false;
 
+	bOutHasHoudiniStaticMeshOutput = State->bHasHoudiniStaticMeshOutput;
+
+	return State->bSuccess;
+}
+
+//
+TSharedPtr<FHoudiniOutputProcessingState>
+FHoudiniOutputTranslator::BeginProcessOutputs(UHoudiniCookable* HC)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::BeginProcessOutputs);
+
+	if (!IsValid(HC))
+		return nullptr;
+
+	if (!HC->IsOutputSupported() || !HC->OutputData)
+		return nullptr;
+
+	TSharedPtr<FHoudiniOutputProcessingState> State = MakeShared<FHoudiniOutputProcessingState>();
+
 	// 1. Create all the outputs and their components
-	FHoudiniPackageParams PackageParams;
+	FHoudiniPackageParams& PackageParams = State->PackageParams;
 	PackageParams.PackageMode = FHoudiniPackageParams::GetDefaultStaticMeshesCookMode();
 	PackageParams.ReplaceMode = FHoudiniPackageParams::GetDefaultReplaceMode();
 
@@ -152,23 +175,65 @@ FHoudiniOutputTranslator::ProcessOutputs(
 	PackageParams.ComponentGUID = HC->CookableGUID;
 	PackageParams.ObjectName = FString();
 
-	TArray<UPackage*> CreatedPackages;
-	if (!CreateAllOutputs(
-		HC->GetOutputs(),
-		HC->GetInputs(),
-		PackageParams,
-		HC->GetComponent(), // TODO COOKABLE: Use Cookable / Component here ? - need to split
-		HC->GetWorld(),
-		HC->IsProxyStaticMeshEnabled(),
-		HC->HasNoProxyMeshNextCookBeenRequested(),
-		HC->IsBakeAfterNextCookEnabled(),
-		HC->GetSplitMeshSupport(),
-		HC->GetStaticMeshGenerationProperties(),
-		HC->GetStaticMeshBuildSettings(),
-		bOutHasHoudiniStaticMeshOutput,
-		CreatedPackages))
+	BeginCreateAllOutputs(HC->GetOutputs(), HC->GetInputs(), HC->GetWorld(), *State);
+
+	return State;
+}
+
+//
+bool
+FHoudiniOutputTranslator::ContinueProcessOutputs(
+	UHoudiniCookable* HC,
+	FHoudiniOutputProcessingState& InOutState,
+	double InEndTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::ContinueProcessOutputs);
+
+	if (InOutState.IsFinished())
+		return true;
+
+	if (!IsValid(HC) || !HC->IsOutputSupported() || !HC->OutputData)
+	{
+		// Nothing left to process, the remaining outputs will not be created
+		InOutState.bSuccess = false;
+		InOutState.bFinished = true;
+		return true;
+	}
+
+	TArray<TObjectPtr<UHoudiniOutput>>& Outputs = HC->GetOutputs();
+	if (Outputs.Num() < InOutState.NumOutputs)
+	{
+		// The outputs have been modified since we started processing them
+		HOUDINI_LOG_WARNING(TEXT("%s: Outputs were modified while being processed."), *HC->GetDisplayName());
+		InOutState.NumOutputs = Outputs.Num();
+	}
+
+	// Create the outputs one at a time, until we run out of time
+	// TODO COOKABLE: Use Cookable / Component here ? - need to split
+	while (!InOutState.HasProcessedAllOutputs())
+	{
+		CreateNextOutput(
+			Outputs,
+			HC->GetComponent(),
+			HC->GetWorld(),
+			HC->IsProxyStaticMeshEnabled(),
+			HC->HasNoProxyMeshNextCookBeenRequested(),
+			HC->IsBakeAfterNextCookEnabled(),
+			HC->GetSplitMeshSupport(),
+			HC->GetStaticMeshGenerationProperties(),
+			HC->GetStaticMeshBuildSettings(),
+			InOutState);
+
+		if (InEndTime > 0.0 && FPlatformTime::Seconds() >= InEndTime)
+			break;
+	}
+
+	if (!InOutState.HasProcessedAllOutputs())
 		return false;
 
+	// Now that all the other outputs have been created, create the instancers
+	FinishCreateAllOutputs(Outputs, HC->GetComponent(), HC->GetWorld(), InOutState);
+
 	// 2. Output cleanup
 	CleanOutputsPostCreate(HC->OutputData->Outputs, HC->GetWorld(), HC->HasBeenLoaded());
 
@@ -176,13 +241,15 @@ FHoudiniOutputTranslator::ProcessOutputs(
 	UpdateDataLayersAndLevelInstanceOnOutput(HC->OutputData->Outputs);
 
 	// 4. Save all created packages	
-	if (CreatedPackages.Num() > 0)
+	if (InOutState.CreatedPackages.Num() > 0)
 	{
 		// Save created packages. For example, we don't want landscape layers deleted 
 		// along with the HDA.
-		FEditorFileUtils::PromptForCheckoutAndSave(CreatedPackages, true, false);
+		FEditorFileUtils::PromptForCheckoutAndSave(InOutState.CreatedPackages, true, false);
 	}
 
+	InOutState.bFinished = true;
+
 	return true;
 }
 
@@ -313,37 +380,19 @@ FHoudiniOutputTranslator::UpdateOutputAttributesAndTags(UHoudiniCookable* InHC)
 	return true;
 }
 
-bool
-FHoudiniOutputTranslator::CreateAllOutputs(
-	TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
+void
+FHoudiniOutputTranslator::BeginCreateAllOutputs(
+	const TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
 	const TArray<TObjectPtr<UHoudiniInput>>& Inputs,
-	const FHoudiniPackageParams& PackageParams,
-	UObject* InOuter,
 	UWorld* InWorld,
-	bool bIsProxyStaticMeshEnabled,
-	bool bHasNoProxyMeshNextCookBeenRequested,
-	bool bIsBakeAfterNextCookEnabled,
-	bool bSplitMeshSupport,
-	const FHoudiniStaticMeshGenerationProperties& InStaticMeshGenerationProperties,
-	const FMeshBuildSettings& InStaticMeshBuildSettings,
-	bool& bOutHasHoudiniStaticMeshOutput,
-	TArray<UPackage*>& OutCreatedPackages)
+	FHoudiniOutputProcessingState& OutState)
 {
-	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::CreateAllOutputs);
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::BeginCreateAllOutputs);
 
 	//
 	// 3. Create the actual outputs assets/components
 	//
 
-	// TODO COOKABLE: Handle the case where the Out is NOT a component
-	// we need to split output asset creation from component creation!
-	UHoudiniCookable* OuterHC = Cast<UHoudiniCookable>(InOuter);
-	USceneComponent* InOuterComponent = Cast<USceneComponent>(InOuter);
-	if (!InOuterComponent)
-	{
-		InOuterComponent = OuterHC ? OuterHC->GetComponent() : nullptr;
-	}
-
 	// NOTE: The world can be NULL when, for example, when working with
 	// HoudiniAssetComponents in Blueprints.
 	if (InWorld && IsValid(InWorld->WorldComposition))
@@ -352,340 +401,387 @@ FHoudiniOutputTranslator::CreateAllOutputs(
 		InWorld->WorldComposition->bTemporarilyDisableOriginTracking = true;
 	}
 
-	// "Process" the mesh.
-	// TODO: Move this to the actual processing stage,
-	// And see if some of this could be threaded
-
 	// ----------------------------------------------------
 	// 3.1 Outputs prepass
 	// ----------------------------------------------------
 
-	// Collect all the landscape layers' global min/max values.
-	TMap<FString, float> LandscapeLayerGlobalMinimums;
-	TMap<FString, float> LandscapeLayerGlobalMaximums;
-
-	// Store the instancer outputs separately so we can process them later, after all mesh output are processed.
 	// Determine the total number of instances, if we have more than 1 then mesh parts with instanced geo we will not create proxy meshes
 	// Also if we have object instancer (or oldschool attribute instancers), we won't be creating any proxy at all
-	TArray<UHoudiniOutput*> InstancerOutputs;
-	int32 NumInstances = 0;
-	bool bHasObjectInstancer = false;
+	// Collect all the landscape layers' global min/max values as well.
+	OutState.NumInstances = 0;
+	OutState.bHasObjectInstancer = false;
 	for (auto& CurOutput : Outputs)
 	{
 		if (CurOutput->GetType() == EHoudiniOutputType::Instancer)
 		{
-			// InstancerOutputs.Add(CurOutput);
 			for (const FHoudiniGeoPartObject& HGPO : CurOutput->GetHoudiniGeoPartObjects())
 			{
 				if (HGPO.Type == EHoudiniPartType::Instancer)
 				{
 					if (HGPO.InstancerType == EHoudiniInstancerType::PackedPrimitive || HGPO.InstancerType == EHoudiniInstancerType::GeometryCollection)
 					{
-						NumInstances += HGPO.PartInfo.InstanceCount;
+						OutState.NumInstances += HGPO.PartInfo.InstanceCount;
 					}
 					else
 					{
-						NumInstances += HGPO.PartInfo.PointCount;
+						OutState.NumInstances += HGPO.PartInfo.PointCount;
 					}
 
 					if ((HGPO.InstancerType == EHoudiniInstancerType::ObjectInstancer)
 						|| (HGPO.InstancerType == EHoudiniInstancerType::OldSchoolAttributeInstancer))
 					{
-						bHasObjectInstancer = true;
+						OutState.bHasObjectInstancer = true;
 					}
 				}
 			}
 		}
 		else if (CurOutput->GetType() == EHoudiniOutputType::Landscape)
 		{
-			FHoudiniLandscapeTranslator::CalcHeightFieldsArrayGlobalZMinZMax(CurOutput->GetHoudiniGeoPartObjects(), LandscapeLayerGlobalMinimums, LandscapeLayerGlobalMaximums, false);
+			FHoudiniLandscapeTranslator::CalcHeightFieldsArrayGlobalZMinZMax(CurOutput->GetHoudiniGeoPartObjects(), OutState.LandscapeLayerGlobalMinimums, OutState.LandscapeLayerGlobalMaximums, false);
 		}
 	}
 
-	bOutHasHoudiniStaticMeshOutput = false;
+	OutState.bHasHoudiniStaticMeshOutput = false;
 
 	// Get all our landscape inputs
-	TArray<ALandscapeProxy*> AllInputLandscapes;
-	FHoudiniEngineUtils::GatherLandscapeInputs(Inputs, AllInputLandscapes);
+	FHoudiniEngineUtils::GatherLandscapeInputs(Inputs, OutState.AllInputLandscapes);
+
+	OutState.NumOutputs = Outputs.Num();
+	OutState.NextOutputIndex = 0;
+}
+
+void
+FHoudiniOutputTranslator::CreateNextOutput(
+	TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
+	UObject* InOuter,
+	UWorld* InWorld,
+	bool bIsProxyStaticMeshEnabled,
+	bool bHasNoProxyMeshNextCookBeenRequested,
+	bool bIsBakeAfterNextCookEnabled,
+	bool bSplitMeshSupport,
+	const FHoudiniStaticMeshGenerationProperties& InStaticMeshGenerationProperties,
+	const FMeshBuildSettings& InStaticMeshBuildSettings,
+	FHoudiniOutputProcessingState& InOutState)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::CreateNextOutput);
 
 	// ----------------------------------------------------
 	// 3.2 Process outputs
 	// ----------------------------------------------------
+	if (InOutState.HasProcessedAllOutputs())
+		return;
+
+	const int32 OutputIdx = InOutState.NextOutputIndex++;
+	UHoudiniOutput* CurOutput = Outputs.IsValidIndex(OutputIdx) ? Outputs[OutputIdx].Get() : nullptr;
+	if (!IsValid(CurOutput))
+		return;
+
+	FString Notification = FString::Format(TEXT("Processing output {0} / {1}..."), { FString::FromInt(OutputIdx + 1), FString::FromInt(InOutState.NumOutputs) });
+	FHoudiniEngine::Get().UpdateTaskSlateNotification(FText::FromString(Notification));
+
+	// TODO COOKABLE: Handle the case where the Out is NOT a component
+	// we need to split output asset creation from component creation!
+	UHoudiniCookable* OuterHC = Cast<UHoudiniCookable>(InOuter);
+	USceneComponent* InOuterComponent = Cast<USceneComponent>(InOuter);
+	if (!InOuterComponent)
+	{
+		InOuterComponent = OuterHC ? OuterHC->GetComponent() : nullptr;
+	}
+
+	// The data shared by all outputs lives in the processing state
+	const FHoudiniPackageParams& PackageParams = InOutState.PackageParams;
+	const int32 NumInstances = InOutState.NumInstances;
+	const bool bHasObjectInstancer = InOutState.bHasObjectInstancer;
+	bool& bOutHasHoudiniStaticMeshOutput = InOutState.bHasHoudiniStaticMeshOutput;
+	int32& NumVisibleOutputs = InOutState.NumVisibleOutputs;
+	int32& NumTextureOutputs = InOutState.NumTextureOutputs;
+	UTexture2D*& VisibleTexture = InOutState.VisibleTexture;
+	TArray<ALandscapeProxy*>& AllInputLandscapes = InOutState.AllInputLandscapes;
+
 	// Landscape creation will cache the first tile as a reference location
 	// in this struct to be used by during construction of subsequent tiles.
 	// Landscape Size info will be cached by the first tile, similar to LandscapeReferenceLocation
-	FHoudiniClearedEditLayers ClearedLandscapeLayers;
-	TMap<FString, ALandscape*> LandscapeMap;
+	FHoudiniClearedEditLayers& ClearedLandscapeLayers = InOutState.ClearedLandscapeLayers;
+	TMap<FString, ALandscape*>& LandscapeMap = InOutState.LandscapeMap;
 
 	// Landscape splines track edit layers that were cleared per-landscape
-	TMap<ALandscape*, TSet<FName>> ClearedLandscapeEditLayersForSplines;
+	TMap<ALandscape*, TSet<FName>>& ClearedLandscapeEditLayersForSplines = InOutState.ClearedLandscapeEditLayersForSplines;
 
 	// The houdini materials that have been generated by this HDA.
 	// We track them to prevent recreate the same houdini material over and over if it is assigned to multiple parts.
 	// (this can easily happen when using packed prims)
-	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>> AllOutputMaterials;
+	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>>& AllOutputMaterials = InOutState.AllOutputMaterials;
 
-	UTexture2D* VisibleTexture = nullptr;
-	UMaterialInterface* VisibleMat = nullptr;
-	int32 NumVisibleOutputs = 0;
-	int32 NumTextureOutputs = 0;
-	int32 NumOutputs = Outputs.Num();
-	bool bHasLandscape = false;
-	for (int32 OutputIdx = 0; OutputIdx < NumOutputs; OutputIdx++)
-	{
-		UHoudiniOutput* CurOutput = Outputs[OutputIdx];
-		if (!IsValid(CurOutput))
-			continue;
+	TArray<UPackage*>& OutCreatedPackages = InOutState.CreatedPackages;
 
-		FString Notification = FString::Format(TEXT("Processing output {0} / {1}..."), { FString::FromInt(OutputIdx + 1), FString::FromInt(NumOutputs) });
-		FHoudiniEngine::Get().UpdateTaskSlateNotification(FText::FromString(Notification));
+	/*
+	// TODO: Cookable ? Handle this case
+	if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
+	{
+		return;
+	}
+	*/
 
-		/*
-		// TODO: Cookable ? Handle this case
-		if (!HAC->IsOutputTypeSupported(CurOutput->GetType()))
+	switch (CurOutput->GetType())
+	{
+		case EHoudiniOutputType::Mesh:
 		{
-			continue;
-		}
-		*/
+			bool bEnableProxy = 
+				bIsProxyStaticMeshEnabled && !bHasNoProxyMeshNextCookBeenRequested && !bIsBakeAfterNextCookEnabled;
 
-		switch (CurOutput->GetType())
-		{
-			case EHoudiniOutputType::Mesh:
+			if (bEnableProxy && NumInstances > 1)
 			{
-				bool bEnableProxy = 
-					bIsProxyStaticMeshEnabled && !bHasNoProxyMeshNextCookBeenRequested && !bIsBakeAfterNextCookEnabled;
-
-				if (bEnableProxy && NumInstances > 1)
+				if (bHasObjectInstancer)
 				{
-					if (bHasObjectInstancer)
-					{
-						// Completely disable proxies if we have object instancers/old school attribute instancers
-						// as they rely on having a static mesh created (and the instanced mesh HGPO is not marked as instanced...)
-						bEnableProxy = false;
-					}
-					else
+					// Completely disable proxies if we have object instancers/old school attribute instancers
+					// as they rely on having a static mesh created (and the instanced mesh HGPO is not marked as instanced...)
+					bEnableProxy = false;
+				}
+				else
+				{
+					// If we dont have proxy instancer, enable proxy only for non-instanced mesh
+					for (const FHoudiniGeoPartObject& HGPO : CurOutput->GetHoudiniGeoPartObjects())
 					{
-						// If we dont have proxy instancer, enable proxy only for non-instanced mesh
-						for (const FHoudiniGeoPartObject& HGPO : CurOutput->GetHoudiniGeoPartObjects())
+						if (HGPO.bIsInstanced && HGPO.Type == EHoudiniPartType::Mesh)
 						{
-							if (HGPO.bIsInstanced && HGPO.Type == EHoudiniPartType::Mesh)
-							{
-								bEnableProxy = false;
-								break;
-							}
+							bEnableProxy = false;
+							break;
 						}
 					}
 				}
+			}
 
-				EHoudiniStaticMeshMethod MeshMethod = EHoudiniStaticMeshMethod::FMeshDescription;
-				if (bEnableProxy)
-					MeshMethod = EHoudiniStaticMeshMethod::UHoudiniStaticMesh;
-
-				FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
-					CurOutput,
-					PackageParams,
-					MeshMethod,
-					bSplitMeshSupport,
-					InStaticMeshGenerationProperties,
-					InStaticMeshBuildSettings,
-					AllOutputMaterials,
-					InOuterComponent);
-
-				NumVisibleOutputs++;
+			EHoudiniStaticMeshMethod MeshMethod = EHoudiniStaticMeshMethod::FMeshDescription;
+			if (bEnableProxy)
+				MeshMethod = EHoudiniStaticMeshMethod::UHoudiniStaticMesh;
 
-				// Look for UHoudiniStaticMesh in the output, and set bOutHasHoudiniStaticMeshOutput accordingly
-				if (bEnableProxy && !bOutHasHoudiniStaticMeshOutput)
-				{
-					bOutHasHoudiniStaticMeshOutput = bOutHasHoudiniStaticMeshOutput || CurOutput->HasAnyCurrentProxy();
-				}
+			FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
+				CurOutput,
+				PackageParams,
+				MeshMethod,
+				bSplitMeshSupport,
+				InStaticMeshGenerationProperties,
+				InStaticMeshBuildSettings,
+				AllOutputMaterials,
+				InOuterComponent);
 
-				// Make sure to mark the mesh output as a geometry collection mesh if it is one
-				if (FHoudiniGeometryCollectionTranslator::IsGeometryCollectionMesh(CurOutput))
-				{
-					for (auto& Pair : CurOutput->OutputObjects)
-						Pair.Value.bIsGeometryCollectionPiece = true;
-				}
+			NumVisibleOutputs++;
 
-				break;
+			// Look for UHoudiniStaticMesh in the output, and set bOutHasHoudiniStaticMeshOutput accordingly
+			if (bEnableProxy && !bOutHasHoudiniStaticMeshOutput)
+			{
+				bOutHasHoudiniStaticMeshOutput = bOutHasHoudiniStaticMeshOutput || CurOutput->HasAnyCurrentProxy();
 			}
 
-
-			case EHoudiniOutputType::Curve:
+			// Make sure to mark the mesh output as a geometry collection mesh if it is one
+			if (FHoudiniGeometryCollectionTranslator::IsGeometryCollectionMesh(CurOutput))
 			{
-				const TArray<FHoudiniGeoPartObject>& GeoPartObjects = CurOutput->GetHoudiniGeoPartObjects();
-				if (GeoPartObjects.Num() <= 0)
-					continue;
+				for (auto& Pair : CurOutput->OutputObjects)
+					Pair.Value.bIsGeometryCollectionPiece = true;
+			}
 
-				const FHoudiniGeoPartObject& CurHGPO = GeoPartObjects[0];
-				if (CurOutput->IsEditableNode())
-				{
-					if (!CurOutput->HasEditableNodeBuilt())
-					{
-						// Editable curve, only need to be built once. 
-						UHoudiniSplineComponent* HoudiniSplineComponent = FHoudiniSplineTranslator::CreateHoudiniSplineComponentFromHoudiniEditableNode(
-							CurHGPO.GeoId,
-							CurHGPO.PartName,
-							InOuterComponent);
+			break;
+		}
 
-						HoudiniSplineComponent->SetIsEditableOutputCurve(true);
 
-						FHoudiniOutputObjectIdentifier EditableSplineComponentIdentifier;
-						EditableSplineComponentIdentifier.ObjectId = CurHGPO.ObjectId;
-						EditableSplineComponentIdentifier.GeoId = CurHGPO.GeoId;
-						EditableSplineComponentIdentifier.PartId = CurHGPO.PartId;
-						EditableSplineComponentIdentifier.PartName = CurHGPO.PartName;
-
-						TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = CurOutput->GetOutputObjects();
-						FHoudiniOutputObject& FoundOutputObject = OutputObjects.FindOrAdd(EditableSplineComponentIdentifier);
-						check(FoundOutputObject.OutputComponents.Num() < 2); // Multiple components not supported yet.
-						FoundOutputObject.OutputComponents.Empty();
-						FoundOutputObject.OutputComponents.Add(HoudiniSplineComponent);
-						CurOutput->SetHasEditableNodeBuilt(true);
-					}
-				}
-				else
+		case EHoudiniOutputType::Curve:
+		{
+			const TArray<FHoudiniGeoPartObject>& GeoPartObjects = CurOutput->GetHoudiniGeoPartObjects();
+			if (GeoPartObjects.Num() <= 0)
+				return;
+
+			const FHoudiniGeoPartObject& CurHGPO = GeoPartObjects[0];
+			if (CurOutput->IsEditableNode())
+			{
+				if (!CurOutput->HasEditableNodeBuilt())
 				{
-					// Output curve
-					FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, InOuterComponent);
-					NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
-					break;
+					// Editable curve, only need to be built once. 
+					UHoudiniSplineComponent* HoudiniSplineComponent = FHoudiniSplineTranslator::CreateHoudiniSplineComponentFromHoudiniEditableNode(
+						CurHGPO.GeoId,
+						CurHGPO.PartName,
+						InOuterComponent);
+
+					HoudiniSplineComponent->SetIsEditableOutputCurve(true);
+
+					FHoudiniOutputObjectIdentifier EditableSplineComponentIdentifier;
+					EditableSplineComponentIdentifier.ObjectId = CurHGPO.ObjectId;
+					EditableSplineComponentIdentifier.GeoId = CurHGPO.GeoId;
+					EditableSplineComponentIdentifier.PartId = CurHGPO.PartId;
+					EditableSplineComponentIdentifier.PartName = CurHGPO.PartName;
+
+					TMap<FHoudiniOutputObjectIdentifier, FHoudiniOutputObject>& OutputObjects = CurOutput->GetOutputObjects();
+					FHoudiniOutputObject& FoundOutputObject = OutputObjects.FindOrAdd(EditableSplineComponentIdentifier);
+					check(FoundOutputObject.OutputComponents.Num() < 2); // Multiple components not supported yet.
+					FoundOutputObject.OutputComponents.Empty();
+					FoundOutputObject.OutputComponents.Add(HoudiniSplineComponent);
+					CurOutput->SetHasEditableNodeBuilt(true);
 				}
 			}
-			break;
-
-			case EHoudiniOutputType::Instancer:
-				InstancerOutputs.Add(CurOutput);
-				break;
-
-			case EHoudiniOutputType::Landscape:
+			else
 			{
-				NumVisibleOutputs++;
-
-				// No Cooked prefixed needed when cooking an HDA, the name is derived internally.
-				FString CookedPrefix;
-
-				FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
-					CurOutput,
-					AllInputLandscapes,
-					CookedPrefix,
-					InWorld,
-					PackageParams,
-					LandscapeMap,
-					ClearedLandscapeLayers,
-					OutCreatedPackages);
+				// Output curve
+				FHoudiniSplineTranslator::CreateAllSplinesFromHoudiniOutput(CurOutput, InOuterComponent);
+				NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
+				break;
+			}
+		}
+		break;
 
-				bHasLandscape = true;
+		case EHoudiniOutputType::Instancer:
+			// Instancers are created once all the other outputs have been processed
+			break;
 
-				for (auto& Pair : CurOutput->GetOutputObjects())
+		case EHoudiniOutputType::Landscape:
+		{
+			NumVisibleOutputs++;
+
+			// No Cooked prefixed needed when cooking an HDA, the name is derived internally.
+			FString CookedPrefix;
+
+			FHoudiniLandscapeTranslator::ProcessLandscapeOutput(
+				CurOutput,
+				AllInputLandscapes,
+				CookedPrefix,
+				InWorld,
+				PackageParams,
+				LandscapeMap,
+				ClearedLandscapeLayers,
+				OutCreatedPackages);
+
+			for (auto& Pair : CurOutput->GetOutputObjects())
+			{
+				UHoudiniLandscapeTargetLayerOutput* LayerOutput = Cast<UHoudiniLandscapeTargetLayerOutput>(Pair.Value.OutputObject);
+				if (IsValid(LayerOutput))
 				{
-					UHoudiniLandscapeTargetLayerOutput* LayerOutput = Cast<UHoudiniLandscapeTargetLayerOutput>(Pair.Value.OutputObject);
-					if (IsValid(LayerOutput))
+					ALandscapeProxy* OutputLandscape = LayerOutput->Landscape;
+					if (OutputLandscape && !LayerOutput->PropertyAttributes.IsEmpty())
 					{
-						ALandscapeProxy* OutputLandscape = LayerOutput->Landscape;
-						if (OutputLandscape && !LayerOutput->PropertyAttributes.IsEmpty())
-						{
-							FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(OutputLandscape, LayerOutput->PropertyAttributes);
-							OutputLandscape->GetLandscapeInfo()->FixupProxiesTransform();
-							OutputLandscape->GetLandscapeInfo()->RecreateLandscapeInfo(InWorld, true);
-							OutputLandscape->RecreateCollisionComponents();
-							FEditorDelegates::PostLandscapeLayerUpdated.Broadcast();
-						}
+						FHoudiniEngineUtils::UpdateGenericPropertiesAttributes(OutputLandscape, LayerOutput->PropertyAttributes);
+						OutputLandscape->GetLandscapeInfo()->FixupProxiesTransform();
+						OutputLandscape->GetLandscapeInfo()->RecreateLandscapeInfo(InWorld, true);
+						OutputLandscape->RecreateCollisionComponents();
+						FEditorDelegates::PostLandscapeLayerUpdated.Broadcast();
 					}
-					break;
 				}
 				break;
 			}
+			break;
+		}
 
-			case EHoudiniOutputType::DataTable:
+		case EHoudiniOutputType::DataTable:
+		{
+			for (auto&& HGPO : CurOutput->HoudiniGeoPartObjects)
 			{
-				for (auto&& HGPO : CurOutput->HoudiniGeoPartObjects)
-				{
-					FHoudiniDataTableTranslator::BuildDataTable(HGPO, CurOutput, PackageParams);
-				}
-				break;
+				FHoudiniDataTableTranslator::BuildDataTable(HGPO, CurOutput, PackageParams);
 			}
+			break;
+		}
 
-			case EHoudiniOutputType::LandscapeSpline:
+		case EHoudiniOutputType::LandscapeSpline:
+		{
+			if (!FHoudiniLandscapeSplineTranslator::ProcessLandscapeSplineOutput(
+				CurOutput,
+				AllInputLandscapes,
+				InWorld,
+				PackageParams,
+				ClearedLandscapeEditLayersForSplines))
 			{
-				if (!FHoudiniLandscapeSplineTranslator::ProcessLandscapeSplineOutput(
-					CurOutput,
-					AllInputLandscapes,
-					InWorld,
-					PackageParams,
-					ClearedLandscapeEditLayersForSplines))
-				{
-					break;
-				}
-
-				// Translation successful
-				NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
 				break;
 			}
 
-			case EHoudiniOutputType::AnimSequence:
-			{
-				FHoudiniAnimationTranslator::CreateAnimSequenceFromOutput(CurOutput, PackageParams, InOuterComponent);
-				break;
-			}
+			// Translation successful
+			NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
+			break;
+		}
 
-			case EHoudiniOutputType::PCG:
-			{
+		case EHoudiniOutputType::AnimSequence:
+		{
+			FHoudiniAnimationTranslator::CreateAnimSequenceFromOutput(CurOutput, PackageParams, InOuterComponent);
+			break;
+		}
+
+		case EHoudiniOutputType::PCG:
+		{
 #if defined(HOUDINI_USE_PCG)
-				FHoudiniPCGTranslator::CreatePCGFromOutput(CurOutput);
+			FHoudiniPCGTranslator::CreatePCGFromOutput(CurOutput);
 #endif
-				break;
-			}
+			break;
+		}
 
-			case EHoudiniOutputType::Skeletal:
-			{
-				FHoudiniSkeletalMeshTranslator::ProcessSkeletalMeshOutputs(
-					CurOutput, PackageParams, AllOutputMaterials, InOuterComponent);
+		case EHoudiniOutputType::Skeletal:
+		{
+			FHoudiniSkeletalMeshTranslator::ProcessSkeletalMeshOutputs(
+				CurOutput, PackageParams, AllOutputMaterials, InOuterComponent);
 
-				NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
-				break;
-			}
+			NumVisibleOutputs += CurOutput->GetOutputObjects().Num();
+			break;
+		}
 
-			case EHoudiniOutputType::Cop:
-			{
-				FHoudiniTextureTranslator::ProcessCopOutput(CurOutput, PackageParams);
+		case EHoudiniOutputType::Cop:
+		{
+			FHoudiniTextureTranslator::ProcessCopOutput(CurOutput, PackageParams);
 
-				NumTextureOutputs += CurOutput->GetOutputObjects().Num();
-				for (auto& It : CurOutput->GetOutputObjects())
-				{
-					// If we haven;t already selected a texture to display..
-					if (IsValid(VisibleTexture))
-						break;
+			NumTextureOutputs += CurOutput->GetOutputObjects().Num();
+			for (auto& It : CurOutput->GetOutputObjects())
+			{
+				// If we haven;t already selected a texture to display..
+				if (IsValid(VisibleTexture))
+					break;
 
-					// ... Get the first valid texture for display purpose
-					VisibleTexture = Cast<UTexture2D>(It.Value.OutputObject);
-					if (IsValid(VisibleTexture))
-						break;
-				}
-				break;
+				// ... Get the first valid texture for display purpose
+				VisibleTexture = Cast<UTexture2D>(It.Value.OutputObject);
+				if (IsValid(VisibleTexture))
+					break;
 			}
-
-			default:
-				// Do Nothing for now
-				break;
+			break;
 		}
 
-		for (auto& CurMat : CurOutput->AssignmentMaterialsById)
-		{
-			// Add the newly generated materials if any
-			if (!AllOutputMaterials.Contains(CurMat.Key))
-				AllOutputMaterials.Add(CurMat);
-		}
+		default:
+			// Do Nothing for now
+			break;
+	}
+
+	for (auto& CurMat : CurOutput->AssignmentMaterialsById)
+	{
+		// Add the newly generated materials if any
+		if (!AllOutputMaterials.Contains(CurMat.Key))
+			AllOutputMaterials.Add(CurMat);
+	}
+}
+
+void
+FHoudiniOutputTranslator::FinishCreateAllOutputs(
+	TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
+	UObject* InOuter,
+	UWorld* InWorld,
+	FHoudiniOutputProcessingState& InOutState)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::FinishCreateAllOutputs);
+
+	UHoudiniCookable* OuterHC = Cast<UHoudiniCookable>(InOuter);
+	USceneComponent* InOuterComponent = Cast<USceneComponent>(InOuter);
+	if (!InOuterComponent)
+	{
+		InOuterComponent = OuterHC ? OuterHC->GetComponent() : nullptr;
 	}
 
+	const FHoudiniPackageParams& PackageParams = InOutState.PackageParams;
+
+	// ----------------------------------------------------
+	// 3.3 Process instancers
+	// ----------------------------------------------------
 	bool HasGeometryCollection = false;
 
 	// Now that all meshes have been created, process the instancers
 	int InstanceCount = FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(Outputs, InOuterComponent, PackageParams);
-	NumVisibleOutputs += InstanceCount;
+	InOutState.NumVisibleOutputs += InstanceCount;
 
-	for (auto& CurOutput : InstancerOutputs)
+	for (auto& CurOutput : Outputs)
 	{
-		if (!HasGeometryCollection && FHoudiniGeometryCollectionTranslator::IsGeometryCollectionInstancer(CurOutput))
+		if (!IsValid(CurOutput) || CurOutput->GetType() != EHoudiniOutputType::Instancer)
+			continue;
+
+		if (FHoudiniGeometryCollectionTranslator::IsGeometryCollectionInstancer(CurOutput))
 		{
 			HasGeometryCollection = true;
 			break;
@@ -699,14 +795,16 @@ FHoudiniOutputTranslator::CreateAllOutputs(
 		FHoudiniGeometryCollectionTranslator::SetupGeometryCollectionComponentFromOutputs(Outputs, OutputOwner, InOuterComponent, PackageParams, InWorld);
 	}
 
-	if (NumVisibleOutputs > 0)
+	UTexture2D* VisibleTexture = InOutState.VisibleTexture;
+	UMaterialInterface* VisibleMat = nullptr;
+	if (InOutState.NumVisibleOutputs > 0)
 	{
 		// If we have valid outputs, we don't need to display the houdini logo anymore...
 		FHoudiniEngineUtils::RemoveHoudiniLogoFromComponent(InOuterComponent);
 		// .. or the default COP nesh
 		FHoudiniEngineUtils::RemoveTextureMeshFromComponent(InOuterComponent);
 	}
-	else if (NumTextureOutputs > 0)
+	else if (InOutState.NumTextureOutputs > 0)
 	{
 		// Create a temporary material to display the texture
 		if (VisibleTexture)
@@ -727,8 +825,28 @@ FHoudiniOutputTranslator::CreateAllOutputs(
 		// ... if we don't have any valid outputs however, display the Houdini logo
 		FHoudiniEngineUtils::AddHoudiniLogoToComponent(InOuterComponent);
 	}
+}
 
-	return true;
+void
+FHoudiniOutputProcessingState::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	Collector.AddReferencedObjects(AllInputLandscapes);
+	for (auto& Pair : LandscapeMap)
+		Collector.AddReferencedObject(Pair.Value);
+
+	for (auto& Pair : AllOutputMaterials)
+		Collector.AddReferencedObject(Pair.Value);
+
+	Collector.AddReferencedObject(VisibleTexture);
+	Collector.AddReferencedObjects(CreatedPackages);
+}
+
+
+void
+FHoudiniProxyRefinementState::AddReferencedObjects(FReferenceCollector& Collector)
+{
+	for (auto& Pair : AllOutputMaterials)
+		Collector.AddReferencedObject(Pair.Value);
 }
 
 
@@ -834,14 +952,24 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 	UHoudiniCookable* HC,
 	bool bInDestroyProxies)
 {
-	if (!IsValid(HC))
+	TSharedPtr<FHoudiniProxyRefinementState> State = BeginBuildStaticMeshesOnHoudiniProxyMeshOutputs(HC, bInDestroyProxies);
+	if (!State.IsValid())
 		return false;
 
-	UObject* OuterComponent = HC->GetComponent();
-	if(!OuterComponent)
-		OuterComponent = HC;
+	return ContinueBuildStaticMeshesOnHoudiniProxyMeshOutputs(HC, *State, 0.0);
+}
+
+TSharedPtr<FHoudiniProxyRefinementState>
+FHoudiniOutputTranslator::BeginBuildStaticMeshesOnHoudiniProxyMeshOutputs(
+	UHoudiniCookable* HC,
+	bool bInDestroyProxies)
+{
+	if (!IsValid(HC))
+		return nullptr;
+
+	TSharedPtr<FHoudiniProxyRefinementState> State = MakeShared<FHoudiniProxyRefinementState>();
 
-	FHoudiniPackageParams PackageParams;
+	FHoudiniPackageParams& PackageParams = State->PackageParams;
 	PackageParams.PackageMode = FHoudiniPackageParams::GetDefaultStaticMeshesCookMode();
 	PackageParams.ReplaceMode = FHoudiniPackageParams::GetDefaultReplaceMode();
 
@@ -854,26 +982,63 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 	PackageParams.ComponentGUID = HC->GetCookableGUID();
 	PackageParams.ObjectName = FString();
 
-	// Keep track of all generated houdini materials to avoid recreating them over and over
-	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>> AllOutputMaterials;
+	State->bDestroyProxies = bInDestroyProxies;
+	State->CookCount = HC->GetCookCount();
 
-	bool bFoundProxies = false;
-	TArray<UHoudiniOutput*> InstancerOutputs;
-	for(int Idx = 0; Idx < HC->GetNumOutputs(); Idx++)
+	for (int Idx = 0; Idx < HC->GetNumOutputs(); Idx++)
 	{
 		UHoudiniOutput* CurOutput = HC->GetOutputAt(Idx);
 		if (!CurOutput)
 			continue;
 
+		State->Outputs.Add(CurOutput);
+		if (CurOutput->GetType() == EHoudiniOutputType::Mesh && CurOutput->HasAnyCurrentProxy())
+			State->NumMeshOutputs++;
+	}
+
+	return State;
+}
+
+bool
+FHoudiniOutputTranslator::ContinueBuildStaticMeshesOnHoudiniProxyMeshOutputs(
+	UHoudiniCookable* HC,
+	FHoudiniProxyRefinementState& InOutState,
+	double InEndTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniOutputTranslator::ContinueBuildStaticMeshesOnHoudiniProxyMeshOutputs);
+
+	if (InOutState.bFinished)
+		return true;
+
+	if (!IsValid(HC))
+	{
+		InOutState.bFinished = true;
+		return true;
+	}
+
+	UObject* OuterComponent = HC->GetComponent();
+	if(!OuterComponent)
+		OuterComponent = HC;
+
+	// Keep track of all generated houdini materials to avoid recreating them over and over
+	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>>& AllOutputMaterials = InOutState.AllOutputMaterials;
+
+	while (InOutState.NextOutputIndex < InOutState.Outputs.Num())
+	{
+		UHoudiniOutput* CurOutput = InOutState.Outputs[InOutState.NextOutputIndex++].Get();
+		if (!IsValid(CurOutput))
+			continue;
+
+		bool bRefinedMesh = false;
 		const EHoudiniOutputType OutputType = CurOutput->GetType();
 		if (OutputType == EHoudiniOutputType::Mesh)
 		{
 			if (CurOutput->HasAnyCurrentProxy())
 			{
-				bFoundProxies = true;
+				InOutState.bFoundProxies = true;
 				FHoudiniMeshTranslator::CreateAllMeshesAndComponentsFromHoudiniOutput(
 					CurOutput,
-					PackageParams,
+					InOutState.PackageParams,
 					EHoudiniStaticMeshMethod::FMeshDescription,
 					HC->GetSplitMeshSupport(),
 					HC->GetStaticMeshGenerationProperties(),
@@ -881,8 +1046,11 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 					AllOutputMaterials,
 					OuterComponent,
 					true, // bInTreatExistingMaterialsAsUpToDate
-					bInDestroyProxies
-				);  
+					InOutState.bDestroyProxies
+				);
+
+				InOutState.NumRefinedMeshOutputs++;
+				bRefinedMesh = true;
 			}
 		}
 		else if (OutputType == EHoudiniOutputType::Instancer)
@@ -894,8 +1062,8 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 				{
 					// This is a single instance instancer (a mesh) 
 					// that will need to be rebuilt
-					InstancerOutputs.Add(CurOutput);
-					bFoundProxies = true;
+					InOutState.InstancerOutputs.AddUnique(CurOutput);
+					InOutState.bFoundProxies = true;
 				}
 			}
 		}
@@ -906,15 +1074,28 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 			if (!AllOutputMaterials.Contains(CurMat.Key))
 				AllOutputMaterials.Add(CurMat);
 		}
+
+		// Continue on the next tick if we're out of time
+		if (bRefinedMesh && InEndTime > 0.0 && FPlatformTime::Seconds() >= InEndTime)
+			return false;
+	}
+
+	InOutState.bFinished = true;
+
+	TArray<UHoudiniOutput*> InstancerOutputs;
+	for (const TWeakObjectPtr<UHoudiniOutput>& CurOutput : InOutState.InstancerOutputs)
+	{
+		if (CurOutput.IsValid())
+			InstancerOutputs.Add(CurOutput.Get());
 	}
 
 	// Return if no proxies or instancers were found
-	if (!bFoundProxies || InstancerOutputs.Num() <= 0)
+	if (!InOutState.bFoundProxies || InstancerOutputs.Num() <= 0)
 		return true;
 
 	// We might need to also rebuild some instancer outputs (single instance instancer)
 	// And we might need to destroy the proxies for the instancer outputs before rebuilding the instancer
-	if (bInDestroyProxies)
+	if (InOutState.bDestroyProxies)
 	{
 		for (auto& CurOutput : InstancerOutputs)
 		{
@@ -932,7 +1113,7 @@ FHoudiniOutputTranslator::BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 	}
 
 	// Rebuild the instancers
-	FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(InstancerOutputs, HC->GetOutputs(), OuterComponent, PackageParams);
+	FHoudiniInstanceTranslator::CreateAllInstancersFromHoudiniOutputs(InstancerOutputs, HC->GetOutputs(), OuterComponent, InOutState.PackageParams);
 
 	return true;
 }
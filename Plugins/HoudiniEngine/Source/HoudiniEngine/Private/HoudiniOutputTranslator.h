@@ -29,6 +29,9 @@
 #include "HAPI/HAPI_Common.h"
 #include "CoreMinimal.h"
 #include "HoudiniEngineRuntime.h"
+#include "HoudiniOutput.h"
+#include "HoudiniPackageParams.h"
+#include "UObject/GCObject.h"
 
 class UHoudiniOutput;
 class UHoudiniInput;
@@ -36,6 +39,10 @@ class AActor;
 class UActorComponent;
 class USceneComponent;
 class UHoudiniCookable;
+class ALandscape;
+class ALandscapeProxy;
+class UMaterialInterface;
+class UTexture2D;
 
 struct FHoudiniObjectInfo;
 struct FHoudiniGeoInfo;
@@ -51,6 +58,102 @@ enum class EHoudiniGeoType : uint8;
 enum class EHoudiniPartType : uint8;
 enum class EHoudiniCurveType : int8;
 
+// State of the creation of a cookable's outputs.
+// Lets the outputs be created one at a time, so that their processing can be spread over multiple ticks.
+// Keeps the objects that are shared between outputs (landscapes, materials...) alive in between.
+struct HOUDINIENGINE_API FHoudiniOutputProcessingState : public FGCObject
+{
+public:
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FHoudiniOutputProcessingState"); }
+
+	int32 GetNumOutputs() const { return NumOutputs; }
+	int32 GetNumProcessedOutputs() const { return NextOutputIndex; }
+	bool HasProcessedAllOutputs() const { return NextOutputIndex >= NumOutputs; }
+	bool IsFinished() const { return bFinished; }
+
+	// Package params used for all the outputs
+	FHoudiniPackageParams PackageParams;
+
+	// Number of outputs when processing started, and index of the next one to create
+	int32 NumOutputs = 0;
+	int32 NextOutputIndex = 0;
+
+	// Prepass results: total number of instances, and whether we have object instancers
+	int32 NumInstances = 0;
+	bool bHasObjectInstancer = false;
+
+	// Landscape layers' global min/max values
+	TMap<FString, float> LandscapeLayerGlobalMinimums;
+	TMap<FString, float> LandscapeLayerGlobalMaximums;
+
+	// Landscape inputs, and landscapes created / edit layers cleared by the landscape outputs processed so far
+	TArray<ALandscapeProxy*> AllInputLandscapes;
+	FHoudiniClearedEditLayers ClearedLandscapeLayers;
+	TMap<FString, ALandscape*> LandscapeMap;
+	TMap<ALandscape*, TSet<FName>> ClearedLandscapeEditLayersForSplines;
+
+	// The houdini materials that have been generated by the outputs processed so far
+	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>> AllOutputMaterials;
+
+	UTexture2D* VisibleTexture = nullptr;
+	int32 NumVisibleOutputs = 0;
+	int32 NumTextureOutputs = 0;
+
+	bool bHasHoudiniStaticMeshOutput = false;
+	TArray<UPackage*> CreatedPackages;
+
+	// Indicates all outputs have been created, and the post-create steps (instancers, cleanup...) are done
+	bool bFinished = false;
+
+	// Set to false if processing had to be stopped before all the outputs were created
+	bool bSuccess = true;
+};
+
+// State of the refinement of a cookable's proxy meshes to static meshes.
+// Lets the proxy mesh outputs be refined one at a time, so that refinement can be spread over multiple ticks.
+struct HOUDINIENGINE_API FHoudiniProxyRefinementState : public FGCObject
+{
+public:
+
+	// FGCObject interface
+	virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+	virtual FString GetReferencerName() const override { return TEXT("FHoudiniProxyRefinementState"); }
+
+	int32 GetNumMeshOutputs() const { return NumMeshOutputs; }
+	int32 GetNumRefinedMeshOutputs() const { return NumRefinedMeshOutputs; }
+	bool IsFinished() const { return bFinished; }
+
+	// Package params used for all the static meshes
+	FHoudiniPackageParams PackageParams;
+
+	// Whether the proxies are destroyed once refined
+	bool bDestroyProxies = false;
+
+	// Cook count of the cookable when refinement started
+	int32 CookCount = 0;
+
+	// Outputs of the cookable when refinement started, and index of the next one to process
+	TArray<TWeakObjectPtr<UHoudiniOutput>> Outputs;
+	int32 NextOutputIndex = 0;
+
+	// Number of mesh outputs that had proxies when refinement started, and number of them refined so far
+	int32 NumMeshOutputs = 0;
+	int32 NumRefinedMeshOutputs = 0;
+
+	// Single instance instancers using a proxy, they are rebuilt once all the meshes are refined
+	TArray<TWeakObjectPtr<UHoudiniOutput>> InstancerOutputs;
+	bool bFoundProxies = false;
+
+	// The houdini materials of the outputs processed so far
+	TMap<FHoudiniMaterialIdentifier, TObjectPtr<UMaterialInterface>> AllOutputMaterials;
+
+	// Indicates all outputs have been refined, and the instancers rebuilt
+	bool bFinished = false;
+};
+
 struct HOUDINIENGINE_API FHoudiniOutputTranslator
 {
 public:
@@ -58,16 +161,42 @@ public:
 	// 
 	static bool UpdateOutputs(UHoudiniCookable* HC);
 
-	//
+	// Creates all the outputs of a cookable in one go
 	static bool ProcessOutputs(
 		UHoudiniCookable* HC,
 		bool& bOutHasHoudiniStaticMeshOutput);
 
-	//
+	// Starts processing the outputs of a cookable.
+	// Returns the state to pass to ContinueProcessOutputs(), or null if the outputs can't be processed.
+	static TSharedPtr<FHoudiniOutputProcessingState> BeginProcessOutputs(UHoudiniCookable* HC);
+
+	// Creates the cookable's outputs, one at a time, until InEndTime (FPlatformTime::Seconds()) is reached.
+	// At least one output is created per call. An InEndTime of 0 processes all the remaining outputs.
+	// Returns true once all outputs have been created and the post-create steps are done.
+	static bool ContinueProcessOutputs(
+		UHoudiniCookable* HC,
+		FHoudiniOutputProcessingState& InOutState,
+		double InEndTime);
+
+	// Builds UStaticMesh for all the proxy meshes of a cookable in one go
 	static bool BuildStaticMeshesOnHoudiniProxyMeshOutputs(
 		UHoudiniCookable* HC,
 		bool bInDestroyProxies = false);
 
+	// Starts refining the proxy meshes of a cookable.
+	// Returns the state to pass to ContinueBuildStaticMeshesOnHoudiniProxyMeshOutputs(), or null if the cookable is invalid.
+	static TSharedPtr<FHoudiniProxyRefinementState> BeginBuildStaticMeshesOnHoudiniProxyMeshOutputs(
+		UHoudiniCookable* HC,
+		bool bInDestroyProxies = false);
+
+	// Builds the UStaticMesh of the cookable's proxy mesh outputs, one output at a time, until InEndTime (FPlatformTime::Seconds()) is reached.
+	// At least one output is refined per call. An InEndTime of 0 refines all the remaining outputs.
+	// Returns true once all outputs have been refined and the instancers using proxies have been rebuilt.
+	static bool ContinueBuildStaticMeshesOnHoudiniProxyMeshOutputs(
+		UHoudiniCookable* HC,
+		FHoudiniProxyRefinementState& InOutState,
+		double InEndTime);
+
 	//
 	static bool UpdateLoadedOutputs(
 		HAPI_NodeId InNodeId,
@@ -129,11 +258,17 @@ protected:
 	static bool UpdateOutputAttributesAndTags(UHoudiniCookable* InHC);
 
 	// 3. Create the actual outputs assets/components
-	static bool CreateAllOutputs(
-		TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
+	// 3.1 Outputs prepass, initializes the processing state
+	static void BeginCreateAllOutputs(
+		const TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
 		const TArray<TObjectPtr<UHoudiniInput>>& Inputs,
-		const FHoudiniPackageParams& PackageParams,
-		UObject* InOuterComponent,
+		UWorld* InWorld,
+		FHoudiniOutputProcessingState& OutState);
+
+	// 3.2 Create the next output's assets/components
+	static void CreateNextOutput(
+		TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
+		UObject* InOuter,
 		UWorld* InWorld,
 		bool bIsProxyStaticMeshEnabled,
 		bool bHasNoProxyMeshNextCookBeenRequested,
@@ -141,8 +276,14 @@ protected:
 		bool bSplitMeshSupport,
 		const FHoudiniStaticMeshGenerationProperties& InStaticMeshGenerationProperties,
 		const FMeshBuildSettings& InStaticMeshBuildSettings,
-		bool& bOutHasHoudiniStaticMeshOutput,
-		TArray<UPackage*>& OutCreatedPackages);
+		FHoudiniOutputProcessingState& InOutState);
+
+	// 3.3 Create the instancers, once all other outputs have been created
+	static void FinishCreateAllOutputs(
+		TArray<TObjectPtr<UHoudiniOutput>>& Outputs,
+		UObject* InOuter,
+		UWorld* InWorld,
+		FHoudiniOutputProcessingState& InOutState);
 
 	// 4. Output cleanup
 	static void CleanOutputsPostCreate(
@@ -0,0 +1,257 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniProxyRefinementQueue.h"
+
+#include "HoudiniEngine.h"
+#include "HoudiniEnginePrivatePCH.h"
+#include "HoudiniCookable.h"
+#include "HoudiniOutput.h"
+#include "HoudiniOutputTranslator.h"
+
+#include "Components/PrimitiveComponent.h"
+
+#if WITH_EDITOR
+	#include "Editor.h"
+	#include "EditorViewportClient.h"
+#endif
+
+void
+FHoudiniProxyRefinementQueue::Enqueue(UHoudiniCookable* HC)
+{
+	if (!IsValid(HC))
+		return;
+
+	FRequest* ExistingRequest = Requests.FindByPredicate([HC](const FRequest& Request) { return Request.Cookable.Get() == HC; });
+	if (ExistingRequest)
+	{
+		// Already queued for the proxies of the current cook
+		if (ExistingRequest->State->CookCount == HC->GetCookCount())
+			return;
+
+		Cancel(HC);
+	}
+
+	TSharedPtr<FHoudiniProxyRefinementState> State = FHoudiniOutputTranslator::BeginBuildStaticMeshesOnHoudiniProxyMeshOutputs(HC);
+	if (!State.IsValid())
+		return;
+
+	FRequest& NewRequest = Requests.AddDefaulted_GetRef();
+	NewRequest.Cookable = HC;
+	NewRequest.State = State;
+}
+
+bool
+FHoudiniProxyRefinementQueue::Cancel(const UHoudiniCookable* HC)
+{
+	return Requests.RemoveAll([HC](const FRequest& Request) { return Request.Cookable.Get() == HC; }) > 0;
+}
+
+void
+FHoudiniProxyRefinementQueue::CancelAll()
+{
+	Requests.Empty();
+}
+
+bool
+FHoudiniProxyRefinementQueue::IsQueued(const UHoudiniCookable* HC) const
+{
+	return Requests.ContainsByPredicate([HC](const FRequest& Request) { return Request.Cookable.Get() == HC; });
+}
+
+void
+FHoudiniProxyRefinementQueue::Tick(double InEndTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniProxyRefinementQueue::Tick);
+
+	// Drop the refinements that have been cancelled by a new cook, or that were done by a synchronous refinement
+	for (int32 Idx = Requests.Num() - 1; Idx >= 0; Idx--)
+	{
+		if (IsRequestValid(Requests[Idx]))
+			continue;
+
+		UHoudiniCookable* HC = Requests[Idx].Cookable.Get();
+		if (IsValid(HC))
+			HOUDINI_LOG_MESSAGE(TEXT("%s: Proxy mesh refinement cancelled, the proxies have been replaced or refined."), *HC->GetDisplayName());
+
+		Requests.RemoveAt(Idx);
+	}
+
+	if (Requests.Num() <= 0)
+		return;
+
+	SortRequests();
+
+	for (int32 Idx = 0; Idx < Requests.Num(); )
+	{
+		UHoudiniCookable* HC = Requests[Idx].Cookable.Get();
+		if (IsRefinementPaused(HC))
+		{
+			Idx++;
+			continue;
+		}
+
+		TSharedPtr<FHoudiniProxyRefinementState> State = Requests[Idx].State;
+		if (!FHoudiniOutputTranslator::ContinueBuildStaticMeshesOnHoudiniProxyMeshOutputs(HC, *State, InEndTime))
+		{
+			// Out of time, continue on the next tick
+			if (HC->GetDoSlateNotifications())
+			{
+				FString Notification = FString::Format(TEXT("{0} :\nRefining proxy meshes {1} / {2}..."),
+					{ HC->GetDisplayName(), FString::FromInt(State->GetNumRefinedMeshOutputs()), FString::FromInt(State->GetNumMeshOutputs()) });
+				FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString(Notification), false);
+			}
+
+			return;
+		}
+
+		HOUDINI_LOG_MESSAGE(TEXT("%s: Refined %d proxy mesh output(s) to static meshes."), *HC->GetDisplayName(), State->GetNumRefinedMeshOutputs());
+		if (HC->GetDoSlateNotifications())
+			FHoudiniEngine::Get().UpdateCookingNotification(FText::FromString(HC->GetDisplayName() + " :\nFinished refining proxy meshes"), true);
+
+		Requests.RemoveAt(Idx);
+
+		if (InEndTime > 0.0 && FPlatformTime::Seconds() >= InEndTime)
+			return;
+	}
+}
+
+bool
+FHoudiniProxyRefinementQueue::IsRequestValid(const FRequest& InRequest)
+{
+	UHoudiniCookable* HC = InRequest.Cookable.Get();
+	if (!IsValid(HC) || !InRequest.State.IsValid())
+		return false;
+
+	// A new cook replaces the proxies we were refining
+	if (HC->GetCookCount() != InRequest.State->CookCount || HC->GetCurrentState() != EHoudiniAssetState::None)
+		return false;
+
+	// Same if a cook is about to start
+	if (HC->HasRecookBeenRequested() || HC->NeedUpdateParameters() || HC->NeedUpdateInputs())
+		return false;
+
+	// The proxies have been refined already (on save, by a refine command...)
+	if (InRequest.State->GetNumRefinedMeshOutputs() == 0 && !HC->HasAnyCurrentProxyOutput())
+		return false;
+
+	return true;
+}
+
+bool
+FHoudiniProxyRefinementQueue::IsRefinementPaused(UHoudiniCookable* HC)
+{
+	UWorld* World = HC->GetWorld();
+	if (World && (World->IsPlayingReplay() || World->IsPlayInEditor()))
+	{
+		UCookableProxyData* ProxyData = HC->GetProxyData();
+		if (!ProxyData || !ProxyData->bAllowPlayInEditorRefinement)
+			return true;
+	}
+
+	return false;
+}
+
+void
+FHoudiniProxyRefinementQueue::SortRequests()
+{
+	if (Requests.Num() <= 1)
+		return;
+
+	bool bHasView = false;
+	bool bIsPerspective = false;
+	FVector ViewLocation = FVector::ZeroVector;
+	FVector ViewDirection = FVector::ForwardVector;
+	double ViewHalfFOV = 0.0;
+
+#if WITH_EDITOR
+	// Get the active viewport's camera
+	if (GEditor && GEditor->GetActiveViewport())
+	{
+		FEditorViewportClient* ViewportClient = (FEditorViewportClient*)GEditor->GetActiveViewport()->GetClient();
+		if (ViewportClient)
+		{
+			bHasView = true;
+			bIsPerspective = ViewportClient->IsPerspective();
+			ViewLocation = ViewportClient->GetViewLocation();
+			ViewDirection = ViewportClient->GetViewRotation().Vector();
+			ViewHalfFOV = FMath::DegreesToRadians(ViewportClient->ViewFOV * 0.5);
+		}
+	}
+#endif
+
+	for (FRequest& Request : Requests)
+	{
+		Request.bVisible = false;
+		Request.DistanceSquared = TNumericLimits<double>::Max();
+
+		UHoudiniCookable* HC = Request.Cookable.Get();
+		if (!IsValid(HC))
+			continue;
+
+		for (const TObjectPtr<UHoudiniOutput>& CurOutput : HC->GetOutputs())
+		{
+			if (!IsValid(CurOutput))
+				continue;
+
+			for (const auto& CurOutputObject : CurOutput->GetOutputObjects())
+			{
+				if (!CurOutputObject.Value.bProxyIsCurrent)
+					continue;
+
+				UPrimitiveComponent* ProxyComponent = Cast<UPrimitiveComponent>(CurOutputObject.Value.ProxyComponent);
+				if (!IsValid(ProxyComponent))
+					continue;
+
+				const FBoxSphereBounds& Bounds = ProxyComponent->Bounds;
+				const FVector ToBounds = Bounds.Origin - ViewLocation;
+				const double Distance = ToBounds.Size();
+				Request.DistanceSquared = FMath::Min(Request.DistanceSquared, Distance * Distance);
+
+				// Visible if rendered recently, and for perspective views, if the bounds are in the camera's field of view
+				bool bVisible = ProxyComponent->WasRecentlyRendered(0.5f);
+				if (bVisible && bHasView && bIsPerspective && Distance > Bounds.SphereRadius)
+				{
+					const double AngleToBounds = FMath::Acos(FMath::Clamp(FVector::DotProduct(ToBounds / Distance, ViewDirection), -1.0, 1.0));
+					const double BoundsHalfAngle = FMath::Asin(FMath::Clamp(Bounds.SphereRadius / Distance, 0.0, 1.0));
+					bVisible = AngleToBounds - BoundsHalfAngle <= ViewHalfFOV;
+				}
+
+				Request.bVisible |= bVisible;
+			}
+		}
+	}
+
+	// Visible proxies first, then the closest to the camera. Keep the queue order otherwise.
+	Requests.StableSort([](const FRequest& A, const FRequest& B)
+	{
+		if (A.bVisible != B.bVisible)
+			return A.bVisible;
+
+		return A.DistanceSquared < B.DistanceSquared;
+	});
+}
@@ -0,0 +1,87 @@
+/*
+* Copyright (c) <2021> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class UHoudiniCookable;
+
+struct FHoudiniProxyRefinementState;
+
+// Refines the proxy meshes of cookables to static meshes in the background.
+// The refinement of each queued cookable is spread over multiple ticks: every tick refines proxy mesh outputs until
+// the tick's time limit is reached. Cookables whose proxies are visible in the active viewport are refined first.
+// A queued refinement is cancelled when a new cook of the cookable replaces its proxies.
+struct HOUDINIENGINE_API FHoudiniProxyRefinementQueue
+{
+public:
+
+	// Queues the refinement of the cookable's proxy meshes.
+	// Does nothing if the cookable is already queued and hasn't been cooked since.
+	void Enqueue(UHoudiniCookable* HC);
+
+	// Removes the cookable from the queue, returns true if it was queued
+	bool Cancel(const UHoudiniCookable* HC);
+
+	// Removes all cookables from the queue
+	void CancelAll();
+
+	// Returns true if the cookable's proxy meshes are waiting to be refined
+	bool IsQueued(const UHoudiniCookable* HC) const;
+
+	// Number of cookables in the queue
+	int32 Num() const { return Requests.Num(); }
+
+	// Refines the queued proxy meshes until InEndTime (FPlatformTime::Seconds()) is reached.
+	// At least one output is refined per call. An InEndTime of 0 refines everything that is queued.
+	void Tick(double InEndTime);
+
+private:
+
+	struct FRequest
+	{
+		TWeakObjectPtr<UHoudiniCookable> Cookable;
+		TSharedPtr<FHoudiniProxyRefinementState> State;
+
+		// Refinement order, updated every tick
+		bool bVisible = false;
+		double DistanceSquared = 0.0;
+	};
+
+	// Returns false if the request has been cancelled by a new cook, or doesn't have anything left to refine
+	static bool IsRequestValid(const FRequest& InRequest);
+
+	// Returns true if refinement should wait, ie if the cookable's world is playing in editor
+	static bool IsRefinementPaused(UHoudiniCookable* HC);
+
+	// Updates the visibility and distance of the requests' proxies, and sorts them accordingly
+	void SortRequests();
+
+	TArray<FRequest> Requests;
+};
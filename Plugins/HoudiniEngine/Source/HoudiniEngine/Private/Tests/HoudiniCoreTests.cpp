@@ -1,5 +1,10 @@
 #include "../HoudiniEngine.h"
+#include "../HoudiniEngineScheduler.h"
+#include "../HoudiniEngineTelemetry.h"
+#include "HoudiniCookable.h"
+#include "HAL/IConsoleManager.h"
 #include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
 
 #if WITH_DEV_AUTOMATION_TESTS
 
@@ -10,4 +15,102 @@ bool HoudiniCoreTest::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTestSchedulerPollBackoff, "Houdini.Core.SchedulerPollBackoff", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTestSchedulerPollBackoff::RunTest(const FString & Parameters)
+{
+	FHoudiniEnginePollBackoff PollBackoff(0.0002f, 0.1f, 2.0f);
+
+	// Starts below a millisecond, and doubles after each poll
+	TestEqual(TEXT("First interval"), PollBackoff.NextInterval(), 0.0002f);
+	TestEqual(TEXT("Second interval"), PollBackoff.NextInterval(), 0.0004f);
+	TestEqual(TEXT("Third interval"), PollBackoff.NextInterval(), 0.0008f);
+
+	// Never sleeps longer than the max interval
+	float Interval = 0.0f;
+	for (int32 Idx = 0; Idx < 32; Idx++)
+		Interval = PollBackoff.NextInterval();
+
+	TestEqual(TEXT("Capped interval"), Interval, 0.1f);
+
+	PollBackoff.Reset();
+	TestEqual(TEXT("Interval after reset"), PollBackoff.NextInterval(), 0.0002f);
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(HoudiniCoreTestTelemetryRingBuffer, "Houdini.Core.TelemetryRingBuffer", EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool HoudiniCoreTestTelemetryRingBuffer::RunTest(const FString & Parameters)
+{
+	IConsoleVariable* CVarEnable = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.Telemetry.Enable"));
+	IConsoleVariable* CVarBufferSize = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.Telemetry.BufferSize"));
+	if (!TestNotNull(TEXT("Enable CVar"), CVarEnable) || !TestNotNull(TEXT("BufferSize CVar"), CVarBufferSize))
+		return false;
+
+	const int32 PrevEnable = CVarEnable->GetInt();
+	const int32 PrevBufferSize = CVarBufferSize->GetInt();
+	CVarEnable->Set(1, ECVF_SetByCode);
+	CVarBufferSize->Set(2, ECVF_SetByCode);
+
+	// Use a local telemetry to leave the session's records alone
+	FHoudiniEngineTelemetry Telemetry;
+	UHoudiniCookable* HC = NewObject<UHoudiniCookable>(GetTransientPackage());
+
+	for (int32 CookIdx = 0; CookIdx < 3; CookIdx++)
+	{
+		Telemetry.BeginRecord(HC, TEXT("Cook"));
+		Telemetry.BeginStage(HC, EHoudiniCookStage::Cook);
+		FPlatformProcess::Sleep(0.001f);
+		Telemetry.EndStage(HC, EHoudiniCookStage::Cook);
+		Telemetry.AddObjectsProduced(HC, TEXT("Mesh"), CookIdx + 1);
+		Telemetry.EndRecord(HC, CookIdx == 0 ? EHoudiniCookTelemetryResult::Failed : EHoudiniCookTelemetryResult::Success);
+	}
+
+	// A discarded record is not kept
+	Telemetry.BeginRecord(HC, TEXT("Cook"));
+	Telemetry.DiscardRecord(HC);
+	TestFalse(TEXT("No open record after discard"), Telemetry.HasOpenRecord(HC));
+
+	// Only the two most recent records are kept, oldest first
+	TArray<FHoudiniCookTelemetryRecord> Records;
+	Telemetry.GetRecords(Records);
+	TestEqual(TEXT("Number of records"), Records.Num(), 2);
+	if (Records.Num() == 2)
+	{
+		TestEqual(TEXT("Oldest record"), Records[0].GetNumObjectsProduced(), 2);
+		TestEqual(TEXT("Newest record"), Records[1].GetNumObjectsProduced(), 3);
+		TestTrue(TEXT("Cook stage timed"), Records[1].GetStageTime(EHoudiniCookStage::Cook) > 0.0);
+		TestTrue(TEXT("Stages within the total time"), Records[1].GetStageTime(EHoudiniCookStage::Cook) <= Records[1].TotalTime);
+	}
+
+	TArray<FHoudiniCookTelemetrySummary> Summaries;
+	Telemetry.GetSummaries(Summaries);
+	TestEqual(TEXT("Number of summaries"), Summaries.Num(), 1);
+	if (Summaries.Num() == 1)
+	{
+		TestEqual(TEXT("Summarized records"), Summaries[0].NumRecords, 2);
+		TestEqual(TEXT("Summarized objects"), Summaries[0].NumObjectsProduced, 5);
+	}
+
+	// One CSV line per record, after the header
+	TArray<FString> CsvLines;
+	Telemetry.ToCsv().ParseIntoArrayLines(CsvLines);
+	TestEqual(TEXT("CSV lines"), CsvLines.Num(), 3);
+
+	TSharedPtr<FJsonObject> Json;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(Telemetry.ToJson());
+	TestTrue(TEXT("Valid JSON"), FJsonSerializer::Deserialize(Reader, Json) && Json.IsValid());
+	if (Json.IsValid())
+		TestEqual(TEXT("JSON records"), Json->GetArrayField(TEXT("records")).Num(), 2);
+
+	Telemetry.Reset();
+	TestEqual(TEXT("Records after reset"), Telemetry.Num(), 0);
+
+	CVarEnable->Set(PrevEnable, ECVF_SetByCode);
+	CVarBufferSize->Set(PrevBufferSize, ECVF_SetByCode);
+
+	return true;
+}
+
 #endif
\ No newline at end of file
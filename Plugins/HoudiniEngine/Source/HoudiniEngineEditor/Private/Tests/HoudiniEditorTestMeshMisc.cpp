@@ -34,7 +34,12 @@
 #include "HoudiniEngine.h"
 #include "HoudiniEngineAttributes.h"
 #include "HoudiniEngineUtils.h"
+#include "HoudiniMeshTranslator.h"
+#include "HoudiniOutput.h"
 #include "Misc/DefaultValueHelper.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Serialization/ObjectAndNameAsStringProxyArchive.h"
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestMiscMeshes_ActorProperties, "Houdini.UnitTests.Mesh.ActorProperties",
                                          EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
@@ -370,3 +375,203 @@ bool FHoudiniEditorTestMiscMeshes_MaterialProperties::RunTest(const FString& Par
 	return true;
 }
 
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestMiscMeshes_AttributeTransfer, "Houdini.UnitTests.Mesh.AttributeTransfer",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestMiscMeshes_AttributeTransfer::RunTest(const FString& Parameters)
+{
+	// Checks that the parallel attribute gather used by CreateHoudiniStaticMesh() gives exactly the same
+	// split data as the serial transfer, for every float attribute of the test HDA's mesh parts.
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	// Now create the test context.
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, FString(TEXT("/Game/TestHDAs/Mesh/Misc/TestActorMaterials.umap"))));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, return false);
+
+	Context->SetProxyMeshEnabled(false);
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+		{
+			Context->StartCookingHDA();
+			return true;
+		}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+		{
+			TArray<UHoudiniOutput*> Outputs;
+			Context->GetOutputs(Outputs);
+			HOUDINI_TEST_NOT_EQUAL_ON_FAIL(Outputs.Num(), 0, return true);
+
+			const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+
+			int32 NumComparedAttributes = 0;
+
+			// Output buffer reused across all calls, as CreateHoudiniStaticMesh() does across splits.
+			TArray<float> ParallelData;
+			TArray<int32> ValidWedges;
+
+			for (UHoudiniOutput* Output : Outputs)
+			{
+				for (const FHoudiniGeoPartObject& Part : Output->GetHoudiniGeoPartObjects())
+				{
+					if (Part.Type != EHoudiniPartType::Mesh)
+						continue;
+
+					HAPI_PartInfo PartInfo;
+					HAPI_Result Result = FHoudiniApi::GetPartInfo(Session, Part.GeoId, Part.PartId, &PartInfo);
+					HOUDINI_TEST_EQUAL_ON_FAIL(Result, HAPI_RESULT_SUCCESS, continue);
+
+					if (PartInfo.vertexCount <= 0)
+						continue;
+
+					TArray<int32> VertexList;
+					VertexList.SetNumUninitialized(PartInfo.vertexCount);
+					Result = FHoudiniApi::GetVertexList(Session, Part.GeoId, Part.PartId, VertexList.GetData(), 0, PartInfo.vertexCount);
+					HOUDINI_TEST_EQUAL_ON_FAIL(Result, HAPI_RESULT_SUCCESS, continue);
+
+					// Test the whole part, and two splits using every other triangle.
+					TArray<TArray<int32>> SplitVertexLists;
+					SplitVertexLists.Add(VertexList);
+					for (int32 SplitIdx = 0; SplitIdx < 2; SplitIdx++)
+					{
+						TArray<int32>& SplitVertexList = SplitVertexLists.Add_GetRef(VertexList);
+						for (int32 WedgeIdx = 0; WedgeIdx < SplitVertexList.Num(); WedgeIdx++)
+						{
+							if ((WedgeIdx / 3) % 2 == SplitIdx)
+								SplitVertexList[WedgeIdx] = -1;
+						}
+					}
+
+					const HAPI_AttributeOwner Owners[] = { HAPI_ATTROWNER_POINT, HAPI_ATTROWNER_VERTEX, HAPI_ATTROWNER_PRIM, HAPI_ATTROWNER_DETAIL };
+					for (HAPI_AttributeOwner Owner : Owners)
+					{
+						TArray<FString> AttributeNames = FHoudiniEngineUtils::GetAttributeNames(Session, Part.GeoId, Part.PartId, Owner);
+						for (const FString& AttrName : AttributeNames)
+						{
+							std::string CStr = TCHAR_TO_ANSI(*AttrName);
+							FHoudiniHapiAccessor Accessor(Part.GeoId, Part.PartId, CStr.c_str());
+							HAPI_AttributeInfo Info;
+							if (!Accessor.GetInfo(Info, Owner) || Info.storage != HAPI_STORAGETYPE_FLOAT)
+								continue;
+
+							TArray<float> Values;
+							HOUDINI_TEST_EQUAL_ON_FAIL(Accessor.GetAttributeData(Info, Values), true, continue);
+
+							for (const TArray<int32>& SplitVertexList : SplitVertexLists)
+							{
+								TArray<float> SerialData;
+								const int32 SerialCount = FHoudiniMeshTranslator::TransferRegularPointAttributesToVertices(
+									SplitVertexList, Info, Values, SerialData);
+
+								FHoudiniMeshTranslator::GetSplitValidWedges(SplitVertexList, ValidWedges);
+								const int32 ParallelCount = FHoudiniMeshTranslator::GatherRegularPointAttributesToVertices(
+									SplitVertexList, ValidWedges, Info, Values, ParallelData);
+
+								HOUDINI_TEST_EQUAL(ParallelCount, SerialCount);
+								HOUDINI_TEST_EQUAL_ON_FAIL(ParallelData.Num(), SerialData.Num(), continue);
+								HOUDINI_TEST_EQUAL(ParallelData == SerialData, true);
+							}
+
+							NumComparedAttributes++;
+						}
+					}
+				}
+			}
+
+			// At least P should have been compared.
+			HOUDINI_TEST_NOT_EQUAL(NumComparedAttributes, 0);
+
+			return true;
+		}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestMiscMeshes_PartContentHash, "Houdini.UnitTests.Mesh.PartContentHash",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestMiscMeshes_PartContentHash::RunTest(const FString& Parameters)
+{
+	// The part content hash is used to reuse meshes of parts that didn't change when their geo recooks,
+	// so it must be stable across recooks and change as soon as the part's geometry does.
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	AddCommand(new FFunctionLatentCommand([this]()
+	{
+		const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Session, return true);
+
+		HAPI_NodeId GeoNodeId = -1;
+		HAPI_NodeId BoxNodeId = -1;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::CreateNode(-1, TEXT("Object/geo"), TEXT("PartContentHash"), true, &GeoNodeId), HAPI_RESULT_SUCCESS, return true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::CreateNode(GeoNodeId, TEXT("box"), TEXT("box"), true, &BoxNodeId), HAPI_RESULT_SUCCESS);
+
+		uint64 FirstHash = 0;
+		uint64 RecookHash = 0;
+		uint64 ScaledHash = 0;
+		uint64 RevertedHash = 0;
+		uint64 FirstLayoutHash = 0;
+		uint64 ScaledLayoutHash = 0;
+
+		// Hash, then recook without any change
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetPartContentHash(BoxNodeId, 0, FirstHash), true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetPartLayoutHash(BoxNodeId, 0, FirstLayoutHash), true);
+		FHoudiniEngineUtils::HapiCookNode(BoxNodeId, nullptr, true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetPartContentHash(BoxNodeId, 0, RecookHash), true);
+
+		// Change the geometry, then change it back
+		FHoudiniApi::SetParmFloatValue(Session, BoxNodeId, "scale", 0, 2.0f);
+		FHoudiniEngineUtils::HapiCookNode(BoxNodeId, nullptr, true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetPartContentHash(BoxNodeId, 0, ScaledHash), true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetPartLayoutHash(BoxNodeId, 0, ScaledLayoutHash), true);
+
+		FHoudiniApi::SetParmFloatValue(Session, BoxNodeId, "scale", 0, 1.0f);
+		FHoudiniEngineUtils::HapiCookNode(BoxNodeId, nullptr, true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::HapiGetPartContentHash(BoxNodeId, 0, RevertedHash), true);
+
+		HOUDINI_TEST_NOT_EQUAL(FirstHash, (uint64)0);
+		HOUDINI_TEST_EQUAL(RecookHash, FirstHash);
+		HOUDINI_TEST_NOT_EQUAL(ScaledHash, FirstHash);
+		HOUDINI_TEST_EQUAL(RevertedHash, FirstHash);
+
+		// Scaling the box moves its points, but doesn't change its layout
+		HOUDINI_TEST_NOT_EQUAL(FirstLayoutHash, (uint64)0);
+		HOUDINI_TEST_EQUAL(ScaledLayoutHash, FirstLayoutHash);
+
+		FHoudiniApi::DeleteNode(Session, GeoNodeId);
+
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestMiscMeshes_PartHashSerialization, "Houdini.UnitTests.Mesh.PartHashSerialization",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestMiscMeshes_PartHashSerialization::RunTest(const FString& Parameters)
+{
+	// The part hashes are saved with the output objects, so that meshes of unchanged parts are reused after a reload
+	FHoudiniOutputObject SavedObject;
+	SavedObject.PartContentHash = 0x0123456789abcdefull;
+	SavedObject.PartLayoutHash = 0xfedcba9876543210ull;
+
+	TArray<uint8> Bytes;
+	FMemoryWriter Writer(Bytes);
+	FObjectAndNameAsStringProxyArchive WriterProxy(Writer, false);
+	FHoudiniOutputObject::StaticStruct()->SerializeItem(WriterProxy, &SavedObject, nullptr);
+
+	FHoudiniOutputObject LoadedObject;
+	FMemoryReader Reader(Bytes);
+	FObjectAndNameAsStringProxyArchive ReaderProxy(Reader, false);
+	FHoudiniOutputObject::StaticStruct()->SerializeItem(ReaderProxy, &LoadedObject, nullptr);
+
+	HOUDINI_TEST_EQUAL(LoadedObject.PartContentHash, SavedObject.PartContentHash);
+	HOUDINI_TEST_EQUAL(LoadedObject.PartLayoutHash, SavedObject.PartLayoutHash);
+
+	return true;
+}
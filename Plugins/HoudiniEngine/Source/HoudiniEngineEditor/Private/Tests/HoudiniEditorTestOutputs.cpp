@@ -43,6 +43,7 @@
 #include "Misc/AutomationTest.h"
 #include "HoudiniAssetActorFactory.h"
 #include "GenericPlatform/GenericPlatformProcess.h"
+#include "HAL/IConsoleManager.h"
 #include "HoudiniParameterToggle.h"
 #include "Components/InstancedStaticMeshComponent.h"
 #include "HoudiniEditorUnitTestUtils.h"
@@ -300,6 +301,74 @@ bool FHoudiniEditorTestOutput::RunTest(const FString & Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestOutputTimeSliced, "Houdini.UnitTests.OutputTests.TimeSlicedProcessing", 
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext  | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestOutputTimeSliced::RunTest(const FString & Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// This test ensures that outputs are still all created when their processing is spread over multiple ticks. The tick
+	///	time limit is lowered so that each tick only creates one output.
+	/// Landscape outputs are only checked before 5.6, like in the other landscape tests.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	IConsoleVariable* TickTimeLimit = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.TickTimeLimit"));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(TickTimeLimit, return true);
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, TEXT("/Game/TestHDAs/Outputs/Test_Outputs"), FTransform::Identity, false));
+	Context->SetProxyMeshEnabled(false);
+	Context->Data.Add(TEXT("TickTimeLimit"), TickTimeLimit->GetString());
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Enable the cube, the height field and the instances, with a tiny time limit.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, TickTimeLimit]()
+	{
+		TickTimeLimit->Set(0.000001f);
+
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "cube", true, 0);
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 6
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "heightfield", true, 0);
+#else
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "heightfield", false, 0);
 #endif
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "instances", true, 0);
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, TickTimeLimit]()
+	{
+		// Restore the time limit first, so a failure does not affect the other tests
+		TickTimeLimit->Set(*Context->Data[TEXT("TickTimeLimit")]);
 
+		TArray<UHoudiniOutput*> Outputs;
+		Context->GetOutputs(Outputs);
+
+		// All outputs should have been created, even though each tick ran out of time
+		TArray<UStaticMeshComponent*> StaticMeshOutputs = FHoudiniEditorUnitTestUtils::GetOutputsWithComponent<UStaticMeshComponent>(Outputs);
+		HOUDINI_TEST_NOT_EQUAL(StaticMeshOutputs.Num(), 0);
+
+#if ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION < 6
+		TArray<UHoudiniLandscapeTargetLayerOutput*> LandscapeOutput = FHoudiniEditorUnitTestUtils::GetOutputsWithObject<UHoudiniLandscapeTargetLayerOutput>(Outputs);
+		HOUDINI_TEST_EQUAL(LandscapeOutput.Num(), 1);
+#endif
+
+		TArray<UInstancedStaticMeshComponent*> Components = FHoudiniEditorUnitTestUtils::GetOutputsWithComponent<UInstancedStaticMeshComponent>(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(Components.Num(), 1, return true);
+		HOUDINI_TEST_EQUAL(Components[0]->GetNumRenderInstances(), 4);
+
+		return true;
+	}));
+
+	return true;
+}
+
+
+#endif
@@ -0,0 +1,567 @@
+/*
+* Copyright (c) <2025> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniEditorTestPerformance.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniCookable.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineBakeUtils.h"
+#include "HoudiniEngineCommands.h"
+#include "HoudiniEngineTelemetry.h"
+#include "HoudiniEngineUtils.h"
+#include "HoudiniParameterFloat.h"
+#include "HoudiniParameterInt.h"
+#include "HoudiniParameterMultiParm.h"
+#include "HoudiniParameterString.h"
+#include "HoudiniParameterToggle.h"
+#include "HoudiniRuntimeSettings.h"
+#include "HAL/IConsoleManager.h"
+#include "HAL/PlatformMemory.h"
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Serialization/JsonSerializer.h"
+
+static TAutoConsoleVariable<FString> CVarHoudiniEnginePerfTestsBaseline(
+	TEXT("HoudiniEngine.PerfTests.Baseline"),
+	TEXT(""),
+	TEXT("Path of the baseline the performance tests are compared against.\n")
+	TEXT("Default is <Project>/TestData/HoudiniPerformanceBaseline.json.\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEnginePerfTestsUpdateBaseline(
+	TEXT("HoudiniEngine.PerfTests.UpdateBaseline"),
+	0,
+	TEXT("If enabled, the performance tests save their measurements to the baseline instead of comparing against it.\n")
+	TEXT("0: Disabled\n")
+	TEXT("1: Enabled\n")
+);
+
+// Measurements as they are named in the baseline and results files
+struct FHoudiniPerformanceMetric
+{
+	const TCHAR* Name;
+	double FHoudiniPerformanceSample::* Value;
+	bool bIsMemory;
+};
+
+static const FHoudiniPerformanceMetric GHoudiniPerformanceMetrics[] =
+{
+	{ TEXT("instantiate"), &FHoudiniPerformanceSample::InstantiateTime, false },
+	{ TEXT("cook"), &FHoudiniPerformanceSample::CookTime, false },
+	{ TEXT("translate"), &FHoudiniPerformanceSample::TranslateTime, false },
+	{ TEXT("bake"), &FHoudiniPerformanceSample::BakeTime, false },
+	{ TEXT("peak_memory_mb"), &FHoudiniPerformanceSample::PeakMemoryMB, true },
+};
+
+// State of a benchmark, shared between its latent commands
+struct FHoudiniPerformanceRun
+{
+	void Start()
+	{
+		const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+		StartUsedPhysical = Stats.UsedPhysical;
+		PeakUsedPhysical = Stats.UsedPhysical;
+		StartProcessPeakUsedPhysical = Stats.PeakUsedPhysical;
+		ProcessPeakUsedPhysical = Stats.PeakUsedPhysical;
+	}
+
+	void SampleMemory()
+	{
+		const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+		PeakUsedPhysical = FMath::Max<uint64>(PeakUsedPhysical, Stats.UsedPhysical);
+		ProcessPeakUsedPhysical = FMath::Max<uint64>(ProcessPeakUsedPhysical, Stats.PeakUsedPhysical);
+	}
+
+	double GetPeakMemoryMB() const
+	{
+		// Memory is only sampled once per frame, the process peak catches what happens between two samples
+		// when it goes over the previous peak of the process.
+		const uint64 PeakDelta = FMath::Max<uint64>(
+			PeakUsedPhysical - StartUsedPhysical,
+			ProcessPeakUsedPhysical - StartProcessPeakUsedPhysical);
+		return (double)PeakDelta / (1024.0 * 1024.0);
+	}
+
+	FHoudiniPerformanceSample Sample;
+
+	// Start time of the last telemetry record used, so a cook that didn't produce a record isn't mistaken for it
+	FDateTime LastRecordTime = FDateTime::MinValue();
+
+	uint64 StartUsedPhysical = 0;
+	uint64 PeakUsedPhysical = 0;
+	uint64 StartProcessPeakUsedPhysical = 0;
+	uint64 ProcessPeakUsedPhysical = 0;
+};
+
+// Samples the memory every frame while waiting for the cook to complete
+class FHoudiniPerformanceLatentCommand : public FHoudiniLatentTestCommand
+{
+public:
+	FHoudiniPerformanceLatentCommand(TSharedPtr<FHoudiniTestContext> InContext, TSharedPtr<FHoudiniPerformanceRun> InRun, TFunction<bool()> InLatentPredicate)
+		: FHoudiniLatentTestCommand(InContext, InLatentPredicate), Run(InRun) {}
+
+	virtual bool Update() override
+	{
+		Run->SampleMemory();
+		return FHoudiniLatentTestCommand::Update();
+	}
+
+	TSharedPtr<FHoudiniPerformanceRun> Run;
+};
+
+static bool
+GetLastCookRecord(const UHoudiniCookable* HC, const FDateTime& After, FHoudiniCookTelemetryRecord& OutRecord)
+{
+	if (!IsValid(HC))
+		return false;
+
+	TArray<FHoudiniCookTelemetryRecord> Records;
+	FHoudiniEngineTelemetry::Get().GetRecords(Records);
+
+	const FString CookableName = HC->GetDisplayName();
+	for (int32 Idx = Records.Num() - 1; Idx >= 0; Idx--)
+	{
+		const FHoudiniCookTelemetryRecord& Record = Records[Idx];
+		if (Record.StartTime <= After)
+			break;
+
+		if (Record.CookableName != CookableName || Record.Operation != TEXT("Cook"))
+			continue;
+
+		if (Record.Result != EHoudiniCookTelemetryResult::Success)
+			return false;
+
+		OutRecord = Record;
+		return true;
+	}
+
+	return false;
+}
+
+static void
+ReadTolerance(const TSharedPtr<FJsonObject>& JsonObject, FHoudiniPerformanceTolerance& OutTolerance)
+{
+	const TSharedPtr<FJsonObject>* ToleranceObject = nullptr;
+	if (!JsonObject.IsValid() || !JsonObject->TryGetObjectField(TEXT("tolerance"), ToleranceObject))
+		return;
+
+	(*ToleranceObject)->TryGetNumberField(TEXT("relative_time"), OutTolerance.RelativeTime);
+	(*ToleranceObject)->TryGetNumberField(TEXT("absolute_time"), OutTolerance.AbsoluteTime);
+	(*ToleranceObject)->TryGetNumberField(TEXT("relative_memory"), OutTolerance.RelativeMemory);
+	(*ToleranceObject)->TryGetNumberField(TEXT("absolute_memory_mb"), OutTolerance.AbsoluteMemoryMB);
+}
+
+bool
+FHoudiniPerformanceAutomationTest::CreateInProcessSessionIfInvalid()
+{
+	PreviousSessionType = EHoudiniRuntimeSettingsSessionType::HRSST_InProcess;
+
+	const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+	const bool bIsSessionValid = FHoudiniEngineCommands::IsSessionValid();
+	if (bIsSessionValid && Session && Session->type == HAPI_SESSION_INPROCESS)
+		return true;
+
+	if (bIsSessionValid)
+	{
+		// Out of process sessions are created with the type from the settings, by the editor or the other tests
+		const UHoudiniRuntimeSettings* HoudiniRuntimeSettings = GetDefault<UHoudiniRuntimeSettings>();
+		PreviousSessionType = HoudiniRuntimeSettings->SessionType;
+
+		HOUDINI_LOG_MESSAGE(TEXT("[FHoudiniPerformanceAutomationTest] Replacing the current Houdini Engine session with an in-process session."));
+		FHoudiniEngine::Get().StopSession();
+	}
+	else
+	{
+		PreviousSessionType = EHoudiniRuntimeSettingsSessionType::HRSST_None;
+	}
+
+	if (!FHoudiniEngine::Get().CreateSession(EHoudiniRuntimeSettingsSessionType::HRSST_InProcess))
+		return false;
+
+	// Cookables instantiated in the previous session need to be instantiated in the new one
+	FHoudiniEngineUtils::MarkAllCookablesAsNeedInstantiation();
+
+	return true;
+}
+
+void
+FHoudiniPerformanceAutomationTest::RestorePreviousSession()
+{
+	const EHoudiniRuntimeSettingsSessionType SessionType = PreviousSessionType;
+	PreviousSessionType = EHoudiniRuntimeSettingsSessionType::HRSST_InProcess;
+
+	// The in-process session was already running before the benchmark
+	if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_InProcess)
+		return;
+
+	HOUDINI_LOG_MESSAGE(TEXT("[FHoudiniPerformanceAutomationTest] Restoring the Houdini Engine session that was running before the benchmark."));
+	FHoudiniEngine::Get().StopSession();
+
+	if (SessionType == EHoudiniRuntimeSettingsSessionType::HRSST_None)
+		return;
+
+	if (!FHoudiniEngine::Get().CreateSession(SessionType, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName))
+	{
+		AddWarning(TEXT("Could not restore the Houdini Engine session that was running before the benchmark."));
+		return;
+	}
+
+	// Cookables instantiated in the in-process session need to be instantiated in the restored one
+	FHoudiniEngineUtils::MarkAllCookablesAsNeedInstantiation();
+}
+
+bool
+FHoudiniPerformanceAutomationTest::RunBenchmark(const FString& BenchmarkName, const FString& HDAName, const TArray<FBenchmarkStep>& Steps)
+{
+	HOUDINI_TEST_EQUAL_ON_FAIL(CreateInProcessSessionIfInvalid(), true, RestorePreviousSession(); return false);
+
+	// Stage timings are read from the cook telemetry
+	if (!FHoudiniEngineTelemetry::IsEnabled())
+	{
+		IConsoleVariable* CVarTelemetryEnable = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.Telemetry.Enable"));
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(CVarTelemetryEnable, RestorePreviousSession(); return false);
+		CVarTelemetryEnable->Set(1, ECVF_SetByCode);
+	}
+
+	TSharedPtr<FHoudiniPerformanceRun> Run = MakeShared<FHoudiniPerformanceRun>();
+	Run->Start();
+
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, HDAName, FTransform::Identity, false));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, RestorePreviousSession(); return false);
+
+	Context->SetProxyMeshEnabled(false);
+
+	// Larger scales can take a while, especially on build machines
+	Context->MaxTime = 600.0;
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Instantiate and cook with the default parameters.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniPerformanceLatentCommand(Context, Run, [Context]()
+	{
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniPerformanceLatentCommand(Context, Run, [this, Context, Run]()
+	{
+		FHoudiniCookTelemetryRecord Record;
+		HOUDINI_TEST_EQUAL_ON_FAIL(GetLastCookRecord(Context->GetCookable(), Run->LastRecordTime, Record), true, return true);
+
+		Run->Sample.InstantiateTime = Record.GetStageTime(EHoudiniCookStage::Instantiate);
+		Run->LastRecordTime = Record.StartTime;
+		return true;
+	}));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Set the parameters to the benchmarked scale, cooking after each step.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	for (const FBenchmarkStep& Step : Steps)
+	{
+		AddCommand(new FHoudiniPerformanceLatentCommand(Context, Run, [this, Context, Step]()
+		{
+			if (HasAnyErrors())
+				return true;
+
+			Step(Context);
+			if (!HasAnyErrors())
+				Context->StartCookingHDA();
+
+			return true;
+		}));
+	}
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Measure the last cook, bake and compare against the baseline.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniPerformanceLatentCommand(Context, Run, [this, Context, Run, BenchmarkName]()
+	{
+		if (HasAnyErrors())
+			return true;
+
+		FHoudiniCookTelemetryRecord Record;
+		HOUDINI_TEST_EQUAL_ON_FAIL(GetLastCookRecord(Context->GetCookable(), Run->LastRecordTime, Record), true, return true);
+
+		Run->Sample.CookTime = Record.GetStageTime(EHoudiniCookStage::PreCook) + Record.GetStageTime(EHoudiniCookStage::Cook);
+		Run->Sample.TranslateTime =
+			Record.GetStageTime(EHoudiniCookStage::PostCook)
+			+ Record.GetStageTime(EHoudiniCookStage::AttributeFetch)
+			+ Record.GetStageTime(EHoudiniCookStage::MeshBuild)
+			+ Record.GetStageTime(EHoudiniCookStage::Instancer)
+			+ Record.GetStageTime(EHoudiniCookStage::Landscape)
+			+ Record.GetStageTime(EHoudiniCookStage::OutputProcessing);
+		Run->LastRecordTime = Record.StartTime;
+
+		FHoudiniBakeSettings BakeSettings;
+		const double BakeStartTime = FPlatformTime::Seconds();
+		const bool bBaked = Context->Bake(BakeSettings);
+		Run->Sample.BakeTime = FPlatformTime::Seconds() - BakeStartTime;
+		HOUDINI_TEST_EQUAL_ON_FAIL(bBaked, true, return true);
+
+		Run->SampleMemory();
+		Run->Sample.PeakMemoryMB = Run->GetPeakMemoryMB();
+
+		ReportSample(BenchmarkName, Run->Sample);
+		return true;
+	}));
+
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	// Give the following tests back the session they expect, even if the benchmark failed.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this]()
+	{
+		RestorePreviousSession();
+		return true;
+	}));
+
+	return true;
+}
+
+void
+FHoudiniPerformanceAutomationTest::ReportSample(const FString& BenchmarkName, const FHoudiniPerformanceSample& Sample)
+{
+	AddInfo(FString::Printf(
+		TEXT("%s: instantiate %.3f s, cook %.3f s, translate %.3f s, bake %.3f s, peak memory %.1f MB"),
+		*BenchmarkName, Sample.InstantiateTime, Sample.CookTime, Sample.TranslateTime, Sample.BakeTime, Sample.PeakMemoryMB));
+
+	if (!SaveSample(GetResultsPath(), BenchmarkName, Sample))
+		AddWarning(FString::Printf(TEXT("Could not save the performance results to %s"), *GetResultsPath()));
+
+	const FString BaselinePath = GetBaselinePath();
+	if (CVarHoudiniEnginePerfTestsUpdateBaseline.GetValueOnGameThread() != 0)
+	{
+		HOUDINI_TEST_EQUAL(SaveSample(BaselinePath, BenchmarkName, Sample), true);
+		AddInfo(FString::Printf(TEXT("Updated the baseline of %s in %s"), *BenchmarkName, *BaselinePath));
+		return;
+	}
+
+	const TSharedPtr<FJsonObject> Baseline = LoadJsonFile(BaselinePath);
+	const TSharedPtr<FJsonObject>* Benchmarks = nullptr;
+	const TSharedPtr<FJsonObject>* BaselineSample = nullptr;
+	if (!Baseline.IsValid()
+		|| !Baseline->TryGetObjectField(TEXT("benchmarks"), Benchmarks)
+		|| !(*Benchmarks)->TryGetObjectField(BenchmarkName, BaselineSample))
+	{
+		AddWarning(FString::Printf(
+			TEXT("No baseline for %s in %s, set HoudiniEngine.PerfTests.UpdateBaseline to 1 to record one."),
+			*BenchmarkName, *BaselinePath));
+		return;
+	}
+
+	// Tolerances of the baseline can be overridden per benchmark
+	FHoudiniPerformanceTolerance Tolerance;
+	ReadTolerance(Baseline, Tolerance);
+	ReadTolerance(*BaselineSample, Tolerance);
+
+	for (const FHoudiniPerformanceMetric& Metric : GHoudiniPerformanceMetrics)
+	{
+		double BaselineValue = 0.0;
+		if (!(*BaselineSample)->TryGetNumberField(Metric.Name, BaselineValue))
+			continue;
+
+		const double Value = Sample.*Metric.Value;
+		const double AllowedRegression = Metric.bIsMemory
+			? FMath::Max(BaselineValue * Tolerance.RelativeMemory, Tolerance.AbsoluteMemoryMB)
+			: FMath::Max(BaselineValue * Tolerance.RelativeTime, Tolerance.AbsoluteTime);
+
+		if (Value > BaselineValue + AllowedRegression)
+		{
+			AddError(FString::Printf(
+				TEXT("%s: %s regressed to %.3f, baseline is %.3f (allowed up to %.3f)"),
+				*BenchmarkName, Metric.Name, Value, BaselineValue, BaselineValue + AllowedRegression));
+		}
+		else if (Value < BaselineValue - AllowedRegression)
+		{
+			AddInfo(FString::Printf(
+				TEXT("%s: %s improved to %.3f, baseline is %.3f. Consider updating the baseline."),
+				*BenchmarkName, Metric.Name, Value, BaselineValue));
+		}
+	}
+}
+
+FString
+FHoudiniPerformanceAutomationTest::GetBaselinePath()
+{
+	const FString BaselinePath = CVarHoudiniEnginePerfTestsBaseline.GetValueOnGameThread();
+	if (!BaselinePath.IsEmpty())
+		return BaselinePath;
+
+	return FPaths::Combine(FPaths::ProjectDir(), TEXT("TestData"), TEXT("HoudiniPerformanceBaseline.json"));
+}
+
+FString
+FHoudiniPerformanceAutomationTest::GetResultsPath()
+{
+	// Next to the other test outputs when running on the build machines
+	const FString TestOutputDirectory = FPlatformMisc::GetEnvironmentVariable(TEXT("TEST_OUTPUT_DIR"));
+	if (!TestOutputDirectory.IsEmpty())
+		return FPaths::Combine(TestOutputDirectory, TEXT("HoudiniPerformanceResults.json"));
+
+	return FPaths::Combine(FPaths::AutomationTransientDir(), TEXT("HoudiniPerformanceResults.json"));
+}
+
+TSharedPtr<FJsonObject>
+FHoudiniPerformanceAutomationTest::LoadJsonFile(const FString& Path)
+{
+	FString JsonString;
+	if (!FFileHelper::LoadFileToString(JsonString, *Path))
+		return nullptr;
+
+	TSharedPtr<FJsonObject> JsonObject;
+	TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(JsonString);
+	if (!FJsonSerializer::Deserialize(Reader, JsonObject))
+		return nullptr;
+
+	return JsonObject;
+}
+
+bool
+FHoudiniPerformanceAutomationTest::SaveSample(const FString& Path, const FString& BenchmarkName, const FHoudiniPerformanceSample& Sample)
+{
+	// Keep the other benchmarks and tolerances already in the file
+	TSharedPtr<FJsonObject> Root = LoadJsonFile(Path);
+	if (!Root.IsValid())
+		Root = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> Benchmarks;
+	const TSharedPtr<FJsonObject>* ExistingBenchmarks = nullptr;
+	if (Root->TryGetObjectField(TEXT("benchmarks"), ExistingBenchmarks))
+		Benchmarks = *ExistingBenchmarks;
+	else
+		Benchmarks = MakeShared<FJsonObject>();
+
+	TSharedPtr<FJsonObject> SampleObject;
+	const TSharedPtr<FJsonObject>* ExistingSample = nullptr;
+	if (Benchmarks->TryGetObjectField(BenchmarkName, ExistingSample))
+		SampleObject = *ExistingSample;
+	else
+		SampleObject = MakeShared<FJsonObject>();
+
+	for (const FHoudiniPerformanceMetric& Metric : GHoudiniPerformanceMetrics)
+		SampleObject->SetNumberField(Metric.Name, Sample.*Metric.Value);
+
+	Benchmarks->SetObjectField(BenchmarkName, SampleObject);
+	Root->SetObjectField(TEXT("benchmarks"), Benchmarks);
+
+	FString JsonString;
+	TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&JsonString);
+	if (!FJsonSerializer::Serialize(Root.ToSharedRef(), Writer))
+		return false;
+
+	return FFileHelper::SaveStringToFile(JsonString, *Path);
+}
+
+bool
+FHoudiniPerformanceAutomationTest::RunMeshSplitsBenchmark(const int32 NumSplits)
+{
+	TArray<FBenchmarkStep> Steps;
+
+	// Set number of multiparms; cook before we update the values.
+	Steps.Add([this, NumSplits](TSharedPtr<FHoudiniTestContext> Context)
+	{
+		SET_HDA_PARAMETER_NUM_ELEMENTS(Context, UHoudiniParameterMultiParm, "cube_groups", NumSplits);
+		SET_HDA_PARAMETER_NUM_ELEMENTS(Context, UHoudiniParameterMultiParm, "sphere_groups", 0);
+		return true;
+	});
+
+	// One cube for the main geometry, and one per simple collision split.
+	Steps.Add([this, NumSplits](TSharedPtr<FHoudiniTestContext> Context)
+	{
+		for (int32 Index = 0; Index < NumSplits; Index++)
+		{
+			const FString ParmName = FString::Format(TEXT("cube_group{0}"), { Index + 1 });
+			const FString GroupName = Index == 0 ? FString() : FString::Printf(TEXT("collision_geo_simple_box_%d"), Index);
+			SET_HDA_PARAMETER(Context, UHoudiniParameterString, TCHAR_TO_ANSI(*ParmName), GroupName, 0);
+		}
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "pack", false, 0);
+		return true;
+	});
+
+	return RunBenchmark(FString::Printf(TEXT("MeshSplits.%d"), NumSplits), MeshHDA, Steps);
+}
+
+bool
+FHoudiniPerformanceAutomationTest::RunInstancesBenchmark(const int32 NumInstances)
+{
+	TArray<FBenchmarkStep> Steps;
+	Steps.Add([this, NumInstances](TSharedPtr<FHoudiniTestContext> Context)
+	{
+		SET_HDA_PARAMETER(Context, UHoudiniParameterString, "instance_object", InstancedMesh, 0);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterInt, "max_instances", NumInstances, 0);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "split_instance_meshes", false, 0);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "foliage", false, 0);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterToggle, "instance_origin", true, 0);
+		return true;
+	});
+
+	return RunBenchmark(FString::Printf(TEXT("Instances.%d"), NumInstances), InstancesHDA, Steps);
+}
+
+bool
+FHoudiniPerformanceAutomationTest::RunLandscapeBenchmark(const int32 LandscapeSize)
+{
+	TArray<FBenchmarkStep> Steps;
+	Steps.Add([this, LandscapeSize](TSharedPtr<FHoudiniTestContext> Context)
+	{
+		SET_HDA_PARAMETER(Context, UHoudiniParameterInt, "size", LandscapeSize, 0);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterInt, "size", LandscapeSize, 1);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterInt, "grid_size", 1, 0);
+		SET_HDA_PARAMETER(Context, UHoudiniParameterFloat, "height_scale", 1.0f, 0);
+		return true;
+	});
+
+	return RunBenchmark(FString::Printf(TEXT("Landscapes.%d"), LandscapeSize), LandscapeHDA, Steps);
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+// Benchmarks. They use the PerfFilter instead of the ProductFilter so they don't run along the unit tests.
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#define IMPLEMENT_HOUDINI_PERFORMANCE_TEST(TClass, PrettyName, RunFunction, Scale) \
+	IMPLEMENT_SIMPLE_CLASS_HOUDINI_AUTOMATION_TEST(TClass, FHoudiniPerformanceAutomationTest, PrettyName, \
+		EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::PerfFilter) \
+	bool TClass::RunTest(const FString& Parameters) { return RunFunction(Scale); }
+
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_MeshSplits1, "Houdini.Performance.MeshSplits.1", RunMeshSplitsBenchmark, 1)
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_MeshSplits16, "Houdini.Performance.MeshSplits.16", RunMeshSplitsBenchmark, 16)
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_MeshSplits64, "Houdini.Performance.MeshSplits.64", RunMeshSplitsBenchmark, 64)
+
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_Instances100, "Houdini.Performance.Instances.100", RunInstancesBenchmark, 100)
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_Instances1000, "Houdini.Performance.Instances.1000", RunInstancesBenchmark, 1000)
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_Instances10000, "Houdini.Performance.Instances.10000", RunInstancesBenchmark, 10000)
+
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_Landscapes64, "Houdini.Performance.Landscapes.64", RunLandscapeBenchmark, 64)
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_Landscapes256, "Houdini.Performance.Landscapes.256", RunLandscapeBenchmark, 256)
+IMPLEMENT_HOUDINI_PERFORMANCE_TEST(FHoudiniEditorTestPerformance_Landscapes1024, "Houdini.Performance.Landscapes.1024", RunLandscapeBenchmark, 1024)
+
+#endif
@@ -0,0 +1,113 @@
+/*
+* Copyright (c) <2025> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#pragma once
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "CoreMinimal.h"
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+#include "HoudiniRuntimeSettings.h"
+
+class FJsonObject;
+
+// Measurements of one benchmark run. Times are wall times in seconds.
+struct FHoudiniPerformanceSample
+{
+	// Instantiation of the HDA in the Houdini session
+	double InstantiateTime = 0.0;
+	// Upload of the parameters and cook of the HDA
+	double CookTime = 0.0;
+	// Translation of the cooked geometry to Unreal outputs
+	double TranslateTime = 0.0;
+	// Bake of the outputs to actors
+	double BakeTime = 0.0;
+	// Peak memory used by the process above what it used before the benchmark, in MB.
+	// The HDA cooks in-process, so this includes the memory used by Houdini.
+	double PeakMemoryMB = 0.0;
+};
+
+// Allowed regression over the baseline. A measurement fails if it exceeds the baseline by more than
+// Max(Baseline * Relative, Absolute), the absolute tolerance avoids failing on noise for short or small measurements.
+struct FHoudiniPerformanceTolerance
+{
+	double RelativeTime = 0.25;
+	double AbsoluteTime = 0.05;
+	double RelativeMemory = 0.25;
+	double AbsoluteMemoryMB = 32.0;
+};
+
+struct FHoudiniPerformanceAutomationTest : public FHoudiniAutomationTest
+{
+	FHoudiniPerformanceAutomationTest(const FString& InName, const bool bInComplexTask)
+		: FHoudiniAutomationTest(InName, bInComplexTask)
+	{
+	}
+
+	// Sets the HDA parameters before a cook. Use the SET_HDA_PARAMETER macros, failures are reported as test errors.
+	typedef TFunction<bool(TSharedPtr<FHoudiniTestContext> Context)> FBenchmarkStep;
+
+	// Instantiates the HDA in a new map and cooks it once with its default parameters, then runs every step followed
+	// by a cook. The last cook and a bake of its outputs are measured and compared against the baseline.
+	bool RunBenchmark(const FString& BenchmarkName, const FString& HDAName, const TArray<FBenchmarkStep>& Steps);
+
+	// Main geometry plus NumSplits - 1 simple collision splits, one cube per split
+	bool RunMeshSplitsBenchmark(const int32 NumSplits);
+	bool RunInstancesBenchmark(const int32 NumInstances);
+	// Square landscape of LandscapeSize x LandscapeSize vertices
+	bool RunLandscapeBenchmark(const int32 LandscapeSize);
+
+	// Benchmarks always cook in an in-process session: no Houdini server or network is needed and the timings
+	// don't include the IPC overhead. Replaces the current session if it is not in-process.
+	bool CreateInProcessSessionIfInvalid();
+
+	// Restarts the session that was replaced by CreateInProcessSessionIfInvalid(), if any,
+	// so that the tests running after the benchmark get the same kind of session as before.
+	void RestorePreviousSession();
+
+	// Compares the sample against the baseline, adding an error for each measurement over the tolerance,
+	// or a warning if the baseline has no sample for this benchmark.
+	// Also saves the sample to the results file, or to the baseline if HoudiniEngine.PerfTests.UpdateBaseline is set.
+	void ReportSample(const FString& BenchmarkName, const FHoudiniPerformanceSample& Sample);
+
+	static FString GetBaselinePath();
+	static FString GetResultsPath();
+
+	// Baseline and results files share the same format, a results file can be used as a baseline.
+	static TSharedPtr<FJsonObject> LoadJsonFile(const FString& Path);
+	static bool SaveSample(const FString& Path, const FString& BenchmarkName, const FHoudiniPerformanceSample& Sample);
+
+	// Type of the session that was running before the benchmark. HRSST_InProcess if it was kept, HRSST_None if there was none.
+	EHoudiniRuntimeSettingsSessionType PreviousSessionType = EHoudiniRuntimeSettingsSessionType::HRSST_InProcess;
+
+	const static inline FString MeshHDA = TEXT("/Game/TestHDAs/Mesh/Test_MeshGroups");
+	const static inline FString InstancesHDA = TEXT("/Game/TestHDAs/Instances/Test_Instances");
+	const static inline FString LandscapeHDA = TEXT("/Game/TestHDAs/Landscape/Test_Landscapes");
+	const static inline FString InstancedMesh = TEXT("/Script/Engine.StaticMesh'/Game/TestObjects/SM_Cube.SM_Cube'");
+};
+
+#endif
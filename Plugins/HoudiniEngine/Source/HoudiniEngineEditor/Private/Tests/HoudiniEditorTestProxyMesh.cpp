@@ -36,7 +36,15 @@
 #include "HoudiniEditorUnitTestUtils.h"
 #include "FoliageType_InstancedStaticMesh.h"
 #include "HoudiniEngineBakeUtils.h"
+#include "HoudiniProxyRefinementQueue.h"
 #include "HoudiniEngineRuntimePrivatePCH.h"
+#include "HoudiniStaticMeshComponent.h"
+#include "Editor.h"
+#include "HAL/IConsoleManager.h"
+#include "RenderingThread.h"
+#include "Misc/App.h"
+#include "Components/SceneCaptureComponent2D.h"
+#include "Engine/TextureRenderTarget2D.h"
 
 IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestsProxyMeshVertices, "Houdini.UnitTests.ProxyMesh.Vertices",
 	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext  | EAutomationTestFlags::ProductFilter)
@@ -137,6 +145,261 @@ bool FHoudiniEditorTestsProxyMeshVertices::RunTest(const FString& Parameters)
 	return true;
 }
 
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestsProxyMeshBackgroundRefinement, "Houdini.UnitTests.ProxyMesh.BackgroundRefinement",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext  | EAutomationTestFlags::ProductFilter)
 
-#endif
+bool FHoudiniEditorTestsProxyMeshBackgroundRefinement::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Refines proxy meshes with a refinement queue, one output per tick, and checks that a new cook cancels
+	/// the refinement of the proxies it replaces.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	// Now create the test context.
+	TSharedPtr<FHoudiniTestContext> Context(new FHoudiniTestContext(this, FHoudiniEditorTestProxyMeshes::HDAAsset, FTransform::Identity, false));
+	HOUDINI_TEST_EQUAL_ON_FAIL(Context->IsValid(), true, return false);
+
+	UHoudiniCookable* HC = Context->GetCookable() ? Context->GetCookable() : Context->GetHAC()->GetCookable();
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(HC, return false);
+
+	// Refine with our own queue, the timer would refine the proxies with the manager's
+	Context->SetProxyMeshEnabled(true);
+	HC->SetEnableProxyStaticMeshRefinementByTimerOverride(false);
+
+	TSharedPtr<FHoudiniProxyRefinementQueue> Queue = MakeShared<FHoudiniProxyRefinementQueue>();
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HC, Queue]()
+	{
+		TArray<UHoudiniOutput*> Outputs;
+		Context->GetOutputs(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEditorUnitTestUtils::GetOutputsWithProxyComponent(Outputs).Num(), 1, return true);
+
+		Queue->Enqueue(HC);
+		Queue->Enqueue(HC);
+		HOUDINI_TEST_EQUAL(Queue->Num(), 1);
+		HOUDINI_TEST_EQUAL(Queue->IsQueued(HC), true);
+
+		// An end time in the past refines a single output per tick
+		int32 NumTicks = 0;
+		while (Queue->Num() > 0 && NumTicks < 10)
+		{
+			Queue->Tick(FPlatformTime::Seconds());
+			NumTicks++;
+		}
+
+		HOUDINI_TEST_EQUAL(Queue->Num(), 0);
+		HOUDINI_TEST_EQUAL(HC->HasAnyCurrentProxyOutput(), false);
+
+		TArray<UStaticMeshComponent*> StaticMeshComponents = FHoudiniEditorUnitTestUtils::GetOutputsWithComponent<UStaticMeshComponent>(Outputs);
+		HOUDINI_TEST_EQUAL_ON_FAIL(StaticMeshComponents.Num(), 1, return true);
+		HOUDINI_TEST_NOT_NULL(StaticMeshComponents[0]->GetStaticMesh());
+
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context]()
+	{
+		// Cook again to get new proxies
+		Context->StartCookingHDA();
+		return true;
+	}));
+
+	AddCommand(new FHoudiniLatentTestCommand(Context, [this, Context, HC, Queue]()
+	{
+		HOUDINI_TEST_EQUAL_ON_FAIL(HC->HasAnyCurrentProxyOutput(), true, return true);
+
+		Queue->Enqueue(HC);
+		HOUDINI_TEST_EQUAL(Queue->IsQueued(HC), true);
+
+		// Requesting a new cook must drop the refinement of the proxies it will replace
+		Context->StartCookingHDA();
+		Queue->Tick(0.0);
+		HOUDINI_TEST_EQUAL(Queue->Num(), 0);
+		HOUDINI_TEST_EQUAL(HC->HasAnyCurrentProxyOutput(), true);
+
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestsProxyMeshDrawPathBenchmark, "Houdini.UnitTests.ProxyMesh.DrawPathBenchmark",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestsProxyMeshDrawPathBenchmark::RunTest(const FString& Parameters)
+{
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+	/// Renders 500 proxy mesh components with the dynamic and static draw paths (with and without vertex welding)
+	/// through a scene capture, and checks that the static draw path isn't slower. Does not need a Houdini session.
+	/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+	// Nothing is rendered with the null RHI, so there would be nothing to compare
+	if (!FApp::CanEverRender())
+	{
+		AddWarning(TEXT("Rendering is disabled (null RHI), skipping the proxy mesh draw path benchmark."));
+		return true;
+	}
+
+	UWorld* World = GEditor ? GEditor->GetEditorWorldContext().World() : nullptr;
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(World, return false);
+
+	IConsoleVariable* StaticDrawPath = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.ProxyMeshStaticDrawPath"));
+	IConsoleVariable* WeldVertices = IConsoleManager::Get().FindConsoleVariable(TEXT("HoudiniEngine.ProxyMeshWeldVertices"));
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(StaticDrawPath, return false);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(WeldVertices, return false);
+
+	const int32 PrevStaticDrawPath = StaticDrawPath->GetInt();
+	const int32 PrevWeldVertices = WeldVertices->GetInt();
+
+	// A grid of quads, with per triangle vertex normals and UVs like the proxies created from Houdini
+	const int32 GridSize = 32;
+	const float GridSpacing = 10.0f;
+	UHoudiniStaticMesh* Mesh = NewObject<UHoudiniStaticMesh>(GetTransientPackage(), NAME_None, RF_Transient);
+	Mesh->Initialize((GridSize + 1) * (GridSize + 1), GridSize * GridSize * 2, 1, 0, true, false, false, false);
 
+	for (int32 Y = 0; Y <= GridSize; Y++)
+	{
+		for (int32 X = 0; X <= GridSize; X++)
+			Mesh->SetVertexPosition(Y * (GridSize + 1) + X, FVector3f(X * GridSpacing, Y * GridSpacing, 0.0f));
+	}
+
+	int32 TriangleIdx = 0;
+	for (int32 Y = 0; Y < GridSize; Y++)
+	{
+		for (int32 X = 0; X < GridSize; X++)
+		{
+			const int32 V0 = Y * (GridSize + 1) + X;
+			const int32 V1 = V0 + 1;
+			const int32 V2 = V0 + GridSize + 1;
+			const int32 V3 = V2 + 1;
+
+			for (const FIntVector& Triangle : { FIntVector(V0, V2, V1), FIntVector(V1, V2, V3) })
+			{
+				Mesh->SetTriangleVertexIndices(TriangleIdx, Triangle);
+				for (uint8 TriVertIdx = 0; TriVertIdx < 3; TriVertIdx++)
+				{
+					const FVector3f& Position = Mesh->GetVertexPositions()[Triangle[TriVertIdx]];
+					Mesh->SetTriangleVertexNormal(TriangleIdx, TriVertIdx, FVector3f(0.0f, 0.0f, 1.0f));
+					Mesh->SetTriangleVertexUV(TriangleIdx, TriVertIdx, 0, FVector2f(Position.X, Position.Y) / (GridSize * GridSpacing));
+				}
+				TriangleIdx++;
+			}
+		}
+	}
+	Mesh->Optimize();
+
+	// Spawn the proxy components on a single transient actor
+	const int32 NumComponents = 500;
+	const int32 NumComponentsPerRow = 25;
+
+	FActorSpawnParameters SpawnParams;
+	SpawnParams.ObjectFlags |= RF_Transient;
+	AActor* Actor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+	HOUDINI_TEST_NOT_NULL_ON_FAIL(Actor, return false);
+
+	USceneComponent* RootComponent = NewObject<USceneComponent>(Actor, TEXT("Root"), RF_Transient);
+	Actor->SetRootComponent(RootComponent);
+	RootComponent->RegisterComponent();
+
+	TArray<UHoudiniStaticMeshComponent*> Components;
+	for (int32 ComponentIdx = 0; ComponentIdx < NumComponents; ComponentIdx++)
+	{
+		UHoudiniStaticMeshComponent* Component = NewObject<UHoudiniStaticMeshComponent>(Actor, NAME_None, RF_Transient);
+		Component->SetupAttachment(RootComponent);
+		Component->SetRelativeLocation(FVector(
+			(ComponentIdx % NumComponentsPerRow) * GridSize * GridSpacing * 1.2f,
+			(ComponentIdx / NumComponentsPerRow) * GridSize * GridSpacing * 1.2f,
+			0.0f));
+		Component->SetMesh(Mesh);
+		Component->RegisterComponent();
+		Components.Add(Component);
+	}
+
+	// Render the components through a scene capture looking down on the grid, so that a view of the scene
+	// is actually drawn even when no editor viewport is (headless runs)
+	const FVector GridCenter(
+		NumComponentsPerRow * GridSize * GridSpacing * 0.6f,
+		(NumComponents / NumComponentsPerRow) * GridSize * GridSpacing * 0.6f,
+		0.0f);
+
+	UTextureRenderTarget2D* RenderTarget = NewObject<UTextureRenderTarget2D>(GetTransientPackage(), NAME_None, RF_Transient);
+	RenderTarget->InitAutoFormat(1280, 720);
+	RenderTarget->UpdateResourceImmediately(true);
+
+	USceneCaptureComponent2D* SceneCapture = NewObject<USceneCaptureComponent2D>(Actor, NAME_None, RF_Transient);
+	SceneCapture->SetupAttachment(RootComponent);
+	SceneCapture->SetRelativeLocationAndRotation(GridCenter + FVector(0.0f, 0.0f, GridCenter.X * 1.5f), FRotator(-90.0f, 0.0f, 0.0f));
+	SceneCapture->FOVAngle = 90.0f;
+	SceneCapture->TextureTarget = RenderTarget;
+	SceneCapture->bCaptureEveryFrame = false;
+	SceneCapture->bCaptureOnMovement = false;
+	SceneCapture->PrimitiveRenderMode = ESceneCapturePrimitiveRenderMode::PRM_UseShowOnlyList;
+	SceneCapture->ShowOnlyActors.Add(Actor);
+	SceneCapture->RegisterComponent();
+
+	// Recreates the proxies with the given settings, then returns the average time (in ms) to draw a frame
+	auto MeasureFrameTime = [&](int32 InStaticDrawPath, int32 InWeldVertices)
+	{
+		StaticDrawPath->Set(InStaticDrawPath);
+		WeldVertices->Set(InWeldVertices);
+
+		for (UHoudiniStaticMeshComponent* Component : Components)
+			Component->MarkRenderStateDirty();
+
+		World->SendAllEndOfFrameUpdates();
+		FlushRenderingCommands();
+
+		// Warm up, so that the static draw commands are cached before we start measuring
+		SceneCapture->CaptureScene();
+		FlushRenderingCommands();
+
+		const int32 NumFrames = 30;
+		const double StartTime = FPlatformTime::Seconds();
+		for (int32 FrameIdx = 0; FrameIdx < NumFrames; FrameIdx++)
+		{
+			SceneCapture->CaptureScene();
+			FlushRenderingCommands();
+		}
+
+		// Reading the render target back waits for the GPU to be done with all the captures
+		TArray<FColor> Pixels;
+		RenderTarget->GameThread_GetRenderTargetResource()->ReadPixels(Pixels);
+
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0 / NumFrames;
+	};
+
+	const double DynamicFrameTime = MeasureFrameTime(0, 0);
+	const double StaticFrameTime = MeasureFrameTime(1, 0);
+	const double StaticWeldedFrameTime = MeasureFrameTime(1, 1);
+
+	AddInfo(FString::Printf(
+		TEXT("%d proxy components: dynamic draw path %.3f ms/frame, static draw path %.3f ms/frame, static draw path with welded vertices %.3f ms/frame"),
+		NumComponents, DynamicFrameTime, StaticFrameTime, StaticWeldedFrameTime));
+
+	// The static draw path caches its draw commands instead of gathering them every frame, it shouldn't be slower
+	HOUDINI_TEST_EQUAL(StaticFrameTime <= DynamicFrameTime * FHoudiniEditorTestProxyMeshes::DrawPathTolerance, true);
+	HOUDINI_TEST_EQUAL(StaticWeldedFrameTime <= DynamicFrameTime * FHoudiniEditorTestProxyMeshes::DrawPathTolerance, true);
+
+	// All components should have a proxy, whatever the draw path
+	for (UHoudiniStaticMeshComponent* Component : Components)
+		HOUDINI_TEST_NOT_NULL(Component->SceneProxy);
+
+	StaticDrawPath->Set(PrevStaticDrawPath);
+	WeldVertices->Set(PrevWeldVertices);
+
+	World->DestroyActor(Actor);
+
+	return true;
+}
+
+
+#endif
@@ -35,6 +35,10 @@ class FHoudiniEditorTestProxyMeshes
 {
 public:
 	const static inline FString HDAAsset = TEXT("/Game/TestHDAs/Mesh/Test_Mesh");
+
+	// How much slower than the dynamic draw path, the static draw path is allowed to be.
+	// Leaves room for timing noise when both paths end up drawing at the same speed.
+	static constexpr double DrawPathTolerance = 1.1;
 };
 #endif
 
@@ -0,0 +1,254 @@
+/*
+* Copyright (c) <2025> Side Effects Software Inc.
+* All rights reserved.
+*
+* Redistribution and use in source and binary forms, with or without
+* modification, are permitted provided that the following conditions are met:
+*
+* 1. Redistributions of source code must retain the above copyright notice,
+*    this list of conditions and the following disclaimer.
+*
+* 2. The name of Side Effects Software may not be used to endorse or
+*    promote products derived from this software without specific prior
+*    written permission.
+*
+* THIS SOFTWARE IS PROVIDED BY SIDE EFFECTS SOFTWARE "AS IS" AND ANY EXPRESS
+* OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES
+* OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.  IN
+* NO EVENT SHALL SIDE EFFECTS SOFTWARE BE LIABLE FOR ANY DIRECT, INDIRECT,
+* INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+* LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA,
+* OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+* LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING
+* NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE,
+* EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+*/
+
+
+#include "HoudiniEditorTestScheduler.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+#include "HoudiniApi.h"
+#include "HoudiniEditorTestUtils.h"
+#include "HoudiniEditorUnitTestUtils.h"
+#include "HoudiniEngine.h"
+#include "HoudiniEngineTask.h"
+#include "HoudiniEngineTaskInfo.h"
+#include "HoudiniEngineUtils.h"
+#include "Misc/AutomationTest.h"
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestScheduler_CookLatency, "Houdini.UnitTests.Scheduler.CookLatency",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestScheduler_CookLatency::RunTest(const FString& Parameters)
+{
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	AddCommand(new FFunctionLatentCommand([this]()
+	{
+		const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Session, return true);
+
+		// Trivial network to cook: a box in a geo object
+		HAPI_NodeId GeoNodeId = -1;
+		HAPI_NodeId BoxNodeId = -1;
+		HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::CreateNode(-1, TEXT("Object/geo"), TEXT("SchedulerCookLatency"), true, &GeoNodeId), HAPI_RESULT_SUCCESS, return true);
+		HOUDINI_TEST_EQUAL(FHoudiniEngineUtils::CreateNode(GeoNodeId, TEXT("box"), TEXT("box"), true, &BoxNodeId), HAPI_RESULT_SUCCESS);
+
+		const int32 NumCooks = 20;
+		const double Timeout = 10.0;
+
+		TArray<double> Latencies;
+		for (int32 CookIdx = 0; CookIdx < NumCooks && BoxNodeId >= 0; CookIdx++)
+		{
+			// Dirty the box so that every cook does some work
+			FHoudiniApi::SetParmFloatValue(Session, BoxNodeId, "scale", 0, 1.0f + CookIdx * 0.01f);
+
+			FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+			Task.ActorName = TEXT("SchedulerCookLatency");
+			Task.AssetId = BoxNodeId;
+
+			// Measure from when the task is queued to when its result is available to the manager
+			const double StartTime = FPlatformTime::Seconds();
+			FHoudiniEngine::Get().AddTask(Task);
+
+			FHoudiniEngineTaskInfo TaskInfo;
+			while (FPlatformTime::Seconds() - StartTime < Timeout)
+			{
+				if (FHoudiniEngine::Get().RetrieveTaskInfo(Task.HapiGUID, TaskInfo)
+					&& TaskInfo.TaskState != EHoudiniEngineTaskState::None
+					&& TaskInfo.TaskState != EHoudiniEngineTaskState::Working)
+				{
+					break;
+				}
+
+				FPlatformProcess::SleepNoStats(0.0f);
+			}
+
+			const double Latency = FPlatformTime::Seconds() - StartTime;
+			FHoudiniEngine::Get().RemoveTaskInfo(Task.HapiGUID);
+
+			HOUDINI_TEST_EQUAL_ON_FAIL(TaskInfo.TaskState, EHoudiniEngineTaskState::Success, break);
+			Latencies.Add(Latency);
+		}
+
+		if (GeoNodeId >= 0)
+			FHoudiniApi::DeleteNode(Session, GeoNodeId);
+
+		HOUDINI_TEST_EQUAL_ON_FAIL(Latencies.Num(), NumCooks, return true);
+
+		Latencies.Sort();
+		const double MedianLatency = Latencies[NumCooks / 2];
+		AddInfo(FString::Printf(
+			TEXT("Trivial cook latency over %d cooks: median %.2f ms, min %.2f ms, max %.2f ms"),
+			NumCooks, MedianLatency * 1000.0, Latencies[0] * 1000.0, Latencies.Last() * 1000.0));
+
+		// Should be at least an order of magnitude below the previous fixed poll interval
+		HOUDINI_TEST_EQUAL(MedianLatency < FHoudiniEditorTestScheduler::LegacyPollInterval / 10.0, true);
+
+		return true;
+	}));
+
+	return true;
+}
+
+IMPLEMENT_SIMPLE_HOUDINI_AUTOMATION_TEST(FHoudiniEditorTestScheduler_ConcurrentCooks, "Houdini.UnitTests.Scheduler.ConcurrentCooks",
+	EAutomationTestFlags::EditorContext | EAutomationTestFlags::ClientContext | EAutomationTestFlags::ServerContext | EAutomationTestFlags::CommandletContext | EAutomationTestFlags::ProductFilter)
+
+bool FHoudiniEditorTestScheduler_ConcurrentCooks::RunTest(const FString& Parameters)
+{
+	/// Make sure we have a Houdini Session before doing anything.
+	FHoudiniEditorTestUtils::CreateSessionIfInvalidWithLatentRetries(this, FHoudiniEditorTestUtils::HoudiniEngineSessionPipeName, {}, {});
+
+	AddCommand(new FFunctionLatentCommand([this]()
+	{
+		const HAPI_Session* Session = FHoudiniEngine::Get().GetSession();
+		HOUDINI_TEST_NOT_NULL_ON_FAIL(Session, return true);
+
+		const int32 NumSchedulingSessions = FHoudiniEngine::Get().GetNumSchedulingSessions();
+		HOUDINI_TEST_EQUAL_ON_FAIL(NumSchedulingSessions > 0, true, return true);
+
+		// One independent network per "asset", subdivided so that each cook takes long enough to measure
+		const int32 NumAssets = 8;
+		TArray<HAPI_NodeId> GeoNodeIds;
+		TArray<HAPI_NodeId> BoxNodeIds;
+		TArray<HAPI_NodeId> CookNodeIds;
+		for (int32 AssetIdx = 0; AssetIdx < NumAssets; AssetIdx++)
+		{
+			HAPI_NodeId GeoNodeId = -1;
+			HAPI_NodeId BoxNodeId = -1;
+			HAPI_NodeId SubdivideNodeId = -1;
+			const FString Label = FString::Printf(TEXT("SchedulerConcurrentCooks%d"), AssetIdx);
+			HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::CreateNode(-1, TEXT("Object/geo"), Label, true, &GeoNodeId), HAPI_RESULT_SUCCESS, break);
+			GeoNodeIds.Add(GeoNodeId);
+			HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::CreateNode(GeoNodeId, TEXT("box"), TEXT("box"), true, &BoxNodeId), HAPI_RESULT_SUCCESS, break);
+			HOUDINI_TEST_EQUAL_ON_FAIL(FHoudiniEngineUtils::CreateNode(GeoNodeId, TEXT("subdivide"), TEXT("subdivide"), false, &SubdivideNodeId), HAPI_RESULT_SUCCESS, break);
+			FHoudiniApi::ConnectNodeInput(Session, SubdivideNodeId, 0, BoxNodeId, 0);
+			FHoudiniApi::SetParmIntValue(Session, SubdivideNodeId, "iterations", 0, 5);
+			BoxNodeIds.Add(BoxNodeId);
+			CookNodeIds.Add(SubdivideNodeId);
+		}
+
+		HOUDINI_TEST_EQUAL(CookNodeIds.Num(), NumAssets);
+
+		// Queues one cook per asset, either all on the first session (cooked one after the other by its scheduler) or
+		// each pinned to its node's session, and returns the wall time until all the results are available.
+		auto RunCooks = [this, Session, &BoxNodeIds, &CookNodeIds, NumSchedulingSessions](const bool bConcurrent, const float InScale, bool& bOutSuccess)
+		{
+			bOutSuccess = true;
+
+			TArray<FGuid> TaskGUIDs;
+			const double StartTime = FPlatformTime::Seconds();
+			for (int32 AssetIdx = 0; AssetIdx < CookNodeIds.Num(); AssetIdx++)
+			{
+				// Dirty the box so that every pass recooks the whole network
+				FHoudiniApi::SetParmFloatValue(Session, BoxNodeIds[AssetIdx], "scale", 0, InScale);
+
+				const HAPI_NodeId CookNodeId = CookNodeIds[AssetIdx];
+				int32 SessionIndex = 0;
+				if (bConcurrent)
+				{
+					// Pinning must be stable and within the available sessions
+					SessionIndex = FHoudiniEngine::Get().GetSessionIndexForNode(CookNodeId);
+					HOUDINI_TEST_EQUAL(SessionIndex, FHoudiniEngine::Get().GetSessionIndexForNode(CookNodeId));
+					HOUDINI_TEST_EQUAL(SessionIndex >= 0 && SessionIndex < NumSchedulingSessions, true);
+				}
+
+				FHoudiniEngineTask Task(EHoudiniEngineTaskType::AssetCooking, FGuid::NewGuid());
+				Task.ActorName = FString::Printf(TEXT("SchedulerConcurrentCooks%d"), AssetIdx);
+				Task.AssetId = CookNodeId;
+				Task.SessionIndex = SessionIndex;
+
+				FHoudiniEngine::Get().AddTask(Task);
+				TaskGUIDs.Add(Task.HapiGUID);
+			}
+
+			// Results are consumed the same way regardless of the session that cooked them
+			const double Timeout = 60.0;
+			TArray<EHoudiniEngineTaskState> TaskStates;
+			TaskStates.Init(EHoudiniEngineTaskState::Working, TaskGUIDs.Num());
+			int32 NumFinished = 0;
+			while (NumFinished < TaskGUIDs.Num() && FPlatformTime::Seconds() - StartTime < Timeout)
+			{
+				for (int32 TaskIdx = 0; TaskIdx < TaskGUIDs.Num(); TaskIdx++)
+				{
+					FHoudiniEngineTaskInfo TaskInfo;
+					if (TaskStates[TaskIdx] != EHoudiniEngineTaskState::Working
+						|| !FHoudiniEngine::Get().RetrieveTaskInfo(TaskGUIDs[TaskIdx], TaskInfo)
+						|| TaskInfo.TaskState == EHoudiniEngineTaskState::None
+						|| TaskInfo.TaskState == EHoudiniEngineTaskState::Working)
+					{
+						continue;
+					}
+
+					TaskStates[TaskIdx] = TaskInfo.TaskState;
+					NumFinished++;
+				}
+
+				FPlatformProcess::SleepNoStats(0.0f);
+			}
+
+			const double WallTime = FPlatformTime::Seconds() - StartTime;
+
+			for (int32 TaskIdx = 0; TaskIdx < TaskGUIDs.Num(); TaskIdx++)
+			{
+				FHoudiniEngine::Get().RemoveTaskInfo(TaskGUIDs[TaskIdx]);
+				HOUDINI_TEST_EQUAL(TaskStates[TaskIdx], EHoudiniEngineTaskState::Success);
+				bOutSuccess &= TaskStates[TaskIdx] == EHoudiniEngineTaskState::Success;
+			}
+
+			return WallTime;
+		};
+
+		// Concurrent pass first, so that any warm up cost on the server counts against it
+		bool bConcurrentSuccess = false;
+		bool bSerialSuccess = false;
+		const double ConcurrentTime = RunCooks(true, 1.5f, bConcurrentSuccess);
+		const double SerialTime = RunCooks(false, 2.0f, bSerialSuccess);
+
+		for (HAPI_NodeId GeoNodeId : GeoNodeIds)
+			FHoudiniApi::DeleteNode(Session, GeoNodeId);
+
+		AddInfo(FString::Printf(
+			TEXT("%d cooks: %.2f ms on a single session, %.2f ms concurrently on %d session(s), speed-up x%.2f"),
+			CookNodeIds.Num(), SerialTime * 1000.0, ConcurrentTime * 1000.0, NumSchedulingSessions,
+			ConcurrentTime > 0.0 ? SerialTime / ConcurrentTime : 0.0));
+
+		if (!bConcurrentSuccess || !bSerialSuccess)
+			return true;
+
+		// Spreading the cooks over the sessions must never be slower than queuing them all on one session.
+		// With a single session both passes go through the same scheduler, so there is nothing to compare.
+		if (NumSchedulingSessions > 1)
+		{
+			HOUDINI_TEST_EQUAL(ConcurrentTime <= SerialTime * FHoudiniEditorTestScheduler::ConcurrentCooksTolerance, true);
+		}
+
+		return true;
+	}));
+
+	return true;
+}
+
+#endif
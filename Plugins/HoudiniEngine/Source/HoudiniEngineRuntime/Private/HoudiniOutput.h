@@ -767,6 +767,17 @@ struct HOUDINIENGINERUNTIME_API FHoudiniOutputObject
 
 		UPROPERTY()
 		FHoudiniLevelInstanceParams LevelInstanceParams;
+
+		// Content hash of the part this mesh was created from (see FHoudiniEngineUtils::HapiGetPartContentHash).
+		// Used to reuse the mesh when its geo recooked but the part didn't change, including after a reload.
+		// Left to 0 when the part's content wasn't hashed.
+		UPROPERTY()
+		uint64 PartContentHash = 0;
+
+		// Layout hash of the part this mesh was created from (see FHoudiniEngineUtils::HapiGetPartLayoutHash).
+		// The content hash is only compared when the part's layout hasn't changed.
+		UPROPERTY()
+		uint64 PartLayoutHash = 0;
 };
 
 
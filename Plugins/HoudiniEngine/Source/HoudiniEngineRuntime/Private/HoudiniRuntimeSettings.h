@@ -191,7 +191,7 @@ protected:
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session)
 		TEnumAsByte<enum EHoudiniRuntimeSettingsSessionType> SessionType;
 
-		// The number of threaded sessions to be used to send/receive data (default: 1)
+		// The number of threaded sessions to be used to send/receive data and to cook independent HDAs concurrently (default: 1)
 		UPROPERTY(GlobalConfig, EditAnywhere, Category = Session, meta = (ClampMin = "1", ClampMax = "128"))
 		int32 NumSessions;
 
@@ -31,8 +31,10 @@
 
 #include "Async/ParallelFor.h"
 #include "Engine/Engine.h"
+#include "HAL/IConsoleManager.h"
 #include "Materials/Material.h"
 #include "PrimitiveViewRelevance.h"
+#include "SceneManagement.h"
 #include "ProfilingDebugging/CpuProfilerTrace.h"
 #include "Runtime/Launch/Resources/Version.h"
 #include "SceneView.h"
@@ -44,6 +46,45 @@
 
 // Based on: Plugins\Experimental\MeshModelingToolset\Source\ModelingComponents\Private\BaseDynamicMeshSceneProxy.h
 
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyMeshStaticDrawPath(
+	TEXT("HoudiniEngine.ProxyMeshStaticDrawPath"),
+	1,
+	TEXT("Whether Houdini proxy meshes are rendered with cached static mesh draw commands.\n")
+	TEXT("Applies to proxies created after the change.\n")
+	TEXT("0: Build the mesh batches every frame\n")
+	TEXT("1: Use the static draw path (Default)\n")
+);
+
+static TAutoConsoleVariable<int32> CVarHoudiniEngineProxyMeshWeldVertices(
+	TEXT("HoudiniEngine.ProxyMeshWeldVertices"),
+	0,
+	TEXT("Whether identical triangle vertices of Houdini proxy meshes are welded when creating their render buffers.\n")
+	TEXT("Applies to proxies created after the change.\n")
+	TEXT("0: One vertex per triangle vertex (Default)\n")
+	TEXT("1: Weld vertices\n")
+);
+
+// Attributes of a triangle vertex, used to find identical vertices when welding
+struct FHoudiniStaticMeshWeldKey
+{
+	uint32 PositionIndex;
+	FVector3f Normal;
+	FVector3f TangentU;
+	FVector3f TangentV;
+	FColor Color;
+	FVector2f UVs[MAX_STATIC_TEXCOORDS];
+
+	bool operator==(const FHoudiniStaticMeshWeldKey& Other) const
+	{
+		return FMemory::Memcmp(this, &Other, sizeof(FHoudiniStaticMeshWeldKey)) == 0;
+	}
+
+	friend uint32 GetTypeHash(const FHoudiniStaticMeshWeldKey& Key)
+	{
+		return FCrc::MemCrc32(&Key, sizeof(FHoudiniStaticMeshWeldKey));
+	}
+};
+
 //
 // FHoudiniStaticMeshRenderBufferSet
 //
@@ -162,6 +203,8 @@ FHoudiniStaticMeshSceneProxy::FHoudiniStaticMeshSceneProxy(UHoudiniStaticMeshCom
 #else
 	, MaterialRelevance(InComponent ? InComponent->GetMaterialRelevance(InFeatureLevel) : FMaterialRelevance())
 #endif
+	, bUseStaticDrawPath(CVarHoudiniEngineProxyMeshStaticDrawPath.GetValueOnAnyThread() != 0)
+	, bWeldVertices(CVarHoudiniEngineProxyMeshWeldVertices.GetValueOnAnyThread() != 0)
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	, Owner(InComponent ? InComponent->GetOwner() : nullptr)
 #endif
@@ -256,6 +299,28 @@ void FHoudiniStaticMeshSceneProxy::Build()
 	}
 }
 
+void FHoudiniStaticMeshSceneProxy::DrawStaticElements(FStaticPrimitiveDrawInterface* PDI)
+{
+	if (!bUseStaticDrawPath)
+		return;
+
+	for (FHoudiniStaticMeshRenderBufferSet* BufferSet : BufferSets)
+	{
+		if (!BufferSet || BufferSet->NumTriangles == 0 || BufferSet->TriangleIndexBuffer.Indices.Num() <= 0)
+			continue;
+
+		UMaterialInterface* Material = BufferSet->Material;
+		if (!Material)
+			continue;
+
+		FMeshBatch Mesh;
+		if (PopulateMeshElement(Mesh, *BufferSet, Material->GetRenderProxy(), false, SDPG_World, 0, nullptr))
+		{
+			PDI->DrawMesh(Mesh, FLT_MAX);
+		}
+	}
+}
+
 void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const
 {
 	const FEngineShowFlags EngineShowFlags = ViewFamily.EngineShowFlags;
@@ -318,14 +383,14 @@ void FHoudiniStaticMeshSceneProxy::GetDynamicMeshElements(const TArray<const FSc
 			if (BufferSet->TriangleIndexBuffer.Indices.Num() > 0)
 			{
 				FMeshBatch& Mesh = Collector.AllocateMesh();
-				if (PopulateMeshElement(Mesh, *BufferSet, MaterialProxy, false, DepthPriority, ViewIdx, DynamicPrimitiveUniformBuffer))
+				if (PopulateMeshElement(Mesh, *BufferSet, MaterialProxy, false, DepthPriority, ViewIdx, &DynamicPrimitiveUniformBuffer))
 				{
 					Collector.AddMesh(ViewIdx, Mesh);
 				}
 				if (bRenderAsWireframe)
 				{
 					FMeshBatch& WireframeMesh = Collector.AllocateMesh();
-					if (PopulateMeshElement(WireframeMesh, *BufferSet, WireframeMaterialProxy, true, DepthPriority, ViewIdx, DynamicPrimitiveUniformBuffer))
+					if (PopulateMeshElement(WireframeMesh, *BufferSet, WireframeMaterialProxy, true, DepthPriority, ViewIdx, &DynamicPrimitiveUniformBuffer))
 					{
 						Collector.AddMesh(ViewIdx, WireframeMesh);
 					}
@@ -349,7 +414,7 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	bool bRenderAsWireframe,
 	ESceneDepthPriorityGroup DepthPriority,
 	int ViewIndex,
-	FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer) const
+	FDynamicPrimitiveUniformBuffer* DynamicPrimitiveUniformBuffer) const
 {
 	FMeshBatchElement& BatchElement = InMeshBatch.Elements[0];
 	BatchElement.IndexBuffer = &Buffers.TriangleIndexBuffer;
@@ -357,7 +422,9 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	InMeshBatch.VertexFactory = &Buffers.LocalVertexFactory;
 	InMeshBatch.MaterialRenderProxy = Material;
 
-	BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer.UniformBuffer;
+	// Static mesh batches (no dynamic uniform buffer) use the primitive's uniform buffer
+	if (DynamicPrimitiveUniformBuffer)
+		BatchElement.PrimitiveUniformBufferResource = &DynamicPrimitiveUniformBuffer->UniformBuffer;
 
 	BatchElement.FirstIndex = 0;
 	BatchElement.NumPrimitives = Buffers.NumTriangles;
@@ -367,6 +434,9 @@ bool FHoudiniStaticMeshSceneProxy::PopulateMeshElement(
 	InMeshBatch.Type = PT_TriangleList;
 	InMeshBatch.DepthPriorityGroup = DepthPriority;
 	InMeshBatch.bCanApplyViewModeOverrides = false;
+	InMeshBatch.LODIndex = 0;
+	InMeshBatch.CastShadow = true;
+	InMeshBatch.bUseAsOccluder = ShouldUseAsOccluder();
 	
 	return true;
 }
@@ -377,7 +447,13 @@ FPrimitiveViewRelevance FHoudiniStaticMeshSceneProxy::GetViewRelevance(const FSc
 	FPrimitiveViewRelevance Result;
 
 	Result.bDrawRelevance = IsShown(View);
-	Result.bDynamicRelevance = true;
+
+	// Use the cached static draw commands, unless the view needs the dynamic path (wireframe, bounds...)
+	if (bUseStaticDrawPath && !IsRichView(*View->Family) && !View->Family->EngineShowFlags.Bounds)
+		Result.bStaticRelevance = true;
+	else
+		Result.bDynamicRelevance = true;
+
 	Result.bRenderCustomDepth = ShouldRenderCustomDepth();
 	Result.bRenderInMainPass = ShouldRenderInMainPass();
 	Result.bShadowRelevance = IsShadowCast(View);
@@ -407,8 +483,15 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	if (NumTriangles == 0)
 		return;
 
+	if (bWeldVertices)
+	{
+		PopulateWeldedBuffers(InMesh, InBuffers, InTriangleIDs, InTriangleGroupStartIdx, NumTriangles);
+		return;
+	}
+
 	const uint32 NumVertices = NumTriangles * 3;
 	const uint32 NumUVLayers = InMesh->GetNumUVLayers();
+	const uint32 NumVertexInstances = InMesh->GetNumVertexInstances();
 
 	InBuffers->PositionVertexBuffer.Init(NumVertices);
 	// There must be at least one UV layer
@@ -462,7 +545,7 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 			{
 				for (uint8 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
 				{
-					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[MeshVtxInstanceIdx]);
+					InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, VertexInstanceUVs[UVLayerIdx * NumVertexInstances + MeshVtxInstanceIdx]);
 				}
 			}
 			else
@@ -478,6 +561,111 @@ void FHoudiniStaticMeshSceneProxy::PopulateBuffers(const UHoudiniStaticMesh *InM
 	});
 }
 
+void FHoudiniStaticMeshSceneProxy::PopulateWeldedBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs, uint32 InTriangleGroupStartIdx, uint32 InNumTriangles)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshSceneProxy::PopulateWeldedBuffers);
+
+	const uint32 NumTriangleVertices = InNumTriangles * 3;
+	const uint32 NumUVLayers = FMath::Min<uint32>(InMesh->GetNumUVLayers(), MAX_STATIC_TEXCOORDS);
+	const uint32 NumVertexInstances = InMesh->GetNumVertexInstances();
+
+	const TArray<FIntVector>& TriangleIndices = InMesh->GetTriangleIndices();
+	const TArray<FColor>& VertexInstanceColors = InMesh->GetVertexInstanceColors();
+	const TArray<FVector3f>& VertexInstanceNormals = InMesh->GetVertexInstanceNormals();
+	const TArray<FVector3f>& VertexInstanceUTangents = InMesh->GetVertexInstanceUTangents();
+	const TArray<FVector3f>& VertexInstanceVTangents = InMesh->GetVertexInstanceVTangents();
+	const TArray<FVector2f>& VertexInstanceUVs = InMesh->GetVertexInstanceUVs();
+
+	const bool bHasColors = InMesh->HasColors();
+	const bool bHasNormals = InMesh->HasNormals();
+	const bool bHasTangents = InMesh->HasTangents();
+
+	// Gather the final attributes of every triangle vertex.
+	// Keys are zeroed so that unused UV layers don't prevent welding.
+	TArray<FHoudiniStaticMeshWeldKey> Keys;
+	Keys.SetNumZeroed(NumTriangleVertices);
+	ParallelFor(InNumTriangles, [&](uint32 TriangleIDIdx)
+	{
+		const uint32 TriangleID = InTriangleIDs ? (*InTriangleIDs)[InTriangleGroupStartIdx + TriangleIDIdx] : TriangleIDIdx;
+		const FIntVector &TriIndices = TriangleIndices[TriangleID];
+
+		for (uint8 TriVertIdx = 0; TriVertIdx < 3; ++TriVertIdx)
+		{
+			const uint32 MeshVtxInstanceIdx = TriangleID * 3 + TriVertIdx;
+
+			FHoudiniStaticMeshWeldKey& Key = Keys[TriangleIDIdx * 3 + TriVertIdx];
+			Key.PositionIndex = TriIndices[TriVertIdx];
+			Key.Normal = bHasNormals ? VertexInstanceNormals[MeshVtxInstanceIdx] : FVector3f(0, 0, 1);
+			if (bHasTangents)
+			{
+				Key.TangentU = VertexInstanceUTangents[MeshVtxInstanceIdx];
+				Key.TangentV = VertexInstanceVTangents[MeshVtxInstanceIdx];
+			}
+			else
+			{
+				Key.Normal.FindBestAxisVectors(Key.TangentU, Key.TangentV);
+			}
+
+			Key.Color = bHasColors ? VertexInstanceColors[MeshVtxInstanceIdx] : DefaultVertexColor;
+
+			for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+			{
+				Key.UVs[UVLayerIdx] = VertexInstanceUVs[UVLayerIdx * NumVertexInstances + MeshVtxInstanceIdx];
+			}
+		}
+	});
+
+	// Weld the triangle vertices, the first occurrence of each key becomes a vertex of the buffers
+	TArray<uint32> WeldedVertexKeyIndices;
+	WeldedVertexKeyIndices.Reserve(NumTriangleVertices);
+	TMap<FHoudiniStaticMeshWeldKey, uint32> KeyToVertexIndex;
+	KeyToVertexIndex.Reserve(NumTriangleVertices);
+
+	InBuffers->TriangleIndexBuffer.Indices.SetNumUninitialized(NumTriangleVertices);
+	for (uint32 TriVertIdx = 0; TriVertIdx < NumTriangleVertices; ++TriVertIdx)
+	{
+		const FHoudiniStaticMeshWeldKey& Key = Keys[TriVertIdx];
+		const uint32* FoundVertexIdx = KeyToVertexIndex.Find(Key);
+		if (FoundVertexIdx)
+		{
+			InBuffers->TriangleIndexBuffer.Indices[TriVertIdx] = *FoundVertexIdx;
+		}
+		else
+		{
+			const uint32 NewVertexIdx = WeldedVertexKeyIndices.Add(TriVertIdx);
+			KeyToVertexIndex.Add(Key, NewVertexIdx);
+			InBuffers->TriangleIndexBuffer.Indices[TriVertIdx] = NewVertexIdx;
+		}
+	}
+
+	const uint32 NumVertices = WeldedVertexKeyIndices.Num();
+	InBuffers->PositionVertexBuffer.Init(NumVertices);
+	// There must be at least one UV layer
+	InBuffers->StaticMeshVertexBuffer.Init(NumVertices, NumUVLayers > 0 ? NumUVLayers : 1);
+	InBuffers->ColorVertexBuffer.Init(NumVertices);
+
+	const TArray<FVector3f>& VertexPositions = InMesh->GetVertexPositions();
+	ParallelFor(NumVertices, [&](uint32 VertIdx)
+	{
+		const FHoudiniStaticMeshWeldKey& Key = Keys[WeldedVertexKeyIndices[VertIdx]];
+
+		InBuffers->PositionVertexBuffer.VertexPosition(VertIdx) = VertexPositions[Key.PositionIndex];
+		InBuffers->StaticMeshVertexBuffer.SetVertexTangents(VertIdx, Key.TangentU, Key.TangentV, Key.Normal);
+		if (NumUVLayers > 0)
+		{
+			for (uint32 UVLayerIdx = 0; UVLayerIdx < NumUVLayers; ++UVLayerIdx)
+			{
+				InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVLayerIdx, Key.UVs[UVLayerIdx]);
+			}
+		}
+		else
+		{
+			InBuffers->StaticMeshVertexBuffer.SetVertexUV(VertIdx, 0, FVector2f::ZeroVector);
+		}
+		InBuffers->ColorVertexBuffer.VertexColor(VertIdx) = Key.Color;
+	});
+}
+
 void FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet()
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FHoudiniStaticMeshSceneProxy::BuildSingleBufferSet);
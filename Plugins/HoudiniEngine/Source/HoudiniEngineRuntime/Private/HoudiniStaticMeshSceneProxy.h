@@ -110,6 +110,8 @@ public:
 	virtual void Build();
 
 	// FPrimitiveSceneProxy
+	virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override;
+
 	virtual void GetDynamicMeshElements(const TArray<const FSceneView*>& Views, const FSceneViewFamily& ViewFamily, uint32 VisibilityMap, FMeshElementCollector& Collector) const override;
 
 	virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override;
@@ -134,6 +136,9 @@ public:
 protected:
 	void PopulateBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs=nullptr, uint32 InTriangleGroupStartIdx=0u, uint32 InNumTrianglesInGroup=0u);
 
+	// Same as PopulateBuffers, but triangle vertices with identical attributes share a single vertex in the buffers
+	void PopulateWeldedBuffers(const UHoudiniStaticMesh *InMesh, FHoudiniStaticMeshRenderBufferSet *InBuffers, const TArray<uint32>* InTriangleIDs, uint32 InTriangleGroupStartIdx, uint32 InNumTriangles);
+
 	// Virtual function for creating a new buffer set instances.
 	// Subclasses can overwrite this is they use a different buffer set with 
 	// different instantiation requirements.
@@ -154,7 +159,7 @@ protected:
 		bool bRenderAsWireframe,
 		ESceneDepthPriorityGroup DepthPriority,
 		int ViewIndex,
-		FDynamicPrimitiveUniformBuffer& DynamicPrimitiveUniformBuffer) const;
+		FDynamicPrimitiveUniformBuffer* DynamicPrimitiveUniformBuffer) const;
 
 	virtual UMaterialInterface* GetMaterial(uint32 InMaterialIdx) const;
 
@@ -166,6 +171,13 @@ protected:
 
 	FMaterialRelevance MaterialRelevance;
 
+	// Render the mesh with cached static mesh draw commands (DrawStaticElements) instead of
+	// building mesh batches every frame. Debug views (wireframe...) still use the dynamic path.
+	bool bUseStaticDrawPath;
+
+	// Weld identical triangle vertices when populating the buffers
+	bool bWeldVertices;
+
 private:
 #if STATICMESH_ENABLE_DEBUG_RENDERING
 	AActor* Owner;